@@ -66,6 +66,52 @@
  *
  */
 #define FEP_CLOCKSERVICE_MAIN_CLOCK_SIM_TIME_TIME_FACTOR_DEFAULT_VALUE 1.0
+/**
+ * @brief Time in ms the timing master waits for all timing clients to acknowledge a time event.
+ * The time events are sent to all timing clients at once. A timing client not acknowledging
+ * within this time is reported by an incident and deactivated, it gets no further time events
+ * until it registers again (see @ref FEP_CLOCKSERVICE_MASTER_SYNC_KEEP_LATE_SLAVES).
+ * @see @ref page_fep_timing_3
+ *
+ */
+#define FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT FEP_CLOCKSERVICE".SyncTimeout_ms"
+/**
+ * @brief Default value of the timing master's sync timeout property in ms
+ * @see @ref page_fep_timing_3
+ *
+ */
+#define FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT_DEFAULT_VALUE 5000
+/**
+ * @brief Keeps the timing clients not acknowledging a time event within the sync timeout (boolean).
+ * The late timing clients are reported by an incident only and get the next time events as
+ * usual. The master does not wait for the late acknowledgements, so these timing clients may
+ * miss time events.
+ * @see @ref page_fep_timing_3
+ *
+ */
+#define FEP_CLOCKSERVICE_MASTER_SYNC_KEEP_LATE_SLAVES FEP_CLOCKSERVICE".SyncKeepLateSlaves"
+/**
+ * @brief Default value of the timing master's keep late slaves property
+ * @see @ref page_fep_timing_3
+ *
+ */
+#define FEP_CLOCKSERVICE_MASTER_SYNC_KEEP_LATE_SLAVES_DEFAULT_VALUE false
+/**
+ * @brief Switches the time events of discrete clocks to the data channel (boolean).
+ * Relevant for the timing master and its discrete timing clients. The timing master publishes
+ * each time event once as data sample and the timing clients acknowledge it by data sample
+ * instead of one RPC round trip per timing client. Timing clients without this property
+ * are still synchronized by RPC.
+ * @see @ref page_fep_timing_3
+ *
+ */
+#define FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL FEP_CLOCKSERVICE".SyncDataChannel"
+/**
+ * @brief Default value of the data channel property of the clock synchronization
+ * @see @ref page_fep_timing_3
+ *
+ */
+#define FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL_DEFAULT_VALUE false
 /**
  * @brief Name of the clock service built-in clock to retrieve the current system time (continous clock).
  * @see @ref FEP_CLOCKSERVICE_MAIN_CLOCK
@@ -304,6 +304,69 @@ namespace fep
         #define FEP_TX_ADAPTER_WORKERTHREADS_FIELD "nNumberOfWorkerThreads"
         FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterField_nNumberOfWorkerThreads;
         //@}
+        //@{
+        /// Comma separated list of CPUs the worker threads are pinned to (empty: no pinning) [full path]
+        #define FEP_TX_ADAPTER_WORKER_CPU_AFFINITY_PATH  FEP_COMPONENT_CONFIG_TX_ADAPTER "." FEP_TX_ADAPTER_WORKER_CPU_AFFINITY_FIELD
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterPath_strWorkerCpuAffinity;
+        //@}
+        //@{
+        /// Comma separated list of CPUs the worker threads are pinned to (empty: no pinning)
+        #define FEP_TX_ADAPTER_WORKER_CPU_AFFINITY_FIELD "strWorkerCpuAffinity"
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterField_strWorkerCpuAffinity;
+        //@}
+        //@{
+        /// Switch to let idle worker threads poll for incoming data instead of sleeping [full path]
+        #define FEP_TX_ADAPTER_WORKER_BUSY_POLLING_PATH  FEP_COMPONENT_CONFIG_TX_ADAPTER "." FEP_TX_ADAPTER_WORKER_BUSY_POLLING_FIELD
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterPath_bWorkerBusyPolling;
+        //@}
+        //@{
+        /// Switch to let idle worker threads poll for incoming data instead of sleeping
+        #define FEP_TX_ADAPTER_WORKER_BUSY_POLLING_FIELD "bWorkerBusyPolling"
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterField_bWorkerBusyPolling;
+        //@}
+        //@{
+        /// Period in ms the transport statistics of the signals are mirrored into the property tree
+        /// with (0: not mirrored, they are available via RPC only) [full path]
+        #define FEP_TX_ADAPTER_STATISTICS_MIRROR_PERIOD_PATH  FEP_COMPONENT_CONFIG_TX_ADAPTER "." FEP_TX_ADAPTER_STATISTICS_MIRROR_PERIOD_FIELD
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterPath_nStatisticsMirrorPeriod;
+        //@}
+        //@{
+        /// Period in ms the transport statistics of the signals are mirrored into the property tree
+        /// with (0: not mirrored, they are available via RPC only)
+        #define FEP_TX_ADAPTER_STATISTICS_MIRROR_PERIOD_FIELD "nStatisticsMirrorPeriod_ms"
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterField_nStatisticsMirrorPeriod;
+        //@}
+        //@{
+        /// Node the transport statistics are mirrored to, one subnode per signal below
+        /// "Input" and "Output"
+        #define FEP_TX_ADAPTER_STATISTICS_PATH  FEP_COMPONENT_CONFIG_TX_ADAPTER ".Statistics"
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterPath_Statistics;
+        //@}
+        //@{
+        /// Encoding of the sent messages: "json" always sends the JSON representation,
+        /// "negotiated" (default) sends binary messages to single participants that announced
+        /// to decode them, "binary" sends every message with a binary encoding binary
+        /// (all participants of the system must decode them) [full path]
+        #define FEP_TX_ADAPTER_MESSAGE_ENCODING_PATH  FEP_COMPONENT_CONFIG_TX_ADAPTER "." FEP_TX_ADAPTER_MESSAGE_ENCODING_FIELD
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterPath_strMessageEncoding;
+        //@}
+        //@{
+        /// Encoding of the sent messages ("json", "negotiated" or "binary")
+        #define FEP_TX_ADAPTER_MESSAGE_ENCODING_FIELD "strMessageEncoding"
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterField_strMessageEncoding;
+        //@}
+        //@{
+        /// Switch to send messages addressed to a single participant to its inbox channel
+        /// instead of the broadcast channel, if the participant announced its inbox
+        /// (default: true) [full path]
+        #define FEP_TX_ADAPTER_MESSAGE_INBOX_PATH  FEP_COMPONENT_CONFIG_TX_ADAPTER "." FEP_TX_ADAPTER_MESSAGE_INBOX_FIELD
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterPath_bMessageInbox;
+        //@}
+        //@{
+        /// Switch to send messages addressed to a single participant to its inbox channel
+        #define FEP_TX_ADAPTER_MESSAGE_INBOX_FIELD "bMessageInbox"
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strTxAdapterField_bMessageInbox;
+        //@}
 
         /* FEP Timing */
         /*------------------------------------------------------------------------------------------------------------*/
@@ -363,6 +426,16 @@ namespace fep
         #define FEP_RPC_CLIENT_REMOTE_TIMEOUT_PATH   FEP_COMPONENT_CONFIG_RPC_CLIENT "." FEP_RPC_CLIENT_REMOTE_TIMEOUT_FIELD
         FEP_PARTICIPANT_EXPORT extern const char*  const g_strRPCClient_RemoteTimeoutPath;
         //@}
+        //@{
+        /// Switch to send requests to participants on the same host over a local socket (field)
+        #define FEP_RPC_CLIENT_LOCAL_TRANSPORT_FIELD "bLocalTransport"
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strRPCClient_LocalTransportField;
+        //@}
+        //@{
+        /// Switch to send requests to participants on the same host over a local socket (path)
+        #define FEP_RPC_CLIENT_LOCAL_TRANSPORT_PATH   FEP_COMPONENT_CONFIG_RPC_CLIENT "." FEP_RPC_CLIENT_LOCAL_TRANSPORT_FIELD
+        FEP_PARTICIPANT_EXPORT extern const char*  const g_strRPCClient_LocalTransportPath;
+        //@}
 
         /* FEP Signal Registry */
         /*------------------------------------------------------------------------------------------------------------*/
@@ -24,7 +24,9 @@
 #ifndef FEP_RPC_JSON_RPC_CLIENT_H_INCLUDED
 #define FEP_RPC_JSON_RPC_CLIENT_H_INCLUDED
 
+#include <future>
 #include <string>
+#include <json/value.h>
 #include <jsonrpccpp/client/iclientconnector.h>
 #include <jsonrpccpp/common/exception.h>
 #include <jsonrpccpp/server/abstractserverconnector.h>
@@ -81,6 +83,20 @@ namespace detail
     };
 
 
+    /**
+     * Sends a JSON-RPC call without waiting for the response
+     *
+     * @param [in] connection Server and server object the call is sent to
+     * @param [in] method Name of the method
+     * @param [in] params Parameters of the method
+     * @return The future result of the method. Like the methods of the generated client stubs
+     *         it throws jsonrpc::JsonRpcException if the call or the method failed.
+     */
+    FEP_PARTICIPANT_EXPORT std::future<Json::Value> sendJSONRPCRequestAsync(
+        const tClientConnectorInitializerType& connection,
+        const std::string& method,
+        const Json::Value& params);
+
     class  cJSONFEPPServerConnector : public jsonrpc::AbstractServerConnector
     {
     public:
@@ -53,6 +53,30 @@ public:
     virtual fep::Result Set(const char* strResponse) = 0;
 };
 
+/// Interface of the receiver of the response to an asynchronous RPC request
+class IRPCAsyncResponse
+{
+protected:
+    /**
+    * DTOR
+    */
+    virtual ~IRPCAsyncResponse() {};
+public:
+
+    /**
+    * \c Receives the result of the request. Called exactly once for every request
+    * \ref IRPC::SendRequestAsync accepted, by an internal thread of the RPC component that
+    * calls the receivers of all asynchronous requests one after the other.
+    * \note The method may send requests. Blocking delays the results of the other
+    *       asynchronous requests, but not the responses of synchronous requests.
+    *
+    * @param[in] nResult ERR_NOERROR if the response was received, otherwise
+    *                    ERR_TIMEOUT, ERR_CANCELLED, ERR_FAILED or ERR_NOT_CONNECTED
+    * @param[in] strResponse The response data (empty if the request failed).
+    */
+    virtual void OnResponse(fep::Result nResult, const char* strResponse) = 0;
+};
+
 /// Interface of a RPC server
 class IRPCObjectServer
 {
@@ -182,6 +206,28 @@ class IRPC
                                         const char* strMessage,
                                         IRPCResponse* pResponse) const = 0;
 
+        /**
+        * \c Sends a request from \c strElement to the RPC server \c strServerObjectName
+        * without waiting for the response. Any number of requests may be in flight at the
+        * same time, also to the same server.
+        *
+        * @param[in] strElement The name of the element that receives the request.
+        * \note The element must already be connected.
+        * @param[in] strServerObjectName The name of the server to send the request to.
+        * @param[in] strMessage The request message.
+        * @param[in] pResponse Receives the result of the request.
+        * \note \c pResponse must be valid until its \ref IRPCAsyncResponse::OnResponse was called.
+        *
+        * @retval ERR_POINTER pResponse is NULL.
+        * @retval ERR_NOT_CONNECTED If not connected.
+        * @retval ERR_NOT_INITIALISED Not correct initialized.
+        * @retval ERR_NOERROR The request was sent, \c pResponse receives the result.
+        */
+        virtual fep::Result SendRequestAsync(const char* strElement,
+                                             const char* strServerObjectName,
+                                             const char* strMessage,
+                                             IRPCAsyncResponse* pResponse) const = 0;
+
         /**
         * \c Retrieve the RPC server registry
         *
@@ -23,7 +23,10 @@
 #ifndef FEP_RPC_STUBS_HEADER_
 #define FEP_RPC_STUBS_HEADER_
 
+#include <future>
+#include <string>
 #include <a_util/result/result_type.h>
+#include <json/value.h>
 #include <jsonrpccpp/server/abstractserverconnector.h>
 
 #include "module/fep_module_intf.h"
@@ -60,12 +63,29 @@ public:
         const char* server_object_name,
         IRPC& rpc) :
         base_class(detail::tClientConnectorInitializerType(
-                   server_name, server_object_name, rpc))
+                   server_name, server_object_name, rpc)),
+        m_oConnection(server_name, server_object_name, rpc)
     {
         // Setting default timeout parameter of client to property tree
         //oModuleToBind.GetPropertyTree()->SetPropertyValue(FEP_RPC_CLIENT_REMOTE_TIMEOUT_PATH, 5000);
     }
 
+    /**
+     * Calls a method of the server without waiting for the response, any number of calls
+     * may be in flight at the same time. Derived clients add asynchronous variants of the
+     * methods of the generated stub on top of this, e.g. <tt>GetRunlevelAsync()</tt>
+     * calling <tt>callAsync("GetRunlevel", Json::nullValue)</tt>.
+     *
+     * @param [in] method Name of the method
+     * @param [in] params Parameters of the method (as the generated stub passes them)
+     * @return The future result of the method, get() throws jsonrpc::JsonRpcException
+     *         like the methods of the generated stub
+     */
+    std::future<Json::Value> callAsync(const std::string& method, const Json::Value& params)
+    {
+        return detail::sendJSONRPCRequestAsync(m_oConnection, method, params);
+    }
+
     /**
      * @retval The ID of the bound rpc server
      */
@@ -81,6 +101,10 @@ public:
     {
         return fep::getRPCDefaultName<Interface>();
     }
+
+private:
+    /// Server and server object of the asynchronous calls
+    detail::tClientConnectorInitializerType m_oConnection;
 };
 
 /**
@@ -75,7 +75,10 @@ namespace rpc
             /// register to get a IRPCClockSyncMaster::EventID::timeUpdateAfter event
             register_for_timeUpdateAfter = 0x04,
             /// register to get a IRPCClockSyncMaster::EventID::timeReset event
-            register_for_timeReset = 0x08
+            register_for_timeReset = 0x08,
+            /// receive the registered events on the data channel of the master (if switched on there)
+            /// and acknowledge them by data sample
+            register_for_data_channel = 0x10
         };
     public:
         ///definiton of the FEP rpc service iid for a clock synchronization master 
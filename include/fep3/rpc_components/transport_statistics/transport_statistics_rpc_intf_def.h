@@ -0,0 +1,54 @@
+/**
+* Declaration of the Class IRPCTransportStatisticsDef. (can be reached from over rpc)
+*
+* @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*
+*/
+
+#ifndef __FEP_RPC_TRANSPORT_STATISTICS_INTF_DEF_H
+#define __FEP_RPC_TRANSPORT_STATISTICS_INTF_DEF_H
+
+//very important to have this relative! system library!
+#include "../rpc/fep_rpc_definition.h"
+
+namespace fep
+{
+namespace rpc
+{
+    /**
+     * @brief definition of the external service interface of the transport statistics
+     * @see transport_statistics.json file
+     */
+    class IRPCTransportStatisticsDef
+    {
+        protected:
+            /**
+             * @brief Destroy the IRPCTransportStatisticsDef object
+             * 
+             */
+            virtual ~IRPCTransportStatisticsDef() = default;
+
+        public:
+            ///definiton of the FEP rpc service iid as transport statistics service
+            FEP_RPC_IID("transport_statistics.iid", "transport_statistics");
+
+    };
+}
+}
+
+#endif // __FEP_RPC_TRANSPORT_STATISTICS_INTF_DEF_H
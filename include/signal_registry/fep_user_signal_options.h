@@ -23,6 +23,7 @@
 #ifndef _FEP_USER_SIGNAL_OPTIONS_H_
 #define _FEP_USER_SIGNAL_OPTIONS_H_
 
+#include <cstdint>
 #include <string>
 #include "fep_participant_export.h"
 #include "fep_dptr.h"
@@ -248,6 +249,130 @@ namespace fep
         */
         bool GetAsyncPublisherSetting() const;
 
+    public:
+        /**
+        * Enable/Disable zero copy reception for this signal.
+        * If enabled, received samples of raw signals are handed to the data listeners as a
+        * read-only view on the buffer of the transmission driver instead of being copied
+        * twice on their way through the transmission adapter. The driver buffer is released
+        * as soon as the next sample arrives.
+        *
+        * \note this only affects raw input signals
+        * \note the setting is ignored if the transmission driver does not support it
+        * \note Default is disabled
+        *
+        * @param [in] bZeroCopy True enables/ False disables zero copy reception
+        */
+        void SetZeroCopyReception(const bool bZeroCopy);
+
+        /**
+        * Returns whether zero copy reception is requested for this signal
+        *
+        * @retval true Zero copy reception is requested
+        * @retval false Zero copy reception is not requested
+        */
+        bool GetZeroCopyReceptionSetting() const;
+
+        /**
+        * Enable/Disable conflation for this signal.
+        * If enabled, only the newest received sample is processed whenever the data listeners
+        * cannot keep up: all older samples still waiting for processing are discarded without
+        * being deserialized. If no free reception buffer is left, the oldest waiting sample
+        * makes room for the new one instead of the new one being dropped.
+        * Meant for state-like signals where only the latest value matters, the latency of a
+        * sample is bounded at the cost of skipping samples under load.
+        *
+        * \note this only affects input signals
+        * \note Default is disabled
+        *
+        * @param [in] bConflate True enables/ False disables conflation
+        */
+        void SetConflation(const bool bConflate);
+
+        /**
+        * Returns whether conflation is enabled for this signal
+        *
+        * @retval true Conflation is enabled
+        * @retval false Conflation is disabled
+        */
+        bool GetConflationSetting() const;
+
+    public:
+        /**
+        * Assigns the signal to a bundle.
+        * Output signals with the same bundle id are packed into a single transmission
+        * (one driver sample with one compact header per signal) instead of being
+        * transmitted one by one. A bundle is transmitted as soon as every signal of the
+        * bundle was written once, a signal is written a second time, the samples do not
+        * belong to the same frame or the bundle is flushed explicitly (e.g. at the end of a
+        * locked step).
+        * Input signals with a bundle id additionally receive the samples contained in
+        * bundles with the same id, so both sides have to use the same bundle id.
+        *
+        * \note Bundles are meant for small signals, a sample has to fit into one bundle (62 KB).
+        * \note Default is no bundle (empty bundle id)
+        *
+        * @param [in] strBundleId Id of the bundle, empty to transmit the signal on its own
+        */
+        void SetBundleId(const char * strBundleId);
+
+        /**
+        * Returns the bundle the signal is assigned to
+        *
+        * @returns The bundle id, empty if the signal is not bundled
+        */
+        std::string GetBundleId() const;
+
+        /**
+        * Enables delta encoding for an output signal.
+        * Instead of the whole sample only the bytes that changed since the previous sample
+        * are transmitted (XOR/run-length encoded). Every nKeyframeInterval-th sample and every
+        * sample the delta would not be smaller for is transmitted completely (keyframe).
+        * A receiver that missed a sample drops the following deltas until the next keyframe,
+        * so the interval bounds how long a lost sample affects the receivers.
+        * Receivers decode delta encoded samples without any configuration.
+        *
+        * \note Receivers of FEP SDK versions not knowing delta encoding reject all samples
+        *       of the signal (wrong major version, see \ref fep_transmission_compatibility).
+        * \note Meant for large signals of which only a small part changes per sample
+        *       (e.g. occupancy grids). Delta encoding is not applied to bundled signals.
+        * \note Default is 0 (delta encoding disabled)
+        *
+        * @param [in] nKeyframeInterval Number of samples between two keyframes, 0 to disable
+        */
+        void SetDeltaKeyframeInterval(uint32_t nKeyframeInterval);
+
+        /**
+        * Returns the keyframe interval of the delta encoding
+        *
+        * @returns The keyframe interval, 0 if delta encoding is disabled
+        */
+        uint32_t GetDeltaKeyframeInterval() const;
+
+        /**
+        * Enables/Disables stamping the samples of an output signal with a monotonic wall clock.
+        * The stamp (8 bytes) is appended to every transmitted sample, receivers use it to
+        * collect the latency of the signal in wall clock time in addition to the latency in
+        * simulation time, which is always collected from the time stamp of the sample.
+        *
+        * \note The wall clock is only comparable between participants on the same host.
+        * \note Receivers of FEP SDK versions not knowing the stamp reject all samples
+        *       of the signal (wrong major version, see \ref fep_transmission_compatibility).
+        * \note Bundled signals are not stamped.
+        * \note Default is disabled
+        *
+        * @param [in] bLatencyStamp True enables/ False disables the wall clock stamp
+        */
+        void SetLatencyStamp(const bool bLatencyStamp);
+
+        /**
+        * Returns whether the samples are stamped with the monotonic wall clock
+        *
+        * @retval true The samples are stamped
+        * @retval false The samples are not stamped
+        */
+        bool GetLatencyStampSetting() const;
+
         /**
         * Checks whether the set options are valid.
         * Options are valid if a RAW signal has no type and every DDL signal has a type.
@@ -18,6 +18,11 @@
 #ifndef _FEP_TRANSMISSION_RECEIVE_INTF_H_
 #define _FEP_TRANSMISSION_RECEIVE_INTF_H_
 
+#include <cstdint>
+
+#include "fep_participant_export.h"
+#include "fep_errors.h"
+
 namespace fep
 {
     /**
@@ -45,6 +50,89 @@ namespace fep
         */
         virtual fep::Result SetReceiver(tCallbackFuncPtr pCallback, void * pCallee) = 0;
 
+        /** Signature of the function releasing a buffer handed over by a zero copy callback
+        * @param void* void pointer to the release context given along with the buffer
+        */
+        typedef void (*tReleaseFuncPtr)(void *);
+
+        /** Signature of the zero copy callback function
+        * @param void* void pointer to the instance of the class providing the callback
+        * @param void* void pointer to the data (owned by the driver)
+        * @param size of the data
+        * @param tReleaseFuncPtr function that has to be called exactly once to hand the buffer back
+        * @param void* release context to be passed to the release function
+        */
+        typedef void (*tZeroCopyCallbackFuncPtr)(void *, const void *, size_t, tReleaseFuncPtr, void *);
+
+        /**
+        * The method \ref SetZeroCopyReceiver registers a callback function that is called when data
+        * is received. In contrast to \ref SetReceiver the buffer remains valid after the callback
+        * returned and is owned by the callee until it calls the given release function.
+        * Drivers that are not able to lend their buffers do not need to implement this method.
+        *
+        * @param [in] pCallback  pointer to the callback function
+        * @param [in] pCallee void pointer to an instance of the class providing the callback
+        * @returns  Standard result code.
+        * @retval ERR_NOERROR  Everything went fine
+        * @retval ERR_NOT_SUPPORTED  The driver does not support zero copy reception,
+        *                            \ref SetReceiver has to be used instead
+        */
+        virtual fep::Result SetZeroCopyReceiver(tZeroCopyCallbackFuncPtr pCallback, void * pCallee)
+        {
+            (void)pCallback;
+            (void)pCallee;
+            return ERR_NOT_SUPPORTED;
+        }
+
+        /// A single received buffer as handed over by the batch callback
+        struct tReceivedBuffer
+        {
+            /// void pointer to the data (only valid during the callback)
+            const void* pData;
+            /// size of the data
+            size_t szSize;
+        };
+
+        /** Signature of the batch callback function
+        * @param void* void pointer to the instance of the class providing the callback
+        * @param tReceivedBuffer* array of received buffers
+        * @param size_t number of buffers in the array
+        */
+        typedef void (*tBatchCallbackFuncPtr)(void *, const tReceivedBuffer *, size_t);
+
+        /**
+        * The method \ref SetBatchReceiver registers a callback function that is called when
+        * several samples were received at once (e.g. a burst drained from the network).
+        * The callee is able to process the whole batch at once instead of sample by sample.
+        * The callback registered with \ref SetReceiver is still used for single samples.
+        * Drivers that are not able to receive batches do not need to implement this method.
+        *
+        * @param [in] pCallback  pointer to the callback function
+        * @param [in] pCallee void pointer to an instance of the class providing the callback
+        * @returns  Standard result code.
+        * @retval ERR_NOERROR  Everything went fine
+        * @retval ERR_NOT_SUPPORTED  The driver does not support batch reception, all samples
+        *                            are passed to the callback registered with \ref SetReceiver
+        */
+        virtual fep::Result SetBatchReceiver(tBatchCallbackFuncPtr pCallback, void * pCallee)
+        {
+            (void)pCallback;
+            (void)pCallee;
+            return ERR_NOT_SUPPORTED;
+        }
+
+        /**
+        * The method \ref GetLostSampleCount returns the number of samples the driver gave up
+        * while receiving them, e.g. because some of their fragments never arrived.
+        * Drivers that do not fragment samples do not need to implement this method.
+        *
+        * @returns  Number of samples lost by the driver
+        */
+        virtual uint64_t GetLostSampleCount() const
+        {
+            return 0;
+        }
+
         /**
         * The method \ref Enable activates the receiver so that data can be received.
         * Sample reception with a deactivated receiver will cause an error report.
@@ -38,6 +38,12 @@ namespace fep
         TT_RTI_DDS = 0,
         /// Transmission via Zyre/ZMQ
         TT_ZMQ = 3,
+        /// Transmission via POSIX shared memory (participants on the same host, Linux only)
+        TT_SHM = 4,
+        /// Transmission within the process (participants in the same process only)
+        TT_INPROC = 5,
+        /// Transmission via UDP multicast (Linux only)
+        TT_UDP = 6,
     } tTransmissionType;
 
     /**
@@ -38,6 +38,33 @@ namespace fep
         */
         virtual fep::Result Transmit(const void *pData, size_t szSize) = 0;
 
+        /** Signature of the function called by the driver once a lent buffer is no longer used
+        * @param void* void pointer to the release context given along with the buffer
+        */
+        typedef void (*tReleaseFuncPtr)(void *);
+
+        /**
+        * The method \ref TransmitZeroCopy transmits a data block of size szSize without copying it.
+        * The buffer is lent to the driver and must not be changed until the driver calls the given
+        * release function, which happens exactly once (also if the transmission failed).
+        * Drivers that are not able to send from lent buffers do not need to implement this method,
+        * the default implementation calls \ref Transmit and releases the buffer right away.
+        *
+        * @param [in] pData  void pointer to the data
+        * @param [in] szSize size of the data block
+        * @param [in] pRelease function releasing the buffer
+        * @param [in] pContext release context to be passed to the release function
+        * @returns  Standard result code.
+        * @retval ERR_NOERROR  Everything went fine
+        */
+        virtual fep::Result TransmitZeroCopy(const void *pData, size_t szSize,
+            tReleaseFuncPtr pRelease, void * pContext)
+        {
+            fep::Result nResult = Transmit(pData, szSize);
+            pRelease(pContext);
+            return nResult;
+        }
+
         /**
         * The method \ref Enable activates the transmitter so that data can be received.
         * Sample transmission with a deactivated transmitter will cause an error report.
@@ -0,0 +1,346 @@
+/**
+ * Implementation of the FEP byte order conversion kernels
+ *
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ * @file
+ */
+
+#include <cstdint>
+#include <cstring>
+#include "_common/fep_byteswap.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define FEP_BYTESWAP_SSE2
+        #include <emmintrin.h>
+    #endif
+    #if defined(_MSC_VER)
+        #define FEP_BYTESWAP_AVX2
+        #define FEP_TARGET_AVX2
+        #include <intrin.h>
+        #include <immintrin.h>
+    #elif defined(__GNUC__)
+        #define FEP_BYTESWAP_AVX2
+        #define FEP_TARGET_AVX2 __attribute__((target("avx2")))
+        #include <immintrin.h>
+    #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define FEP_BYTESWAP_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace
+{
+typedef void (*tSwapFunc)(uint8_t*, const uint8_t*, size_t);
+
+/// The kernels of one instruction set
+struct tKernelTable
+{
+    fep::tByteSwapKernel eKernel;
+    tSwapFunc pSwap16;
+    tSwapFunc pSwap32;
+    tSwapFunc pSwap64;
+};
+
+// Scalar kernels - memcpy keeps unaligned access well defined and is inlined by the compiler
+
+void ScalarSwap16(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        uint16_t nValue;
+        ::memcpy(&nValue, pSrc + 2 * i, 2);
+        nValue = static_cast<uint16_t>((nValue << 8) | (nValue >> 8));
+        ::memcpy(pDest + 2 * i, &nValue, 2);
+    }
+}
+
+void ScalarSwap32(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        uint32_t nValue;
+        ::memcpy(&nValue, pSrc + 4 * i, 4);
+        nValue = ((nValue & 0x000000FFu) << 24) | ((nValue & 0x0000FF00u) << 8)
+            | ((nValue & 0x00FF0000u) >> 8) | ((nValue & 0xFF000000u) >> 24);
+        ::memcpy(pDest + 4 * i, &nValue, 4);
+    }
+}
+
+void ScalarSwap64(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        uint64_t nValue;
+        ::memcpy(&nValue, pSrc + 8 * i, 8);
+        nValue = ((nValue & 0x00000000000000FFull) << 56) | ((nValue & 0x000000000000FF00ull) << 40)
+            | ((nValue & 0x0000000000FF0000ull) << 24) | ((nValue & 0x00000000FF000000ull) << 8)
+            | ((nValue & 0x000000FF00000000ull) >> 8) | ((nValue & 0x0000FF0000000000ull) >> 24)
+            | ((nValue & 0x00FF000000000000ull) >> 40) | ((nValue & 0xFF00000000000000ull) >> 56);
+        ::memcpy(pDest + 8 * i, &nValue, 8);
+    }
+}
+
+#ifdef FEP_BYTESWAP_SSE2
+// SSE2 has no byte shuffle: 16 bit lanes are swapped by shifts,
+// wider elements additionally reorder their 16 bit lanes first.
+
+inline __m128i Sse2SwapBytesIn16(__m128i vValue)
+{
+    return _mm_or_si128(_mm_slli_epi16(vValue, 8), _mm_srli_epi16(vValue, 8));
+}
+
+void Sse2Swap16(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        __m128i vValue = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 2 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + 2 * i), Sse2SwapBytesIn16(vValue));
+    }
+    ScalarSwap16(pDest + 2 * i, pSrc + 2 * i, nCount - i);
+}
+
+void Sse2Swap32(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 4 <= nCount; i += 4)
+    {
+        __m128i vValue = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 4 * i));
+        vValue = _mm_shufflelo_epi16(vValue, _MM_SHUFFLE(2, 3, 0, 1));
+        vValue = _mm_shufflehi_epi16(vValue, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + 4 * i), Sse2SwapBytesIn16(vValue));
+    }
+    ScalarSwap32(pDest + 4 * i, pSrc + 4 * i, nCount - i);
+}
+
+void Sse2Swap64(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 2 <= nCount; i += 2)
+    {
+        __m128i vValue = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 8 * i));
+        vValue = _mm_shufflelo_epi16(vValue, _MM_SHUFFLE(0, 1, 2, 3));
+        vValue = _mm_shufflehi_epi16(vValue, _MM_SHUFFLE(0, 1, 2, 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + 8 * i), Sse2SwapBytesIn16(vValue));
+    }
+    ScalarSwap64(pDest + 8 * i, pSrc + 8 * i, nCount - i);
+}
+#endif
+
+#ifdef FEP_BYTESWAP_AVX2
+FEP_TARGET_AVX2 inline void Avx2Shuffle(uint8_t* pDest, const uint8_t* pSrc, size_t nBlocks,
+    __m256i vMask)
+{
+    for (size_t i = 0; i < nBlocks; ++i)
+    {
+        __m256i vValue = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + 32 * i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDest + 32 * i), _mm256_shuffle_epi8(vValue, vMask));
+    }
+}
+
+FEP_TARGET_AVX2 void Avx2Swap16(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    const __m256i vMask = _mm256_setr_epi8(
+        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const size_t nBlocks = nCount / 16;
+    Avx2Shuffle(pDest, pSrc, nBlocks, vMask);
+    ScalarSwap16(pDest + 32 * nBlocks, pSrc + 32 * nBlocks, nCount - 16 * nBlocks);
+}
+
+FEP_TARGET_AVX2 void Avx2Swap32(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    const __m256i vMask = _mm256_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const size_t nBlocks = nCount / 8;
+    Avx2Shuffle(pDest, pSrc, nBlocks, vMask);
+    ScalarSwap32(pDest + 32 * nBlocks, pSrc + 32 * nBlocks, nCount - 8 * nBlocks);
+}
+
+FEP_TARGET_AVX2 void Avx2Swap64(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    const __m256i vMask = _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const size_t nBlocks = nCount / 4;
+    Avx2Shuffle(pDest, pSrc, nBlocks, vMask);
+    ScalarSwap64(pDest + 32 * nBlocks, pSrc + 32 * nBlocks, nCount - 4 * nBlocks);
+}
+
+bool CpuSupportsAvx2()
+{
+#if defined(_MSC_VER)
+    int aInfo[4];
+    __cpuid(aInfo, 0);
+    if (aInfo[0] < 7)
+    {
+        return false;
+    }
+    __cpuid(aInfo, 1);
+    // the OS has to save the YMM registers (OSXSAVE + AVX and XCR0 bits 1 and 2)
+    if ((aInfo[2] & (1 << 27)) == 0 || (aInfo[2] & (1 << 28)) == 0
+        || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+    __cpuidex(aInfo, 7, 0);
+    return (aInfo[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif
+
+#ifdef FEP_BYTESWAP_NEON
+void NeonSwap16(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        vst1q_u8(pDest + 2 * i, vrev16q_u8(vld1q_u8(pSrc + 2 * i)));
+    }
+    ScalarSwap16(pDest + 2 * i, pSrc + 2 * i, nCount - i);
+}
+
+void NeonSwap32(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 4 <= nCount; i += 4)
+    {
+        vst1q_u8(pDest + 4 * i, vrev32q_u8(vld1q_u8(pSrc + 4 * i)));
+    }
+    ScalarSwap32(pDest + 4 * i, pSrc + 4 * i, nCount - i);
+}
+
+void NeonSwap64(uint8_t* pDest, const uint8_t* pSrc, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 2 <= nCount; i += 2)
+    {
+        vst1q_u8(pDest + 8 * i, vrev64q_u8(vld1q_u8(pSrc + 8 * i)));
+    }
+    ScalarSwap64(pDest + 8 * i, pSrc + 8 * i, nCount - i);
+}
+#endif
+
+const tKernelTable s_oScalarKernels = { fep::BSK_Scalar, ScalarSwap16, ScalarSwap32, ScalarSwap64 };
+#ifdef FEP_BYTESWAP_SSE2
+const tKernelTable s_oSse2Kernels = { fep::BSK_SSE2, Sse2Swap16, Sse2Swap32, Sse2Swap64 };
+#endif
+#ifdef FEP_BYTESWAP_AVX2
+const tKernelTable s_oAvx2Kernels = { fep::BSK_AVX2, Avx2Swap16, Avx2Swap32, Avx2Swap64 };
+#endif
+#ifdef FEP_BYTESWAP_NEON
+const tKernelTable s_oNeonKernels = { fep::BSK_NEON, NeonSwap16, NeonSwap32, NeonSwap64 };
+#endif
+
+/// Returns the kernels of the given instruction set, NULL if not available on this CPU
+const tKernelTable* FindKernels(fep::tByteSwapKernel eKernel)
+{
+    switch (eKernel)
+    {
+    case fep::BSK_Scalar:
+        return &s_oScalarKernels;
+#ifdef FEP_BYTESWAP_SSE2
+    case fep::BSK_SSE2:
+        return &s_oSse2Kernels;
+#endif
+#ifdef FEP_BYTESWAP_AVX2
+    case fep::BSK_AVX2:
+        return CpuSupportsAvx2() ? &s_oAvx2Kernels : NULL;
+#endif
+#ifdef FEP_BYTESWAP_NEON
+    case fep::BSK_NEON:
+        return &s_oNeonKernels;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+/// Runtime CPU dispatch: the best instruction set available
+const tKernelTable* SelectKernels()
+{
+    const fep::tByteSwapKernel aPreferred[] = { fep::BSK_AVX2, fep::BSK_NEON, fep::BSK_SSE2 };
+    for (size_t i = 0; i < sizeof(aPreferred) / sizeof(aPreferred[0]); ++i)
+    {
+        const tKernelTable* pCandidate = FindKernels(aPreferred[i]);
+        if (NULL != pCandidate)
+        {
+            return pCandidate;
+        }
+    }
+    return &s_oScalarKernels;
+}
+
+/// Returns the dispatched kernels (selected once at the first call)
+const tKernelTable& GetKernels()
+{
+    static const tKernelTable* s_pKernels = SelectKernels();
+    return *s_pKernels;
+}
+}
+
+void fep::SwapCopy16(void* pDestination, const void* pSource, size_t nCount)
+{
+    GetKernels().pSwap16(static_cast<uint8_t*>(pDestination), static_cast<const uint8_t*>(pSource), nCount);
+}
+
+void fep::SwapCopy32(void* pDestination, const void* pSource, size_t nCount)
+{
+    GetKernels().pSwap32(static_cast<uint8_t*>(pDestination), static_cast<const uint8_t*>(pSource), nCount);
+}
+
+void fep::SwapCopy64(void* pDestination, const void* pSource, size_t nCount)
+{
+    GetKernels().pSwap64(static_cast<uint8_t*>(pDestination), static_cast<const uint8_t*>(pSource), nCount);
+}
+
+fep::tByteSwapKernel fep::GetByteSwapKernel()
+{
+    return GetKernels().eKernel;
+}
+
+bool fep::SwapCopyWithKernel(tByteSwapKernel eKernel, size_t nWidth,
+    void* pDestination, const void* pSource, size_t nCount)
+{
+    const tKernelTable* pKernels = FindKernels(eKernel);
+    if (NULL == pKernels)
+    {
+        return false;
+    }
+    uint8_t* pDest = static_cast<uint8_t*>(pDestination);
+    const uint8_t* pSrc = static_cast<const uint8_t*>(pSource);
+    switch (nWidth)
+    {
+    case 2:
+        pKernels->pSwap16(pDest, pSrc, nCount);
+        return true;
+    case 4:
+        pKernels->pSwap32(pDest, pSrc, nCount);
+        return true;
+    case 8:
+        pKernels->pSwap64(pDest, pSrc, nCount);
+        return true;
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ * Declaration of the FEP byte order conversion kernels
+ *
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ * @file
+ */
+
+#ifndef _FEP_BYTESWAP_
+#define _FEP_BYTESWAP_
+
+#include <cstddef>
+#include "fep_participant_export.h"
+
+namespace fep
+{
+    /// Instruction set used by the byte order conversion kernels
+    enum tByteSwapKernel
+    {
+        BSK_Scalar = 0, ///< portable C++ loop
+        BSK_SSE2,       ///< x86 SSE2 (128 bit)
+        BSK_AVX2,       ///< x86 AVX2 (256 bit)
+        BSK_NEON        ///< ARM NEON (128 bit)
+    };
+
+    /**
+     * Copies \a nCount 16 bit elements from \a pSource to \a pDestination and swaps the
+     * byte order of every element on the way. The buffers must not overlap and do not need
+     * to be aligned. The fastest kernel supported by the CPU is chosen at the first call.
+     *
+     * @param [out] pDestination destination buffer (at least 2 * \a nCount bytes)
+     * @param [in] pSource source buffer (at least 2 * \a nCount bytes)
+     * @param [in] nCount number of elements
+     */
+    FEP_PARTICIPANT_EXPORT void SwapCopy16(void* pDestination, const void* pSource, size_t nCount);
+
+    /// 32 bit variant of \ref SwapCopy16
+    FEP_PARTICIPANT_EXPORT void SwapCopy32(void* pDestination, const void* pSource, size_t nCount);
+
+    /// 64 bit variant of \ref SwapCopy16
+    FEP_PARTICIPANT_EXPORT void SwapCopy64(void* pDestination, const void* pSource, size_t nCount);
+
+    /**
+     * Returns the kernel chosen by the runtime CPU dispatch of \ref SwapCopy16,
+     * \ref SwapCopy32 and \ref SwapCopy64.
+     * @return The kernel
+     */
+    FEP_PARTICIPANT_EXPORT tByteSwapKernel GetByteSwapKernel();
+
+    /**
+     * Runs the conversion with an explicitly chosen kernel (used for testing).
+     * @param [in] eKernel kernel to be used, it has to be supported by the CPU
+     * @param [in] nWidth element width in bytes (2, 4 or 8)
+     * @param [out] pDestination destination buffer (at least \a nWidth * \a nCount bytes)
+     * @param [in] pSource source buffer (at least \a nWidth * \a nCount bytes)
+     * @param [in] nCount number of elements
+     * @retval true the conversion was done
+     * @retval false the kernel is not available on this CPU or the width is not supported
+     */
+    FEP_PARTICIPANT_EXPORT bool SwapCopyWithKernel(tByteSwapKernel eKernel, size_t nWidth,
+        void* pDestination, const void* pSource, size_t nCount);
+}
+
+#endif //_FEP_BYTESWAP_
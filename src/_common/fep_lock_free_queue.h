@@ -0,0 +1,276 @@
+/**
+ * Declaration of the template class cLockFreeQueue.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_LOCK_FREE_QUEUE_
+#define _FEP_LOCK_FREE_QUEUE_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace fep
+{
+    /// Bounded lock-free ring buffer queue.
+    /// Any number of producers and consumers may access the queue concurrently (the typical use
+    /// is one driver thread producing and the queue manager workers consuming or vice versa).
+    /// Every slot carries a sequence number telling producers and consumers whether it is
+    /// free or filled, so neither side ever takes a lock.
+    /// In contrast to \ref cLockedQueue the capacity is fixed: enqueueing into a full queue
+    /// fails and is counted as overflow.
+    template <typename T> class cLockFreeQueue
+    {
+    private:
+        /// One slot of the ring
+        struct sCell
+        {
+            /// Sequence number of the slot
+            std::atomic<size_t> nSequence;
+            /// The stored element
+            T tData;
+        };
+
+        /// Size of a cache line, used to keep producer and consumer position apart
+        static const size_t s_szCacheLine = 64;
+
+    public:
+        /// CTOR
+        /// @param [in] szCapacity Capacity of the queue, rounded up to a power of two.
+        ///                        A capacity of 0 creates an unusable queue that has
+        ///                        to be initialized by \ref Initialize.
+        explicit cLockFreeQueue(size_t szCapacity = 0) :
+            m_pCells(NULL), m_szMask(0), m_nEnqueuePos(0), m_nDequeuePos(0), m_nOverflowCount(0),
+            m_szHighWaterMark(0)
+        {
+            Initialize(szCapacity);
+        }
+
+        /// DTOR
+        ~cLockFreeQueue()
+        {
+            delete[] m_pCells;
+        }
+
+    private:
+        /// no copy
+        cLockFreeQueue(const cLockFreeQueue&);
+        /// no assignment
+        cLockFreeQueue& operator=(const cLockFreeQueue&);
+
+    public:
+        /// (Re-)Initializes the queue with the given capacity, dropping all contained elements.
+        /// Must not be called concurrently to any other method.
+        /// @param [in] szCapacity Capacity of the queue, rounded up to a power of two
+        void Initialize(size_t szCapacity)
+        {
+            delete[] m_pCells;
+            m_pCells = NULL;
+            m_szMask = 0;
+            if (0 < szCapacity)
+            {
+                size_t szSize = 2;
+                while (szSize < szCapacity)
+                {
+                    szSize <<= 1;
+                }
+                m_pCells = new sCell[szSize];
+                for (size_t i = 0; i < szSize; ++i)
+                {
+                    m_pCells[i].nSequence.store(i, std::memory_order_relaxed);
+                }
+                m_szMask = szSize - 1;
+            }
+            m_nEnqueuePos.store(0, std::memory_order_relaxed);
+            m_nDequeuePos.store(0, std::memory_order_relaxed);
+            m_nOverflowCount.store(0, std::memory_order_relaxed);
+            m_szHighWaterMark.store(0, std::memory_order_relaxed);
+        }
+
+        /// Returns the capacity of the queue
+        /// @return The capacity (a power of two or 0)
+        size_t GetCapacity() const
+        {
+            return (NULL == m_pCells) ? 0 : m_szMask + 1;
+        }
+
+        /// Push an element at end of queue
+        /// @param [in] t Element to add to the queue
+        /// @retval true Element added
+        /// @retval false Queue is full (counted as overflow)
+        bool Enqueue(const T& t)
+        {
+            if (NULL == m_pCells)
+            {
+                m_nOverflowCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            sCell* pCell;
+            size_t nPos = m_nEnqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                pCell = &m_pCells[nPos & m_szMask];
+                size_t nSeq = pCell->nSequence.load(std::memory_order_acquire);
+                intptr_t nDiff = static_cast<intptr_t>(nSeq) - static_cast<intptr_t>(nPos);
+                if (0 == nDiff)
+                {
+                    if (m_nEnqueuePos.compare_exchange_weak(nPos, nPos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (0 > nDiff)
+                {
+                    m_nOverflowCount.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                else
+                {
+                    nPos = m_nEnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            pCell->tData = t;
+            pCell->nSequence.store(nPos + 1, std::memory_order_release);
+            UpdateHighWaterMark(nPos + 1 - m_nDequeuePos.load(std::memory_order_relaxed));
+            return true;
+        }
+
+        /// Try to copy the first element and remove it from the queue
+        /// @param [out] t The first element of the queue, if present
+        /// @retval true Element found
+        /// @retval false Queue is empty
+        bool TryDequeue(T& t)
+        {
+            if (NULL == m_pCells)
+            {
+                return false;
+            }
+            sCell* pCell;
+            size_t nPos = m_nDequeuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                pCell = &m_pCells[nPos & m_szMask];
+                size_t nSeq = pCell->nSequence.load(std::memory_order_acquire);
+                intptr_t nDiff = static_cast<intptr_t>(nSeq) - static_cast<intptr_t>(nPos + 1);
+                if (0 == nDiff)
+                {
+                    if (m_nDequeuePos.compare_exchange_weak(nPos, nPos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (0 > nDiff)
+                {
+                    return false;
+                }
+                else
+                {
+                    nPos = m_nDequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            t = pCell->tData;
+            pCell->nSequence.store(nPos + m_szMask + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// Try to copy the first element and remove it from the queue.
+        /// Unlock guard, when queue is empty.
+        /// @param [out] t The first element of the queue, if present
+        /// @param [in] guard Mutex to guard the queue
+        /// @retval true Element found
+        /// @retval false Queue is empty
+        template <class GUARD> bool TryDequeueAndUnlockGuardIfEmpty(T& t, GUARD& guard)
+        {
+            if (TryDequeue(t))
+            {
+                return true;
+            }
+            guard.unlock();
+            return false;
+        }
+
+        /// Checks whether the queue holds a completely enqueued element.
+        /// The result is a snapshot only if other threads access the queue concurrently.
+        /// @retval true Queue is empty
+        /// @retval false Queue holds at least one element
+        bool IsEmpty() const
+        {
+            if (NULL == m_pCells)
+            {
+                return true;
+            }
+            size_t nPos = m_nDequeuePos.load(std::memory_order_acquire);
+            return m_pCells[nPos & m_szMask].nSequence.load(std::memory_order_acquire) != nPos + 1;
+        }
+
+        /// Returns the number of elements rejected because the queue was full
+        /// @return Number of rejected elements since the last \ref Initialize
+        uint64_t GetOverflowCount() const
+        {
+            return m_nOverflowCount.load(std::memory_order_relaxed);
+        }
+
+        /// Returns the highest number of elements the queue held at once
+        /// @return High-water mark since the last \ref Initialize
+        size_t GetHighWaterMark() const
+        {
+            return m_szHighWaterMark.load(std::memory_order_relaxed);
+        }
+
+    private:
+        /// Raises the high-water mark to the given depth (if it is higher)
+        /// @param [in] szDepth Number of elements seen after an enqueue
+        void UpdateHighWaterMark(size_t szDepth)
+        {
+            // the consumer position is read without synchronization, clamp the snapshot
+            if (szDepth > m_szMask + 1)
+            {
+                return;
+            }
+            size_t szMark = m_szHighWaterMark.load(std::memory_order_relaxed);
+            while (szDepth > szMark
+                && !m_szHighWaterMark.compare_exchange_weak(szMark, szDepth, std::memory_order_relaxed))
+            {
+            }
+        }
+
+    private:
+        /// The ring
+        sCell* m_pCells;
+        /// Capacity - 1, used to map positions onto the ring
+        size_t m_szMask;
+        /// Padding keeping the producer position in its own cache line
+        char m_aPadding0[s_szCacheLine];
+        /// Position of the next element to be enqueued
+        std::atomic<size_t> m_nEnqueuePos;
+        /// Padding keeping the consumer position in its own cache line
+        char m_aPadding1[s_szCacheLine - sizeof(std::atomic<size_t>)];
+        /// Position of the next element to be dequeued
+        std::atomic<size_t> m_nDequeuePos;
+        /// Padding keeping the counters out of the consumer cache line
+        char m_aPadding2[s_szCacheLine - sizeof(std::atomic<size_t>)];
+        /// Number of elements rejected because the queue was full
+        std::atomic<uint64_t> m_nOverflowCount;
+        /// Highest number of elements the queue held at once
+        std::atomic<size_t> m_szHighWaterMark;
+    };
+} // namespace fep
+
+#endif // _FEP_LOCK_FREE_QUEUE_
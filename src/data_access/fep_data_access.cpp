@@ -44,12 +44,14 @@
 #include "mapping/fep_mapping.h"
 #include "messages/fep_command_mute_signal_intf.h"
 #include "messages/fep_notification_resultcode.h"
+#include "perfmeasure/fep_trace.h"
 #include "signal_registry/fep_signal_registry.h"
 #include "signal_registry/fep_signal_struct.h"
 #include "transmission_adapter/fep_data_listener_adapter.h"
 #include "transmission_adapter/fep_preparation_data_listener_intf.h"
 #include "transmission_adapter/fep_preparation_data_sample_intf.h"
 #include "transmission_adapter/fep_signal_direction.h"
+#include "transmission_adapter/fep_transmission.h"
 #include "transmission_adapter/fep_transmission_adapter_intf.h"
 #include "transmission_adapter/fep_user_data_sample_intf.h"
 #include "data_access/fep_data_access.h"
@@ -57,7 +59,7 @@
 using namespace fep;
 
 cDataAccess::cDataAccess() :
-    m_bIsInitialized(false), m_poTransmissionAdapter(NULL),
+    m_bIsInitialized(false), m_poTransmissionAdapter(NULL), m_poTransmissionAdapterPrivate(NULL),
     m_poSignalRegistryPrivate(NULL), m_poSignalMappingPrivate(NULL),
     m_poIncidentHandler(NULL), m_poPropertyTree(NULL)
 {
@@ -92,6 +94,7 @@ fep::Result cDataAccess::Initialize(ITransmissionAdapter* poTransmissionAdapter,
     if (fep::isOk(nRes))
     {
         m_poTransmissionAdapter = poTransmissionAdapter;
+        m_poTransmissionAdapterPrivate = dynamic_cast<ITransmissionAdapterPrivate*>(poTransmissionAdapter);
         m_poSignalRegistryPrivate = poSignalRegistryPrivate;
         m_poSignalMappingPrivate = poSignalMappingPrivate;
         m_poIncidentHandler = poIncidentHandler;
@@ -141,6 +144,7 @@ fep::Result cDataAccess::Finalize()
         }
 
         m_poTransmissionAdapter = NULL;
+        m_poTransmissionAdapterPrivate = NULL;
         m_poSignalRegistryPrivate = NULL;
         m_poSignalMappingPrivate = NULL;
         m_poIncidentHandler = NULL;
@@ -499,8 +503,7 @@ fep::Result cDataAccess::RegisterDataListener(IUserDataListener* poDataListener,
 fep::Result cDataAccess::TransmitData(IUserDataSample* poSample, bool bSync)
 {
     if (!poSample) { return ERR_POINTER; }
-    // TBD: is this needed?
-    //MEASURE_POINT(ApiTransmitCalled);
+    FEP_TRACE_SPAN("TransmitData", "transmission");
 
     fep::Result nResult = ERR_NOERROR;
 
@@ -523,6 +526,16 @@ fep::Result cDataAccess::TransmitData(IUserDataSample* poSample, bool bSync)
     return nResult;
 }
 
+fep::Result cDataAccess::FlushSignalBundles()
+{
+    fep::Result nResult = ERR_NOERROR;
+    if (NULL != m_poTransmissionAdapterPrivate)
+    {
+        nResult = m_poTransmissionAdapterPrivate->FlushSignalBundles();
+    }
+    return nResult;
+}
+
 fep::Result cDataAccess::UnregisterDataListener(IUserDataListener* poDataListener, const handle_t hSignalHandle)
 {
     if (!poDataListener) { return ERR_POINTER; }
@@ -35,6 +35,7 @@
 
 #include "data_access/fep_data_sample_buffer.h"
 #include "data_access/fep_user_data_access_intf.h"
+#include "fep_errors.h"
 #include "fep_participant_export.h"
 #include "fep_result_decl.h"
 #include "messages/fep_command_listener.h"
@@ -50,6 +51,7 @@ namespace fep
     class ISignalMappingPrivate;
     class ISignalRegistryPrivate;
     class ITransmissionAdapter;
+    class ITransmissionAdapterPrivate;
     class cDataListenerAdapter;
     class cSignalCounter;
     struct tSignal;
@@ -104,6 +106,17 @@ namespace fep
 
         /// @copydoc IUserDataAccess::TransmitData
         virtual fep::Result TransmitData(IUserDataSample* poSample, bool bSync) =0;
+
+        /**
+        * Transmits the samples of all bundled output signals that are still waiting for the
+        * rest of their bundle (see \ref cUserSignalOptions::SetBundleId).
+        * @returns Standard result code
+        * @retval ERR_NOERROR Everything went fine
+        */
+        virtual fep::Result FlushSignalBundles()
+        {
+            return ERR_NOERROR;
+        }
     };
  
     /**
@@ -284,6 +297,9 @@ namespace fep
         /// @copydoc IUserDataAccess::TransmitData
         fep::Result TransmitData(IUserDataSample* poSample, bool bSync);
 
+        /// @copydoc IUserDataAccessPrivate::FlushSignalBundles
+        fep::Result FlushSignalBundles();
+
         /// @copydoc IUserDataAccess::UnregisterDataListener
         fep::Result UnregisterDataListener(IUserDataListener* poDataListener, const handle_t hSignalHandle);
 
@@ -332,6 +348,8 @@ namespace fep
         bool m_bIsInitialized;
         /// pointer to the transmission adapter used by the module
         ITransmissionAdapter* m_poTransmissionAdapter;
+        /// private interface of the transmission adapter (NULL if it has none, e.g. a mock)
+        ITransmissionAdapterPrivate* m_poTransmissionAdapterPrivate;
         /// the instance of the signal registry of the current module
         ISignalRegistryPrivate* m_poSignalRegistryPrivate;
         /// the instance of the signal mapping component of the module
@@ -266,6 +266,11 @@ fep::Result cStepDataAccess::TransmitAllOutputs()
                 break;
             }
         }
+        // bundled outputs have to be on the wire at the end of the step as well
+        if (isOk(result) && isFailed(m_pUserDataAccessPrivate->FlushSignalBundles()))
+        {
+            result = ERR_FAILED;
+        }
     }
     m_bNeedToSkip = false;
 
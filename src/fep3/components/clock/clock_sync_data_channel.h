@@ -0,0 +1,107 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef __FEP_CLOCK_SYNC_DATA_CHANNEL_H
+#define __FEP_CLOCK_SYNC_DATA_CHANNEL_H
+
+#include <cstdint>
+#include <string>
+#include <a_util/base/types.h>
+
+#include "transmission_adapter/fep_serialization_helpers.h"
+
+namespace fep
+{
+namespace detail
+{
+/**
+ * Samples exchanged between the ClockMaster and the discrete clock sync slaves if the
+ * data channel is switched on (see @ref FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL).
+ * The master publishes every time event once as tick, each slave answers with an ack on
+ * one signal shared by all slaves. Both are raw signals in network byte order.
+ */
+#pragma pack(push,1)
+/// Time event sent by the master
+struct ClockSyncTick
+{
+    /// Number of the tick, the acks refer to it
+    uint32_t step;
+    /// rpc::IRPCClockSyncMasterDef::EventID of the time event
+    int32_t event_id;
+    /// New time of the time event
+    timestamp_t new_time;
+    /// Old time of the time event
+    timestamp_t old_time;
+};
+
+/// Acknowledgement of a tick sent by a slave
+struct ClockSyncAck
+{
+    /// Id of the slave returned by the registration at the master
+    int32_t slave_id;
+    /// Number of the acknowledged tick
+    uint32_t step;
+    /// Time of the slave after the time event
+    timestamp_t time;
+};
+#pragma pack(pop)
+
+static inline void convertClockSyncTickToNetworkByteorder(ClockSyncTick& tick)
+{
+    tick.step = fep::header::ConvertToNetworkByteorder<uint32_t>(tick.step);
+    tick.event_id = fep::header::ConvertToNetworkByteorder<int32_t>(tick.event_id);
+    tick.new_time = fep::header::ConvertToNetworkByteorder<timestamp_t>(tick.new_time);
+    tick.old_time = fep::header::ConvertToNetworkByteorder<timestamp_t>(tick.old_time);
+}
+
+static inline void convertClockSyncTickToHostByteorder(ClockSyncTick& tick)
+{
+    tick.step = fep::header::ConvertToHostByteorder<uint32_t>(tick.step);
+    tick.event_id = fep::header::ConvertToHostByteorder<int32_t>(tick.event_id);
+    tick.new_time = fep::header::ConvertToHostByteorder<timestamp_t>(tick.new_time);
+    tick.old_time = fep::header::ConvertToHostByteorder<timestamp_t>(tick.old_time);
+}
+
+static inline void convertClockSyncAckToNetworkByteorder(ClockSyncAck& ack)
+{
+    ack.slave_id = fep::header::ConvertToNetworkByteorder<int32_t>(ack.slave_id);
+    ack.step = fep::header::ConvertToNetworkByteorder<uint32_t>(ack.step);
+    ack.time = fep::header::ConvertToNetworkByteorder<timestamp_t>(ack.time);
+}
+
+static inline void convertClockSyncAckToHostByteorder(ClockSyncAck& ack)
+{
+    ack.slave_id = fep::header::ConvertToHostByteorder<int32_t>(ack.slave_id);
+    ack.step = fep::header::ConvertToHostByteorder<uint32_t>(ack.step);
+    ack.time = fep::header::ConvertToHostByteorder<timestamp_t>(ack.time);
+}
+
+/// Name of the tick signal of the master \p master_name
+inline std::string getClockSyncTickSignalName(const std::string& master_name)
+{
+    return "_ClockSyncTick_" + master_name;
+}
+
+/// Name of the ack signal of the slaves of the master \p master_name
+inline std::string getClockSyncAckSignalName(const std::string& master_name)
+{
+    return "_ClockSyncAck_" + master_name;
+}
+
+} // namespace detail
+} // namespace fep
+#endif //__FEP_CLOCK_SYNC_DATA_CHANNEL_H
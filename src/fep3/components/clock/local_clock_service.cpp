@@ -27,8 +27,10 @@
 #include <a_util/strings/strings_format.h>
 #include <a_util/strings/strings_functions.h>
 
+#include "fep3/base/streamtype/default_streamtype.h"
 #include "fep3/components/base/component_intf.h"
 #include "fep3/components/clock/clock_service_intf.h"
+#include "fep3/components/data_registry/data_registry_intf.h"
 #include "fep3/rpc_components/clock/clock_service.h"
 #include "fep3/rpc_components/clock/clock_service_rpc_intf_def.h"
 #include "fep3/rpc_components/clock/clock_sync_master.h"
@@ -37,9 +39,11 @@
 #include "fep3/components/rpc/fep_rpc_stubs.h"
 #include "fep3/components/legacy/property_tree/fep_propertytree_intf.h"
 #include "fep3/components/rpc/fep_rpc_intf.h"
+#include "fep_error_helpers.h"
 #include "fep_errors.h"
 #include "incident_handler/fep_incident_handler_intf.h"
 #include "incident_handler/fep_severity_level.h"
+#include "clock_sync_data_channel.h"
 #include "local_clock_service.h"
 #include "local_clock_service_master.h"
 #ifdef __QNX__
@@ -139,9 +143,10 @@ public:
 protected:
     int registerSyncSlave(int event_id_flag, const std::string& slave_name) override
     {
-        if (fep::isOk(_service.masterRegisterSlave(slave_name, event_id_flag)))
+        int32_t slave_id = -1;
+        if (fep::isOk(_service.masterRegisterSlave(slave_name, event_id_flag, slave_id)))
         {
-            return 0;
+            return slave_id;
         }
         return -1;
     }
@@ -230,6 +235,19 @@ protected:
             return static_cast<int>(_service.getType(clock_name.c_str()));
         }
     }
+    Json::Value getSyncSlaveStatistics() override
+    {
+        const ClockSyncStatistics statistics = _service.masterSyncStatistics();
+        Json::Value value(Json::objectValue);
+        value["steps"] = Json::UInt64(statistics.steps);
+        value["late_acks"] = Json::UInt64(statistics.late_acks);
+        value["data_acks"] = Json::UInt64(statistics.data_acks);
+        value["last_slowest_slave"] = statistics.last_slowest_slave;
+        value["last_slowest_ack_us"] = Json::Int64(statistics.last_slowest_ack_us);
+        value["max_slowest_slave"] = statistics.max_slowest_slave;
+        value["max_slowest_ack_us"] = Json::Int64(statistics.max_slowest_ack_us);
+        return value;
+    }
 
 private:
     LocalClockService& _service;
@@ -290,9 +308,28 @@ fep::Result LocalClockService::create()
             FEP_CLOCKSERVICE_MAIN_CLOCK_SIM_TIME_CYCLE_TIME_DEFAULT_VALUE);
     }
 
+    res = getProperty(*property_tree, FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT);
+    if (res.empty())
+    {
+        // set default sync timeout
+        setProperty(*property_tree,
+            FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT,
+            FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT_DEFAULT_VALUE);
+    }
+
+    // set default keep late slaves
+    setPropertyIfNotExists(*property_tree,
+        FEP_CLOCKSERVICE_MASTER_SYNC_KEEP_LATE_SLAVES,
+        FEP_CLOCKSERVICE_MASTER_SYNC_KEEP_LATE_SLAVES_DEFAULT_VALUE);
+
+    // set default data channel
+    setPropertyIfNotExists(*property_tree,
+        FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL,
+        FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL_DEFAULT_VALUE);
+
     IRPC* rpc = _components->getComponent<IRPC>();
 
-    _clock_master.reset(new fep::detail::ClockMaster(*rpc));
+    _clock_master.reset(new fep::detail::ClockMaster(*rpc, _incident_handler));
     _clock_event_sink->registerSink(*_clock_master.get());
 
     if (_rpc_impl == nullptr)
@@ -327,11 +364,47 @@ fep::Result LocalClockService::initializing()
 {
     deinitializing();
 
+    IPropertyTree* property_tree = _components->getComponent<IPropertyTree>();
+    if (getProperty(*property_tree,
+                    FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL,
+                    FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL_DEFAULT_VALUE))
+    {
+        // the signals are created by the data registry in ready()
+        IDataRegistry* data_registry = _components->getComponent<IDataRegistry>();
+        if (data_registry == nullptr)
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND,
+                "%s is set, but there is no data registry",
+                FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL);
+        }
+        const std::string master_name = _components->getComponent<IRPC>()->GetLocalName();
+        const std::string tick_signal_name = getClockSyncTickSignalName(master_name);
+        const std::string ack_signal_name = getClockSyncAckSignalName(master_name);
+        RETURN_IF_FAILED(data_registry->registerDataOut(tick_signal_name.c_str(), StreamTypeRaw()));
+        RETURN_IF_FAILED(data_registry->registerDataIn(ack_signal_name.c_str(), StreamTypeRaw()));
+        RETURN_IF_FAILED(data_registry->registerDataReceiveListener(ack_signal_name.c_str(),
+                                                                    *_clock_master));
+        _clock_master->setDataChannel(
+            data_registry->getWriter(tick_signal_name.c_str(), 1, sizeof(ClockSyncTick)));
+        _ack_signal_name = ack_signal_name;
+    }
+
     return fep::Result();
 }
 
 fep::Result LocalClockService::deinitializing()
 {
+    // the signals stay registered, the data registry unregisters them in its deinitializing()
+    if (_components && !_ack_signal_name.empty())
+    {
+        IDataRegistry* data_registry = _components->getComponent<IDataRegistry>();
+        if (data_registry)
+        {
+            data_registry->unregisterDataReceiveListener(_ack_signal_name.c_str(), *_clock_master);
+        }
+        _clock_master->setDataChannel(nullptr);
+        _ack_signal_name.clear();
+    }
     return fep::Result();
 }
 
@@ -366,12 +439,27 @@ fep::Result LocalClockService::ready()
         _local_system_sim_clock.updateConfiguration(cycle_time, time_factor);
     }
 
+    int32_t sync_timeout =
+        getProperty(*property_tree,
+                    FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT,
+                    FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT_DEFAULT_VALUE);
+    if (sync_timeout <= 0)
+    {
+        sync_timeout = FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT_DEFAULT_VALUE;
+    }
+    _clock_master->setSyncTimeout(sync_timeout);
+    _clock_master->setKeepLateSlaves(
+        getProperty(*property_tree,
+                    FEP_CLOCKSERVICE_MASTER_SYNC_KEEP_LATE_SLAVES,
+                    FEP_CLOCKSERVICE_MASTER_SYNC_KEEP_LATE_SLAVES_DEFAULT_VALUE));
+
     return fep::Result();
 }
 
 fep::Result LocalClockService::start()
 {
     std::lock_guard<std::recursive_mutex> lock(_lock_list);
+    _clock_master->resetSyncStatistics();
     // make sure _current clock is always valid!!
     _current_clock->start(*_clock_event_sink.get());
     _is_started = true;
@@ -660,9 +748,11 @@ void LocalClockService::unregisterEventSink(IClock::IEventSink& clock_event_sink
     _clock_event_sink->unregisterSink(clock_event_sink);
 }
 
-fep::Result LocalClockService::masterRegisterSlave(const std::string& slave_name, int event_id_flag)
+fep::Result LocalClockService::masterRegisterSlave(const std::string& slave_name,
+                                                   int event_id_flag,
+                                                   int32_t& slave_id)
 {
-    return _clock_master->registerSlave(slave_name, event_id_flag);
+    return _clock_master->registerSlave(slave_name, event_id_flag, slave_id);
 }
 
 fep::Result LocalClockService::masterUnregisterSlave(const std::string& slave_name)
@@ -677,5 +767,10 @@ fep::Result LocalClockService::masterSlaveSyncedEvent(const std::string& slave_n
     return _clock_master->receiveSlaveSyncedEvent(slave_name, time);
 }
 
+ClockSyncStatistics LocalClockService::masterSyncStatistics() const
+{
+    return _clock_master->getSyncStatistics();
+}
+
 } // namespace detail
 } // namespace fep
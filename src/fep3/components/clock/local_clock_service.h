@@ -19,6 +19,7 @@
 #define __FEP_CLOCK_SERVICE_H
 
 #include <atomic>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -42,6 +43,7 @@ namespace detail
 
 class ClockEventSinkRegistry;
 class ClockMaster;
+struct ClockSyncStatistics;
 class RPCClockService;
 class RPCClockSyncMaster;
 
@@ -69,9 +71,10 @@ public:
     void unregisterEventSink(IClock::IEventSink& clock_event_sink) override;
 
 public: // for Sync Master support
-    fep::Result masterRegisterSlave(const std::string& slave_name, int event_id_flag);
+    fep::Result masterRegisterSlave(const std::string& slave_name, int event_id_flag, int32_t& slave_id);
     fep::Result masterUnregisterSlave(const std::string& slave_name);
     fep::Result masterSlaveSyncedEvent(const std::string& slave_name, timestamp_t time);
+    ClockSyncStatistics masterSyncStatistics() const;
     // getMasterTime and getMasterType is already implemented
 public:
     fep::Result create() override;
@@ -108,6 +111,8 @@ private:
     RPCClockSyncMaster* _rpc_impl_master;
     std::unique_ptr<ClockEventSinkRegistry> _clock_event_sink;
     std::unique_ptr<detail::ClockMaster> _clock_master;
+    // ack signal of the data channel, empty if switched off
+    std::string _ack_signal_name;
 };
 
 } // namespace detail
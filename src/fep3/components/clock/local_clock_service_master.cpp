@@ -19,17 +19,26 @@
  *
  */
 
+#include <chrono>
+#include <cstdint>
 #include <exception>
 #include <string>
 #include <utility>
+#include <vector>
 #include <a_util/result/result_type.h>
 #include <a_util/strings/strings_convert_decl.h>
 #include <a_util/strings/strings_format.h>
 
 //#include "fep_participant_sdk.h"
 #include "fep3/rpc_components/clock/clock_sync_slave_client.h"
+#include "fep3/components/data_registry/data_sample.h"
+#include "fep3/components/data_registry/raw_memory.h"
 #include "fep_errors.h"
+#include "incident_handler/fep_incident_handler_intf.h"
+#include "incident_handler/fep_severity_level.h"
+#include "clock_sync_data_channel.h"
 #include "local_clock_service_master.h"
+#include "perfmeasure/fep_trace.h"
 
 namespace fep
 {
@@ -41,8 +50,11 @@ namespace detail
 
 ClockSlave::ClockSlave(const std::string& name,
     IRPC& rpc,
-    int event_id_flag) : _active(false),
+    int event_id_flag,
+    int32_t slave_id) : _active(false),
                          _event_id_flag(event_id_flag),
+                         _slave_id(slave_id),
+                         _data_channel_confirmed(false),
                          fep::rpc_object_client<fep::rpc_stubs::RPCClockSyncSlaveClient,
                                                 rpc::IRPCClockSyncSlaveDef>(name.c_str(), rpc::IRPCClockSyncSlaveDef::DEFAULT_NAME, rpc)
 {
@@ -76,7 +88,39 @@ void ClockSlave::setEventIDFlag(int event_id_flag)
     _event_id_flag = event_id_flag;
 }
 
-ClockMaster::ClockMaster(IRPC& rpc) : _rpc(rpc)
+int32_t ClockSlave::getSlaveID() const
+{
+    return _slave_id;
+}
+
+bool ClockSlave::isDataChannelConfirmed() const
+{
+    return _data_channel_confirmed;
+}
+
+void ClockSlave::setDataChannelConfirmed(bool confirmed)
+{
+    _data_channel_confirmed = confirmed;
+}
+
+std::future<Json::Value> ClockSlave::syncTimeEventAsync(int event_id,
+                                                        const std::string& new_time,
+                                                        const std::string& old_time)
+{
+    Json::Value params;
+    params["event_id"] = event_id;
+    params["new_time"] = new_time;
+    params["old_time"] = old_time;
+    return callAsync("syncTimeEvent", params);
+}
+
+ClockMaster::ClockMaster(IRPC& rpc, IIncidentHandler& incident_handler)
+    : _rpc(rpc),
+      _incident_handler(incident_handler),
+      _next_slave_id(0),
+      _sync_timeout_ms(FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT_DEFAULT_VALUE),
+      _keep_late_slaves(FEP_CLOCKSERVICE_MASTER_SYNC_KEEP_LATE_SLAVES_DEFAULT_VALUE),
+      _tick_step(0)
 {
 }
 
@@ -85,19 +129,24 @@ ClockMaster::~ClockMaster()
 
 }
 
-fep::Result ClockMaster::registerSlave(const std::string& slave_name, int event_id_flag)
+fep::Result ClockMaster::registerSlave(const std::string& slave_name,
+                                       int event_id_flag,
+                                       int32_t& slave_id)
 {
     auto it = _slaves.find(slave_name);
     if (it != _slaves.end())
     {
         it->second->setEventIDFlag(event_id_flag);
+        it->second->setDataChannelConfirmed(false);
         it->second->activate();
+        slave_id = it->second->getSlaveID();
     }
     else
     {
         auto& ref = _slaves[slave_name];
-        ref.reset(new ClockSlave(slave_name, _rpc, event_id_flag));
+        ref.reset(new ClockSlave(slave_name, _rpc, event_id_flag, _next_slave_id++));
         ref->activate();
+        slave_id = ref->getSlaveID();
     }
     return fep::Result();
 }
@@ -118,96 +167,322 @@ fep::Result ClockMaster::receiveSlaveSyncedEvent(const std::string& slave_name,
     return fep::Result();
 }
 
-void ClockMaster::timeUpdateBegin(timestamp_t old_time, timestamp_t new_time)
+void ClockMaster::setSyncTimeout(int32_t timeout_ms)
 {
-    using namespace a_util::strings;
-    for (auto& slave : _slaves)
+    _sync_timeout_ms = timeout_ms;
+}
+
+void ClockMaster::setKeepLateSlaves(bool keep_late_slaves)
+{
+    _keep_late_slaves = keep_late_slaves;
+}
+
+ClockSyncStatistics ClockMaster::getSyncStatistics() const
+{
+    std::lock_guard<std::mutex> lock(_statistics_lock);
+    return _statistics;
+}
+
+void ClockMaster::resetSyncStatistics()
+{
+    std::lock_guard<std::mutex> lock(_statistics_lock);
+    _statistics = ClockSyncStatistics();
+}
+
+void ClockMaster::setDataChannel(std::unique_ptr<IDataRegistry::IDataWriter> tick_writer)
+{
+    _tick_writer = std::move(tick_writer);
+}
+
+bool ClockMaster::sendTick(uint32_t step,
+                           rpc::IRPCClockSyncMasterDef::EventID event_id,
+                           timestamp_t new_time,
+                           timestamp_t old_time)
+{
+    ClockSyncTick tick{step, static_cast<int32_t>(event_id), new_time, old_time};
+    convertClockSyncTickToNetworkByteorder(tick);
+    size_t tick_size = sizeof(tick);
+    DataSampleRawMemoryRef sample(new_time, &tick, tick_size);
+    return fep::isOk(_tick_writer->write(sample)) && fep::isOk(_tick_writer->flush());
+}
+
+bool ClockMaster::findDataAckUnlocked(int32_t slave_id,
+                                      std::chrono::steady_clock::time_point& ack_time) const
+{
+    for (const auto& data_ack : _data_acks)
     {
-        try
+        if (data_ack.first == slave_id)
         {
-            if (slave.second->isSet(rpc::IRPCClockSyncMasterDef::register_for_timeUpdateBefore))
-            {
-                toInt64(
-                            slave.second->syncTimeEvent(
-                                rpc::IRPCClockSyncMasterDef::timeUpdateBefore,
-                                toString(new_time),
-                                toString(old_time)));
-            }
+            ack_time = data_ack.second;
+            return true;
         }
-        catch(std::exception&)
+    }
+    return false;
+}
+
+void ClockMaster::onReceive(const data_read_ptr<const IStreamType>& type)
+{
+    //ignore
+}
+
+void ClockMaster::onReceive(const data_read_ptr<const IDataRegistry::IDataSample>& sample)
+{
+    ClockSyncAck ack;
+    RawMemoryStandardType<ClockSyncAck> ack_memory(ack);
+    if (sample->read(ack_memory) != sizeof(ack))
+    {
+        return;
+    }
+    const auto receive_time = std::chrono::steady_clock::now();
+    convertClockSyncAckToHostByteorder(ack);
+    {
+        std::lock_guard<std::mutex> lock(_data_ack_lock);
+        // acks of earlier ticks come from slaves which were late already
+        if (ack.step != _tick_step)
         {
-            slave.second->deactivate();
+            return;
         }
+        _data_acks.emplace_back(ack.slave_id, receive_time);
     }
+    _data_ack_received.notify_one();
 }
 
-void ClockMaster::timeUpdating(timestamp_t new_time)
+void ClockMaster::syncTimeEvent(rpc::IRPCClockSyncMasterDef::EventIDFlag flag,
+                                rpc::IRPCClockSyncMasterDef::EventID event_id,
+                                timestamp_t new_time,
+                                timestamp_t old_time)
 {
     using namespace a_util::strings;
+    FEP_TRACE_SPAN("syncTimeEvent", "clock");
+
+    struct PendingAck
+    {
+        const std::string& slave_name;
+        std::shared_ptr<ClockSlave> slave;
+        /// the ack is awaited on the data channel, otherwise by RPC
+        bool by_data;
+        std::future<Json::Value> ack;
+    };
+    std::vector<PendingAck> pending_acks;
+    pending_acks.reserve(_slaves.size());
+
+    const auto start = std::chrono::steady_clock::now();
+    const bool data_channel = static_cast<bool>(_tick_writer);
+    bool send_tick = false;
     for (auto& slave : _slaves)
     {
-        try
+        // a deactivated slave gets no events until it registers again
+        if (slave.second->isActive() && slave.second->isSet(flag))
+        {
+            const bool by_data =
+                data_channel && slave.second->isSet(rpc::IRPCClockSyncMasterDef::register_for_data_channel);
+            send_tick |= by_data;
+            pending_acks.push_back(PendingAck{
+                slave.first,
+                slave.second,
+                by_data && slave.second->isDataChannelConfirmed(),
+                std::future<Json::Value>()});
+        }
+    }
+    if (pending_acks.empty())
+    {
+        return;
+    }
+
+    // one tick for all slaves on the data channel, it is sent before the RPC requests
+    // because the slaves on the data channel do not wait for anything else
+    uint32_t tick_step = 0;
+    if (send_tick)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_data_ack_lock);
+            tick_step = ++_tick_step;
+            _data_acks.clear();
+        }
+        if (!sendTick(tick_step, event_id, new_time, old_time))
         {
-            if (slave.second->isSet(rpc::IRPCClockSyncMasterDef::register_for_timeUpdating))
+            for (auto& pending_ack : pending_acks)
             {
-                toInt64(
-                    slave.second->syncTimeEvent(
-                        rpc::IRPCClockSyncMasterDef::timeUpdating,
-                        toString(new_time),
-                        toString(0)));
+                pending_ack.by_data = false;
+                pending_ack.slave->setDataChannelConfirmed(false);
             }
         }
-        catch(std::exception&)
+    }
+
+    // send the event to all slaves first, so the step lasts as long as the slowest slave
+    // and not as long as all slaves together
+    for (auto& pending_ack : pending_acks)
+    {
+        if (!pending_ack.by_data)
         {
-            slave.second->deactivate();
+            try
+            {
+                pending_ack.ack = pending_ack.slave->syncTimeEventAsync(
+                    event_id, toString(new_time), toString(old_time));
+            }
+            catch (std::exception&)
+            {
+                pending_ack.slave->deactivate();
+            }
         }
     }
-}
 
-void ClockMaster::timeUpdateEnd(timestamp_t new_time)
-{
-    using namespace a_util::strings;
-    for (auto& slave : _slaves)
+    const auto deadline = start + std::chrono::milliseconds(_sync_timeout_ms.load());
+    std::string slowest_slave;
+    auto slowest_ack = std::chrono::steady_clock::duration::zero();
+    bool slowest_ack_known = false;
+    uint64_t late_acks = 0;
+    uint64_t data_acks = 0;
+    for (auto& pending_ack : pending_acks)
     {
-        try
+        bool was_ready = false;
+        bool acknowledged = false;
+        auto ack_time = std::chrono::steady_clock::time_point();
+        if (pending_ack.by_data)
         {
-            if (slave.second->isSet(rpc::IRPCClockSyncMasterDef::register_for_timeUpdateAfter))
+            const int32_t slave_id = pending_ack.slave->getSlaveID();
+            std::unique_lock<std::mutex> lock(_data_ack_lock);
+            was_ready = findDataAckUnlocked(slave_id, ack_time);
+            acknowledged = was_ready || _data_ack_received.wait_until(lock, deadline, [&]
             {
-                toInt64(
-                    slave.second->syncTimeEvent(
-                        rpc::IRPCClockSyncMasterDef::timeUpdateAfter,
-                        toString(new_time),
-                        toString(0)));
-            }
+                return findDataAckUnlocked(slave_id, ack_time);
+            });
         }
-        catch(std::exception& )
+        else if (pending_ack.ack.valid())
         {
-            slave.second->deactivate();
+            was_ready =
+                std::future_status::ready == pending_ack.ack.wait_for(std::chrono::seconds(0));
+            acknowledged =
+                was_ready || std::future_status::ready == pending_ack.ack.wait_until(deadline);
+            ack_time = std::chrono::steady_clock::now();
+        }
+        else
+        {
+            // sending failed, the slave is deactivated
+            continue;
         }
-    }
-}
 
-void ClockMaster::timeResetBegin(timestamp_t old_time, timestamp_t new_time)
-{
-    using namespace a_util::strings;
-    for (auto& slave : _slaves)
-    {
-        try
+        if (!acknowledged)
+        {
+            // a future is dropped, its request ends with the RPC timeout
+            const bool keep_slave = _keep_late_slaves;
+            if (keep_slave)
+            {
+                // a slave on the data channel gets the next events by RPC too until it acknowledges again
+                pending_ack.slave->setDataChannelConfirmed(false);
+            }
+            else
+            {
+                pending_ack.slave->deactivate();
+            }
+            if (0 == late_acks++)
+            {
+                slowest_slave = pending_ack.slave_name;
+                slowest_ack = std::chrono::steady_clock::now() - start;
+                slowest_ack_known = true;
+            }
+            fep::Result result(ERR_TIMEOUT,
+                format("Clock sync slave %s did not acknowledge time event %d within %d ms%s.",
+                       pending_ack.slave_name.c_str(),
+                       static_cast<int>(event_id),
+                       static_cast<int>(_sync_timeout_ms.load()),
+                       keep_slave ? "" : ", it is deactivated").c_str(),
+                __LINE__, __FILE__, "syncTimeEvent");
+            _incident_handler.InvokeIncident(static_cast<int16_t>(result.getErrorCode()),
+                fep::SL_Warning, result.getDescription(), "ClockMaster", __LINE__, __FILE__);
+            continue;
+        }
+        if (pending_ack.by_data)
+        {
+            ++data_acks;
+        }
+        else
         {
-            if (slave.second->isSet(rpc::IRPCClockSyncMasterDef::register_for_timeReset))
+            try
+            {
+                toInt64(pending_ack.ack.get().asString());
+            }
+            catch (std::exception&)
+            {
+                pending_ack.slave->deactivate();
+                continue;
+            }
+            if (send_tick
+                && pending_ack.slave->isSet(rpc::IRPCClockSyncMasterDef::register_for_data_channel))
             {
-                toInt64(
-                    slave.second->syncTimeEvent(
-                        rpc::IRPCClockSyncMasterDef::timeReset,
-                        toString(new_time),
-                        toString(old_time)));
+                // the slave got the tick too, it is on the data channel from now on
+                std::lock_guard<std::mutex> lock(_data_ack_lock);
+                auto data_ack_time = std::chrono::steady_clock::time_point();
+                pending_ack.slave->setDataChannelConfirmed(
+                    findDataAckUnlocked(pending_ack.slave->getSlaveID(), data_ack_time));
             }
         }
-        catch(std::exception& )
+        // the ack time is known for acks on the data channel and for RPC acks that had to be
+        // waited for, as the RPC acks are awaited in order the last one of them is the slowest
+        // RPC slave. An RPC ack which was ready already only counts if no other ack is known.
+        const bool ack_time_known = pending_ack.by_data || !was_ready;
+        const auto ack_duration = ack_time - start;
+        if (0 == late_acks
+            && (slowest_slave.empty()
+                || (ack_time_known && (!slowest_ack_known || ack_duration > slowest_ack))))
         {
-            slave.second->deactivate();
+            slowest_slave = pending_ack.slave_name;
+            slowest_ack = ack_duration;
+            slowest_ack_known = ack_time_known;
         }
     }
+
+    if (slowest_slave.empty())
+    {
+        return;
+    }
+    const int64_t slowest_ack_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(slowest_ack).count();
+    FEP_TRACE_INSTANT_VALUE("SlowestSlaveAck", "clock", slowest_ack_us);
+
+    std::lock_guard<std::mutex> lock(_statistics_lock);
+    ++_statistics.steps;
+    _statistics.late_acks += late_acks;
+    _statistics.data_acks += data_acks;
+    _statistics.last_slowest_slave = slowest_slave;
+    _statistics.last_slowest_ack_us = slowest_ack_us;
+    if (_statistics.max_slowest_slave.empty() || slowest_ack_us > _statistics.max_slowest_ack_us)
+    {
+        _statistics.max_slowest_slave = slowest_slave;
+        _statistics.max_slowest_ack_us = slowest_ack_us;
+    }
+}
+
+void ClockMaster::timeUpdateBegin(timestamp_t old_time, timestamp_t new_time)
+{
+    syncTimeEvent(rpc::IRPCClockSyncMasterDef::register_for_timeUpdateBefore,
+                  rpc::IRPCClockSyncMasterDef::timeUpdateBefore,
+                  new_time,
+                  old_time);
+}
+
+void ClockMaster::timeUpdating(timestamp_t new_time)
+{
+    syncTimeEvent(rpc::IRPCClockSyncMasterDef::register_for_timeUpdating,
+                  rpc::IRPCClockSyncMasterDef::timeUpdating,
+                  new_time,
+                  0);
+}
+
+void ClockMaster::timeUpdateEnd(timestamp_t new_time)
+{
+    syncTimeEvent(rpc::IRPCClockSyncMasterDef::register_for_timeUpdateAfter,
+                  rpc::IRPCClockSyncMasterDef::timeUpdateAfter,
+                  new_time,
+                  0);
+}
+
+void ClockMaster::timeResetBegin(timestamp_t old_time, timestamp_t new_time)
+{
+    syncTimeEvent(rpc::IRPCClockSyncMasterDef::register_for_timeReset,
+                  rpc::IRPCClockSyncMasterDef::timeReset,
+                  new_time,
+                  old_time);
 }
 
 void ClockMaster::timeResetEnd(timestamp_t new_time)
@@ -18,9 +18,17 @@
 #ifndef __FEP_CLOCK_SERVICE_MASTER_H
 #define __FEP_CLOCK_SERVICE_MASTER_H
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 #include <a_util/base/types.h>
 
 #include "fep_result_decl.h"
@@ -28,10 +36,12 @@
 #include "fep3/rpc_components/clock/clock_service_rpc_intf_def.h"
 #include "fep3/components/rpc/fep_rpc_stubs.h"
 #include "fep3/components/clock/clock_service_intf.h"
+#include "fep3/components/data_registry/data_registry_intf.h"
 
 namespace fep
 {
 
+class IIncidentHandler;
 class IRPC;
 
 namespace detail
@@ -40,7 +50,7 @@ class ClockSlave
     : public fep::rpc_object_client<fep::rpc_stubs::RPCClockSyncSlaveClient, rpc::IRPCClockSyncSlaveDef>
 {
 public:
-    ClockSlave(const std::string& name, IRPC& rpc, int event_id_flag);
+    ClockSlave(const std::string& name, IRPC& rpc, int event_id_flag, int32_t slave_id);
     ~ClockSlave();
 
     void activate();
@@ -49,23 +59,93 @@ public:
 
     bool isSet(rpc::IRPCClockSyncMasterDef::EventIDFlag flag);
     void setEventIDFlag(int event_id_flag);
+    int32_t getSlaveID() const;
+
+    /**
+     * @brief Whether an ack of the slave was received on the data channel.
+     * Until then the time events are sent by RPC additionally, the tick may get lost while
+     * the data channel of a new slave is not connected yet.
+     */
+    bool isDataChannelConfirmed() const;
+    void setDataChannelConfirmed(bool confirmed);
+
+    /**
+     * @brief Sends a time event without waiting for the acknowledgement of the slave.
+     * @return The future acknowledgement (the time of the slave),
+     *         get() throws like RPCClockSyncSlaveClient::syncTimeEvent
+     */
+    std::future<Json::Value> syncTimeEventAsync(int event_id,
+                                                const std::string& new_time,
+                                                const std::string& old_time);
 
 private:
     bool _active;
     int _event_id_flag;
+    int32_t _slave_id;
+    bool _data_channel_confirmed;
 };
 
-class ClockMaster : public IClock::IEventSink
+/**
+ * @brief Acknowledgement times of the clock sync slaves collected by the ClockMaster.
+ * A step is one time event awaited from at least one slave.
+ */
+struct ClockSyncStatistics
+{
+    /// Number of steps
+    uint64_t steps = 0;
+    /// Number of acknowledgements not received within the sync timeout
+    uint64_t late_acks = 0;
+    /// Number of acknowledgements received on the data channel
+    uint64_t data_acks = 0;
+    /// Slowest slave of the last step
+    std::string last_slowest_slave;
+    /// Time until the slowest slave of the last step acknowledged in us
+    int64_t last_slowest_ack_us = 0;
+    /// Slowest slave of all steps
+    std::string max_slowest_slave;
+    /// Time until the slowest slave of all steps acknowledged in us
+    int64_t max_slowest_ack_us = 0;
+};
+
+/**
+ * @brief Distributes the time events of the main clock to the registered clock sync slaves.
+ * Each event is sent to all slaves at once, then the master waits until all of them
+ * acknowledged it or the sync timeout expired. A slave not acknowledging within the sync
+ * timeout is reported by an incident and deactivated, unless late slaves are kept
+ * (see @ref setKeepLateSlaves). A slave failing to receive the event is deactivated.
+ * If a data channel is set, slaves registered with register_for_data_channel get the event
+ * as one ClockSyncTick sample and acknowledge it by ClockSyncAck sample, all other slaves by RPC.
+ */
+class ClockMaster : public IClock::IEventSink, public IDataRegistry::IDataReceiveListener
 {
 public:
-    explicit ClockMaster(IRPC& rpc);
+    ClockMaster(IRPC& rpc, IIncidentHandler& incident_handler);
     virtual ~ClockMaster();
 
 public:
-    fep::Result registerSlave(const std::string& slave_name, int event_id_flag);
+    fep::Result registerSlave(const std::string& slave_name, int event_id_flag, int32_t& slave_id);
     fep::Result unregisterSlave(const std::string& slave_name);
     fep::Result receiveSlaveSyncedEvent(const std::string& slave_name, timestamp_t time);
 
+    /**
+     * @brief Sets the time to wait for the acknowledgements of a time event.
+     * @param timeout_ms the timeout in ms, see @ref FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT
+     */
+    void setSyncTimeout(int32_t timeout_ms);
+    /**
+     * @brief Sets whether slaves not acknowledging within the sync timeout are kept.
+     * @param keep_late_slaves true to keep them, see @ref FEP_CLOCKSERVICE_MASTER_SYNC_KEEP_LATE_SLAVES
+     */
+    void setKeepLateSlaves(bool keep_late_slaves);
+    ClockSyncStatistics getSyncStatistics() const;
+    void resetSyncStatistics();
+
+    /**
+     * @brief Sets the writer of the tick signal, the acks are passed to @ref onReceive.
+     * @param tick_writer the writer or nullptr to send all time events by RPC
+     */
+    void setDataChannel(std::unique_ptr<IDataRegistry::IDataWriter> tick_writer);
+
 public:
     void timeUpdateBegin(timestamp_t old_time, timestamp_t new_time);
     void timeUpdating(timestamp_t new_time);
@@ -73,9 +153,40 @@ public:
     void timeResetBegin(timestamp_t old_time, timestamp_t new_time);
     void timeResetEnd(timestamp_t new_time);
 
+public:
+    void onReceive(const data_read_ptr<const IStreamType>& type) override;
+    void onReceive(const data_read_ptr<const IDataRegistry::IDataSample>& sample) override;
+
+private:
+    void syncTimeEvent(rpc::IRPCClockSyncMasterDef::EventIDFlag flag,
+                       rpc::IRPCClockSyncMasterDef::EventID event_id,
+                       timestamp_t new_time,
+                       timestamp_t old_time);
+    bool sendTick(uint32_t step,
+                  rpc::IRPCClockSyncMasterDef::EventID event_id,
+                  timestamp_t new_time,
+                  timestamp_t old_time);
+    bool findDataAckUnlocked(int32_t slave_id,
+                             std::chrono::steady_clock::time_point& ack_time) const;
+
 private:
     IRPC& _rpc;
+    IIncidentHandler& _incident_handler;
     std::map<std::string, std::shared_ptr<ClockSlave>> _slaves;
+    int32_t _next_slave_id;
+    std::atomic<int32_t> _sync_timeout_ms;
+    std::atomic<bool> _keep_late_slaves;
+
+    std::unique_ptr<IDataRegistry::IDataWriter> _tick_writer;
+    /// guards _tick_step and _data_acks, the acks are received by the transmission thread
+    std::mutex _data_ack_lock;
+    std::condition_variable _data_ack_received;
+    uint32_t _tick_step;
+    /// slave id and receive time of the acks of the current tick
+    std::vector<std::pair<int32_t, std::chrono::steady_clock::time_point>> _data_acks;
+
+    mutable std::mutex _statistics_lock;
+    ClockSyncStatistics _statistics;
 };
 
 } // namespace detail
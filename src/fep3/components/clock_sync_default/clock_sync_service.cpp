@@ -25,10 +25,13 @@
 #include <a_util/result/result_type.h>
 #include <a_util/result/error_def.h>
 
+#include "fep3/base/streamtype/default_streamtype.h"
 #include "fep3/components/base/component_intf.h"
 #include "fep3/components/clock/clock_base.h"
 #include "fep3/components/clock/clock_service_intf.h"
+#include "fep3/components/clock/clock_sync_data_channel.h"
 #include "fep3/components/clock_sync_default/clock_sync_service_intf.h"
+#include "fep3/components/data_registry/data_registry_intf.h"
 #include "fep3/components/legacy/property_tree/fep_component_config.h"
 #include "fep3/components/legacy/property_tree/fep_propertytree_intf.h"
 #include "fep3/components/rpc/fep_rpc_intf.h"
@@ -111,6 +114,28 @@ fep::Result ClockSynchronizationService::initializing()
         auto created = new MasterOnDemandClockDiscrete(cycle_time, master_name, *_components->getComponent<IRPC>(), false);
         _slave_clock.first.reset(created);
         _slave_clock.second = created;
+
+        if (getProperty(*property_tree,
+                        FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL,
+                        FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL_DEFAULT_VALUE))
+        {
+            // the signals are created by the data registry in ready()
+            IDataRegistry* data_registry = _components->getComponent<IDataRegistry>();
+            if (data_registry == nullptr)
+            {
+                RETURN_ERROR_DESCRIPTION(fep::ERR_NOT_FOUND,
+                    "%s is set, but there is no data registry",
+                    FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL);
+            }
+            const std::string tick_signal_name = getClockSyncTickSignalName(master_name);
+            const std::string ack_signal_name = getClockSyncAckSignalName(master_name);
+            RETURN_IF_FAILED(data_registry->registerDataIn(tick_signal_name.c_str(), StreamTypeRaw()));
+            RETURN_IF_FAILED(data_registry->registerDataOut(ack_signal_name.c_str(), StreamTypeRaw()));
+            RETURN_IF_FAILED(data_registry->registerDataReceiveListener(tick_signal_name.c_str(), *created));
+            created->setDataChannel(
+                data_registry->getWriter(ack_signal_name.c_str(), 1, sizeof(ClockSyncAck)));
+            _tick_signal_name = tick_signal_name;
+        }
     }
     if (_slave_clock.first)
     {
@@ -124,6 +149,17 @@ fep::Result ClockSynchronizationService::deinitializing()
     if (_components)
     {
         IClockService* clock_service = _components->getComponent<IClockService>();
+        if (!_tick_signal_name.empty())
+        {
+            // the signals stay registered, the data registry unregisters them in its deinitializing()
+            IDataRegistry* data_registry = _components->getComponent<IDataRegistry>();
+            if (data_registry && _slave_clock.second)
+            {
+                data_registry->unregisterDataReceiveListener(_tick_signal_name.c_str(),
+                                                             *_slave_clock.second);
+            }
+            _tick_signal_name.clear();
+        }
         if (_slave_clock.first)
         {
             clock_service->unregisterClock(_slave_clock.first->getName());
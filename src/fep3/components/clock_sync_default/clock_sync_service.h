@@ -19,6 +19,7 @@
 #define __FEP_CLOCK_SYNC_SERVICE_H
 
 #include <memory>
+#include <string>
 #include <utility>
 #include "fep_result_decl.h"
 #include "fep3/components/base/component_base.h"
@@ -52,6 +53,8 @@ class ClockSynchronizationService : public IClockSyncService,
     private:
         //configured clock synchronizer
         std::pair<std::unique_ptr<ClockBase>, FarClockUpdater*> _slave_clock;
+        // tick signal of the data channel, empty if switched off
+        std::string _tick_signal_name;
 };
 
 }
@@ -29,6 +29,8 @@
 #include "fep3/components/clock/clock_service_intf.h"   // IWYU pragma: keep
 #include "fep3/components/clock_sync_default/interpolation_time.h"
 #include "fep3/components/clock_sync_default/clock_sync_service_intf.h"
+#include "fep3/components/data_registry/data_sample.h"
+#include "fep3/components/data_registry/raw_memory.h"
 #include "fep3/components/rpc/fep_rpc_intf.h"
 #include "master_on_demand_clock_client.h"
 
@@ -59,6 +61,39 @@ int getEventIDFlags(bool beforeAndAfterEvent)
     }
 }
 
+static int getEventIDFlag(int event_id)
+{
+    switch (event_id)
+    {
+    case fep::rpc::IRPCClockSyncMasterDef::timeUpdateBefore:
+        return fep::rpc::IRPCClockSyncMasterDef::register_for_timeUpdateBefore;
+    case fep::rpc::IRPCClockSyncMasterDef::timeUpdating:
+        return fep::rpc::IRPCClockSyncMasterDef::register_for_timeUpdating;
+    case fep::rpc::IRPCClockSyncMasterDef::timeUpdateAfter:
+        return fep::rpc::IRPCClockSyncMasterDef::register_for_timeUpdateAfter;
+    case fep::rpc::IRPCClockSyncMasterDef::timeReset:
+        return fep::rpc::IRPCClockSyncMasterDef::register_for_timeReset;
+    default:
+        return 0;
+    }
+}
+
+/// Position of the event within one time update, a reset starts a new sequence
+static int getEventOrder(rpc::IRPCClockSyncMasterDef::EventID event_id)
+{
+    switch (event_id)
+    {
+    case fep::rpc::IRPCClockSyncMasterDef::timeUpdateBefore:
+        return 1;
+    case fep::rpc::IRPCClockSyncMasterDef::timeUpdating:
+        return 2;
+    case fep::rpc::IRPCClockSyncMasterDef::timeUpdateAfter:
+        return 3;
+    default:
+        return 0;
+    }
+}
+
 FarClockUpdater::FarClockUpdater(int32_t on_demand_step_size,
                                  const std::string& master,
                                  IRPC& rpc,
@@ -72,13 +107,160 @@ FarClockUpdater::FarClockUpdater(int32_t on_demand_step_size,
       _on_demand_step_size(on_demand_step_size),
       _next_request_gettime(-1),
       _rpc(rpc),
-      _master_type(-1)
+      _master_type(-1),
+      _slave_id(-1),
+      _stop_ticks(true),
+      _newest_event_time(0),
+      _newest_event_order(-1),
+      _reset_handled(false),
+      _last_reset_new_time(0),
+      _last_reset_old_time(0),
+      _last_event_time(0)
 {
 }
 
 FarClockUpdater::~FarClockUpdater()
 {
     stopWorkingIfStarted();
+    stopTickWorker();
+}
+
+void FarClockUpdater::setDataChannel(std::unique_ptr<IDataRegistry::IDataWriter> ack_writer)
+{
+    _ack_writer = std::move(ack_writer);
+}
+
+void FarClockUpdater::startTickWorker()
+{
+    stopTickWorker();
+    {
+        std::lock_guard<std::mutex> locked(_lock_ticks);
+        _stop_ticks = false;
+        _ticks.clear();
+    }
+    _tick_worker.reset(new std::thread([this] { tickWork(); }));
+}
+
+void FarClockUpdater::stopTickWorker()
+{
+    {
+        std::lock_guard<std::mutex> locked(_lock_ticks);
+        _stop_ticks = true;
+    }
+    _tick_received.notify_one();
+    if (_tick_worker && _tick_worker->joinable())
+    {
+        _tick_worker->join();
+    }
+    _tick_worker.reset();
+}
+
+void FarClockUpdater::onReceive(const data_read_ptr<const IStreamType>& type)
+{
+    //ignore
+}
+
+void FarClockUpdater::onReceive(const data_read_ptr<const IDataRegistry::IDataSample>& sample)
+{
+    detail::ClockSyncTick tick;
+    RawMemoryStandardType<detail::ClockSyncTick> tick_memory(tick);
+    if (sample->read(tick_memory) != sizeof(tick))
+    {
+        return;
+    }
+    detail::convertClockSyncTickToHostByteorder(tick);
+    if ((getEventIDFlags(_beforeAndAfterEvent) & getEventIDFlag(tick.event_id)) == 0)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> locked(_lock_ticks);
+        if (_stop_ticks)
+        {
+            return;
+        }
+        _ticks.push_back(tick);
+    }
+    _tick_received.notify_one();
+}
+
+void FarClockUpdater::tickWork()
+{
+    // the time events are processed here and not within the transmission thread,
+    // so the jobs triggered by them do not delay the delivery of their input data
+    std::unique_lock<std::mutex> locked(_lock_ticks);
+    while (true)
+    {
+        _tick_received.wait(locked, [this] { return _stop_ticks || !_ticks.empty(); });
+        if (_stop_ticks)
+        {
+            return;
+        }
+        const detail::ClockSyncTick tick = _ticks.front();
+        _ticks.pop_front();
+        locked.unlock();
+
+        const timestamp_t time =
+            handleTimeEvent(static_cast<rpc::IRPCClockSyncMasterDef::EventID>(tick.event_id),
+                            tick.new_time,
+                            tick.old_time);
+        sendAck(tick.step, time);
+
+        locked.lock();
+    }
+}
+
+void FarClockUpdater::sendAck(uint32_t step, timestamp_t time)
+{
+    const int32_t slave_id = _slave_id;
+    if (slave_id < 0)
+    {
+        // not registered, the master does not wait for this ack
+        return;
+    }
+    detail::ClockSyncAck ack{slave_id, step, time};
+    detail::convertClockSyncAckToNetworkByteorder(ack);
+    size_t ack_size = sizeof(ack);
+    DataSampleRawMemoryRef ack_sample(time, &ack, ack_size);
+    if (fep::isOk(_ack_writer->write(ack_sample)))
+    {
+        _ack_writer->flush();
+    }
+}
+
+timestamp_t FarClockUpdater::handleTimeEvent(rpc::IRPCClockSyncMasterDef::EventID event_id,
+                                             timestamp_t new_time,
+                                             timestamp_t old_time)
+{
+    if (!_ack_writer)
+    {
+        return masterTimeEvent(event_id, new_time, old_time);
+    }
+    // until the master received an ack on the data channel it sends the time events by RPC
+    // too. The copy arriving second is only acknowledged, as is a tick overtaken by the RPC
+    // of a later event - handling it would turn the clock back.
+    std::lock_guard<std::mutex> locked(_lock_event);
+    const int order = getEventOrder(event_id);
+    if (rpc::IRPCClockSyncMasterDef::timeReset == event_id)
+    {
+        if (_reset_handled && _last_reset_new_time == new_time && _last_reset_old_time == old_time)
+        {
+            return _last_event_time;
+        }
+        _reset_handled = true;
+        _last_reset_new_time = new_time;
+        _last_reset_old_time = old_time;
+    }
+    else if (_newest_event_order >= 0
+             && (new_time < _newest_event_time
+                 || (new_time == _newest_event_time && order <= _newest_event_order)))
+    {
+        return _last_event_time;
+    }
+    _last_event_time = masterTimeEvent(event_id, new_time, old_time);
+    _newest_event_time = new_time;
+    _newest_event_order = order;
+    return _last_event_time;
 }
 
 void FarClockUpdater::registerToRPC()
@@ -142,8 +324,12 @@ void FarClockUpdater::registerToMaster()
 
     try
     {
-        _far_clock_master.registerSyncSlave(getEventIDFlags(_beforeAndAfterEvent),
-                                            _rpc.GetLocalName());
+        int event_id_flags = getEventIDFlags(_beforeAndAfterEvent);
+        if (_ack_writer)
+        {
+            event_id_flags |= fep::rpc::IRPCClockSyncMasterDef::register_for_data_channel;
+        }
+        _slave_id = _far_clock_master.registerSyncSlave(event_id_flags, _rpc.GetLocalName());
     }
     catch (std::exception&)
     {
@@ -168,9 +354,9 @@ std::string FarClockUpdater::syncTimeEvent(int event_id,
                                            const std::string& new_time,
                                            const std::string& old_time)
 {
-    timestamp_t time = masterTimeEvent(static_cast<rpc::IRPCClockSyncMasterDef::EventID>(event_id),
-                                        a_util::strings::toInt64(new_time),
-                                        a_util::strings::toInt64(old_time));
+    timestamp_t time = handleTimeEvent(static_cast<rpc::IRPCClockSyncMasterDef::EventID>(event_id),
+                                       a_util::strings::toInt64(new_time),
+                                       a_util::strings::toInt64(old_time));
     return a_util::strings::toString(time);
 }
 
@@ -182,6 +368,15 @@ bool FarClockUpdater::isClientRegistered()
 void FarClockUpdater::startRPC()
 {
     registerToRPC();
+    if (_ack_writer)
+    {
+        {
+            std::lock_guard<std::mutex> locked(_lock_event);
+            _newest_event_order = -1;
+            _reset_handled = false;
+        }
+        startTickWorker();
+    }
     registerToMaster();
     if (_master_type != IClock::discrete)
     {
@@ -193,6 +388,7 @@ void FarClockUpdater::stopRPC()
 {
     stopWorkingIfStarted();
     unregisterFromMaster();
+    stopTickWorker();
     unregisterFromRPC();
 }
 
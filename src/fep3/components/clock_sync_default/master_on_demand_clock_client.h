@@ -20,6 +20,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <condition_variable>
@@ -30,6 +31,8 @@
 
 #include "fep_result_decl.h"
 #include "fep3/components/clock/clock_base.h"
+#include "fep3/components/clock/clock_sync_data_channel.h"
+#include "fep3/components/data_registry/data_registry_intf.h"
 #include "fep3/rpc_components/clock/clock_service_rpc_intf_def.h"
 #include "fep3/rpc_components/clock/clock_sync_master_client.h" // IWYU pragma: keep
 #include "fep3/rpc_components/clock/clock_sync_slave.h"
@@ -43,7 +46,8 @@ class IRPC;
 
 //@TODO : these clocks must be an component !!
 
-class FarClockUpdater : public rpc_object_server<rpc_stubs::RPCClockSyncSlave, rpc::IRPCClockSyncSlaveDef>
+class FarClockUpdater : public rpc_object_server<rpc_stubs::RPCClockSyncSlave, rpc::IRPCClockSyncSlaveDef>,
+                        public IDataRegistry::IDataReceiveListener
 {
 protected:
     explicit FarClockUpdater(int32_t on_demand_step_size,
@@ -56,6 +60,16 @@ public:
     void startRPC();
     void stopRPC();
 
+    /**
+     * @brief Receives the time events on the data channel of the master as well.
+     * The ticks passed to @ref onReceive are processed by a worker thread, which acknowledges
+     * them on the ack signal. Must be set before @ref startRPC.
+     * @param ack_writer the writer of the ack signal or nullptr to receive the time events by RPC only
+     */
+    void setDataChannel(std::unique_ptr<IDataRegistry::IDataWriter> ack_writer);
+    void onReceive(const data_read_ptr<const IStreamType>& type) override;
+    void onReceive(const data_read_ptr<const IDataRegistry::IDataSample>& sample) override;
+
 protected:
     virtual void updateTime(timestamp_t new_time, timestamp_t round_trip_time) {};
     virtual timestamp_t masterTimeEvent(rpc::IRPCClockSyncMasterDef::EventID event_id,
@@ -77,6 +91,13 @@ private:
     std::string syncTimeEvent(int event_id,
                               const std::string& new_time,
                               const std::string& old_time) override;
+    timestamp_t handleTimeEvent(rpc::IRPCClockSyncMasterDef::EventID event_id,
+                                timestamp_t new_time,
+                                timestamp_t old_time);
+    void startTickWorker();
+    void stopTickWorker();
+    void tickWork();
+    void sendAck(uint32_t step, timestamp_t time);
 
 private:
     fep::rpc_object_client<rpc_stubs::RPCClockSyncMasterClient, rpc::IRPCClockSyncMasterDef>
@@ -91,6 +112,26 @@ private:
     int32_t _on_demand_step_size;
     int32_t _next_request_gettime;
     IRPC& _rpc;
+
+    std::unique_ptr<IDataRegistry::IDataWriter> _ack_writer;
+    /// id returned by the master on registration, sent within the acks
+    std::atomic<int32_t> _slave_id;
+    /// guards _ticks and _stop_ticks, the ticks are received by the transmission thread
+    std::mutex _lock_ticks;
+    std::condition_variable _tick_received;
+    std::deque<detail::ClockSyncTick> _ticks;
+    bool _stop_ticks;
+    std::unique_ptr<std::thread> _tick_worker;
+    /// serializes the time events received by RPC and on the data channel
+    std::mutex _lock_event;
+    /// new time and position within its time update of the newest handled event (-1: none)
+    timestamp_t _newest_event_time;
+    int _newest_event_order;
+    /// the last handled reset, its copy may arrive after the following updates
+    bool _reset_handled;
+    timestamp_t _last_reset_new_time;
+    timestamp_t _last_reset_old_time;
+    timestamp_t _last_event_time;
 };
 
 class MasterOnDemandClockInterpolating : public FarClockUpdater, public ContinuousClock
@@ -33,6 +33,7 @@
 #include "fep3/components/data_registry/data_registry_fep2/data_sample_pool_fep2.h"
 #include "fep3/components/data_registry/data_item_queue.h"
 #include "fep3/components/data_registry/dynamic_data_item_queue.h"
+#include "data_access/fep_data_access.h"
 #include "data_access/fep_user_data_access_intf.h"
 #include "fep3/components/clock/clock_service_intf.h"
 #include "fep3/components/data_registry/data_registry_fep2/data_sample_fep2.h"
@@ -105,6 +106,7 @@ namespace fep
             explicit DataWriterFEP2(size_t sample_pool_init_size, size_t pre_allocated_size = 0)
             : _pre_allocated_size(pre_allocated_size),
               _user_data_access(nullptr),
+              _user_data_access_private(nullptr),
               _clock_service(nullptr),
               _write_counter(0),
               _marked_for_deletion(false),
@@ -127,6 +129,8 @@ namespace fep
                 _write_counter = 0;
                 _reused_sample_pool->init(_sample_pool_init_size, _pre_allocated_size, user_data_access, signal_handle);
                 _user_data_access = &user_data_access;
+                // only the data access of the module can flush signal bundles
+                _user_data_access_private = dynamic_cast<IUserDataAccessPrivate*>(&user_data_access);
                 _clock_service = &clock_service;
                 _signal_handle = signal_handle;
 
@@ -138,6 +142,7 @@ namespace fep
                 _queue.clear();
                 _signal_handle = nullptr;
                 _user_data_access = nullptr;
+                _user_data_access_private = nullptr;
                 _reused_sample_pool->deinit();
                 return fep::Result();
             }
@@ -171,22 +176,24 @@ namespace fep
 
             virtual fep::Result flush()  override
             {
+                const bool transmitted = _queue.size() > 0;
                 while (_queue.size() > 0)
                 {
                     WrappedTransmitter transmitter(*_user_data_access);
                     _queue.pop(transmitter);
                 }
-                return fep::Result();
+                return flushSignalBundles(transmitted);
             }
 
             virtual fep::Result flushFEP22Compatible(int64_t cycle_time)  override
             {
+                const bool transmitted = _queue.size() > 0;
                 while (_queue.size() > 0)
                 {
                     WrappedTransmitterFEP22Compatible transmitter(*_user_data_access, cycle_time);
                     _queue.pop(transmitter);
                 }
-                return fep::Result();
+                return flushSignalBundles(transmitted);
             }
 
             void markForDeletion() override
@@ -199,10 +206,22 @@ namespace fep
                 return _marked_for_deletion;
             }
 
+        private:
+            /// a flushed sample has to be on the wire, even if it waits for the rest of its bundle
+            fep::Result flushSignalBundles(bool transmitted)
+            {
+                if (transmitted && _user_data_access_private)
+                {
+                    return _user_data_access_private->FlushSignalBundles();
+                }
+                return fep::Result();
+            }
+
         protected:
             std::shared_ptr<DataSampleFEP2Pool>   _reused_sample_pool;
             size_t                          _pre_allocated_size;
             IUserDataAccess*                _user_data_access;
+            IUserDataAccessPrivate*         _user_data_access_private;
             IClockService*                  _clock_service;
             uint32_t                        _write_counter;
             bool                            _marked_for_deletion;
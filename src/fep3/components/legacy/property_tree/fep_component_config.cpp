@@ -156,6 +156,28 @@ namespace fep
          const char*  const g_strTxAdapterPath_nNumberOfWorkerThreads = FEP_TX_ADAPTER_WORKERTHREADS_PATH;
         /// Number of worker threads for forwarding incoming data
          const char*  const g_strTxAdapterField_nNumberOfWorkerThreads = FEP_TX_ADAPTER_WORKERTHREADS_FIELD;
+        /// Comma separated list of CPUs the worker threads are pinned to [full path]
+         const char*  const g_strTxAdapterPath_strWorkerCpuAffinity = FEP_TX_ADAPTER_WORKER_CPU_AFFINITY_PATH;
+        /// Comma separated list of CPUs the worker threads are pinned to
+         const char*  const g_strTxAdapterField_strWorkerCpuAffinity = FEP_TX_ADAPTER_WORKER_CPU_AFFINITY_FIELD;
+        /// Switch to let idle worker threads poll instead of sleeping [full path]
+         const char*  const g_strTxAdapterPath_bWorkerBusyPolling = FEP_TX_ADAPTER_WORKER_BUSY_POLLING_PATH;
+        /// Switch to let idle worker threads poll instead of sleeping
+         const char*  const g_strTxAdapterField_bWorkerBusyPolling = FEP_TX_ADAPTER_WORKER_BUSY_POLLING_FIELD;
+        /// Period the transport statistics are mirrored into the property tree with [full path]
+         const char*  const g_strTxAdapterPath_nStatisticsMirrorPeriod = FEP_TX_ADAPTER_STATISTICS_MIRROR_PERIOD_PATH;
+        /// Period the transport statistics are mirrored into the property tree with
+         const char*  const g_strTxAdapterField_nStatisticsMirrorPeriod = FEP_TX_ADAPTER_STATISTICS_MIRROR_PERIOD_FIELD;
+        /// Node the transport statistics are mirrored to
+         const char*  const g_strTxAdapterPath_Statistics = FEP_TX_ADAPTER_STATISTICS_PATH;
+        /// Encoding of the sent messages ("json", "negotiated" or "binary") [full path]
+         const char*  const g_strTxAdapterPath_strMessageEncoding = FEP_TX_ADAPTER_MESSAGE_ENCODING_PATH;
+        /// Encoding of the sent messages ("json", "negotiated" or "binary")
+         const char*  const g_strTxAdapterField_strMessageEncoding = FEP_TX_ADAPTER_MESSAGE_ENCODING_FIELD;
+        /// Switch to send addressed messages to the inbox of the receiver [full path]
+         const char*  const g_strTxAdapterPath_bMessageInbox = FEP_TX_ADAPTER_MESSAGE_INBOX_PATH;
+        /// Switch to send addressed messages to the inbox of the receiver
+         const char*  const g_strTxAdapterField_bMessageInbox = FEP_TX_ADAPTER_MESSAGE_INBOX_FIELD;
 
          /* FEP RPC Client */
          /*------------------------------------------------------------------------------------------------------------*/
@@ -165,6 +187,10 @@ namespace fep
          const char*  const g_strRPCClient_RemoteTimeoutPath = FEP_RPC_CLIENT_REMOTE_TIMEOUT_PATH;
          /// Number of worker threads for forwarding incoming data
          const char*  const g_strRPCClient_RemoteTimeoutField = FEP_RPC_CLIENT_REMOTE_TIMEOUT_FIELD;
+         /// Switch to send requests to participants on the same host over a local socket [full path]
+         const char*  const g_strRPCClient_LocalTransportPath = FEP_RPC_CLIENT_LOCAL_TRANSPORT_PATH;
+         /// Switch to send requests to participants on the same host over a local socket
+         const char*  const g_strRPCClient_LocalTransportField = FEP_RPC_CLIENT_LOCAL_TRANSPORT_FIELD;
         
         /* FEP Signal Registry */
         /*------------------------------------------------------------------------------------------------------------*/
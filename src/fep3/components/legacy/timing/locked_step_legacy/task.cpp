@@ -220,6 +220,13 @@ void Task::ThreadFunc()
                 }*/
                 guard.unlock();
 
+                // bundled outputs have to be on the wire before the step is acknowledged
+                if (fep::isFailed(m_transmission_adapter_private->FlushSignalBundles()))
+                {
+                    INVOKE_INCIDENT(m_incident_handler, FSI_STEP_LISTENER_TRANSMIT_OUTPUTS_FAIL, SL_Warning,
+                        a_util::strings::format("%s: Transmission of bundled output signals failed.", m_name.c_str()).c_str());
+                }
+
                 if (fep::isOk(result))
                 {
                     DBG_ONLY(std::cerr << m_name << "/" << m_uuid << ": " << " Ack for " << m_current_simulation_time << std::endl);
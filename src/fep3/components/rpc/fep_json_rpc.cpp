@@ -21,7 +21,10 @@
  *
  */
 
+#include <exception>
 #include <string>
+#include <utility>
+#include <jsonrpccpp/client/rpcprotocolclient.h>
 #include <jsonrpccpp/common/errors.h>
 #include <jsonrpccpp/common/exception.h>
 #include <a_util/result/result_type.h>
@@ -106,6 +109,68 @@ void cJSONFEPClientConnector::SendRPCMessage(const std::string& message, std::st
 }
 
 
+/// Fulfills the promise of an asynchronous JSON-RPC call, deletes itself with the response
+class cJSONAsyncResponse : public fep::IRPCAsyncResponse
+{
+    public:
+        std::promise<Json::Value> m_oResult;
+
+        void OnResponse(fep::Result nResult, const char* strResponse) override
+        {
+            if (isFailed(nResult))
+            {
+                m_oResult.set_exception(std::make_exception_ptr(jsonrpc::JsonRpcException(
+                    jsonrpc::Errors::ERROR_CLIENT_CONNECTOR,
+                    a_util::strings::format("error while performing call ((%d) %s: %s)",
+                        nResult.getErrorCode(), nResult.getErrorLabel(), nResult.getDescription()).c_str())));
+            }
+            else
+            {
+                try
+                {
+                    Json::Value oResult;
+                    jsonrpc::RpcProtocolClient().HandleResponse(strResponse, oResult);
+                    m_oResult.set_value(std::move(oResult));
+                }
+                catch (...)
+                {
+                    m_oResult.set_exception(std::current_exception());
+                }
+            }
+            delete this;
+        }
+};
+
+std::future<Json::Value> sendJSONRPCRequestAsync(const tClientConnectorInitializerType& connection,
+    const std::string& method,
+    const Json::Value& params)
+{
+    cJSONAsyncResponse* pResponse = new cJSONAsyncResponse();
+    std::future<Json::Value> oResult = pResponse->m_oResult.get_future();
+
+    Result oRes = ERR_POINTER;
+    if (connection._rpc)
+    {
+        std::string strRequest;
+        jsonrpc::RpcProtocolClient().BuildRequest(method, params, strRequest, false);
+        oRes = connection._rpc->Connect(connection._server_name.c_str(),
+                                        connection._object_name.c_str());
+        if (isOk(oRes))
+        {
+            oRes = connection._rpc->SendRequestAsync(connection._server_name.c_str(),
+                                                     connection._object_name.c_str(),
+                                                     strRequest.c_str(),
+                                                     pResponse);
+        }
+    }
+    if (isFailed(oRes))
+    {
+        // not sent, the response is never called
+        pResponse->OnResponse(oRes, "");
+    }
+    return oResult;
+}
+
 } //ns detail
 
  
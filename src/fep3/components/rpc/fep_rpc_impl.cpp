@@ -23,18 +23,22 @@
 
 #include <atomic>
 #include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <a_util/result/result_type.h>
 #include <a_util/result/error_def.h>
 #include <a_util/strings/strings_functions.h>
-#include <a_util/system/system.h>
 #include "_common/fep_timestamp.h"
 #include "fep3/components/base/component_intf.h"
 #include "fep3/components/legacy/property_tree/fep_component_config.h"
 #include "fep3/components/legacy/property_tree/fep_propertytree_intf.h"
+#include "fep3/components/legacy/property_tree/property_intf.h"
 #include "fep3/components/rpc/fep_element_object_client.h"
 #include "fep3/components/rpc/fep_rpc_element_object.h"
 #include "fep3/components/rpc/fep_rpc_object_registry.h"
-#include "fep3/components/rpc/fep_rpc_server_connection.h"
+#include "fep3/components/rpc/fep_rpc_pending_requests.h"
 #include "fep3/components/clock/clock_service_intf.h"
 #include "fep_errors.h"
 #include "fep_rpc_impl.h"
@@ -42,6 +46,8 @@
 #include "messages/fep_command_rpc.h"
 #include "messages/fep_command_rpc_intf.h"
 #include "module/fep_module_intf.h"
+#include "perfmeasure/fep_trace.h"
+#include "transmission_adapter/fep_transmission.h"
 
 #ifdef GetMessage
 #undef GetMessage
@@ -58,8 +64,8 @@ namespace detail
 #else
         static std::atomic_uint_fast32_t ui32Value{0};
 #endif
-        ui32Value++;
-        return ui32Value;
+        // unique even if several requests are sent at the same time
+        return ++ui32Value;
     }
 }
 cRPC::cRPC(const IModule& module) :
@@ -68,8 +74,12 @@ cRPC::cRPC(const IModule& module) :
     m_pCommandAccess(nullptr),
     m_pClockService(nullptr),
     m_pPropertyTree(nullptr),
-    m_pRegistry(&m_oRegistry)
+    m_pRegistry(&m_oRegistry),
+    m_pMessageWorker(nullptr),
+    m_bLocalTransportStarted(false)
 {
+    m_nTimeoutMS = 5000;
+    m_bLocalTransport = false;
 }
 
 cRPC::~cRPC()
@@ -80,7 +90,8 @@ fep::Result cRPC::create()
 {
     return Initialize(*_module->GetCommandAccess(),
                       *_components->getComponent<IPropertyTree>(),
-                      _module->GetName());
+                      _module->GetName(),
+                      _module->GetDomainId());
 }
 
 fep::Result cRPC::destroy()
@@ -108,22 +119,53 @@ void* cRPC::getInterface(const char* iid)
 
 fep::Result cRPC::Initialize(ICommandAccess& oCommandAccess,
                       IPropertyTree& oPropertyTree,
-                      const std::string& strStartupName)
+                      const std::string& strStartupName,
+                      uint16_t nDomainId)
 {
     //default
     fep::setProperty(oPropertyTree, FEP_RPC_CLIENT_REMOTE_TIMEOUT_PATH, 5000);
+    fep::setProperty(oPropertyTree, FEP_RPC_CLIENT_LOCAL_TRANSPORT_PATH, false);
 
     m_strLocalName = strStartupName;
     m_oRegistry.RegisterObjectServer(rpc::IRPCElementInfo::DEFAULT_NAME, m_oElementObject);
     m_pCommandAccess = &oCommandAccess;
     m_pPropertyTree  = &oPropertyTree;
+    UpdateClientConfig();
+    m_pPropertyTree->RegisterListener(FEP_COMPONENT_CONFIG_RPC_CLIENT, this);
     m_pCommandAccess->RegisterCommandListener(this);
+
+    // not available on every platform, requests are received over the command channel anyway.
+    // The local requests are run by the thread calling the command listeners, so without
+    // that thread there is no local transport.
+    m_pMessageWorker = dynamic_cast<ITransmissionAdapterPrivate*>(&oCommandAccess);
+    m_bLocalTransportStarted = m_pMessageWorker
+        && fep::isOk(m_oLocalTransport.Start(nDomainId, strStartupName,
+        [this](const std::string& strServerObject, const std::string& strRequest, std::string& strResponse)
+        {
+            return HandleLocalRequest(strServerObject, strRequest, strResponse);
+        },
+        [this](uint32_t nRequestId, fep::Result nResult, const std::string& strResponse)
+        {
+            m_oPendingRequests.Complete(nRequestId, nResult, strResponse);
+        }));
     return fep::Result();
 }
 
 void cRPC::Shutdown()
 {
-    m_oServerConnections.StopAllConnections();
+    m_oPendingRequests.CancelAll();
+    m_oLocalTransport.Stop();
+    m_bLocalTransportStarted = false;
+    m_pMessageWorker = nullptr;
+    {
+        std::lock_guard<std::mutex> oLock(m_oConnectionsMutex);
+        m_setConnections.clear();
+    }
+    if (m_pPropertyTree)
+    {
+        m_pPropertyTree->UnregisterListener(FEP_COMPONENT_CONFIG_RPC_CLIENT, this);
+        m_pPropertyTree = nullptr;
+    }
     if (m_pCommandAccess)
     {
         m_pCommandAccess->UnregisterCommandListener(this);
@@ -141,6 +183,10 @@ void cRPC::setClockService(IClockService* pClockService)
 void cRPC::setLocalName(const std::string& strName)
 {
     m_strLocalName = strName;
+    if (m_bLocalTransportStarted)
+    {
+        m_bLocalTransportStarted = fep::isOk(m_oLocalTransport.Rename(strName));
+    }
 }
 
 std::string cRPC::GetLocalName() const
@@ -148,45 +194,10 @@ std::string cRPC::GetLocalName() const
     return m_strLocalName;
 }
 
-fep::Result wait_for_response(detail::cResponseQueue* pQueue,
-                              uint32_t currentRequestID,
-                              IRPCResponse& oResponse, 
-                              int nTimeoutMS)
-{
-    timestamp_t tmBegin = a_util::system::getCurrentMilliseconds();
-    bool bBreak = false;
-    while(!bBreak)
-    {
-        bool bIsNotEmpty = pQueue->WaitForNotEmpty(nTimeoutMS / 2);
-        if (bIsNotEmpty)
-        {
-            detail::cResponseQueue::Item oItemFound;
-            if (pQueue->PopItemMatchesRequestId(currentRequestID, oItemFound))
-            {
-                if (oItemFound.m_eCode == detail::cResponseQueue::Item::Stop)
-                {
-                    return Result(ERR_CANCELLED);
-                }
-                else
-                {
-                    oResponse.Set(oItemFound.m_strResponse.c_str());
-                    return Result();
-                }
-            }
-        }
-        timestamp_t tmEnd = a_util::system::getCurrentMilliseconds();
-        // wait for timeout
-        if (tmEnd - tmBegin > nTimeoutMS)
-        {
-            bBreak = true;
-        }
-    }
-    return Result(ERR_TIMEOUT);
-}
-
 fep::Result cRPC::Connect(const char* strElement, const char* strServerObjectName)
 {
-    m_oServerConnections.AddForKey(strElement);
+    std::lock_guard<std::mutex> oLock(m_oConnectionsMutex);
+    m_setConnections.insert(strElement);
     //usually we can check if the strServerObjectName really exist, but wont do this
     return Result();
 }
@@ -208,44 +219,94 @@ fep::Result cRPC::SendRequest(const char* strElement,
                               const char* strMessage,
                               IRPCResponse* pResponse) const
 {
-    if (m_pCommandAccess)
+    FEP_TRACE_SPAN("SendRequest", "rpc");
+    typedef std::pair<fep::Result, std::string> tResult;
+    std::shared_ptr<std::promise<tResult>> pResult = std::make_shared<std::promise<tResult>>();
+    std::future<tResult> oResult = pResult->get_future();
+    Result nTransmitRes = TransmitRequest(strElement, strServerObjectName, strMessage,
+        [pResult](fep::Result nResult, const std::string& strResponse)
+        {
+            pResult->set_value(tResult(nResult, strResponse));
+        }, false);
+    if (fep::isFailed(nTransmitRes))
     {
-        detail::cServerRPCConnections::cResponseQueueEasyRef oResponseQueue = m_oServerConnections.Get(strElement);
-        if (oResponseQueue.Get())
+        return nTransmitRes;
+    }
+
+    // the pending requests guarantee the completion (at the latest by the timeout)
+    const tResult oResponse = oResult.get();
+    if (fep::isOk(oResponse.first))
+    {
+        pResponse->Set(oResponse.second.c_str());
+    }
+    return oResponse.first;
+}
+
+fep::Result cRPC::SendRequestAsync(const char* strElement,
+                                   const char* strServerObjectName,
+                                   const char* strMessage,
+                                   IRPCAsyncResponse* pResponse) const
+{
+    FEP_TRACE_SPAN("SendRequestAsync", "rpc");
+    if (!pResponse)
+    {
+        return fep::ERR_POINTER;
+    }
+    return TransmitRequest(strElement, strServerObjectName, strMessage,
+        [pResponse](fep::Result nResult, const std::string& strResponse)
         {
-            uint32_t currentRequestID = detail::get_request_id();
-            cRPCCommand oCommand(IRPCCommand::request,
-                                 m_strLocalName,
-                                 strElement,
-                                 strServerObjectName,
-                                 currentRequestID,
-                                 strMessage, 
-                                 fep::GetTimeStampMicrosecondsUTC(),
-                                 GetClockTime());
-            Result nTransmitRes = m_pCommandAccess->TransmitCommand(&oCommand);
-            if (fep::isFailed(nTransmitRes))
-            {
-                return nTransmitRes;
-            }
-            else
-            {
-                // default value of this property is 5000 ms
-                int nTimeoutMS = 0;
-                m_pPropertyTree->GetPropertyValue(FEP_RPC_CLIENT_REMOTE_TIMEOUT_PATH, nTimeoutMS);
-                if (nTimeoutMS < 1)
-                {
-                    return fep::ERR_INVALID_ARG;
-                }
-                Result nWaitRes = wait_for_response(oResponseQueue.Get(), currentRequestID, *pResponse, nTimeoutMS);
-                return nWaitRes;
-            }
-        }
-        else
+            pResponse->OnResponse(nResult, strResponse.c_str());
+        }, true);
+}
+
+fep::Result cRPC::TransmitRequest(const char* strElement,
+                                  const char* strServerObjectName,
+                                  const char* strMessage,
+                                  const detail::cPendingRequests::tCallback& fnCallback,
+                                  bool bAsync) const
+{
+    if (!m_pCommandAccess)
+    {
+        RETURN_ERROR_DESCRIPTION(fep::ERR_NOT_INITIALISED, "No CommandAccess Set");
+    }
+    {
+        std::lock_guard<std::mutex> oLock(m_oConnectionsMutex);
+        if (m_setConnections.end() == m_setConnections.find(strElement))
         {
             RETURN_ERROR_DESCRIPTION(fep::ERR_NOT_CONNECTED, "No Connect called");
         }
     }
-    RETURN_ERROR_DESCRIPTION(fep::ERR_NOT_INITIALISED, "No CommandAccess Set");
+    // default value of this property is 5000 ms
+    const int nTimeoutMS = m_nTimeoutMS;
+    if (nTimeoutMS < 1)
+    {
+        return fep::ERR_INVALID_ARG;
+    }
+
+    // added first, the response may arrive before the request is sent completely
+    const uint32_t currentRequestID = detail::get_request_id();
+    m_oPendingRequests.Add(currentRequestID, nTimeoutMS, fnCallback, bAsync);
+    if (m_bLocalTransport
+        && fep::isOk(m_oLocalTransport.SendRequest(currentRequestID, strElement, strServerObjectName, strMessage)))
+    {
+        return Result();
+    }
+
+    // the participant is not reachable locally, the request was not sent
+    cRPCCommand oCommand(IRPCCommand::request,
+                         m_strLocalName,
+                         strElement,
+                         strServerObjectName,
+                         currentRequestID,
+                         strMessage,
+                         fep::GetTimeStampMicrosecondsUTC(),
+                         GetClockTime());
+    Result nTransmitRes = m_pCommandAccess->TransmitCommand(&oCommand);
+    if (fep::isFailed(nTransmitRes))
+    {
+        m_oPendingRequests.Remove(currentRequestID);
+    }
+    return nTransmitRes;
 }
 
 IRPCObjectServerRegistry* cRPC::GetRegistry() const
@@ -271,6 +332,7 @@ fep::Result cRPC::Update(IRPCCommand const * poCommand)
 
 fep::Result cRPC::HandleRequest(IRPCCommand const * poCommand)
 {
+    FEP_TRACE_SPAN("HandleRequest", "rpc");
     //create own thread ???
     //But on Implementation site 
     std::string strResponse;
@@ -293,15 +355,77 @@ fep::Result cRPC::HandleRequest(IRPCCommand const * poCommand)
 
 fep::Result cRPC::HandleResponse(IRPCCommand const * poCommand)
 {
-    detail::cServerRPCConnections::cResponseQueueEasyRef oResponseQueue = m_oServerConnections.Get(poCommand->GetSender());
-    uint32_t nRequestId = poCommand->GetRequestid();
+    // responses to requests that timed out already are dropped
+    m_oPendingRequests.Complete(poCommand->GetRequestid(), Result(), poCommand->GetRPCContent());
+    return Result();
+}
 
-    if (oResponseQueue.Get())
+fep::Result cRPC::HandleLocalRequest(const std::string& strServerObject,
+                                     const std::string& strRequest,
+                                     std::string& strResponse)
+{
+    FEP_TRACE_SPAN("HandleLocalRequest", "rpc");
+    // processed by the message worker like the requests of the command channel, so the
+    // object servers never see concurrent requests. The task owns the only reference to
+    // the promise, a task that is dropped without being run breaks it.
+    std::shared_ptr<std::promise<void>> pDone = std::make_shared<std::promise<void>>();
+    std::future<void> oDone = pDone->get_future();
+    Result nResult = m_pMessageWorker->DispatchToMessageWorker(
+        [this, pDone, &strServerObject, &strRequest, &strResponse]()
+        {
+            m_oRegistry.ProcessRequest(strServerObject, strRequest, strResponse);
+            pDone->set_value();
+        });
+    pDone.reset();
+    if (fep::isFailed(nResult))
+    {
+        return nResult;
+    }
+    try
+    {
+        oDone.get();
+    }
+    catch (const std::future_error&)
     {
-        oResponseQueue.Get()->Push(detail::cResponseQueue::Item(nRequestId, poCommand->GetRPCContent()));
+        return fep::ERR_CANCELLED;
     }
     return Result();
 }
 
+void cRPC::UpdateClientConfig()
+{
+    int nTimeoutMS = 0;
+    if (fep::isOk(m_pPropertyTree->GetPropertyValue(FEP_RPC_CLIENT_REMOTE_TIMEOUT_PATH, nTimeoutMS)))
+    {
+        m_nTimeoutMS = nTimeoutMS;
+    }
+    bool bLocalTransport = false;
+    if (fep::isOk(m_pPropertyTree->GetPropertyValue(FEP_RPC_CLIENT_LOCAL_TRANSPORT_PATH, bLocalTransport)))
+    {
+        m_bLocalTransport = bLocalTransport;
+    }
+}
+
+fep::Result cRPC::ProcessPropertyAdd(IProperty const * poProperty,
+    IProperty const * poAffectedProperty, char const * strRelativePath)
+{
+    UpdateClientConfig();
+    return ERR_NOERROR;
+}
+
+fep::Result cRPC::ProcessPropertyChange(IProperty const * poProperty,
+    IProperty const * poAffectedProperty, char const * strRelativePath)
+{
+    UpdateClientConfig();
+    return ERR_NOERROR;
+}
+
+fep::Result cRPC::ProcessPropertyDelete(IProperty const * poProperty,
+    IProperty const * poAffectedProperty, char const * strRelativePath)
+{
+    // nothing to do here
+    return ERR_NOERROR;
+}
+
 
 }//ns fep
@@ -24,16 +24,22 @@
 #ifndef FEP_RPC_H_IMPL_INCLUDED
 #define FEP_RPC_H_IMPL_INCLUDED
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <set>
 #include <string>
 #include <a_util/base/types.h>
 
 #include "fep_result_decl.h"
 #include "fep3/components/base/component_base_legacy.h"
 #include "fep3/components/base/fep_component.h"
+#include "fep3/components/legacy/property_tree/property_listener_intf.h"
 #include "fep3/components/rpc/fep_rpc_intf.h"
 #include "fep_rpc_element_object.h"
+#include "fep_rpc_local_transport.h"
 #include "fep_rpc_object_registry.h"
-#include "fep_rpc_server_connection.h"
+#include "fep_rpc_pending_requests.h"
 #include "messages/fep_command_listener.h"
 
 namespace fep
@@ -43,6 +49,7 @@ class ICommandAccess;
 class IModule;
 class IPropertyTree;
 class IRPCCommand;
+class ITransmissionAdapterPrivate;
  
 class IRPCInternal
 {
@@ -54,10 +61,16 @@ class IRPCInternal
 };
 /**
  * An RPC Server that receives calls via FEP.
+ *
+ * Requests to participants on the same host may be sent over a local socket (see
+ * \ref detail::cRPCLocalTransport), all other requests are sent over the command channel.
+ * The requests of both transports are processed by the message worker thread of the
+ * transmission adapter.
  */
 class cRPC : public IRPCInternal,
              public IRPC,
              public cCommandListener,
+             public IPropertyListener,
              public ComponentBaseLegacy
 {
     
@@ -81,6 +94,12 @@ class cRPC : public IRPCInternal,
                                         const char* strMessage,
                                         IRPCResponse* pResponse) const override;
 
+        /// @copydoc fep::IRPC::SendRequestAsync
+        virtual fep::Result SendRequestAsync(const char* strElement,
+                                             const char* strServerObjectName,
+                                             const char* strMessage,
+                                             IRPCAsyncResponse* pResponse) const override;
+
         /// @copydoc fep::IRPC::GetRegistry
         virtual IRPCObjectServerRegistry* GetRegistry() const override;
 
@@ -94,9 +113,21 @@ class cRPC : public IRPCInternal,
 
         fep::Result Initialize(ICommandAccess& oCommandAccess,
                                IPropertyTree&  oPropertyTree,
-                               const std::string& strStartupName);
+                               const std::string& strStartupName,
+                               uint16_t nDomainId);
         void Shutdown();
 
+    public: // implements IPropertyListener
+        /// @copydoc IPropertyListener::ProcessPropertyAdd
+        fep::Result ProcessPropertyAdd(IProperty const * poProperty,
+            IProperty const * poAffectedProperty, char const * strRelativePath);
+        /// @copydoc IPropertyListener::ProcessPropertyChange
+        fep::Result ProcessPropertyChange(IProperty const * poProperty,
+            IProperty const * poAffectedProperty, char const * strRelativePath);
+        /// @copydoc IPropertyListener::ProcessPropertyDelete
+        fep::Result ProcessPropertyDelete(IProperty const * poProperty,
+            IProperty const * poAffectedProperty, char const * strRelativePath);
+
     private:
         void setLocalName(const std::string& strName) override;
         void setClockService(IClockService* pClockService) override;
@@ -105,6 +136,15 @@ class cRPC : public IRPCInternal,
         fep::Result Update(IRPCCommand const * poCommand);
         fep::Result HandleRequest(IRPCCommand const * poCommand);
         fep::Result HandleResponse(IRPCCommand const * poCommand);
+        fep::Result HandleLocalRequest(const std::string& strServerObject,
+                                       const std::string& strRequest,
+                                       std::string& strResponse);
+        fep::Result TransmitRequest(const char* strElement,
+                                    const char* strServerObjectName,
+                                    const char* strMessage,
+                                    const detail::cPendingRequests::tCallback& fnCallback,
+                                    bool bAsync) const;
+        void UpdateClientConfig();
 
     private:
         timestamp_t GetClockTime() const;
@@ -117,9 +157,26 @@ class cRPC : public IRPCInternal,
         IRPCObjectServerRegistry* m_pRegistry;
         std::string               m_strLocalName;
 
-        detail::cServerRPCConnections m_oServerConnections;
         IClockService*            m_pClockService;
 
+        /// Guards m_setConnections
+        mutable std::mutex        m_oConnectionsMutex;
+        /// Elements passed to Connect
+        std::set<std::string>     m_setConnections;
+        /// Requests waiting for their responses (from both transports)
+        mutable detail::cPendingRequests m_oPendingRequests;
+
+        /// Runs the requests received over the local transport (the transmission adapter)
+        ITransmissionAdapterPrivate* m_pMessageWorker;
+        /// Transport for the requests to participants on the same host
+        mutable detail::cRPCLocalTransport m_oLocalTransport;
+        /// Whether the local transport is listening
+        bool                      m_bLocalTransportStarted;
+        /// Cached FEP_RPC_CLIENT_REMOTE_TIMEOUT_PATH
+        std::atomic<int>          m_nTimeoutMS;
+        /// Cached FEP_RPC_CLIENT_LOCAL_TRANSPORT_PATH
+        std::atomic<bool>         m_bLocalTransport;
+
 };
 
 }//ns fep
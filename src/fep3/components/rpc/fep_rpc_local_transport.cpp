@@ -0,0 +1,613 @@
+/**
+ *
+ * Implementation of the local request/reply transport of the RPC component.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#ifdef __linux__
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "fep_errors.h"
+#include "fep_rpc_local_transport.h"
+
+namespace fep
+{
+namespace detail
+{
+
+#ifdef __linux__
+namespace
+{
+    /// Type of a frame
+    enum tFrameType : uint8_t
+    {
+        ft_request = 1,
+        ft_response = 2,
+        /// The receiver listens under another name now, the request was not processed
+        ft_not_addressed = 3,
+        /// The request handler of the receiver failed, the request was not processed
+        ft_failed = 4
+    };
+
+    /// Header of a frame (host byte order, both ends run on the same host)
+    struct tFrameHeader
+    {
+        /// Size of the payload following the header
+        uint32_t nSize;
+        /// Id of the request, the response carries the id of its request
+        uint32_t nRequestId;
+        /// Type of the frame (a tFrameType)
+        uint8_t nType;
+        /// Padding
+        uint8_t aReserved[3];
+    };
+
+    /// Limit of the payload of a frame, guards against garbage on the socket
+    static const uint32_t s_nMaxFrameSize = 256 * 1024 * 1024;
+    /// Time a participant that is not reachable locally is not asked again
+    static const std::chrono::milliseconds s_tmRetryUnreachable(1000);
+
+    /// Determines the address of the socket of a participant
+    bool GetAddress(uint16_t nDomainId, const std::string& strName, sockaddr_un& sAddress, socklen_t& nLength)
+    {
+        const std::string strPath = "fep_rpc/" + std::to_string(nDomainId) + "/" + strName;
+        if (strName.empty() || strPath.size() + 1 > sizeof(sAddress.sun_path))
+        {
+            return false;
+        }
+        memset(&sAddress, 0, sizeof(sAddress));
+        sAddress.sun_family = AF_UNIX;
+        // the leading zero selects the abstract namespace
+        memcpy(sAddress.sun_path + 1, strPath.data(), strPath.size());
+        nLength = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + 1 + strPath.size());
+        return true;
+    }
+
+    /// Checks whether the peer of a connected socket runs as the same user as this process
+    bool IsSameUser(int nSocket)
+    {
+        ucred sCredentials;
+        socklen_t nLength = sizeof(sCredentials);
+        return 0 == getsockopt(nSocket, SOL_SOCKET, SO_PEERCRED, &sCredentials, &nLength)
+            && sCredentials.uid == geteuid();
+    }
+
+    /// Writes all data to the socket
+    bool WriteAll(int nSocket, const char* pData, size_t szSize)
+    {
+        while (szSize > 0)
+        {
+            const ssize_t nWritten = send(nSocket, pData, szSize, MSG_NOSIGNAL);
+            if (nWritten < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                return false;
+            }
+            pData += nWritten;
+            szSize -= static_cast<size_t>(nWritten);
+        }
+        return true;
+    }
+
+    /// Reads exactly szSize bytes, false if the connection was closed
+    bool ReadAll(int nSocket, char* pData, size_t szSize)
+    {
+        while (szSize > 0)
+        {
+            const ssize_t nRead = recv(nSocket, pData, szSize, 0);
+            if (nRead < 0 && EINTR == errno)
+            {
+                continue;
+            }
+            if (nRead <= 0)
+            {
+                return false;
+            }
+            pData += nRead;
+            szSize -= static_cast<size_t>(nRead);
+        }
+        return true;
+    }
+
+    /// Sends a frame
+    bool WriteFrame(int nSocket, tFrameType eType, uint32_t nRequestId, const std::string& strPayload)
+    {
+        tFrameHeader sHeader;
+        memset(&sHeader, 0, sizeof(sHeader));
+        sHeader.nSize = static_cast<uint32_t>(strPayload.size());
+        sHeader.nRequestId = nRequestId;
+        sHeader.nType = eType;
+        return WriteAll(nSocket, reinterpret_cast<const char*>(&sHeader), sizeof(sHeader))
+            && WriteAll(nSocket, strPayload.data(), strPayload.size());
+    }
+
+    /// Receives a frame, false if the connection was closed or the frame is invalid
+    bool ReadFrame(int nSocket, tFrameHeader& sHeader, std::string& strPayload)
+    {
+        if (!ReadAll(nSocket, reinterpret_cast<char*>(&sHeader), sizeof(sHeader))
+            || sHeader.nSize > s_nMaxFrameSize)
+        {
+            return false;
+        }
+        strPayload.resize(sHeader.nSize);
+        return 0 == sHeader.nSize || ReadAll(nSocket, &strPayload[0], sHeader.nSize);
+    }
+
+    /// Appends a length prefixed string
+    void AppendString(std::string& strPayload, const std::string& strValue)
+    {
+        const uint32_t nLength = static_cast<uint32_t>(strValue.size());
+        strPayload.append(reinterpret_cast<const char*>(&nLength), sizeof(nLength));
+        strPayload.append(strValue);
+    }
+
+    /// Reads a length prefixed string
+    bool ReadString(const std::string& strPayload, size_t& szPos, std::string& strValue)
+    {
+        uint32_t nLength = 0;
+        if (strPayload.size() - szPos < sizeof(nLength))
+        {
+            return false;
+        }
+        memcpy(&nLength, strPayload.data() + szPos, sizeof(nLength));
+        szPos += sizeof(nLength);
+        if (strPayload.size() - szPos < nLength)
+        {
+            return false;
+        }
+        strValue.assign(strPayload, szPos, nLength);
+        szPos += nLength;
+        return true;
+    }
+}
+#endif
+
+cRPCLocalTransport::cRPCLocalTransport() :
+    m_nDomainId(0),
+    m_nListenSocket(-1)
+{
+}
+
+cRPCLocalTransport::~cRPCLocalTransport()
+{
+    Stop();
+}
+
+#ifdef __linux__
+
+fep::Result cRPCLocalTransport::Start(uint16_t nDomainId, const std::string& strLocalName,
+    const tRequestHandler& fnRequestHandler, const tResponseHandler& fnResponseHandler)
+{
+    Stop();
+    m_nDomainId = nDomainId;
+    m_fnRequestHandler = fnRequestHandler;
+    m_fnResponseHandler = fnResponseHandler;
+    {
+        std::lock_guard<std::mutex> oLock(m_oNameMutex);
+        m_strLocalName = strLocalName;
+    }
+    return Listen();
+}
+
+fep::Result cRPCLocalTransport::Rename(const std::string& strLocalName)
+{
+    if (!m_fnRequestHandler)
+    {
+        return ERR_NOERROR;
+    }
+    StopListening();
+    {
+        std::lock_guard<std::mutex> oLock(m_oNameMutex);
+        m_strLocalName = strLocalName;
+    }
+    return Listen();
+}
+
+void cRPCLocalTransport::Stop()
+{
+    StopListening();
+    ReapServerConnections(true);
+
+    std::list<std::shared_ptr<tClientConnection>> lstConnections;
+    {
+        std::lock_guard<std::mutex> oLock(m_oClientMutex);
+        for (auto& oConnection : m_mapConnections)
+        {
+            lstConnections.push_back(oConnection.second);
+        }
+        lstConnections.splice(lstConnections.end(), m_lstDroppedConnections);
+        m_mapConnections.clear();
+        m_mapUnreachable.clear();
+    }
+    // joined without lock, the response handler may send requests
+    for (auto& pConnection : lstConnections)
+    {
+        // wakes up the receiving thread, the socket is closed with the connection
+        shutdown(pConnection->nSocket, SHUT_RDWR);
+        pConnection->oThread.join();
+    }
+    m_fnRequestHandler = tRequestHandler();
+    m_fnResponseHandler = tResponseHandler();
+}
+
+fep::Result cRPCLocalTransport::Listen()
+{
+    sockaddr_un sAddress;
+    socklen_t nLength = 0;
+    {
+        std::lock_guard<std::mutex> oLock(m_oNameMutex);
+        if (!GetAddress(m_nDomainId, m_strLocalName, sAddress, nLength))
+        {
+            return ERR_OPEN_FAILED;
+        }
+    }
+
+    const int nSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (nSocket < 0)
+    {
+        return ERR_OPEN_FAILED;
+    }
+    // fails if a participant of the same name runs on this host already
+    if (0 != bind(nSocket, reinterpret_cast<const sockaddr*>(&sAddress), nLength)
+        || 0 != listen(nSocket, SOMAXCONN))
+    {
+        close(nSocket);
+        return ERR_OPEN_FAILED;
+    }
+    m_nListenSocket = nSocket;
+    m_oAcceptThread = std::thread(&cRPCLocalTransport::AcceptThreadFunc, this);
+    return ERR_NOERROR;
+}
+
+void cRPCLocalTransport::StopListening()
+{
+    if (0 <= m_nListenSocket)
+    {
+        // wakes up accept
+        shutdown(m_nListenSocket, SHUT_RDWR);
+        m_oAcceptThread.join();
+        close(m_nListenSocket);
+        m_nListenSocket = -1;
+    }
+}
+
+void cRPCLocalTransport::AcceptThreadFunc()
+{
+    const int nListenSocket = m_nListenSocket;
+    while (true)
+    {
+        const int nSocket = accept4(nListenSocket, NULL, NULL, SOCK_CLOEXEC);
+        if (nSocket < 0)
+        {
+            if (EINTR == errno || ECONNABORTED == errno)
+            {
+                continue;
+            }
+            break;
+        }
+        if (!IsSameUser(nSocket))
+        {
+            // anyone on the host may connect to an abstract socket
+            close(nSocket);
+            continue;
+        }
+        ReapServerConnections(false);
+
+        std::unique_ptr<tServerConnection> pConnection(new tServerConnection());
+        pConnection->nSocket = nSocket;
+        pConnection->bDone = false;
+        std::lock_guard<std::mutex> oLock(m_oServerMutex);
+        pConnection->oThread = std::thread(&cRPCLocalTransport::ServeThreadFunc, this, pConnection.get());
+        m_lstServerConnections.push_back(std::move(pConnection));
+    }
+}
+
+void cRPCLocalTransport::ServeThreadFunc(tServerConnection* pConnection)
+{
+    tFrameHeader sHeader;
+    std::string strPayload;
+    std::string strElement;
+    std::string strServerObject;
+    std::string strResponse;
+    while (ReadFrame(pConnection->nSocket, sHeader, strPayload))
+    {
+        size_t szPos = 0;
+        if (ft_request != sHeader.nType
+            || !ReadString(strPayload, szPos, strElement)
+            || !ReadString(strPayload, szPos, strServerObject))
+        {
+            break;
+        }
+
+        bool bAddressed = false;
+        {
+            std::lock_guard<std::mutex> oLock(m_oNameMutex);
+            bAddressed = strElement == m_strLocalName;
+        }
+        strResponse.clear();
+        tFrameType eType = ft_not_addressed;
+        if (bAddressed)
+        {
+            eType = fep::isOk(m_fnRequestHandler(strServerObject, strPayload.substr(szPos), strResponse))
+                ? ft_response : ft_failed;
+        }
+        if (!WriteFrame(pConnection->nSocket, eType, sHeader.nRequestId, strResponse))
+        {
+            break;
+        }
+    }
+    pConnection->bDone = true;
+}
+
+void cRPCLocalTransport::ReapServerConnections(bool bAll)
+{
+    std::lock_guard<std::mutex> oLock(m_oServerMutex);
+    for (auto itConnection = m_lstServerConnections.begin(); itConnection != m_lstServerConnections.end();)
+    {
+        tServerConnection& oConnection = **itConnection;
+        if (bAll)
+        {
+            // wakes up the thread waiting for the next request, a running request is finished
+            shutdown(oConnection.nSocket, SHUT_RDWR);
+        }
+        if (bAll || oConnection.bDone)
+        {
+            oConnection.oThread.join();
+            close(oConnection.nSocket);
+            itConnection = m_lstServerConnections.erase(itConnection);
+        }
+        else
+        {
+            ++itConnection;
+        }
+    }
+}
+
+void cRPCLocalTransport::ReceiveThreadFunc(tClientConnection* pConnection)
+{
+    fep::Result nBrokenResult = ERR_FAILED;
+    tFrameHeader sHeader;
+    std::string strPayload;
+    while (ReadFrame(pConnection->nSocket, sHeader, strPayload))
+    {
+        if (ft_response != sHeader.nType && ft_not_addressed != sHeader.nType
+            && ft_failed != sHeader.nType)
+        {
+            break;
+        }
+        bool bPending = false;
+        {
+            std::lock_guard<std::mutex> oLock(pConnection->oPendingMutex);
+            bPending = 0 < pConnection->setPending.erase(sHeader.nRequestId);
+        }
+        if (ft_not_addressed == sHeader.nType)
+        {
+            // the participant listens under another name, the following requests fail the same way
+            nBrokenResult = ERR_NOT_CONNECTED;
+            if (bPending)
+            {
+                m_fnResponseHandler(sHeader.nRequestId, ERR_NOT_CONNECTED, std::string());
+            }
+            break;
+        }
+        if (bPending)
+        {
+            m_fnResponseHandler(sHeader.nRequestId,
+                ft_failed == sHeader.nType ? ERR_FAILED : ERR_NOERROR, strPayload);
+        }
+    }
+
+    // fails the requests still waiting, new requests use a new connection
+    shutdown(pConnection->nSocket, SHUT_RDWR);
+    std::set<uint32_t> setPending;
+    {
+        std::lock_guard<std::mutex> oLock(pConnection->oPendingMutex);
+        pConnection->bClosed = true;
+        setPending.swap(pConnection->setPending);
+    }
+    for (uint32_t nRequestId : setPending)
+    {
+        m_fnResponseHandler(nRequestId, nBrokenResult, std::string());
+    }
+    pConnection->bDone = true;
+}
+
+std::shared_ptr<cRPCLocalTransport::tClientConnection> cRPCLocalTransport::GetConnection(
+    const std::string& strElement)
+{
+    std::lock_guard<std::mutex> oLock(m_oClientMutex);
+    ReapClientConnections();
+    auto itConnection = m_mapConnections.find(strElement);
+    if (m_mapConnections.end() != itConnection)
+    {
+        if (!itConnection->second->bDone)
+        {
+            return itConnection->second;
+        }
+        DropConnection(strElement, itConnection->second);
+    }
+
+    const std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+    auto itUnreachable = m_mapUnreachable.find(strElement);
+    if (m_mapUnreachable.end() != itUnreachable && tmNow < itUnreachable->second)
+    {
+        return std::shared_ptr<tClientConnection>();
+    }
+
+    sockaddr_un sAddress;
+    socklen_t nLength = 0;
+    int nSocket = -1;
+    if (GetAddress(m_nDomainId, strElement, sAddress, nLength))
+    {
+        nSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        // a participant of another user is not trusted with the requests
+        if (0 <= nSocket && (0 != connect(nSocket, reinterpret_cast<const sockaddr*>(&sAddress), nLength)
+            || !IsSameUser(nSocket)))
+        {
+            close(nSocket);
+            nSocket = -1;
+        }
+    }
+    if (nSocket < 0)
+    {
+        // most likely the participant runs on another host (or as another user)
+        m_mapUnreachable[strElement] = tmNow + s_tmRetryUnreachable;
+        return std::shared_ptr<tClientConnection>();
+    }
+
+    std::shared_ptr<tClientConnection> pConnection(new tClientConnection(), [](tClientConnection* pClosed)
+    {
+        close(pClosed->nSocket);
+        delete pClosed;
+    });
+    pConnection->nSocket = nSocket;
+    pConnection->bDone = false;
+    pConnection->bClosed = false;
+    pConnection->oThread = std::thread(&cRPCLocalTransport::ReceiveThreadFunc, this, pConnection.get());
+    m_mapUnreachable.erase(strElement);
+    m_mapConnections[strElement] = pConnection;
+    return pConnection;
+}
+
+void cRPCLocalTransport::DropConnection(const std::string& strElement,
+    const std::shared_ptr<tClientConnection>& pConnection)
+{
+    auto itConnection = m_mapConnections.find(strElement);
+    if (m_mapConnections.end() != itConnection && pConnection == itConnection->second)
+    {
+        // wakes up the receiving thread, it is joined later
+        shutdown(pConnection->nSocket, SHUT_RDWR);
+        m_lstDroppedConnections.push_back(pConnection);
+        m_mapConnections.erase(itConnection);
+    }
+}
+
+void cRPCLocalTransport::ReapClientConnections()
+{
+    // only finished threads are joined, a running one might wait for m_oClientMutex
+    for (auto itConnection = m_lstDroppedConnections.begin(); itConnection != m_lstDroppedConnections.end();)
+    {
+        if ((*itConnection)->bDone)
+        {
+            (*itConnection)->oThread.join();
+            itConnection = m_lstDroppedConnections.erase(itConnection);
+        }
+        else
+        {
+            ++itConnection;
+        }
+    }
+}
+
+fep::Result cRPCLocalTransport::SendRequest(uint32_t nRequestId, const std::string& strElement,
+    const std::string& strServerObject, const std::string& strRequest)
+{
+    std::string strPayload;
+    strPayload.reserve(2 * sizeof(uint32_t) + strElement.size() + strServerObject.size() + strRequest.size());
+    AppendString(strPayload, strElement);
+    AppendString(strPayload, strServerObject);
+    strPayload.append(strRequest);
+    if (strPayload.size() > s_nMaxFrameSize)
+    {
+        return ERR_NOT_CONNECTED;
+    }
+
+    // a cached connection might be stale (the participant was restarted), so try a new one once
+    for (int nAttempt = 0; nAttempt < 2; ++nAttempt)
+    {
+        std::shared_ptr<tClientConnection> pConnection = GetConnection(strElement);
+        if (!pConnection)
+        {
+            return ERR_NOT_CONNECTED;
+        }
+
+        bool bClosed = false;
+        {
+            // registered before it is sent, the response may arrive before the write returns
+            std::lock_guard<std::mutex> oLock(pConnection->oPendingMutex);
+            bClosed = pConnection->bClosed;
+            if (!bClosed)
+            {
+                pConnection->setPending.insert(nRequestId);
+            }
+        }
+        if (!bClosed)
+        {
+            bool bWritten = false;
+            {
+                std::lock_guard<std::mutex> oLock(pConnection->oWriteMutex);
+                bWritten = WriteFrame(pConnection->nSocket, ft_request, nRequestId, strPayload);
+            }
+            if (bWritten)
+            {
+                return ERR_NOERROR;
+            }
+            std::lock_guard<std::mutex> oLock(pConnection->oPendingMutex);
+            if (0 == pConnection->setPending.erase(nRequestId))
+            {
+                // the receiving thread reported the broken connection for this request already
+                return ERR_NOERROR;
+            }
+        }
+
+        std::lock_guard<std::mutex> oLock(m_oClientMutex);
+        DropConnection(strElement, pConnection);
+    }
+    return ERR_NOT_CONNECTED;
+}
+
+#else
+
+fep::Result cRPCLocalTransport::Start(uint16_t, const std::string&, const tRequestHandler&,
+    const tResponseHandler&)
+{
+    return ERR_NOT_SUPPORTED;
+}
+
+fep::Result cRPCLocalTransport::Rename(const std::string&)
+{
+    return ERR_NOT_SUPPORTED;
+}
+
+void cRPCLocalTransport::Stop()
+{
+}
+
+fep::Result cRPCLocalTransport::SendRequest(uint32_t, const std::string&, const std::string&,
+    const std::string&)
+{
+    return ERR_NOT_CONNECTED;
+}
+
+#endif
+
+}
+
+}//ns fep
@@ -0,0 +1,199 @@
+/**
+ *
+ * Declaration of the local request/reply transport of the RPC component.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef FEP_RPC_LOCAL_TRANSPORT_H_IMPL_INCLUDED
+#define FEP_RPC_LOCAL_TRANSPORT_H_IMPL_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "fep_result_decl.h"
+
+namespace fep
+{
+
+namespace detail
+{
+/**
+ * Request/reply transport for RPCs between participants on the same host.
+ *
+ * Every participant listens on a unix domain socket named after its domain and name
+ * (abstract namespace, nothing is left behind in the file system). Abstract sockets have no
+ * file permissions, so both ends only talk to peers running as the same user. A client keeps one
+ * connection per remote participant, sends a request as a frame and receives the response
+ * on the same connection, so no message worker thread and no polling are involved.
+ * Any number of requests may be in flight on a connection, a thread per connection
+ * passes the responses to the response handler by their request id. Timeouts are left
+ * to the caller. The request handler is called by a thread per accepted connection, it
+ * has to serialize the requests itself.
+ *
+ * Requests to participants that do not listen on this host (or run as another user) fail
+ * with ERR_NOT_CONNECTED before anything was sent, the caller uses the command channel then.
+ */
+class cRPCLocalTransport
+{
+    public:
+        /// Processes a request (server object, request) and fills in the response, the request
+        /// fails with ERR_FAILED at the client if the handler fails
+        typedef std::function<fep::Result(const std::string&, const std::string&, std::string&)> tRequestHandler;
+        /// Receives the result and the response of a sent request (request id, result, response)
+        typedef std::function<void(uint32_t, fep::Result, const std::string&)> tResponseHandler;
+
+    public:
+        /// CTOR
+        cRPCLocalTransport();
+        /// DTOR
+        ~cRPCLocalTransport();
+
+        /**
+         * Starts listening for requests.
+         * @param [in] nDomainId Domain of the participant
+         * @param [in] strLocalName Name of the participant
+         * @param [in] fnRequestHandler Processes the received requests (called by the connection threads)
+         * @param [in] fnResponseHandler Receives the results of the sent requests (called by the
+         *             connection threads, must not block)
+         * @retval ERR_NOERROR Everything went fine
+         * @retval ERR_NOT_SUPPORTED There are no local sockets on this platform
+         * @retval ERR_OPEN_FAILED The socket could not be opened (e.g. the name is in use),
+         *                         requests can be sent anyway
+         */
+        fep::Result Start(uint16_t nDomainId, const std::string& strLocalName,
+            const tRequestHandler& fnRequestHandler, const tResponseHandler& fnResponseHandler);
+
+        /**
+         * Listens under a new name, established connections are kept.
+         * @param [in] strLocalName New name of the participant
+         * @return see \ref Start
+         */
+        fep::Result Rename(const std::string& strLocalName);
+
+        /// Stops listening, closes all connections and waits for running requests
+        void Stop();
+
+        /**
+         * Sends a request, the response handler receives its result. The result is
+         * ERR_NOERROR with the response, ERR_FAILED if the connection broke after the request
+         * was sent or the request was not processed, or ERR_NOT_CONNECTED if the participant listens under another name now
+         * (the request was not processed).
+         * @param [in] nRequestId Id of the request passed to the response handler
+         * @param [in] strElement Receiving participant
+         * @param [in] strServerObject Server object the request is addressed to
+         * @param [in] strRequest The request
+         * @retval ERR_NOERROR The request was sent
+         * @retval ERR_NOT_CONNECTED The participant is not reachable locally, the request was not sent
+         */
+        fep::Result SendRequest(uint32_t nRequestId, const std::string& strElement,
+            const std::string& strServerObject, const std::string& strRequest);
+
+    private:
+        /// Connection to a remote participant
+        struct tClientConnection
+        {
+            /// Socket
+            int nSocket;
+            /// Serializes the requests written to the connection
+            std::mutex oWriteMutex;
+            /// Thread receiving the responses
+            std::thread oThread;
+            /// Set by the thread when it finished
+            std::atomic<bool> bDone;
+            /// Guards bClosed and setPending
+            std::mutex oPendingMutex;
+            /// Set by the thread when the connection broke, no requests are sent anymore
+            bool bClosed;
+            /// Requests sent on the connection without response
+            std::set<uint32_t> setPending;
+        };
+        /// Connection accepted from a remote participant
+        struct tServerConnection
+        {
+            /// Socket
+            int nSocket;
+            /// Thread serving the connection
+            std::thread oThread;
+            /// Set by the thread when the connection is closed by the client
+            std::atomic<bool> bDone;
+        };
+
+    private:
+        /// Opens the listening socket and starts the accepting thread
+        fep::Result Listen();
+        /// Stops the accepting thread and closes the listening socket
+        void StopListening();
+        /// Thread function accepting connections
+        void AcceptThreadFunc();
+        /// Thread function serving a connection
+        void ServeThreadFunc(tServerConnection* pConnection);
+        /// Thread function receiving the responses of a connection
+        void ReceiveThreadFunc(tClientConnection* pConnection);
+        /// Joins the threads of the connections closed by their clients
+        void ReapServerConnections(bool bAll);
+        /// Returns the connection to a participant, connects if needed (NULL if not reachable)
+        std::shared_ptr<tClientConnection> GetConnection(const std::string& strElement);
+        /// Forgets the connection to a participant after an error (m_oClientMutex is locked)
+        void DropConnection(const std::string& strElement, const std::shared_ptr<tClientConnection>& pConnection);
+        /// Closes the dropped connections, waits for their threads (m_oClientMutex is locked)
+        void ReapClientConnections();
+
+    private:
+        /// Domain of the participant
+        uint16_t m_nDomainId;
+        /// Name the participant listens under (guarded by m_oNameMutex)
+        std::string m_strLocalName;
+        /// Guards m_strLocalName
+        mutable std::mutex m_oNameMutex;
+        /// Processes the received requests
+        tRequestHandler m_fnRequestHandler;
+        /// Receives the results of the sent requests
+        tResponseHandler m_fnResponseHandler;
+        /// Listening socket (-1 if not listening)
+        int m_nListenSocket;
+        /// Thread accepting connections
+        std::thread m_oAcceptThread;
+        /// Guards m_lstServerConnections
+        std::mutex m_oServerMutex;
+        /// Accepted connections
+        std::list<std::unique_ptr<tServerConnection>> m_lstServerConnections;
+        /// Guards m_mapConnections, m_lstDroppedConnections and m_mapUnreachable
+        std::mutex m_oClientMutex;
+        /// Connections to remote participants
+        std::map<std::string, std::shared_ptr<tClientConnection>> m_mapConnections;
+        /// Connections closed or dropped after an error whose threads are not joined yet
+        std::list<std::shared_ptr<tClientConnection>> m_lstDroppedConnections;
+        /// Participants not reachable locally and when to try again
+        std::map<std::string, std::chrono::steady_clock::time_point> m_mapUnreachable;
+};
+}
+
+}//ns fep
+
+#endif //FEP_RPC_LOCAL_TRANSPORT_H_IMPL_INCLUDED
@@ -0,0 +1,214 @@
+/**
+ *
+ * RPC Protocol implementation.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <utility>
+#include <vector>
+#include "fep_errors.h"
+#include "fep_rpc_pending_requests.h"
+
+namespace fep
+{
+namespace detail
+{
+
+cPendingRequests::cPendingRequests() :
+    m_bCallbackRunning(false),
+    m_bShutdown(false)
+{
+    m_oTimerThread = std::thread(&cPendingRequests::TimerThreadFunc, this);
+    m_oCallbackThread = std::thread(&cPendingRequests::CallbackThreadFunc, this);
+}
+
+cPendingRequests::~cPendingRequests()
+{
+    CancelAll();
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_bShutdown = true;
+    }
+    m_cvChanged.notify_one();
+    m_cvCallbacks.notify_one();
+    m_oTimerThread.join();
+    m_oCallbackThread.join();
+}
+
+void cPendingRequests::Add(uint32_t nRequestId, int nTimeoutMS, const tCallback& fnCallback, bool bAsync)
+{
+    const auto tmDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(nTimeoutMS);
+    bool bEarliest = false;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        tRequest& sRequest = m_mapRequests[nRequestId];
+        sRequest.itDeadline = m_mapDeadlines.insert(std::make_pair(tmDeadline, nRequestId));
+        sRequest.fnCallback = fnCallback;
+        sRequest.bAsync = bAsync;
+        bEarliest = sRequest.itDeadline == m_mapDeadlines.begin();
+    }
+    if (bEarliest)
+    {
+        m_cvChanged.notify_one();
+    }
+}
+
+void cPendingRequests::Remove(uint32_t nRequestId)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    auto itRequest = m_mapRequests.find(nRequestId);
+    if (m_mapRequests.end() != itRequest)
+    {
+        m_mapDeadlines.erase(itRequest->second.itDeadline);
+        m_mapRequests.erase(itRequest);
+    }
+}
+
+bool cPendingRequests::Complete(uint32_t nRequestId, fep::Result nResult, const std::string& strResponse)
+{
+    tCallback fnCallback;
+    bool bAsync = false;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        auto itRequest = m_mapRequests.find(nRequestId);
+        if (m_mapRequests.end() == itRequest)
+        {
+            return false;
+        }
+        m_mapDeadlines.erase(itRequest->second.itDeadline);
+        fnCallback = std::move(itRequest->second.fnCallback);
+        bAsync = itRequest->second.bAsync;
+        m_mapRequests.erase(itRequest);
+    }
+    Call(fnCallback, bAsync, nResult, strResponse);
+    return true;
+}
+
+void cPendingRequests::CancelAll()
+{
+    std::vector<tRequest> vecRequests;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        vecRequests.reserve(m_mapRequests.size());
+        for (auto& oRequest : m_mapRequests)
+        {
+            vecRequests.push_back(std::move(oRequest.second));
+        }
+        m_mapRequests.clear();
+        m_mapDeadlines.clear();
+    }
+    const std::string strEmpty;
+    for (auto& sRequest : vecRequests)
+    {
+        Call(sRequest.fnCallback, sRequest.bAsync, ERR_CANCELLED, strEmpty);
+    }
+
+    // the receivers of asynchronous responses may be gone after the caller returns
+    if (std::this_thread::get_id() != m_oCallbackThread.get_id())
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_cvCallbacksDone.wait(oLock, [this]()
+        {
+            return m_qCallbacks.empty() && !m_bCallbackRunning;
+        });
+    }
+}
+
+void cPendingRequests::Call(tCallback& fnCallback, bool bAsync, fep::Result nResult,
+    const std::string& strResponse)
+{
+    if (!bAsync)
+    {
+        fnCallback(nResult, strResponse);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        tCallback fnQueued = std::move(fnCallback);
+        m_qCallbacks.push_back([fnQueued, nResult, strResponse]()
+        {
+            fnQueued(nResult, strResponse);
+        });
+    }
+    m_cvCallbacks.notify_one();
+}
+
+void cPendingRequests::TimerThreadFunc()
+{
+    const std::string strEmpty;
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    while (!m_bShutdown)
+    {
+        if (m_mapDeadlines.empty())
+        {
+            m_cvChanged.wait(oLock);
+            continue;
+        }
+        auto itDeadline = m_mapDeadlines.begin();
+        // copied, the request may be completed while waiting
+        const auto tmDeadline = itDeadline->first;
+        if (std::chrono::steady_clock::now() < tmDeadline)
+        {
+            m_cvChanged.wait_until(oLock, tmDeadline);
+            continue;
+        }
+
+        auto itRequest = m_mapRequests.find(itDeadline->second);
+        tCallback fnCallback = std::move(itRequest->second.fnCallback);
+        const bool bAsync = itRequest->second.bAsync;
+        m_mapRequests.erase(itRequest);
+        m_mapDeadlines.erase(itDeadline);
+
+        oLock.unlock();
+        Call(fnCallback, bAsync, ERR_TIMEOUT, strEmpty);
+        oLock.lock();
+    }
+}
+
+void cPendingRequests::CallbackThreadFunc()
+{
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    // the queued callbacks are called before the thread stops
+    while (!m_bShutdown || !m_qCallbacks.empty())
+    {
+        if (m_qCallbacks.empty())
+        {
+            m_cvCallbacks.wait(oLock);
+            continue;
+        }
+        std::function<void()> fnCall = std::move(m_qCallbacks.front());
+        m_qCallbacks.pop_front();
+        m_bCallbackRunning = true;
+
+        oLock.unlock();
+        fnCall();
+        oLock.lock();
+
+        m_bCallbackRunning = false;
+        if (m_qCallbacks.empty())
+        {
+            m_cvCallbacksDone.notify_all();
+        }
+    }
+}
+
+}
+
+}//ns fep
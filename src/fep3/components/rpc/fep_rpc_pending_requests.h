@@ -0,0 +1,147 @@
+/**
+ *
+ * RPC Protocol declaration.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef FEP_RPC_PENDING_REQUESTS_H_IMPL_INCLUDED
+#define FEP_RPC_PENDING_REQUESTS_H_IMPL_INCLUDED
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "fep_result_decl.h"
+
+namespace fep
+{
+
+namespace detail
+{
+/**
+ * Requests sent by the RPC client that wait for their responses.
+ *
+ * A response is matched by the id of its request, so any number of requests may be in
+ * flight at the same time. Every request gets exactly one call of its callback: with the
+ * response, with ERR_TIMEOUT once its timeout expired or with ERR_CANCELLED.
+ * The callbacks of synchronous requests are called by the thread delivering the response or
+ * by the timer thread of this class, never with an internal lock held. The callbacks of
+ * asynchronous requests are called one after the other by the callback thread of this class,
+ * so they may block (e.g. send a synchronous request) without stalling the delivery of the
+ * responses and the timeouts.
+ */
+class cPendingRequests
+{
+    public:
+        /// Receives the result and the response of a request
+        typedef std::function<void(fep::Result, const std::string&)> tCallback;
+
+    public:
+        /// CTOR, starts the timer thread and the callback thread
+        cPendingRequests();
+        /// DTOR, cancels the pending requests and stops the threads
+        ~cPendingRequests();
+
+        /**
+         * Adds a request. Must be called before the request is sent.
+         * @param [in] nRequestId Id of the request
+         * @param [in] nTimeoutMS Time to wait for the response
+         * @param [in] fnCallback Receives the result
+         * @param [in] bAsync The callback is called by the callback thread
+         */
+        void Add(uint32_t nRequestId, int nTimeoutMS, const tCallback& fnCallback, bool bAsync = false);
+
+        /**
+         * Removes a request without calling its callback (e.g. it could not be sent).
+         * @param [in] nRequestId Id of the request
+         */
+        void Remove(uint32_t nRequestId);
+
+        /**
+         * Completes a request and calls its callback.
+         * @param [in] nRequestId Id of the request
+         * @param [in] nResult Result of the request
+         * @param [in] strResponse The response
+         * @return Whether the request was pending (false for late responses)
+         */
+        bool Complete(uint32_t nRequestId, fep::Result nResult, const std::string& strResponse);
+
+        /// Completes all pending requests with ERR_CANCELLED and waits for the queued
+        /// callbacks of asynchronous requests (unless called by the callback thread)
+        void CancelAll();
+
+    private:
+        /// Thread function completing the requests whose timeouts expired
+        void TimerThreadFunc();
+        /// Thread function calling the callbacks of the asynchronous requests
+        void CallbackThreadFunc();
+        /// Calls a callback or queues it for the callback thread (m_oMutex is not locked)
+        void Call(tCallback& fnCallback, bool bAsync, fep::Result nResult, const std::string& strResponse);
+
+    private:
+        /// Deadlines of the requests in order
+        typedef std::multimap<std::chrono::steady_clock::time_point, uint32_t> tDeadlines;
+        /// A pending request
+        struct tRequest
+        {
+            /// Entry of the request in m_mapDeadlines
+            tDeadlines::iterator itDeadline;
+            /// Receives the result
+            tCallback fnCallback;
+            /// Whether the callback is called by the callback thread
+            bool bAsync;
+        };
+
+    private:
+        /// Guards all members
+        std::mutex m_oMutex;
+        /// Signals a new earliest deadline or the shutdown to the timer thread
+        std::condition_variable m_cvChanged;
+        /// Pending requests by request id
+        std::unordered_map<uint32_t, tRequest> m_mapRequests;
+        /// Deadlines of the pending requests
+        tDeadlines m_mapDeadlines;
+        /// Callbacks of asynchronous requests waiting for the callback thread
+        std::deque<std::function<void()>> m_qCallbacks;
+        /// Signals queued callbacks or the shutdown to the callback thread
+        std::condition_variable m_cvCallbacks;
+        /// Signals that the callback thread called all queued callbacks
+        std::condition_variable m_cvCallbacksDone;
+        /// Whether the callback thread is calling a callback
+        bool m_bCallbackRunning;
+        /// Whether the threads shall stop
+        bool m_bShutdown;
+        /// Thread completing the requests whose timeouts expired
+        std::thread m_oTimerThread;
+        /// Thread calling the callbacks of the asynchronous requests
+        std::thread m_oCallbackThread;
+};
+}
+
+}//ns fep
+
+#endif //FEP_RPC_PENDING_REQUESTS_H_IMPL_INCLUDED
@@ -31,6 +31,7 @@
 #endif
 
 #include "fep_errors.h"
+#include "perfmeasure/fep_trace.h"
 #include "timer_scheduler_impl.h"
 
 namespace fep
@@ -178,6 +179,7 @@ void cTimerScheduler::ProcessSchedulerQueueSynchron(timestamp_t tmCurrent, times
         }
 
         std::promise<void> oFinished;
+        FEP_TRACE_INSTANT_VALUE("WakeUpTimer", "scheduler", current_time_for_call);
         sTimerInfo.pTimer->WakeUp(current_time_for_call, &oFinished);
         oLock.unlock();
         // in this case we have to wait until the timer has finished processing
@@ -237,6 +239,7 @@ void cTimerScheduler::ProcessSchedulerQueueAsynchron(timestamp_t tmCurrent, time
                 // the item must be triggered
 
                 // wakeup the thread
+                FEP_TRACE_INSTANT_VALUE("WakeUpTimer", "scheduler", tmCurrent);
                 itTimer->pTimer->WakeUp(tmCurrent);
 
                 if (itTimer->tmPeriod <= 0)
@@ -49,6 +49,7 @@ JobRuntimeCheck::JobRuntimeCheck(
     fep::IIncidentHandler& incident_handler,
     std::function<fep::Result()> set_participant_to_error_state)
     : _name(name),
+      _trace_point(trace::RegisterTracePoint(name.c_str(), "job")),
       _time_violation_strategy(time_violation_strategy),
       _max_runtime(max_runtime),
       _incident_handler(incident_handler),
@@ -66,8 +67,14 @@ fep::Result JobRuntimeCheck::runJob(const timestamp_t trigger_time, fep::ISchedu
     }
 
     _skip_output = false;
+    trace::cTraceSpan job_span(_trace_point);
 
-    if (fep::isFailed(job.executeDataIn(trigger_time)))
+    fep::Result data_in_result;
+    {
+        FEP_TRACE_SPAN("executeDataIn", "job");
+        data_in_result = job.executeDataIn(trigger_time);
+    }
+    if (fep::isFailed(data_in_result))
     {
         INVOKE_INCIDENT(
             _incident_handler,
@@ -79,7 +86,11 @@ fep::Result JobRuntimeCheck::runJob(const timestamp_t trigger_time, fep::ISchedu
     }
 
     auto start = std::chrono::high_resolution_clock::now();
-    fep::Result result = job.execute(trigger_time);
+    fep::Result result;
+    {
+        FEP_TRACE_SPAN("execute", "job");
+        result = job.execute(trigger_time);
+    }
     auto end = std::chrono::high_resolution_clock::now();
 
     auto execution_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
@@ -102,7 +113,12 @@ fep::Result JobRuntimeCheck::runJob(const timestamp_t trigger_time, fep::ISchedu
 
     if (!_skip_output)
     {
-        if (fep::isFailed(job.executeDataOut(trigger_time)))
+        fep::Result data_out_result;
+        {
+            FEP_TRACE_SPAN("executeDataOut", "job");
+            data_out_result = job.executeDataOut(trigger_time);
+        }
+        if (fep::isFailed(data_out_result))
         {
             INVOKE_INCIDENT(
                 _incident_handler,
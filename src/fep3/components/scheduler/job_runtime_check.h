@@ -29,6 +29,7 @@
 #include <a_util/base/types.h>
 
 #include "fep_result_decl.h"
+#include "perfmeasure/fep_trace.h"
 #include "fep3/components/scheduler/scheduler_job_config.h"
 #include "fep3/components/scheduler/scheduler_service_intf.h"
 
@@ -52,6 +53,8 @@ private:
 
 private:
     const std::string _name;
+    /// trace point named after the job, the whole run of the job is traced
+    const trace::tTracePoint _trace_point;
     fep::JobConfiguration::TimeViolationStrategy _time_violation_strategy;
     timestamp_t _max_runtime;
     fep::IIncidentHandler& _incident_handler;
@@ -30,6 +30,8 @@
 #include "fep_errors.h"
 #include "fep_sdk_participant_version.h"
 #include "messages/fep_message.h"
+#include "messages/fep_message_binary_codec.h"
+#include "messages/fep_message_routing.h"
 
 #if __GNUC__
 // Avoid lots of warnings in libjson
@@ -64,6 +66,10 @@ private:
     std::string m_strSender;
     timestamp_t m_tmTimeStamp;
     timestamp_t m_tmSimTime;
+    /// Additional encodings the sender decodes (see cMessageBinaryCodec)
+    std::string m_strEncodings;
+    /// Routings the sender supports (see cMessageRouting)
+    std::string m_strRouting;
     std::string m_strRepresentation;
 };
 
@@ -109,6 +115,16 @@ cMessage::cMessage(char const * strMessage)
         {
             _d->m_tmSimTime = a_util::strings::toInt64(pNodeIter->as_string());
         }
+        pNodeIter = pHeaderNodeIter->find(cMessageBinaryCodec::s_strEncodingsField);
+        if (pHeaderNodeIter->end() != pNodeIter)
+        {
+            _d->m_strEncodings = pNodeIter->as_string().c_str();
+        }
+        pNodeIter = pHeaderNodeIter->find(cMessageRouting::s_strRoutingField);
+        if (pHeaderNodeIter->end() != pNodeIter)
+        {
+            _d->m_strRouting = pNodeIter->as_string().c_str();
+        }
     }
     CreateStringRepresentation();
 }
@@ -123,6 +139,8 @@ cMessage::cMessage(const char* strSender,
     _d->m_strSender = strSender;
     _d->m_tmTimeStamp = tmTimeStamp;
     _d->m_tmSimTime = tmSimTime;
+    _d->m_strEncodings = cMessageBinaryCodec::s_strBinaryEncoding;
+    _d->m_strRouting = cMessageRouting::s_strInboxRouting;
     CreateStringRepresentation();
 }
 
@@ -144,6 +162,8 @@ cMessage &cMessage::operator=(const cMessage &oOther)
         _d->m_strSender = oOther._d->m_strSender;
         _d->m_tmTimeStamp = oOther._d->m_tmTimeStamp;
         _d->m_tmSimTime = oOther._d->m_tmSimTime;
+        _d->m_strEncodings = oOther._d->m_strEncodings;
+        _d->m_strRouting = oOther._d->m_strRouting;
     }
 
     return *this;
@@ -202,6 +222,16 @@ fep::Result cMessage::CreateStringRepresentation()
     oHeaderNode.push_back(JSONNode("Timestamp", strTimeStamp.c_str()));
     strTimeStamp = a_util::strings::format("%lld", GetSimulationTime());
     oHeaderNode.push_back(JSONNode("SimTime", strTimeStamp.c_str()));
+    if (!_d->m_strEncodings.empty())
+    {
+        oHeaderNode.push_back(JSONNode(cMessageBinaryCodec::s_strEncodingsField,
+            _d->m_strEncodings.c_str()));
+    }
+    if (!_d->m_strRouting.empty())
+    {
+        oHeaderNode.push_back(JSONNode(cMessageRouting::s_strRoutingField,
+            _d->m_strRouting.c_str()));
+    }
     oCompleteNode.push_back(oHeaderNode);
     std::string strTmp = libjson::to_std_string((oCompleteNode.write_formatted()));
     _d->m_strRepresentation = std::string(strTmp.c_str());
@@ -0,0 +1,771 @@
+/**
+ * Implementation of the binary encoding of messages.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <cstring>
+
+#include "messages/fep_command_control.h"
+#include "messages/fep_command_custom.h"
+#include "messages/fep_command_listener_intf.h"
+#include "messages/fep_command_delete_property.h"
+#include "messages/fep_command_get_property.h"
+#include "messages/fep_command_get_schedule.h"
+#include "messages/fep_command_get_signal_info.h"
+#include "messages/fep_command_name_change.h"
+#include "messages/fep_command_reg_prop_listener.h"
+#include "messages/fep_command_resolve_signal_type.h"
+#include "messages/fep_command_rpc.h"
+#include "messages/fep_command_set_property.h"
+#include "messages/fep_command_unreg_prop_listener.h"
+#include "messages/fep_message_binary_codec.h"
+#include "messages/fep_notification_incident.h"
+#include "messages/fep_notification_listener_intf.h"
+#include "messages/fep_notification_name_changed.h"
+#include "messages/fep_notification_resultcode.h"
+#include "messages/fep_notification_signal_description.h"
+#include "messages/fep_notification_state.h"
+#include "messages/fep_notification_unreg_prop_listener_ack.h"
+
+using namespace fep;
+
+const char* const cMessageBinaryCodec::s_strEncodingsField = "Encodings";
+const char* const cMessageBinaryCodec::s_strBinaryEncoding = "binary";
+
+namespace
+{
+    /// Type ids of the binary encoded messages, never change the value of an existing type
+    enum tBinaryMessageType : uint8_t
+    {
+        bmt_control = 0x01,
+        bmt_set_property = 0x02,
+        bmt_get_property = 0x03,
+        bmt_delete_property = 0x04,
+        bmt_reg_prop_listener = 0x05,
+        bmt_unreg_prop_listener = 0x06,
+        bmt_signal_info = 0x07,
+        bmt_resolve_signal_description = 0x08,
+        bmt_name_change = 0x09,
+        bmt_get_schedule = 0x0A,
+        bmt_rpc = 0x0B,
+        bmt_custom = 0x0C,
+
+        bmt_log = 0x41,
+        bmt_state = 0x42,
+        bmt_name_changed = 0x43,
+        bmt_unreg_prop_listener_ack = 0x44,
+        bmt_signal_description = 0x45,
+        bmt_result_code = 0x46
+    };
+
+    /// Kind of the value of a binary encoded set property command
+    enum tPropertyValueKind : uint8_t
+    {
+        pvk_bool = 0,
+        pvk_int32 = 1,
+        pvk_double = 2,
+        pvk_string = 3
+    };
+
+    /// Offset of the type id within the header
+    const size_t s_szTypeOffset = 4;
+
+    /// Appends the fields of a binary message to a buffer
+    class cBinaryWriter
+    {
+    public:
+        /// CTOR
+        explicit cBinaryWriter(std::vector<uint8_t>& vecBuffer) : m_vecBuffer(vecBuffer)
+        {
+        }
+
+        void WriteUInt8(uint8_t nValue)
+        {
+            m_vecBuffer.push_back(nValue);
+        }
+
+        void WriteUInt32(uint32_t nValue)
+        {
+            for (size_t nByte = 0; nByte < sizeof(nValue); ++nByte)
+            {
+                m_vecBuffer.push_back(static_cast<uint8_t>(nValue >> (8 * nByte)));
+            }
+        }
+
+        void WriteInt32(int32_t nValue)
+        {
+            WriteUInt32(static_cast<uint32_t>(nValue));
+        }
+
+        void WriteUInt64(uint64_t nValue)
+        {
+            for (size_t nByte = 0; nByte < sizeof(nValue); ++nByte)
+            {
+                m_vecBuffer.push_back(static_cast<uint8_t>(nValue >> (8 * nByte)));
+            }
+        }
+
+        void WriteInt64(int64_t nValue)
+        {
+            WriteUInt64(static_cast<uint64_t>(nValue));
+        }
+
+        void WriteDouble(double f64Value)
+        {
+            uint64_t nBits;
+            memcpy(&nBits, &f64Value, sizeof(nBits));
+            WriteUInt64(nBits);
+        }
+
+        /// Writes the length as varint followed by the characters, NULL is written as ""
+        void WriteString(const char* strValue)
+        {
+            const size_t szLength = strValue ? strlen(strValue) : 0;
+            size_t szRemaining = szLength;
+            while (szRemaining >= 0x80)
+            {
+                m_vecBuffer.push_back(static_cast<uint8_t>(szRemaining | 0x80));
+                szRemaining >>= 7;
+            }
+            m_vecBuffer.push_back(static_cast<uint8_t>(szRemaining));
+            if (0 < szLength)
+            {
+                m_vecBuffer.insert(m_vecBuffer.end(), reinterpret_cast<const uint8_t*>(strValue),
+                    reinterpret_cast<const uint8_t*>(strValue) + szLength);
+            }
+        }
+
+    private:
+        /// The buffer
+        std::vector<uint8_t>& m_vecBuffer;
+    };
+
+    /// Reads the fields of a binary message, every read fails once the end is passed
+    class cBinaryReader
+    {
+    public:
+        /// CTOR
+        cBinaryReader(const uint8_t* pData, size_t szSize, size_t szOffset)
+            : m_pData(pData), m_szSize(szSize), m_szPos(szOffset)
+        {
+        }
+
+        bool ReadUInt8(uint8_t& nValue)
+        {
+            if (m_szPos + 1 > m_szSize)
+            {
+                return false;
+            }
+            nValue = m_pData[m_szPos++];
+            return true;
+        }
+
+        bool ReadUInt32(uint32_t& nValue)
+        {
+            if (m_szPos + sizeof(nValue) > m_szSize)
+            {
+                return false;
+            }
+            nValue = 0;
+            for (size_t nByte = 0; nByte < sizeof(nValue); ++nByte)
+            {
+                nValue |= static_cast<uint32_t>(m_pData[m_szPos++]) << (8 * nByte);
+            }
+            return true;
+        }
+
+        bool ReadInt32(int32_t& nValue)
+        {
+            uint32_t nRaw;
+            if (!ReadUInt32(nRaw))
+            {
+                return false;
+            }
+            nValue = static_cast<int32_t>(nRaw);
+            return true;
+        }
+
+        bool ReadUInt64(uint64_t& nValue)
+        {
+            if (m_szPos + sizeof(nValue) > m_szSize)
+            {
+                return false;
+            }
+            nValue = 0;
+            for (size_t nByte = 0; nByte < sizeof(nValue); ++nByte)
+            {
+                nValue |= static_cast<uint64_t>(m_pData[m_szPos++]) << (8 * nByte);
+            }
+            return true;
+        }
+
+        bool ReadInt64(int64_t& nValue)
+        {
+            uint64_t nRaw;
+            if (!ReadUInt64(nRaw))
+            {
+                return false;
+            }
+            nValue = static_cast<int64_t>(nRaw);
+            return true;
+        }
+
+        bool ReadDouble(double& f64Value)
+        {
+            uint64_t nBits;
+            if (!ReadUInt64(nBits))
+            {
+                return false;
+            }
+            memcpy(&f64Value, &nBits, sizeof(f64Value));
+            return true;
+        }
+
+        bool ReadString(std::string& strValue)
+        {
+            uint64_t nLength = 0;
+            for (size_t nShift = 0; ; nShift += 7)
+            {
+                uint8_t nByte;
+                // a length beyond 32 bit is malformed
+                if (nShift > 28 || !ReadUInt8(nByte))
+                {
+                    return false;
+                }
+                nLength |= static_cast<uint64_t>(nByte & 0x7F) << nShift;
+                if (0 == (nByte & 0x80))
+                {
+                    break;
+                }
+            }
+            if (nLength > m_szSize - m_szPos)
+            {
+                return false;
+            }
+            strValue.assign(reinterpret_cast<const char*>(m_pData + m_szPos),
+                static_cast<size_t>(nLength));
+            m_szPos += static_cast<size_t>(nLength);
+            return true;
+        }
+
+        /// @return Position of the next field
+        size_t GetPosition() const
+        {
+            return m_szPos;
+        }
+
+    private:
+        /// The message
+        const uint8_t* m_pData;
+        /// Size of the message
+        size_t m_szSize;
+        /// Position of the next field
+        size_t m_szPos;
+    };
+
+    /// Encodes the fields of a message, fails with ERR_NOT_SUPPORTED if the type does not match
+    typedef fep::Result (*tEncodeFunc)(const IMessage* poMessage, cBinaryWriter& oWriter);
+    /// Decodes the fields of a message and provides it to the matching listener
+    typedef fep::Result (*tDecodeFunc)(cBinaryReader& oReader,
+        const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener& oCommandListener, INotificationListener& oNotificationListener);
+
+    /// Encoder and decoder of a message class
+    struct tMessageCodec
+    {
+        /// Type id of the message class
+        tBinaryMessageType nType;
+        /// The encoder
+        tEncodeFunc pEncode;
+        /// The decoder
+        tDecodeFunc pDecode;
+    };
+
+    // Every message class implementing only a single string field is handled alike
+    template <typename INTERFACE, const char* (INTERFACE::*GETTER)() const>
+    fep::Result EncodeStringField(const IMessage* poMessage, cBinaryWriter& oWriter)
+    {
+        const INTERFACE* poTyped = dynamic_cast<const INTERFACE*>(poMessage);
+        if (!poTyped)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+        oWriter.WriteString((poTyped->*GETTER)());
+        return ERR_NOERROR;
+    }
+
+    template <typename CLASS>
+    fep::Result DecodeStringFieldCommand(cBinaryReader& oReader,
+        const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener& oCommandListener, INotificationListener&)
+    {
+        std::string strValue;
+        if (!oReader.ReadString(strValue))
+        {
+            return ERR_INVALID_ARG;
+        }
+        CLASS oCommand(strValue.c_str(), sHeader.strSender.c_str(), sHeader.strReceiver.c_str(),
+            sHeader.tmTimeStamp, sHeader.tmSimTime);
+        return oCommandListener.Update(&oCommand);
+    }
+
+    template <typename CLASS>
+    fep::Result DecodeStringFieldNotification(cBinaryReader& oReader,
+        const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener&, INotificationListener& oNotificationListener)
+    {
+        std::string strValue;
+        if (!oReader.ReadString(strValue))
+        {
+            return ERR_INVALID_ARG;
+        }
+        CLASS oNotification(strValue.c_str(), sHeader.strSender.c_str(),
+            sHeader.strReceiver.c_str(), sHeader.tmTimeStamp, sHeader.tmSimTime);
+        return oNotificationListener.Update(&oNotification);
+    }
+
+    // Message classes without any field
+    template <typename INTERFACE>
+    fep::Result EncodeNoField(const IMessage* poMessage, cBinaryWriter&)
+    {
+        return dynamic_cast<const INTERFACE*>(poMessage) ? ERR_NOERROR : ERR_NOT_SUPPORTED;
+    }
+
+    template <typename CLASS>
+    fep::Result DecodeNoFieldCommand(cBinaryReader&, const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener& oCommandListener, INotificationListener&)
+    {
+        CLASS oCommand(sHeader.strSender.c_str(), sHeader.strReceiver.c_str(),
+            sHeader.tmTimeStamp, sHeader.tmSimTime);
+        return oCommandListener.Update(&oCommand);
+    }
+
+    fep::Result EncodeControl(const IMessage* poMessage, cBinaryWriter& oWriter)
+    {
+        const IControlCommand* poCommand = dynamic_cast<const IControlCommand*>(poMessage);
+        if (!poCommand)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+        oWriter.WriteInt32(static_cast<int32_t>(poCommand->GetEvent()));
+        return ERR_NOERROR;
+    }
+
+    fep::Result DecodeControl(cBinaryReader& oReader, const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener& oCommandListener, INotificationListener&)
+    {
+        int32_t nEvent;
+        if (!oReader.ReadInt32(nEvent))
+        {
+            return ERR_INVALID_ARG;
+        }
+        cControlCommand oCommand(static_cast<tControlEvent>(nEvent), sHeader.strSender.c_str(),
+            sHeader.strReceiver.c_str(), sHeader.tmTimeStamp, sHeader.tmSimTime);
+        return oCommandListener.Update(&oCommand);
+    }
+
+    fep::Result EncodeSetProperty(const IMessage* poMessage, cBinaryWriter& oWriter)
+    {
+        const ISetPropertyCommand* poCommand = dynamic_cast<const ISetPropertyCommand*>(poMessage);
+        // arrays keep the JSON representation
+        if (!poCommand || poCommand->IsArray())
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+        fep::Result nResult = ERR_NOT_SUPPORTED;
+        if (poCommand->IsBoolean())
+        {
+            bool bValue = false;
+            nResult = poCommand->GetValue(bValue);
+            oWriter.WriteUInt8(pvk_bool);
+            oWriter.WriteUInt8(bValue ? 1 : 0);
+        }
+        else if (poCommand->IsInteger())
+        {
+            int32_t nValue = 0;
+            nResult = poCommand->GetValue(nValue);
+            oWriter.WriteUInt8(pvk_int32);
+            oWriter.WriteInt32(nValue);
+        }
+        else if (poCommand->IsFloat())
+        {
+            double f64Value = 0.0;
+            nResult = poCommand->GetValue(f64Value);
+            oWriter.WriteUInt8(pvk_double);
+            oWriter.WriteDouble(f64Value);
+        }
+        else if (poCommand->IsString())
+        {
+            const char* strValue = NULL;
+            nResult = poCommand->GetValue(strValue);
+            oWriter.WriteUInt8(pvk_string);
+            oWriter.WriteString(strValue);
+        }
+        if (fep::isOk(nResult))
+        {
+            oWriter.WriteString(poCommand->GetPropertyPath());
+        }
+        return fep::isOk(nResult) ? ERR_NOERROR : ERR_NOT_SUPPORTED;
+    }
+
+    fep::Result DecodeSetProperty(cBinaryReader& oReader, const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener& oCommandListener, INotificationListener&)
+    {
+        uint8_t nKind;
+        if (!oReader.ReadUInt8(nKind))
+        {
+            return ERR_INVALID_ARG;
+        }
+        bool bValue = false;
+        int32_t nValue = 0;
+        double f64Value = 0.0;
+        std::string strValue;
+        bool bRead = false;
+        switch (nKind)
+        {
+            case pvk_bool:
+            {
+                uint8_t nBool;
+                bRead = oReader.ReadUInt8(nBool);
+                bValue = 0 != nBool;
+                break;
+            }
+            case pvk_int32:
+                bRead = oReader.ReadInt32(nValue);
+                break;
+            case pvk_double:
+                bRead = oReader.ReadDouble(f64Value);
+                break;
+            case pvk_string:
+                bRead = oReader.ReadString(strValue);
+                break;
+            default:
+                break;
+        }
+        std::string strPath;
+        if (!bRead || !oReader.ReadString(strPath))
+        {
+            return ERR_INVALID_ARG;
+        }
+        const char* strSender = sHeader.strSender.c_str();
+        const char* strReceiver = sHeader.strReceiver.c_str();
+        switch (nKind)
+        {
+            case pvk_bool:
+            {
+                cSetPropertyCommand oCommand(bValue, strPath.c_str(), strSender, strReceiver,
+                    sHeader.tmTimeStamp, sHeader.tmSimTime);
+                return oCommandListener.Update(&oCommand);
+            }
+            case pvk_int32:
+            {
+                cSetPropertyCommand oCommand(nValue, strPath.c_str(), strSender, strReceiver,
+                    sHeader.tmTimeStamp, sHeader.tmSimTime);
+                return oCommandListener.Update(&oCommand);
+            }
+            case pvk_double:
+            {
+                cSetPropertyCommand oCommand(f64Value, strPath.c_str(), strSender, strReceiver,
+                    sHeader.tmTimeStamp, sHeader.tmSimTime);
+                return oCommandListener.Update(&oCommand);
+            }
+            default:
+            {
+                cSetPropertyCommand oCommand(strValue.c_str(), strPath.c_str(), strSender,
+                    strReceiver, sHeader.tmTimeStamp, sHeader.tmSimTime);
+                return oCommandListener.Update(&oCommand);
+            }
+        }
+    }
+
+    fep::Result EncodeRPC(const IMessage* poMessage, cBinaryWriter& oWriter)
+    {
+        const IRPCCommand* poCommand = dynamic_cast<const IRPCCommand*>(poMessage);
+        if (!poCommand)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+        oWriter.WriteUInt8(static_cast<uint8_t>(poCommand->GetType()));
+        oWriter.WriteUInt32(poCommand->GetRequestid());
+        oWriter.WriteString(poCommand->GetRPCServerObject());
+        oWriter.WriteString(poCommand->GetRPCContent());
+        return ERR_NOERROR;
+    }
+
+    fep::Result DecodeRPC(cBinaryReader& oReader, const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener& oCommandListener, INotificationListener&)
+    {
+        uint8_t nType;
+        uint32_t nRequestId;
+        std::string strServerObject;
+        std::string strContent;
+        if (!oReader.ReadUInt8(nType) || !oReader.ReadUInt32(nRequestId)
+            || !oReader.ReadString(strServerObject) || !oReader.ReadString(strContent))
+        {
+            return ERR_INVALID_ARG;
+        }
+        cRPCCommand oCommand(static_cast<IRPCCommand::eRPCCommandType>(nType), sHeader.strSender,
+            sHeader.strReceiver, strServerObject, nRequestId, strContent,
+            sHeader.tmTimeStamp, sHeader.tmSimTime);
+        return oCommandListener.Update(&oCommand);
+    }
+
+    fep::Result EncodeCustom(const IMessage* poMessage, cBinaryWriter& oWriter)
+    {
+        const ICustomCommand* poCommand = dynamic_cast<const ICustomCommand*>(poMessage);
+        if (!poCommand)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+        oWriter.WriteString(poCommand->GetName());
+        oWriter.WriteString(poCommand->GetParameters());
+        return ERR_NOERROR;
+    }
+
+    fep::Result DecodeCustom(cBinaryReader& oReader, const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener& oCommandListener, INotificationListener&)
+    {
+        std::string strName;
+        std::string strParameters;
+        if (!oReader.ReadString(strName) || !oReader.ReadString(strParameters))
+        {
+            return ERR_INVALID_ARG;
+        }
+        cCustomCommand oCommand(strName.c_str(), strParameters.c_str(), sHeader.strSender.c_str(),
+            sHeader.strReceiver.c_str(), sHeader.tmTimeStamp, sHeader.tmSimTime);
+        return oCommandListener.Update(&oCommand);
+    }
+
+    fep::Result EncodeIncident(const IMessage* poMessage, cBinaryWriter& oWriter)
+    {
+        const IIncidentNotification* poNotification =
+            dynamic_cast<const IIncidentNotification*>(poMessage);
+        if (!poNotification)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+        oWriter.WriteInt32(poNotification->GetIncidentCode());
+        oWriter.WriteInt32(static_cast<int32_t>(poNotification->GetSeverity()));
+        oWriter.WriteString(poNotification->GetDescription());
+        return ERR_NOERROR;
+    }
+
+    fep::Result DecodeIncident(cBinaryReader& oReader, const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener&, INotificationListener& oNotificationListener)
+    {
+        int32_t nCode;
+        int32_t nSeverity;
+        std::string strDescription;
+        if (!oReader.ReadInt32(nCode) || !oReader.ReadInt32(nSeverity)
+            || !oReader.ReadString(strDescription))
+        {
+            return ERR_INVALID_ARG;
+        }
+        cIncidentNotification oNotification(static_cast<int16_t>(nCode), strDescription.c_str(),
+            static_cast<tSeverityLevel>(nSeverity), sHeader.strSender.c_str(),
+            sHeader.strReceiver.c_str(), sHeader.tmTimeStamp, sHeader.tmSimTime);
+        return oNotificationListener.Update(&oNotification);
+    }
+
+    fep::Result EncodeState(const IMessage* poMessage, cBinaryWriter& oWriter)
+    {
+        const IStateNotification* poNotification = dynamic_cast<const IStateNotification*>(poMessage);
+        if (!poNotification)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+        oWriter.WriteInt32(static_cast<int32_t>(poNotification->GetState()));
+        return ERR_NOERROR;
+    }
+
+    fep::Result DecodeState(cBinaryReader& oReader, const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener&, INotificationListener& oNotificationListener)
+    {
+        int32_t nState;
+        if (!oReader.ReadInt32(nState))
+        {
+            return ERR_INVALID_ARG;
+        }
+        cStateNotification oNotification(static_cast<tState>(nState), sHeader.strSender.c_str(),
+            sHeader.strReceiver.c_str(), sHeader.tmTimeStamp, sHeader.tmSimTime);
+        return oNotificationListener.Update(&oNotification);
+    }
+
+    fep::Result EncodeResultCode(const IMessage* poMessage, cBinaryWriter& oWriter)
+    {
+        const IResultCodeNotification* poNotification =
+            dynamic_cast<const IResultCodeNotification*>(poMessage);
+        if (!poNotification)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+        oWriter.WriteInt64(poNotification->GetCommandCookie());
+        oWriter.WriteInt32(poNotification->GetResultCode().getErrorCode());
+        return ERR_NOERROR;
+    }
+
+    fep::Result DecodeResultCode(cBinaryReader& oReader, const cMessageBinaryCodec::tHeader& sHeader,
+        ICommandListener&, INotificationListener& oNotificationListener)
+    {
+        int64_t nCookie;
+        int32_t nResultCode;
+        if (!oReader.ReadInt64(nCookie) || !oReader.ReadInt32(nResultCode))
+        {
+            return ERR_INVALID_ARG;
+        }
+        cResultCodeNotification oNotification(nCookie, fep::Result(nResultCode),
+            sHeader.strSender.c_str(), sHeader.strReceiver.c_str(),
+            sHeader.tmTimeStamp, sHeader.tmSimTime);
+        return oNotificationListener.Update(&oNotification);
+    }
+
+    /// The message classes with a binary encoding, most frequent first
+    const tMessageCodec s_aCodecs[] =
+    {
+        { bmt_state, &EncodeState, &DecodeState },
+        { bmt_rpc, &EncodeRPC, &DecodeRPC },
+        { bmt_control, &EncodeControl, &DecodeControl },
+        { bmt_result_code, &EncodeResultCode, &DecodeResultCode },
+        { bmt_log, &EncodeIncident, &DecodeIncident },
+        { bmt_set_property, &EncodeSetProperty, &DecodeSetProperty },
+        { bmt_get_property,
+            &EncodeStringField<IGetPropertyCommand, &IGetPropertyCommand::GetPropertyPath>,
+            &DecodeStringFieldCommand<cGetPropertyCommand> },
+        { bmt_delete_property,
+            &EncodeStringField<IDeletePropertyCommand, &IDeletePropertyCommand::GetPropertyPath>,
+            &DecodeStringFieldCommand<cDeletePropertyCommand> },
+        { bmt_reg_prop_listener,
+            &EncodeStringField<IRegPropListenerCommand, &IRegPropListenerCommand::GetPropertyPath>,
+            &DecodeStringFieldCommand<cRegPropListenerCommand> },
+        { bmt_unreg_prop_listener,
+            &EncodeStringField<IUnregPropListenerCommand, &IUnregPropListenerCommand::GetPropertyPath>,
+            &DecodeStringFieldCommand<cUnregPropListenerCommand> },
+        { bmt_signal_info, &EncodeNoField<IGetSignalInfoCommand>,
+            &DecodeNoFieldCommand<cGetSignalInfoCommand> },
+        { bmt_resolve_signal_description,
+            &EncodeStringField<IResolveSignalTypeCommand, &IResolveSignalTypeCommand::GetSignalType>,
+            &DecodeStringFieldCommand<cResolveSignalTypeCommand> },
+        { bmt_name_change,
+            &EncodeStringField<INameChangeCommand, &INameChangeCommand::GetNewName>,
+            &DecodeStringFieldCommand<cNameChangeCommand> },
+        { bmt_get_schedule, &EncodeNoField<IGetScheduleCommand>,
+            &DecodeNoFieldCommand<cGetScheduleCommand> },
+        { bmt_custom, &EncodeCustom, &DecodeCustom },
+        { bmt_name_changed,
+            &EncodeStringField<INameChangedNotification, &INameChangedNotification::GetOldParticipantName>,
+            &DecodeStringFieldNotification<cNameChangedNotification> },
+        { bmt_unreg_prop_listener_ack,
+            &EncodeStringField<IUnregPropListenerAckNotification,
+                &IUnregPropListenerAckNotification::GetPropertyPath>,
+            &DecodeStringFieldNotification<cUnregPropListenerAckNotification> },
+        { bmt_signal_description,
+            &EncodeStringField<ISignalDescriptionNotification,
+                &ISignalDescriptionNotification::GetSignalDescription>,
+            &DecodeStringFieldNotification<cSignalDescriptionNotification> },
+    };
+}
+
+bool cMessageBinaryCodec::IsBinary(const void* pData, size_t szSize)
+{
+    return NULL != pData && 0 < szSize && s_nMagic == *static_cast<const uint8_t*>(pData);
+}
+
+fep::Result cMessageBinaryCodec::Encode(const IMessage* poMessage, std::vector<uint8_t>& vecBuffer)
+{
+    if (!poMessage)
+    {
+        return ERR_POINTER;
+    }
+    vecBuffer.clear();
+    cBinaryWriter oWriter(vecBuffer);
+    oWriter.WriteUInt8(s_nMagic);
+    oWriter.WriteUInt8(s_nFormatVersion);
+    oWriter.WriteUInt8(poMessage->GetMajorVersion());
+    oWriter.WriteUInt8(poMessage->GetMinorVersion());
+    // the type is filled in once the encoder is known
+    oWriter.WriteUInt8(0);
+    oWriter.WriteInt64(poMessage->GetTimeStamp());
+    oWriter.WriteInt64(poMessage->GetSimulationTime());
+    oWriter.WriteString(poMessage->GetSender());
+    oWriter.WriteString(poMessage->GetReceiver());
+    const size_t szHeaderSize = vecBuffer.size();
+
+    for (const tMessageCodec& sCodec : s_aCodecs)
+    {
+        if (fep::isOk(sCodec.pEncode(poMessage, oWriter)))
+        {
+            vecBuffer[s_szTypeOffset] = sCodec.nType;
+            return ERR_NOERROR;
+        }
+        // a failing encoder might have written fields already
+        vecBuffer.resize(szHeaderSize);
+    }
+    return ERR_NOT_SUPPORTED;
+}
+
+fep::Result cMessageBinaryCodec::DecodeHeader(const void* pData, size_t szSize, tHeader& sHeader)
+{
+    if (!pData)
+    {
+        return ERR_POINTER;
+    }
+    cBinaryReader oReader(static_cast<const uint8_t*>(pData), szSize, 0);
+    uint8_t nMagic;
+    uint8_t nFormatVersion;
+    if (!oReader.ReadUInt8(nMagic) || !oReader.ReadUInt8(nFormatVersion))
+    {
+        return ERR_INVALID_ARG;
+    }
+    if (s_nMagic != nMagic || s_nFormatVersion != nFormatVersion)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+    int64_t nTimeStamp;
+    int64_t nSimTime;
+    if (!oReader.ReadUInt8(sHeader.nMajorVersion) || !oReader.ReadUInt8(sHeader.nMinorVersion)
+        || !oReader.ReadUInt8(sHeader.nType) || !oReader.ReadInt64(nTimeStamp)
+        || !oReader.ReadInt64(nSimTime) || !oReader.ReadString(sHeader.strSender)
+        || !oReader.ReadString(sHeader.strReceiver))
+    {
+        return ERR_INVALID_ARG;
+    }
+    sHeader.tmTimeStamp = nTimeStamp;
+    sHeader.tmSimTime = nSimTime;
+    sHeader.szBodyOffset = oReader.GetPosition();
+    return ERR_NOERROR;
+}
+
+fep::Result cMessageBinaryCodec::Decode(const void* pData, size_t szSize, const tHeader& sHeader,
+    ICommandListener& oCommandListener, INotificationListener& oNotificationListener)
+{
+    if (!pData)
+    {
+        return ERR_POINTER;
+    }
+    for (const tMessageCodec& sCodec : s_aCodecs)
+    {
+        if (sCodec.nType == sHeader.nType)
+        {
+            cBinaryReader oReader(static_cast<const uint8_t*>(pData), szSize, sHeader.szBodyOffset);
+            return sCodec.pDecode(oReader, sHeader, oCommandListener, oNotificationListener);
+        }
+    }
+    return ERR_NOT_SUPPORTED;
+}
@@ -0,0 +1,139 @@
+/**
+ * Declaration of the binary encoding of messages.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_MESSAGE_BINARY_CODEC_H_
+#define _FEP_MESSAGE_BINARY_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <a_util/base/types.h>
+
+#include "fep_errors.h"
+
+namespace fep
+{
+    class IMessage;
+    class ICommandListener;
+    class INotificationListener;
+
+    /**
+     * Binary encoding of the messages of the message channel, an alternative to their JSON
+     * representation (\ref IMessage::ToString).
+     *
+     * A binary message starts with \ref s_nMagic, which never starts a JSON text, followed by
+     * the format version, the language version, the message type, the timestamps and the
+     * sender and receiver. The fields of the message follow in the order given by the encoder
+     * of its type. Integers are little endian, strings are prefixed by their length as
+     * LEB128 varint.
+     *
+     * Only messages with a flat set of fields have a binary encoding. Messages carrying
+     * property trees, schedules or signal lists as well as commands answered by cookie
+     * keep their JSON representation.
+     *
+     * Participants advertise that they decode binary messages in the header of their JSON
+     * messages (field \ref s_strEncodingsField).
+     */
+    class cMessageBinaryCodec
+    {
+    public:
+        /// First byte of a binary message
+        static const uint8_t s_nMagic = 0xFE;
+        /// Version of the binary format
+        static const uint8_t s_nFormatVersion = 1;
+        /// Name of the field in the JSON message header listing the additional encodings
+        static const char* const s_strEncodingsField;
+        /// Value of \ref s_strEncodingsField advertising the binary encoding
+        static const char* const s_strBinaryEncoding;
+
+        /// Header of a binary message
+        struct tHeader
+        {
+            /// Major language version of the message
+            uint8_t nMajorVersion;
+            /// Minor language version of the message
+            uint8_t nMinorVersion;
+            /// Type of the message
+            uint8_t nType;
+            /// Timestamp of the message
+            timestamp_t tmTimeStamp;
+            /// Simulation time of the message
+            timestamp_t tmSimTime;
+            /// Sender of the message
+            std::string strSender;
+            /// Receiver of the message (may contain wildcards)
+            std::string strReceiver;
+            /// Offset of the fields of the message
+            size_t szBodyOffset;
+        };
+
+    public:
+        /**
+         * @brief IsBinary Checks whether a received message is binary encoded
+         * @param [in] pData The message
+         * @param [in] szSize Size of the message
+         * @return Whether the message starts with \ref s_nMagic
+         */
+        static bool IsBinary(const void* pData, size_t szSize);
+
+        /**
+         * @brief Encode Encodes a message binary
+         * @param [in] poMessage The message
+         * @param [out] vecBuffer Receives the encoded message
+         * @retval ERR_NOERROR Everything went fine
+         * @retval ERR_POINTER poMessage is NULL
+         * @retval ERR_NOT_SUPPORTED The message has no binary encoding, use its JSON representation
+         */
+        static fep::Result Encode(const IMessage* poMessage, std::vector<uint8_t>& vecBuffer);
+
+        /**
+         * @brief DecodeHeader Decodes the header of a binary message
+         * @param [in] pData The message
+         * @param [in] szSize Size of the message
+         * @param [out] sHeader Receives the header
+         * @retval ERR_NOERROR Everything went fine
+         * @retval ERR_POINTER pData is NULL
+         * @retval ERR_NOT_SUPPORTED The message is no binary message of a supported format version
+         * @retval ERR_INVALID_ARG The message is truncated
+         */
+        static fep::Result DecodeHeader(const void* pData, size_t szSize, tHeader& sHeader);
+
+        /**
+         * @brief Decode Decodes a binary message into the matching message class and provides
+         * it to the matching listener
+         * @param [in] pData The message
+         * @param [in] szSize Size of the message
+         * @param [in] sHeader The header decoded by \ref DecodeHeader
+         * @param [in] oCommandListener Listener the message is provided to if it is a command
+         * @param [in] oNotificationListener Listener the message is provided to if it is a notification
+         * @return The result of the listener
+         * @retval ERR_POINTER pData is NULL
+         * @retval ERR_NOT_SUPPORTED The type of the message is unknown
+         * @retval ERR_INVALID_ARG The message is truncated or malformed
+         */
+        static fep::Result Decode(const void* pData, size_t szSize, const tHeader& sHeader,
+            ICommandListener& oCommandListener, INotificationListener& oNotificationListener);
+    };
+}
+
+#endif // _FEP_MESSAGE_BINARY_CODEC_H_
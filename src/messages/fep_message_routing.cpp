@@ -0,0 +1,42 @@
+/**
+ * Implementation of the routing of addressed messages.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <cstring>
+
+#include "messages/fep_message_routing.h"
+
+using namespace fep;
+
+const char* const cMessageRouting::s_strBroadcastChannel = "command";
+const char* const cMessageRouting::s_strRoutingField = "Routing";
+const char* const cMessageRouting::s_strInboxRouting = "inbox";
+
+std::string cMessageRouting::GetInboxChannel(const std::string& strParticipant)
+{
+    // internal channels start with an underscore, like "_StepTrigger"
+    return "_inbox_" + strParticipant;
+}
+
+bool cMessageRouting::IsSingleReceiver(const char* strReceiver)
+{
+    return NULL != strReceiver && '\0' != strReceiver[0] && NULL == strpbrk(strReceiver, "*?");
+}
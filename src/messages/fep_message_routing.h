@@ -0,0 +1,68 @@
+/**
+ * Declaration of the routing of addressed messages.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_MESSAGE_ROUTING_H_
+#define _FEP_MESSAGE_ROUTING_H_
+
+#include <string>
+
+namespace fep
+{
+    /**
+     * Routing of the messages of the message channel.
+     *
+     * Every participant listens on the broadcast channel and on an inbox channel of its own.
+     * Messages addressed to a single participant are sent to its inbox, so they are neither
+     * received nor parsed by anyone else. Messages to several participants (wildcards) and
+     * messages to participants that did not announce an inbox use the broadcast channel.
+     *
+     * Participants announce their inbox in the header of their JSON messages
+     * (field \ref s_strRoutingField).
+     */
+    class cMessageRouting
+    {
+    public:
+        /// Name of the broadcast channel
+        static const char* const s_strBroadcastChannel;
+        /// Name of the field in the JSON message header listing the supported routings
+        static const char* const s_strRoutingField;
+        /// Value of \ref s_strRoutingField announcing the inbox of the sender
+        static const char* const s_strInboxRouting;
+
+    public:
+        /**
+         * @brief GetInboxChannel Returns the name of the inbox channel of a participant
+         * @param [in] strParticipant Name of the participant
+         * @return The name of the channel
+         */
+        static std::string GetInboxChannel(const std::string& strParticipant);
+
+        /**
+         * @brief IsSingleReceiver Checks whether a receiver addresses a single participant
+         * @param [in] strReceiver The receiver of a message (may contain wildcards)
+         * @return Whether the receiver is a participant name without wildcards
+         */
+        static bool IsSingleReceiver(const char* strReceiver);
+    };
+}
+
+#endif // _FEP_MESSAGE_ROUTING_H_
@@ -373,6 +373,16 @@ fep::Result cModule::Create(const cModuleOptions& oModuleOptions,
         nResult = _d->_component_registry.create();
     }
 
+    if (fep::isOk(nResult))
+    {
+        // the receivers measure the latency of the input signals with the participant clock
+        _d->m_poBusAdapter->SetClockService(_d->_component_registry.getComponent<IClockService>());
+        _d->m_poTransportStatisticsServer.reset(
+            new detail::RPCTransportStatisticsServer(*_d->m_poBusAdapter));
+        nResult = _d->_component_registry.getComponent<IRPC>()->GetRegistry()->RegisterObjectServer(
+            rpc::IRPCTransportStatisticsDef::getRPCDefaultName(), *_d->m_poTransportStatisticsServer);
+    }
+
     if (fep::isOk(nResult))
     {
         // register the _d Pointer as a catch-all strategy. The _d Pointer will
@@ -463,6 +473,22 @@ fep::Result cModule::cModulePrivate::Rollback()
         _p->DestroyDDBEntry(m_mapDDBEntries.begin()->first);
     } 
 
+    if (m_poTransportStatisticsServer)
+    {
+        IRPC* pRPC = _component_registry.getComponent<IRPC>();
+        if (NULL != pRPC)
+        {
+            pRPC->GetRegistry()->UnregisterObjectServer(
+                rpc::IRPCTransportStatisticsDef::getRPCDefaultName());
+        }
+        m_poTransportStatisticsServer.reset();
+    }
+    if (NULL != m_poBusAdapter)
+    {
+        // the clock service is destroyed along with the components
+        m_poBusAdapter->SetClockService(NULL);
+    }
+
     auto res_destroy = _component_registry.destroy();
     if (isFailed(res_destroy))
     {
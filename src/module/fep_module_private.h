@@ -23,6 +23,7 @@
 #ifndef _FEP_MODULE_PRIVATE_H_
 #define _FEP_MODULE_PRIVATE_H_
 
+#include <memory>
 #include <a_util/concurrency.h>
 #include "module/fep_module.h"
 #include "module/fep_module_private_intf.h"
@@ -36,6 +37,7 @@
 #include "fep_dptr.h"
 #include "statemachine/fep_state_request_listener.h"
 #include "statemachine/fep_state_exit_listener_intf.h"
+#include "transmission_adapter/fep_transport_statistics_service.h"
 
 namespace fep
 {
@@ -234,6 +236,8 @@ namespace fep
         ComponentRegistry _component_registry;
         /// The transmission adapter.
         fep::cTransmissionAdapter* m_poBusAdapter;
+        /// The RPC service publishing the transport statistics of the bus adapter
+        std::unique_ptr<detail::RPCTransportStatisticsServer> m_poTransportStatisticsServer;
         /// The state machine.
         fep::cStateMachine* m_poStateMachine;
         /// The fep event handler for this specific module
@@ -0,0 +1,364 @@
+/**
+ * Implementation of the runtime switchable tracing of the participant.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <a_util/process/process.h>
+
+#include "perfmeasure/fep_trace.h"
+
+namespace fep
+{
+namespace trace
+{
+namespace detail
+{
+    std::atomic<bool> g_bEnabled(false);
+}
+
+namespace
+{
+    /// Phase of a recorded event (as used by the Chrome Trace Event format)
+    enum tPhase : uint8_t
+    {
+        phase_complete,
+        phase_instant,
+        phase_instant_value
+    };
+
+    /// A recorded event
+    struct tTraceEvent
+    {
+        /// Begin of the event in ns
+        uint64_t nTimestamp_ns;
+        /// Duration of a span in ns, value of an instant event
+        int64_t nValue;
+        /// The trace point
+        tTracePoint nTracePoint;
+        /// The phase
+        tPhase ePhase;
+    };
+
+    /// A registered trace point
+    struct tTracePointInfo
+    {
+        /// Name of the trace point
+        std::string strName;
+        /// Category of the trace point
+        std::string strCategory;
+    };
+
+    /**
+     * Ring buffer of the events of one thread. The owning thread is the only writer, the
+     * exporter reads the ring without synchronizing with the writer.
+     */
+    class cTraceRing
+    {
+    public:
+        /// CTOR
+        cTraceRing(size_t szCapacity, uint32_t nThreadId)
+            : m_vecEvents(szCapacity), m_szMask(szCapacity - 1), m_nWritePos(0),
+              m_nThreadId(nThreadId), m_bInUse(true)
+        {
+        }
+
+        /// Appends an event, overwriting the oldest one if the ring is full
+        void Push(const tTraceEvent& sEvent)
+        {
+            const uint64_t nPos = m_nWritePos.load(std::memory_order_relaxed);
+            m_vecEvents[nPos & m_szMask] = sEvent;
+            m_nWritePos.store(nPos + 1, std::memory_order_release);
+        }
+
+    public:
+        /// The events
+        std::vector<tTraceEvent> m_vecEvents;
+        /// Mask mapping a position to an index (the capacity is a power of two)
+        size_t m_szMask;
+        /// Number of events pushed so far
+        std::atomic<uint64_t> m_nWritePos;
+        /// Thread id shown in the trace
+        uint32_t m_nThreadId;
+        /// Whether a running thread records into this ring
+        std::atomic<bool> m_bInUse;
+    };
+
+    /// The trace points and rings of the process
+    struct tTraceRegistry
+    {
+        /// CTOR
+        tTraceRegistry() : m_szEventsPerThread(s_szDefaultEventsPerThread), m_nEpoch_ns(Now())
+        {
+        }
+
+        /// Reads the clock of the trace
+        static uint64_t Now()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        /// Protects all members
+        std::mutex m_oMutex;
+        /// The registered trace points, the index is the id
+        std::vector<tTracePointInfo> m_vecTracePoints;
+        /// Lookup of the trace points by category and name
+        std::map<std::pair<std::string, std::string>, tTracePoint> m_mapTracePoints;
+        /// The rings of all threads that ever recorded an event
+        std::vector<std::unique_ptr<cTraceRing>> m_vecRings;
+        /// Capacity of rings created from now on
+        size_t m_szEventsPerThread;
+        /// Events are exported relative to this point in time
+        uint64_t m_nEpoch_ns;
+    };
+
+    tTraceRegistry& GetRegistry()
+    {
+        // never destroyed: threads may still record while static objects are destroyed
+        static tTraceRegistry* s_pRegistry = new tTraceRegistry();
+        return *s_pRegistry;
+    }
+
+    /// Hands the ring of a thread back for reuse when the thread exits
+    struct tThreadRing
+    {
+        tThreadRing() : m_pRing(nullptr)
+        {
+        }
+
+        ~tThreadRing()
+        {
+            if (m_pRing)
+            {
+                m_pRing->m_bInUse.store(false, std::memory_order_release);
+            }
+        }
+
+        /// The ring of the thread
+        cTraceRing* m_pRing;
+    };
+
+    thread_local tThreadRing t_oThreadRing;
+
+    cTraceRing& GetThreadRing()
+    {
+        if (!t_oThreadRing.m_pRing)
+        {
+            tTraceRegistry& oRegistry = GetRegistry();
+            std::lock_guard<std::mutex> oLock(oRegistry.m_oMutex);
+            // the ring of an exited thread is reused, its events stay under its thread id
+            for (auto& pRing : oRegistry.m_vecRings)
+            {
+                if (!pRing->m_bInUse.load(std::memory_order_acquire)
+                    && pRing->m_vecEvents.size() == oRegistry.m_szEventsPerThread)
+                {
+                    pRing->m_bInUse.store(true, std::memory_order_relaxed);
+                    t_oThreadRing.m_pRing = pRing.get();
+                    break;
+                }
+            }
+            if (!t_oThreadRing.m_pRing)
+            {
+                oRegistry.m_vecRings.emplace_back(new cTraceRing(oRegistry.m_szEventsPerThread,
+                    static_cast<uint32_t>(oRegistry.m_vecRings.size() + 1)));
+                t_oThreadRing.m_pRing = oRegistry.m_vecRings.back().get();
+            }
+        }
+        return *t_oThreadRing.m_pRing;
+    }
+
+    /// Writes the string escaped as JSON string (including the quotes)
+    void WriteJsonString(FILE* pFile, const std::string& strValue)
+    {
+        fputc('"', pFile);
+        for (const char cChar : strValue)
+        {
+            if (cChar == '"' || cChar == '\\')
+            {
+                fputc('\\', pFile);
+                fputc(cChar, pFile);
+            }
+            else if (static_cast<unsigned char>(cChar) < 0x20)
+            {
+                fprintf(pFile, "\\u%04x", static_cast<unsigned int>(cChar));
+            }
+            else
+            {
+                fputc(cChar, pFile);
+            }
+        }
+        fputc('"', pFile);
+    }
+}
+
+namespace detail
+{
+    uint64_t Now()
+    {
+        return tTraceRegistry::Now();
+    }
+
+    void RecordSpan(tTracePoint nTracePoint, uint64_t nBegin_ns)
+    {
+        tTraceEvent sEvent;
+        sEvent.nTimestamp_ns = nBegin_ns;
+        sEvent.nValue = static_cast<int64_t>(Now() - nBegin_ns);
+        sEvent.nTracePoint = nTracePoint;
+        sEvent.ePhase = phase_complete;
+        GetThreadRing().Push(sEvent);
+    }
+
+    void RecordInstant(tTracePoint nTracePoint, int64_t nValue, bool bHasValue)
+    {
+        tTraceEvent sEvent;
+        sEvent.nTimestamp_ns = Now();
+        sEvent.nValue = nValue;
+        sEvent.nTracePoint = nTracePoint;
+        sEvent.ePhase = bHasValue ? phase_instant_value : phase_instant;
+        GetThreadRing().Push(sEvent);
+    }
+}
+
+tTracePoint RegisterTracePoint(const char* strName, const char* strCategory)
+{
+    tTraceRegistry& oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.m_oMutex);
+    const std::pair<std::string, std::string> oKey(strCategory ? strCategory : "",
+        strName ? strName : "");
+    auto itTracePoint = oRegistry.m_mapTracePoints.find(oKey);
+    if (itTracePoint != oRegistry.m_mapTracePoints.end())
+    {
+        return itTracePoint->second;
+    }
+    const tTracePoint nTracePoint = static_cast<tTracePoint>(oRegistry.m_vecTracePoints.size());
+    tTracePointInfo sInfo;
+    sInfo.strName = oKey.second;
+    sInfo.strCategory = oKey.first;
+    oRegistry.m_vecTracePoints.push_back(sInfo);
+    oRegistry.m_mapTracePoints[oKey] = nTracePoint;
+    return nTracePoint;
+}
+
+void Enable(size_t szEventsPerThread)
+{
+    size_t szCapacity = 1;
+    while (szCapacity < szEventsPerThread)
+    {
+        szCapacity <<= 1;
+    }
+    tTraceRegistry& oRegistry = GetRegistry();
+    {
+        std::lock_guard<std::mutex> oLock(oRegistry.m_oMutex);
+        oRegistry.m_szEventsPerThread = szCapacity;
+    }
+    detail::g_bEnabled.store(true, std::memory_order_relaxed);
+}
+
+void Disable()
+{
+    detail::g_bEnabled.store(false, std::memory_order_relaxed);
+}
+
+void Clear()
+{
+    tTraceRegistry& oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.m_oMutex);
+    for (auto& pRing : oRegistry.m_vecRings)
+    {
+        pRing->m_nWritePos.store(0, std::memory_order_relaxed);
+    }
+    oRegistry.m_nEpoch_ns = tTraceRegistry::Now();
+}
+
+fep::Result ExportChromeTrace(const char* strFile)
+{
+    if (!strFile)
+    {
+        return ERR_POINTER;
+    }
+    FILE* pFile = fopen(strFile, "w");
+    if (!pFile)
+    {
+        return ERR_OPEN_FAILED;
+    }
+
+    tTraceRegistry& oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.m_oMutex);
+    const unsigned long nProcessId = static_cast<unsigned long>(a_util::process::getCurrentProcessId());
+
+    fprintf(pFile, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    bool bFirst = true;
+    for (const auto& pRing : oRegistry.m_vecRings)
+    {
+        const uint64_t nWritePos = pRing->m_nWritePos.load(std::memory_order_acquire);
+        const uint64_t nCapacity = pRing->m_vecEvents.size();
+        const uint64_t nReadPos = nWritePos > nCapacity ? nWritePos - nCapacity : 0;
+        for (uint64_t nPos = nReadPos; nPos < nWritePos; ++nPos)
+        {
+            const tTraceEvent& sEvent = pRing->m_vecEvents[nPos & pRing->m_szMask];
+            if (sEvent.nTracePoint >= oRegistry.m_vecTracePoints.size()
+                || sEvent.nTimestamp_ns < oRegistry.m_nEpoch_ns)
+            {
+                continue;
+            }
+            const tTracePointInfo& sInfo = oRegistry.m_vecTracePoints[sEvent.nTracePoint];
+
+            fprintf(pFile, bFirst ? "\n{\"name\":" : ",\n{\"name\":");
+            bFirst = false;
+            WriteJsonString(pFile, sInfo.strName);
+            fprintf(pFile, ",\"cat\":");
+            WriteJsonString(pFile, sInfo.strCategory);
+            // the format expects microseconds
+            fprintf(pFile, ",\"pid\":%lu,\"tid\":%u,\"ts\":%.3f", nProcessId, pRing->m_nThreadId,
+                static_cast<double>(sEvent.nTimestamp_ns - oRegistry.m_nEpoch_ns) / 1000.0);
+            switch (sEvent.ePhase)
+            {
+                case phase_complete:
+                    fprintf(pFile, ",\"ph\":\"X\",\"dur\":%.3f}",
+                        static_cast<double>(sEvent.nValue) / 1000.0);
+                    break;
+                case phase_instant:
+                    fprintf(pFile, ",\"ph\":\"i\",\"s\":\"t\"}");
+                    break;
+                case phase_instant_value:
+                    fprintf(pFile, ",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"value\":%" PRId64 "}}",
+                        sEvent.nValue);
+                    break;
+            }
+        }
+    }
+    fprintf(pFile, "\n]}\n");
+
+    const bool bWritten = 0 == ferror(pFile);
+    fclose(pFile);
+    return bWritten ? ERR_NOERROR : ERR_FAILED;
+}
+
+} // namespace trace
+} // namespace fep
@@ -0,0 +1,195 @@
+/**
+ * Declaration of the runtime switchable tracing of the participant.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_TRACE_H_
+#define _FEP_TRACE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "fep_participant_export.h"
+#include "fep_errors.h"
+
+namespace fep
+{
+/**
+ * Tracing of the participant. Trace points are registered by name at runtime, every thread
+ * records its events into its own lock-free ring buffer (the oldest events are overwritten).
+ * Only the first event of a thread locks to allocate its ring buffer. While tracing is
+ * disabled a trace point costs a single relaxed load. The recorded events are exported in
+ * the Chrome Trace Event format, which is understood by chrome://tracing and Perfetto.
+ */
+namespace trace
+{
+    /// Id of a registered trace point
+    typedef uint32_t tTracePoint;
+
+    /// Default number of events kept per thread
+    static const size_t s_szDefaultEventsPerThread = 16384;
+
+    namespace detail
+    {
+        /// Whether tracing is enabled, use \ref IsEnabled
+        FEP_PARTICIPANT_EXPORT extern std::atomic<bool> g_bEnabled;
+
+        /// Records a span of the given trace point
+        FEP_PARTICIPANT_EXPORT void RecordSpan(tTracePoint nTracePoint, uint64_t nBegin_ns);
+        /// Records an instant event of the given trace point
+        FEP_PARTICIPANT_EXPORT void RecordInstant(tTracePoint nTracePoint, int64_t nValue,
+            bool bHasValue);
+        /// Reads the clock of the trace
+        FEP_PARTICIPANT_EXPORT uint64_t Now();
+    }
+
+    /**
+     * @brief RegisterTracePoint Registers a named trace point.
+     * Registering the same name and category again returns the id registered before.
+     * @param [in] strName Name of the trace point
+     * @param [in] strCategory Category of the trace point (used for filtering in the viewer)
+     * @return Id of the trace point
+     */
+    FEP_PARTICIPANT_EXPORT tTracePoint RegisterTracePoint(const char* strName,
+        const char* strCategory);
+
+    /**
+     * @brief Enable Starts recording events.
+     * @param [in] szEventsPerThread Number of events kept per thread (rounded up to the next
+     *                               power of two), applies to threads recording their first
+     *                               event after this call
+     */
+    FEP_PARTICIPANT_EXPORT void Enable(size_t szEventsPerThread = s_szDefaultEventsPerThread);
+
+    /// Stops recording events, the events recorded so far are kept
+    FEP_PARTICIPANT_EXPORT void Disable();
+
+    /// Discards all recorded events. Must only be called while tracing is disabled.
+    FEP_PARTICIPANT_EXPORT void Clear();
+
+    /// @return Whether events are recorded
+    inline bool IsEnabled()
+    {
+        return detail::g_bEnabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief ExportChromeTrace Writes the recorded events of all threads as Chrome Trace Event
+     * JSON file. Export while tracing is disabled, otherwise events overwritten during the
+     * export may show up garbled.
+     * @param [in] strFile Path of the file to write
+     * @retval ERR_NOERROR Everything went fine
+     * @retval ERR_POINTER strFile is NULL
+     * @retval ERR_OPEN_FAILED The file could not be opened
+     * @retval ERR_FAILED Writing the file failed
+     */
+    FEP_PARTICIPANT_EXPORT fep::Result ExportChromeTrace(const char* strFile);
+
+    /**
+     * @brief Records an instant event (e.g. a measure point).
+     * @param [in] nTracePoint The trace point
+     */
+    inline void Instant(tTracePoint nTracePoint)
+    {
+        if (IsEnabled())
+        {
+            detail::RecordInstant(nTracePoint, 0, false);
+        }
+    }
+
+    /**
+     * @brief Records an instant event carrying a value (e.g. a sequence number).
+     * @param [in] nTracePoint The trace point
+     * @param [in] nValue The value shown along with the event
+     */
+    inline void Instant(tTracePoint nTracePoint, int64_t nValue)
+    {
+        if (IsEnabled())
+        {
+            detail::RecordInstant(nTracePoint, nValue, true);
+        }
+    }
+
+    /**
+     * Span of a trace point, recorded from construction until destruction. The span is only
+     * recorded if tracing was enabled at construction.
+     */
+    class cTraceSpan
+    {
+    public:
+        /**
+         * CTOR begins the span
+         * @param [in] nTracePoint The trace point
+         */
+        explicit cTraceSpan(tTracePoint nTracePoint)
+            : m_nTracePoint(nTracePoint), m_nBegin_ns(IsEnabled() ? detail::Now() : 0)
+        {
+        }
+
+        /// DTOR ends the span
+        ~cTraceSpan()
+        {
+            if (0 != m_nBegin_ns)
+            {
+                detail::RecordSpan(m_nTracePoint, m_nBegin_ns);
+            }
+        }
+
+    private:
+        cTraceSpan(const cTraceSpan&);
+        cTraceSpan& operator=(const cTraceSpan&);
+
+    private:
+        /// The trace point
+        tTracePoint m_nTracePoint;
+        /// Begin of the span, 0 if the span is not recorded
+        uint64_t m_nBegin_ns;
+    };
+} // namespace trace
+} // namespace fep
+
+/// helper to create unique identifiers for the trace macros
+#define FEP_TRACE_CONCAT_IMPL(a, b) a##b
+/// helper to create unique identifiers for the trace macros
+#define FEP_TRACE_CONCAT(a, b) FEP_TRACE_CONCAT_IMPL(a, b)
+
+/// trace the remainder of the current scope as span, the trace point is registered on first use
+#define FEP_TRACE_SPAN(name, category) \
+    static const fep::trace::tTracePoint FEP_TRACE_CONCAT(s_nTracePoint, __LINE__) = \
+        fep::trace::RegisterTracePoint(name, category); \
+    fep::trace::cTraceSpan FEP_TRACE_CONCAT(oTraceSpan, __LINE__)(FEP_TRACE_CONCAT(s_nTracePoint, __LINE__))
+
+/// trace an instant event, the trace point is registered on first use
+#define FEP_TRACE_INSTANT(name, category) \
+    do { \
+        static const fep::trace::tTracePoint s_nTracePoint = \
+            fep::trace::RegisterTracePoint(name, category); \
+        fep::trace::Instant(s_nTracePoint); \
+    } while (false)
+
+/// trace an instant event carrying a value, the trace point is registered on first use
+#define FEP_TRACE_INSTANT_VALUE(name, category, value) \
+    do { \
+        static const fep::trace::tTracePoint s_nTracePoint = \
+            fep::trace::RegisterTracePoint(name, category); \
+        fep::trace::Instant(s_nTracePoint, static_cast<int64_t>(value)); \
+    } while (false)
+
+#endif // _FEP_TRACE_H_
@@ -282,6 +282,12 @@ fep::Result cSignalRegistry::InternalRegisterSignal(const cUserSignalOptions & o
             sSig.bRTILowLat = oUserSignalOptions._d->m_bUseLowLatProfile;
             sSig.strRTIMulticast.SetDefaultValue("");
 
+            sSig.bZeroCopy = oUserSignalOptions._d->m_bZeroCopyReception;
+            sSig.strBundleId = oUserSignalOptions._d->m_strBundleId;
+            sSig.nDeltaKeyframeInterval = oUserSignalOptions._d->m_nDeltaKeyframeInterval;
+            sSig.bConflate = oUserSignalOptions._d->m_bConflation;
+            sSig.bLatencyStamp = oUserSignalOptions._d->m_bLatencyStamp;
+
             if (fep::isOk(nResult))
             {
                 m_lstSignals.push_back(sSig);
@@ -63,6 +63,16 @@ namespace fep
         cOptional<bool> bRTIAsyncPub;
         /// Flag indicating use of RTI Multicast (adress::port)
         cOptional<std::string> strRTIMulticast;
+        /// Flag indicating that the driver buffer should be handed to the listeners without copy
+        cOptional<bool> bZeroCopy;
+        /// Id of the bundle the signal is transmitted in (empty if not bundled)
+        cOptional<std::string> strBundleId;
+        /// Number of samples between two keyframes of the delta encoding (0: disabled)
+        cOptional<uint32_t> nDeltaKeyframeInterval;
+        /// Flag indicating that only the newest pending sample should be processed
+        cOptional<bool> bConflate;
+        /// Flag indicating that the samples are stamped with the monotonic wall clock
+        cOptional<bool> bLatencyStamp;
     };
 }
 #endif //_H_INTERAL_SIGNAL_STRUCT_
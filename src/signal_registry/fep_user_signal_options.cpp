@@ -40,6 +40,11 @@ fep::cUserSignalOptions::cUserSignalOptionsPrivate::cUserSignalOptionsPrivate()
     m_bIsRawSignal.SetDefaultValue(true);
     m_bUseLowLatProfile.SetDefaultValue(true);
     m_bUseAsyncPubliser.SetDefaultValue(false);
+    m_bZeroCopyReception.SetDefaultValue(false);
+    m_bConflation.SetDefaultValue(false);
+    m_strBundleId.SetDefaultValue("");
+    m_nDeltaKeyframeInterval.SetDefaultValue(0);
+    m_bLatencyStamp.SetDefaultValue(false);
 }
 
 void fep::cUserSignalOptions::cUserSignalOptionsPrivate::Clear()
@@ -51,6 +56,11 @@ void fep::cUserSignalOptions::cUserSignalOptionsPrivate::Clear()
     m_bIsRawSignal.SetDefaultValue(true);
     m_bUseLowLatProfile.SetDefaultValue(true);
     m_bUseAsyncPubliser.SetDefaultValue(false);
+    m_bZeroCopyReception.SetDefaultValue(false);
+    m_bConflation.SetDefaultValue(false);
+    m_strBundleId.SetDefaultValue("");
+    m_nDeltaKeyframeInterval.SetDefaultValue(0);
+    m_bLatencyStamp.SetDefaultValue(false);
 }
 
 fep::cUserSignalOptions::cUserSignalOptions()
@@ -174,6 +184,59 @@ bool fep::cUserSignalOptions::GetAsyncPublisherSetting() const
     return _d->m_bUseAsyncPubliser.GetValue();
 }
 
+void fep::cUserSignalOptions::SetZeroCopyReception(const bool bZeroCopy)
+{
+    _d->m_bZeroCopyReception.SetValue(bZeroCopy);
+}
+
+bool fep::cUserSignalOptions::GetZeroCopyReceptionSetting() const
+{
+    return _d->m_bZeroCopyReception.GetValue();
+}
+
+void fep::cUserSignalOptions::SetConflation(const bool bConflate)
+{
+    _d->m_bConflation.SetValue(bConflate);
+}
+
+bool fep::cUserSignalOptions::GetConflationSetting() const
+{
+    return _d->m_bConflation.GetValue();
+}
+
+void fep::cUserSignalOptions::SetBundleId(const char * strBundleId)
+{
+    if (NULL != strBundleId)
+    {
+        _d->m_strBundleId.SetValue(strBundleId);
+    }
+}
+
+std::string fep::cUserSignalOptions::GetBundleId() const
+{
+    return _d->m_strBundleId.GetValue();
+}
+
+void fep::cUserSignalOptions::SetDeltaKeyframeInterval(uint32_t nKeyframeInterval)
+{
+    _d->m_nDeltaKeyframeInterval.SetValue(nKeyframeInterval);
+}
+
+uint32_t fep::cUserSignalOptions::GetDeltaKeyframeInterval() const
+{
+    return _d->m_nDeltaKeyframeInterval.GetValue();
+}
+
+void fep::cUserSignalOptions::SetLatencyStamp(const bool bLatencyStamp)
+{
+    _d->m_bLatencyStamp.SetValue(bLatencyStamp);
+}
+
+bool fep::cUserSignalOptions::GetLatencyStampSetting() const
+{
+    return _d->m_bLatencyStamp.GetValue();
+}
+
 bool fep::cUserSignalOptions::CheckValidity() const
 {
     bool bIsValid = false;
@@ -62,6 +62,16 @@ namespace fep
         cOptional<bool> m_bUseLowLatProfile;
         /// Async Publisher mode flag
         cOptional<bool> m_bUseAsyncPubliser;
+        /// Zero copy reception flag
+        cOptional<bool> m_bZeroCopyReception;
+        /// Conflation flag
+        cOptional<bool> m_bConflation;
+        /// Bundle id
+        cOptional<std::string> m_strBundleId;
+        /// Keyframe interval of the delta encoding (0: disabled)
+        cOptional<uint32_t> m_nDeltaKeyframeInterval;
+        /// Wall clock latency stamp flag
+        cOptional<bool> m_bLatencyStamp;
     };
 }
 
@@ -60,6 +60,8 @@ cDDSReceive::cDDSReceive() :
     m_pDomainParticipant(NULL),
     m_pCallback(NULL),
     m_pCallee(NULL),
+    m_pBatchCallback(NULL),
+    m_pBatchCallee(NULL),
     m_szCurrentTotalSize(0),
     m_pLoggingFunc(NULL),
     m_pCalleeLogging(NULL),
@@ -141,6 +143,12 @@ fep::Result cDDSReceive::Unmute()
 }
 
 
+uint64_t cDDSReceive::GetLostSampleCount() const
+{
+    return getLostSampleCount();
+}
+
+
 fep::Result cDDSReceive::SetReceiver(tCallbackFuncPtr pCallback, void * pCallee)
 {
     fep::Result nResult = ERR_POINTER;
@@ -154,6 +162,19 @@ fep::Result cDDSReceive::SetReceiver(tCallbackFuncPtr pCallback, void * pCallee)
     return nResult;
 }
 
+fep::Result cDDSReceive::SetBatchReceiver(tBatchCallbackFuncPtr pCallback, void * pCallee)
+{
+    fep::Result nResult = ERR_POINTER;
+    if ((NULL != pCallback && NULL != pCallee)
+        || (NULL == pCallback && NULL == pCallee))
+    {
+        m_pBatchCallback = pCallback;
+        m_pBatchCallee = pCallee;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
 fep::Result cDDSReceive::CreateDDSEntities()
 {
     fep::Result nResult = ERR_NOERROR;
@@ -445,6 +466,26 @@ void cDDSReceive::on_data_available(DDSDataReader *reader)
             // reception is muted --> just return the loan
             m_pReader->return_loan(pDataItem.oDataSeq, pDataItem.oInfoSeq);
         }
+        else if (m_bDeactivateFragmentation && NULL != m_pBatchCallback)
+        {
+            // hand over all samples of this take() at once
+            m_vecBatch.clear();
+            for (int32_t i = 0; i < pDataItem.oInfoSeq.length(); ++i)
+            {
+                if ((pDataItem.oInfoSeq[i]).valid_data)
+                {
+                    tReceivedBuffer oBuffer;
+                    oBuffer.pData = (pDataItem.oDataSeq[i]).value;
+                    oBuffer.szSize = (pDataItem.oDataSeq[i]).length;
+                    m_vecBatch.push_back(oBuffer);
+                }
+            }
+            if (!m_vecBatch.empty())
+            {
+                m_pBatchCallback(m_pBatchCallee, &m_vecBatch[0], m_vecBatch.size());
+            }
+            m_pReader->return_loan(pDataItem.oDataSeq, pDataItem.oInfoSeq);
+        }
         else
         {
             for (int32_t i = 0; i < pDataItem.oInfoSeq.length(); ++i)
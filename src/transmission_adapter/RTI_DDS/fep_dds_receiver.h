@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 #include <a_util/concurrency/detail/fast_mutex_decl.h>
 
 #include "fep_dds_header.h"
@@ -96,6 +97,17 @@ namespace fep
             */
             fep::Result SetReceiver(tCallbackFuncPtr pCallback, void * pCallee);
 
+            /**
+            * The method \ref SetBatchReceiver registers the callback function that is called with
+            * all valid samples of one take() at once (only used if fragmentation is deactivated).
+            *
+            * @param Function pointer to callback
+            * @param Pointer to object providing this callback
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result SetBatchReceiver(tBatchCallbackFuncPtr pCallback, void * pCallee);
+
             /**
              * The method \ref Enable activates the receiver so that data can be received.
              * Sample reception with a deactivated receiver will cause an error report.
@@ -126,6 +138,14 @@ namespace fep
             */
             fep::Result Unmute();
 
+            /**
+            * The method \ref GetLostSampleCount returns the number of samples the defragmentation
+            * gave up.
+            *
+            * @returns  Number of lost samples
+            */
+            uint64_t GetLostSampleCount() const;
+
 
         public: // overrides DDS::DataReaderListener
             /**
@@ -276,6 +296,12 @@ namespace fep
             tCallbackFuncPtr m_pCallback;
             /// Pointer to the Object whoms callback is to be called
             void* m_pCallee;
+            /// Batch callback that is called with all samples of one take()
+            tBatchCallbackFuncPtr m_pBatchCallback;
+            /// Pointer to the Object whoms batch callback is to be called
+            void* m_pBatchCallee;
+            /// Buffers of the current take() handed over to the batch callback
+            std::vector<tReceivedBuffer> m_vecBatch;
             /// Current total sample size  (when dechunked)
             size_t m_szCurrentTotalSize;
             /// Pointer to the preallocated sample
@@ -0,0 +1,282 @@
+/**
+ * Implementation of the Class cCodecPlan.
+ *
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <cstring>
+#include <a_util/memory/memorybuffer.h>
+#include <a_util/variant/variant.h>
+#include <codec/codec.h>
+#include <codec/codec_factory.h>
+#include <codec/struct_element.h>
+#include <ddlrepresentation/ddlcomplex.h>
+#include <serialization/serialization.h>
+
+#include "_common/fep_byteswap.h"
+#include "fep_errors.h"
+#include "transmission_adapter/fep_codec_plan.h"
+
+namespace fep
+{
+
+/// Returns the size of an element of the given type, 0 for types a plan cannot handle
+static size_t GetElementSize(a_util::variant::VariantType eType)
+{
+    switch (eType)
+    {
+    case a_util::variant::VT_Bool:
+    case a_util::variant::VT_Int8:
+    case a_util::variant::VT_UInt8:
+        return 1;
+    case a_util::variant::VT_Int16:
+    case a_util::variant::VT_UInt16:
+        return 2;
+    case a_util::variant::VT_Int32:
+    case a_util::variant::VT_UInt32:
+    case a_util::variant::VT_Float:
+        return 4;
+    case a_util::variant::VT_Int64:
+    case a_util::variant::VT_UInt64:
+    case a_util::variant::VT_Double:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+cCodecPlan::cCodecPlan() :
+    m_szDeserializedSize(0),
+    m_szSerializedSize(0),
+    m_bValid(false)
+{
+}
+
+void cCodecPlan::Clear()
+{
+    m_vecRuns.clear();
+    m_szDeserializedSize = 0;
+    m_szSerializedSize = 0;
+    m_bValid = false;
+}
+
+bool cCodecPlan::IsValid() const
+{
+    return m_bValid;
+}
+
+size_t cCodecPlan::GetDeserializedSize() const
+{
+    return m_szDeserializedSize;
+}
+
+size_t cCodecPlan::GetSerializedSize() const
+{
+    return m_szSerializedSize;
+}
+
+fep::Result cCodecPlan::Create(const ddl::CodecFactory& oFactory, ddl::DDLComplex* pStruct)
+{
+    Clear();
+    if (NULL == pStruct || fep::isFailed(oFactory.isValid().getErrorCode()))
+    {
+        return ERR_INVALID_ARG;
+    }
+    if (pStruct->hasDynamicElements())
+    {
+        // the layout depends on the content of every single sample
+        return ERR_NOT_SUPPORTED;
+    }
+
+    const size_t szDeserialized = oFactory.getStaticBufferSize(ddl::deserialized);
+    const size_t szSerialized = oFactory.getStaticBufferSize(ddl::serialized);
+    const size_t nElements = oFactory.getStaticElementCount();
+    if (0 == szDeserialized || 0 == szSerialized || 0 == nElements)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    // The plan is not derived from the description but probed from the generic codec:
+    // every element gets the byte pattern 1, 2, ..., n which has to show up either as is
+    // (copy) or reversed (byte order swap) in the serialized representation.
+    std::vector<uint8_t> vecDeserialized(szDeserialized, 0);
+    std::vector<uint8_t> vecSerialized(szSerialized, 0);
+    std::vector<size_t> vecDeserializedOffsets(nElements);
+    std::vector<size_t> vecSizes(nElements);
+    {
+        ddl::Decoder oLayout = oFactory.makeDecoderFor(&vecDeserialized[0], szDeserialized);
+        if (oLayout.getElementCount() != nElements)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+        for (size_t nIdx = 0; nIdx < nElements; ++nIdx)
+        {
+            const ddl::StructElement* pElement = NULL;
+            if (fep::isFailed(oLayout.getElement(nIdx, pElement).getErrorCode()) || NULL == pElement)
+            {
+                return ERR_NOT_SUPPORTED;
+            }
+            vecSizes[nIdx] = GetElementSize(pElement->type);
+            vecDeserializedOffsets[nIdx] = static_cast<const uint8_t*>(oLayout.getElementAddress(nIdx))
+                - &vecDeserialized[0];
+            if (0 == vecSizes[nIdx] || vecDeserializedOffsets[nIdx] + vecSizes[nIdx] > szDeserialized)
+            {
+                return ERR_NOT_SUPPORTED;
+            }
+        }
+    }
+    for (size_t nIdx = 0; nIdx < nElements; ++nIdx)
+    {
+        for (size_t nByte = 0; nByte < vecSizes[nIdx]; ++nByte)
+        {
+            vecDeserialized[vecDeserializedOffsets[nIdx] + nByte] = static_cast<uint8_t>(nByte + 1);
+        }
+    }
+
+    ddl::Decoder oSource = oFactory.makeDecoderFor(&vecDeserialized[0], szDeserialized);
+    if (oSource.getElementCount() != nElements)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+    a_util::memory::MemoryBuffer oSerialized(&vecSerialized[0], szSerialized);
+    if (fep::isFailed(ddl::serialization::transform_to_buffer(oSource, oSerialized).getErrorCode()))
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+
+    ddl::Decoder oResult = oFactory.makeDecoderFor(&vecSerialized[0], szSerialized, ddl::serialized);
+    if (oResult.getElementCount() != nElements)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+    std::vector<bool> vecCovered(szSerialized, false);
+    for (size_t nIdx = 0; nIdx < nElements; ++nIdx)
+    {
+        const size_t szSize = vecSizes[nIdx];
+        const size_t szOffset = static_cast<const uint8_t*>(oResult.getElementAddress(nIdx))
+            - &vecSerialized[0];
+        if (szOffset + szSize > szSerialized)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+
+        bool bCopy = true;
+        bool bSwap = szSize > 1;
+        for (size_t nByte = 0; nByte < szSize; ++nByte)
+        {
+            if (vecCovered[szOffset + nByte])
+            {
+                // overlapping elements (bit fields) cannot be handled by byte runs
+                return ERR_NOT_SUPPORTED;
+            }
+            vecCovered[szOffset + nByte] = true;
+            bCopy = bCopy && vecSerialized[szOffset + nByte] == nByte + 1;
+            bSwap = bSwap && vecSerialized[szOffset + nByte] == szSize - nByte;
+        }
+        if (!bCopy && !bSwap)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
+
+        tRun oRun;
+        oRun.szDeserializedOffset = vecDeserializedOffsets[nIdx];
+        oRun.szSerializedOffset = szOffset;
+        oRun.szSize = szSize;
+        oRun.nSwapWidth = bCopy ? 0 : static_cast<uint8_t>(szSize);
+        AppendRun(oRun);
+    }
+
+    m_szDeserializedSize = szDeserialized;
+    m_szSerializedSize = szSerialized;
+    m_bValid = true;
+    return ERR_NOERROR;
+}
+
+void cCodecPlan::AppendRun(const tRun& oRun)
+{
+    if (!m_vecRuns.empty())
+    {
+        tRun& oLast = m_vecRuns.back();
+        if (oLast.nSwapWidth == oRun.nSwapWidth
+            && oLast.szDeserializedOffset + oLast.szSize == oRun.szDeserializedOffset
+            && oLast.szSerializedOffset + oLast.szSize == oRun.szSerializedOffset)
+        {
+            oLast.szSize += oRun.szSize;
+            return;
+        }
+    }
+    m_vecRuns.push_back(oRun);
+}
+
+void cCodecPlan::CopyRun(uint8_t* pDestination, const uint8_t* pSource, size_t szSize,
+    uint8_t nSwapWidth)
+{
+    switch (nSwapWidth)
+    {
+    case 0:
+        ::memcpy(pDestination, pSource, szSize);
+        break;
+    case 2:
+        SwapCopy16(pDestination, pSource, szSize / 2);
+        break;
+    case 4:
+        SwapCopy32(pDestination, pSource, szSize / 4);
+        break;
+    case 8:
+        SwapCopy64(pDestination, pSource, szSize / 8);
+        break;
+    default:
+        break;
+    }
+}
+
+fep::Result cCodecPlan::Serialize(const void* pSource, size_t szSource,
+    void* pDestination, size_t szDestination) const
+{
+    if (!m_bValid || szSource < m_szDeserializedSize || szDestination < m_szSerializedSize)
+    {
+        return ERR_INVALID_ARG;
+    }
+    const uint8_t* pSrc = static_cast<const uint8_t*>(pSource);
+    uint8_t* pDest = static_cast<uint8_t*>(pDestination);
+    for (std::vector<tRun>::const_iterator itRun = m_vecRuns.begin(); itRun != m_vecRuns.end(); ++itRun)
+    {
+        CopyRun(pDest + itRun->szSerializedOffset, pSrc + itRun->szDeserializedOffset,
+            itRun->szSize, itRun->nSwapWidth);
+    }
+    return ERR_NOERROR;
+}
+
+fep::Result cCodecPlan::Deserialize(const void* pSource, size_t szSource,
+    void* pDestination, size_t szDestination) const
+{
+    if (!m_bValid || szSource < m_szSerializedSize || szDestination < m_szDeserializedSize)
+    {
+        return ERR_INVALID_ARG;
+    }
+    const uint8_t* pSrc = static_cast<const uint8_t*>(pSource);
+    uint8_t* pDest = static_cast<uint8_t*>(pDestination);
+    for (std::vector<tRun>::const_iterator itRun = m_vecRuns.begin(); itRun != m_vecRuns.end(); ++itRun)
+    {
+        CopyRun(pDest + itRun->szDeserializedOffset, pSrc + itRun->szSerializedOffset,
+            itRun->szSize, itRun->nSwapWidth);
+    }
+    return ERR_NOERROR;
+}
+
+}
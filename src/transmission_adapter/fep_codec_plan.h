@@ -0,0 +1,159 @@
+/**
+ * Declaration of the Class cCodecPlan.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_CODEC_PLAN_H_
+#define _FEP_CODEC_PLAN_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "fep_participant_export.h"
+#include "fep_result_decl.h"
+
+namespace ddl
+{
+    class CodecFactory;
+    class DDLComplex;
+}
+
+namespace fep
+{
+    /**
+     * @brief The cCodecPlan class is a precompiled (de)serialization plan for a DDL struct.
+     *
+     * The plan flattens the element tree of a static struct into a list of runs. Each run
+     * either copies a contiguous block or swaps the byte order of a block of equally sized
+     * elements. Padding bytes are not covered by any run. Executing the plan is equivalent
+     * to ddl::serialization::transform_to_buffer but without walking the element tree.
+     *
+     * Structs with dynamic arrays (or anything else the plan cannot reproduce exactly)
+     * lead to an invalid plan - the generic codec has to be used in that case.
+     */
+    class FEP_PARTICIPANT_EXPORT cCodecPlan
+    {
+        /// One step of the plan
+        struct tRun
+        {
+            /// offset within the deserialized (memory) representation
+            size_t szDeserializedOffset;
+            /// offset within the serialized (wire) representation
+            size_t szSerializedOffset;
+            /// number of bytes covered by the run
+            size_t szSize;
+            /// width of the elements whose byte order is swapped, 0 for a plain copy
+            uint8_t nSwapWidth;
+        };
+
+    public:
+        /**
+         * CTOR
+         */
+        cCodecPlan();
+
+        /**
+         * @brief Create Builds the plan for the struct of the given codec factory
+         * @param oFactory Valid codec factory of the signal type
+         * @param pStruct Description of the signal type the factory was created for
+         * @return Standard Error Code
+         * @retval ERR_NOERROR The plan is valid
+         * @retval ERR_NOT_SUPPORTED The struct cannot be handled by a plan (e.g. dynamic arrays)
+         */
+        fep::Result Create(const ddl::CodecFactory& oFactory, ddl::DDLComplex* pStruct);
+
+        /**
+         * @brief Clear Resets the plan to invalid
+         */
+        void Clear();
+
+        /**
+         * @brief IsValid Returns whether the plan can be used
+         * @return true if the plan was created successfully
+         */
+        bool IsValid() const;
+
+        /**
+         * @brief GetDeserializedSize Returns the size of the deserialized representation
+         * @return Size in bytes
+         */
+        size_t GetDeserializedSize() const;
+
+        /**
+         * @brief GetSerializedSize Returns the size of the serialized representation
+         * @return Size in bytes
+         */
+        size_t GetSerializedSize() const;
+
+        /**
+         * @brief Serialize Converts the deserialized representation into the serialized one
+         * @param pSource Deserialized data
+         * @param szSource Size of \a pSource
+         * @param pDestination Buffer receiving the serialized data
+         * @param szDestination Size of \a pDestination
+         * @return Standard Error Code
+         * @retval ERR_INVALID_ARG One of the buffers is too small or the plan is invalid
+         */
+        fep::Result Serialize(const void* pSource, size_t szSource,
+            void* pDestination, size_t szDestination) const;
+
+        /**
+         * @brief Deserialize Converts the serialized representation into the deserialized one
+         * @param pSource Serialized data
+         * @param szSource Size of \a pSource
+         * @param pDestination Buffer receiving the deserialized data
+         * @param szDestination Size of \a pDestination
+         * @return Standard Error Code
+         * @retval ERR_INVALID_ARG One of the buffers is too small or the plan is invalid
+         */
+        fep::Result Deserialize(const void* pSource, size_t szSource,
+            void* pDestination, size_t szDestination) const;
+
+    private:
+        /**
+         * @brief AppendRun Appends an element to the plan, merging it with the last run if possible
+         * @param oRun The element
+         */
+        void AppendRun(const tRun& oRun);
+
+        /**
+         * @brief CopyRun Copies or swaps a single run
+         * @param pDestination Destination of the run
+         * @param pSource Source of the run
+         * @param szSize Size of the run
+         * @param nSwapWidth Width of the swapped elements, 0 for a plain copy
+         */
+        static void CopyRun(uint8_t* pDestination, const uint8_t* pSource, size_t szSize,
+            uint8_t nSwapWidth);
+
+    private:
+        /// The runs in element order
+        std::vector<tRun> m_vecRuns;
+        /// Size of the deserialized representation
+        size_t m_szDeserializedSize;
+        /// Size of the serialized representation
+        size_t m_szSerializedSize;
+        /// Flag indicating a valid plan
+        bool m_bValid;
+    };
+}
+
+#endif // _FEP_CODEC_PLAN_H_
@@ -0,0 +1,233 @@
+/**
+ * Implementation of the Class cDataSampleView.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <cstdint>
+#include <a_util/memory/memory.h>
+#include <a_util/result/result_type.h>
+
+#include "fep_errors.h"
+#include "transmission_adapter/fep_preparation_data_sample_intf.h"
+#include "transmission_adapter/fep_data_sample_view.h"
+
+namespace fep
+{
+
+cDataSampleView::cDataSampleView() :
+    m_bSyncFlag(false),
+    m_nFrameId(0),
+    m_nSampleNumberInFrame(0),
+    m_tmTimeStamp(0),
+    m_hSignalHandle(NULL),
+    m_pData(NULL),
+    m_szDataSize(0),
+    m_pRelease(NULL),
+    m_pReleaseContext(NULL),
+    m_nRefCount(0)
+{
+}
+
+cDataSampleView::~cDataSampleView()
+{
+    // a view must never be destroyed while it is still lent out, but if it happens
+    // at least the driver buffer must not leak
+    if (NULL != m_pRelease)
+    {
+        m_pRelease(m_pReleaseContext);
+    }
+}
+
+fep::Result cDataSampleView::Wrap(const void* pvData, size_t szSize,
+    IReceive::tReleaseFuncPtr pRelease, void* pReleaseContext)
+{
+    if (0 != m_nRefCount.load())
+    {
+        return ERR_RESOURCE_IN_USE;
+    }
+    m_pData = pvData;
+    m_szDataSize = szSize;
+    m_pRelease = pRelease;
+    m_pReleaseContext = pReleaseContext;
+    m_nRefCount.store(1);
+    return ERR_NOERROR;
+}
+
+void cDataSampleView::AddRef()
+{
+    m_nRefCount.fetch_add(1);
+}
+
+bool cDataSampleView::Release()
+{
+    if (1 != m_nRefCount.fetch_sub(1))
+    {
+        return false;
+    }
+    IReceive::tReleaseFuncPtr pRelease = m_pRelease;
+    void* pReleaseContext = m_pReleaseContext;
+    m_pData = NULL;
+    m_szDataSize = 0;
+    m_pRelease = NULL;
+    m_pReleaseContext = NULL;
+    if (NULL != pRelease)
+    {
+        pRelease(pReleaseContext);
+    }
+    return true;
+}
+
+fep::Result cDataSampleView::CopyFrom(const void* pvData, const size_t szSize)
+{
+    return ERR_INVALID_FUNCTION;
+}
+
+fep::Result cDataSampleView::CopyTo(void* pvData, const size_t szSize) const
+{
+    fep::Result nResult = ERR_NOERROR;
+    if (NULL == pvData)
+    {
+        nResult = ERR_POINTER;
+    }
+    else if (m_szDataSize < szSize)
+    {
+        nResult = ERR_MEMORY;
+    }
+    else if (!a_util::memory::copy(pvData, szSize, m_pData, szSize))
+    {
+        nResult = ERR_FAILED;
+    }
+    return nResult;
+}
+
+void* cDataSampleView::GetPtr() const
+{
+    // the interface does not know about const samples - the view is read-only by contract
+    return const_cast<void*>(m_pData);
+}
+
+fep::Result cDataSampleView::Attach(void* pvData, size_t const szSize)
+{
+    return ERR_INVALID_FUNCTION;
+}
+
+fep::Result cDataSampleView::Detach()
+{
+    return ERR_INVALID_FUNCTION;
+}
+
+fep::Result cDataSampleView::SetSignalHandle(handle_t hSignalHandle)
+{
+    m_hSignalHandle = hSignalHandle;
+    return ERR_NOERROR;
+}
+
+handle_t cDataSampleView::GetSignalHandle() const
+{
+    return m_hSignalHandle;
+}
+
+size_t cDataSampleView::GetSize() const
+{
+    return m_szDataSize;
+}
+
+size_t cDataSampleView::GetCapacity() const
+{
+    return m_szDataSize;
+}
+
+fep::Result cDataSampleView::SetSize(const size_t szDataSize)
+{
+    return ERR_INVALID_FUNCTION;
+}
+
+fep::Result cDataSampleView::SetTime(timestamp_t tmSample)
+{
+    m_tmTimeStamp = tmSample;
+    return ERR_NOERROR;
+}
+
+timestamp_t cDataSampleView::GetTime() const
+{
+    return m_tmTimeStamp;
+}
+
+fep::Result cDataSampleView::CopyTo(IPreparationDataSample& oDestination) const
+{
+    fep::Result nResult = ERR_NOERROR;
+    if (NULL != m_pData)
+    {
+        nResult = oDestination.CopyFrom(m_pData, m_szDataSize);
+    }
+    else
+    {
+        nResult = oDestination.AdaptSize(0);
+    }
+    if (fep::isOk(nResult))
+    {
+        oDestination.SetSignalHandle(m_hSignalHandle);
+        oDestination.SetTime(m_tmTimeStamp);
+        oDestination.SetSyncFlag(m_bSyncFlag);
+        oDestination.SetFrameId(m_nFrameId);
+        oDestination.SetSampleNumberInFrame(m_nSampleNumberInFrame);
+    }
+    return nResult;
+}
+
+fep::Result cDataSampleView::AdaptSize(const size_t szDataSize)
+{
+    return ERR_INVALID_FUNCTION;
+}
+
+fep::Result cDataSampleView::SetSyncFlag(bool bSync)
+{
+    m_bSyncFlag = bSync;
+    return ERR_NOERROR;
+}
+
+fep::Result cDataSampleView::SetFrameId(uint64_t nFrameId)
+{
+    m_nFrameId = nFrameId;
+    return ERR_NOERROR;
+}
+
+fep::Result cDataSampleView::SetSampleNumberInFrame(uint16_t nSampleNumber)
+{
+    m_nSampleNumberInFrame = nSampleNumber;
+    return ERR_NOERROR;
+}
+
+bool cDataSampleView::GetSyncFlag() const
+{
+    return m_bSyncFlag;
+}
+
+uint64_t cDataSampleView::GetFrameId() const
+{
+    return m_nFrameId;
+}
+
+uint16_t cDataSampleView::GetSampleNumberInFrame() const
+{
+    return m_nSampleNumberInFrame;
+}
+
+}  // namespace fep
@@ -0,0 +1,144 @@
+/**
+ * Declaration of the Class cDataSampleView.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_DATA_SAMPLE_VIEW_H_
+#define _FEP_DATA_SAMPLE_VIEW_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <a_util/base/types.h>
+
+#include "fep_participant_export.h"
+#include "fep_result_decl.h"
+#include "transmission_adapter/fep_receive_intf.h"
+#include "transmission_adapter/fep_transmission_sample_intf.h"
+
+namespace fep
+{
+class IPreparationDataSample;
+
+/**
+ * The class \ref cDataSampleView implements a read-only data sample referring to a buffer
+ * lent by the transmission driver (see \ref IReceive::SetZeroCopyReceiver).
+ *
+ * The view is reference counted: it is wrapped around a driver buffer holding one reference,
+ * every additional holder calls \ref AddRef. The driver buffer is handed back by the holder
+ * dropping the last reference. Copying a view into another sample always copies the data.
+ *
+ * All methods modifying the data return ERR_INVALID_FUNCTION.
+ */
+class FEP_PARTICIPANT_EXPORT cDataSampleView : public fep::ITransmissionDataSample
+{
+public:
+    /**
+     * CTOR
+     */
+    cDataSampleView();
+
+    /**
+     * DTOR
+     */
+    virtual ~cDataSampleView();
+
+private:
+    /// no copy / assignment, the view owns a driver buffer
+    cDataSampleView(const cDataSampleView&);
+    cDataSampleView& operator=(const cDataSampleView&);
+
+public:
+    /**
+     * Wraps the view around a driver buffer. The view holds one reference afterwards.
+     *
+     * @param [in] pvData  Pointer to the payload within the driver buffer
+     * @param [in] szSize  Size of the payload
+     * @param [in] pRelease  Function handing the buffer back to the driver
+     * @param [in] pReleaseContext  Context to be passed to \a pRelease
+     * @retval ERR_NOERROR  Everything went fine
+     * @retval ERR_RESOURCE_IN_USE  The view still refers to another buffer
+     */
+    fep::Result Wrap(const void* pvData, size_t szSize,
+        IReceive::tReleaseFuncPtr pRelease, void* pReleaseContext);
+
+    /**
+     * Adds a reference to the wrapped buffer.
+     */
+    void AddRef();
+
+    /**
+     * Drops a reference to the wrapped buffer. The driver buffer is handed back when the last
+     * reference is dropped.
+     *
+     * @retval true  The last reference was dropped, the view can be reused
+     * @retval false  The view is still referenced
+     */
+    bool Release();
+
+public: // implements IUserDataSample
+    fep::Result CopyFrom(const void* pvData, const size_t szSize);
+    fep::Result CopyTo(void* pvData, const size_t szSize) const;
+    void* GetPtr() const;
+    fep::Result Attach(void* pvData, size_t const szSize);
+    fep::Result Detach();
+    fep::Result SetSignalHandle(handle_t hSignalHandle);
+    handle_t GetSignalHandle() const;
+    size_t GetSize() const;
+    size_t GetCapacity() const;
+    fep::Result SetSize(const size_t szDataSize);
+    fep::Result SetTime(timestamp_t tmSample);
+    timestamp_t GetTime() const;
+
+public: // implements IPreparationDataSample
+    fep::Result CopyTo(IPreparationDataSample& oDestination) const;
+    fep::Result AdaptSize(const size_t szDataSize);
+    fep::Result SetSyncFlag(bool bSync);
+    fep::Result SetFrameId(uint64_t nFrameId);
+    fep::Result SetSampleNumberInFrame(uint16_t nSampleNumber);
+    bool GetSyncFlag() const;
+    uint64_t GetFrameId() const;
+    uint16_t GetSampleNumberInFrame() const;
+
+private:
+    /// The sync flag of this sample
+    bool m_bSyncFlag;
+    /// The frame number of the sample
+    uint64_t m_nFrameId;
+    /// The sample number within the current frame
+    uint16_t m_nSampleNumberInFrame;
+    /// The timestamp of this sample
+    timestamp_t m_tmTimeStamp;
+    /// The handle of the signal
+    handle_t m_hSignalHandle;
+    /// Pointer to the payload within the driver buffer
+    const void* m_pData;
+    /// Size of the payload
+    size_t m_szDataSize;
+    /// Function handing the buffer back to the driver
+    IReceive::tReleaseFuncPtr m_pRelease;
+    /// Context passed to m_pRelease
+    void* m_pReleaseContext;
+    /// Number of holders of the wrapped buffer
+    std::atomic<int32_t> m_nRefCount;
+};
+
+} // namespace fep
+#endif // _FEP_DATA_SAMPLE_VIEW_H_
@@ -0,0 +1,159 @@
+/**
+ * Implementation of the delta encoding helpers.
+ *
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <cstring>
+
+#include "transmission_adapter/fep_delta_codec.h"
+
+namespace fep
+{
+namespace delta
+{
+
+/// Unchanged bytes ending a changed block - a new run for less would not be smaller
+static const size_t s_szMinUnchangedRun = 4;
+
+/// Appends a LEB128 varint, returns false if it does not fit
+static bool WriteVarint(size_t szValue, uint8_t* pDest, size_t szCapacity, size_t& szPos)
+{
+    do
+    {
+        if (szPos >= szCapacity)
+        {
+            return false;
+        }
+        uint8_t nByte = static_cast<uint8_t>(szValue & 0x7F);
+        szValue >>= 7;
+        pDest[szPos++] = (0 == szValue) ? nByte : static_cast<uint8_t>(nByte | 0x80);
+    } while (0 != szValue);
+    return true;
+}
+
+/// Reads a LEB128 varint, returns false if it is truncated or too large
+static bool ReadVarint(const uint8_t* pSrc, size_t szSize, size_t& szPos, size_t& szValue)
+{
+    szValue = 0;
+    for (size_t nShift = 0; nShift < sizeof(size_t) * 8; nShift += 7)
+    {
+        if (szPos >= szSize)
+        {
+            return false;
+        }
+        uint8_t nByte = pSrc[szPos++];
+        szValue |= static_cast<size_t>(nByte & 0x7F) << nShift;
+        if (0 == (nByte & 0x80))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool EncodeDelta(uint8_t* pReference, const uint8_t* pSample, size_t szSize,
+    uint8_t* pDest, size_t szCapacity, size_t& szEncoded)
+{
+    bool bFits = true;
+    size_t szOut = 0;
+    size_t szPos = 0;
+    while (szPos < szSize)
+    {
+        // skip the unchanged bytes, word by word as long as possible
+        size_t szUnchangedStart = szPos;
+        while (szPos + sizeof(uint64_t) <= szSize
+            && 0 == std::memcmp(pReference + szPos, pSample + szPos, sizeof(uint64_t)))
+        {
+            szPos += sizeof(uint64_t);
+        }
+        while (szPos < szSize && pReference[szPos] == pSample[szPos])
+        {
+            ++szPos;
+        }
+        if (szPos == szSize)
+        {
+            break;
+        }
+
+        // the changed block ends in front of the first long enough unchanged run
+        size_t szChangedStart = szPos;
+        size_t szChangedEnd = szPos;
+        while (szPos < szSize)
+        {
+            if (pReference[szPos] != pSample[szPos])
+            {
+                szChangedEnd = ++szPos;
+            }
+            else if (++szPos - szChangedEnd >= s_szMinUnchangedRun)
+            {
+                break;
+            }
+        }
+        szPos = szChangedEnd;
+        size_t szChanged = szChangedEnd - szChangedStart;
+
+        if (bFits)
+        {
+            bFits = WriteVarint(szChangedStart - szUnchangedStart, pDest, szCapacity, szOut)
+                && WriteVarint(szChanged, pDest, szCapacity, szOut)
+                && szChanged <= szCapacity - szOut;
+            if (bFits)
+            {
+                for (size_t nIdx = 0; nIdx < szChanged; ++nIdx)
+                {
+                    pDest[szOut + nIdx] = pReference[szChangedStart + nIdx] ^ pSample[szChangedStart + nIdx];
+                }
+                szOut += szChanged;
+            }
+        }
+        std::memcpy(pReference + szChangedStart, pSample + szChangedStart, szChanged);
+    }
+    szEncoded = szOut;
+    return bFits;
+}
+
+bool ApplyDelta(uint8_t* pReference, size_t szSize, const uint8_t* pDelta, size_t szDeltaSize)
+{
+    size_t szIn = 0;
+    size_t szPos = 0;
+    while (szIn < szDeltaSize)
+    {
+        size_t szUnchanged = 0;
+        size_t szChanged = 0;
+        if (!ReadVarint(pDelta, szDeltaSize, szIn, szUnchanged)
+            || !ReadVarint(pDelta, szDeltaSize, szIn, szChanged)
+            || szUnchanged > szSize - szPos
+            || szChanged > szSize - szPos - szUnchanged
+            || szChanged > szDeltaSize - szIn)
+        {
+            return false;
+        }
+        szPos += szUnchanged;
+        for (size_t nIdx = 0; nIdx < szChanged; ++nIdx)
+        {
+            pReference[szPos + nIdx] ^= pDelta[szIn + nIdx];
+        }
+        szPos += szChanged;
+        szIn += szChanged;
+    }
+    return true;
+}
+
+} // namespace delta
+} // namespace fep
@@ -0,0 +1,74 @@
+/**
+ * Declaration of the delta encoding helpers.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_DELTA_CODEC_H_
+#define _FEP_DELTA_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "fep_participant_export.h"
+
+namespace fep
+{
+    /**
+     * Delta encoding of samples against the previously transmitted sample (the reference).
+     *
+     * A delta is a sequence of runs, each made of the number of unchanged bytes, the number
+     * of changed bytes (both as LEB128 varints) and the changed bytes XORed with the
+     * reference. Unchanged bytes at the end of the sample are not encoded at all, so a
+     * delta of an unchanged sample is empty. Short unchanged gaps inside a changed block
+     * are kept in the block since a new run would not be any smaller.
+     */
+    namespace delta
+    {
+        /**
+         * Encodes the difference between the reference and the sample and updates the
+         * reference to the sample afterwards - also if the delta does not fit.
+         *
+         * @param [in,out] pReference Reference (last transmitted sample) of szSize bytes
+         * @param [in] pSample Sample to be encoded, szSize bytes
+         * @param [in] szSize Size of reference and sample
+         * @param [out] pDest Destination of the delta
+         * @param [in] szCapacity Capacity of the destination
+         * @param [out] szEncoded Size of the delta (valid if true is returned)
+         * @return true if the delta fits into the destination, false otherwise
+         */
+        FEP_PARTICIPANT_EXPORT bool EncodeDelta(uint8_t* pReference, const uint8_t* pSample,
+            size_t szSize, uint8_t* pDest, size_t szCapacity, size_t& szEncoded);
+
+        /**
+         * Applies a delta created by \ref EncodeDelta to the reference.
+         *
+         * @param [in,out] pReference Reference of szSize bytes, afterwards the encoded sample
+         * @param [in] szSize Size of the reference
+         * @param [in] pDelta The delta
+         * @param [in] szDeltaSize Size of the delta
+         * @return true on success, false if the delta is corrupt or does not match the size
+         *         of the reference (the reference is partially updated in that case)
+         */
+        FEP_PARTICIPANT_EXPORT bool ApplyDelta(uint8_t* pReference, size_t szSize,
+            const uint8_t* pDelta, size_t szDeltaSize);
+    }
+}
+
+#endif // _FEP_DELTA_CODEC_H_
@@ -19,8 +19,9 @@
 #define _FEP_DDS_FRAGMENTATION_H_
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <vector>
-#include <map>
 #include <cstring>
 #include <a_util/base.h>
 
@@ -142,12 +143,10 @@ namespace fep
             // reset fragment index and increment sample number
             Fragment* fragment = reinterpret_cast<Fragment*>(_buffer);
             fragment->index = htole16(0);
-            fragment->sample_number = htole16(le16toh(fragment->sample_number) + 1);
+            fragment->sample_number = htole32(le32toh(fragment->sample_number) + 1);
             fragment->sample_size = htole32(length);
 
-            // data destination is in our preallocated fragment buffer
-            void* const dest = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(_buffer) + sizeof(Fragment));
-            const void* source = sample;
+            const uint8_t* source = static_cast<const uint8_t*>(sample);
 
             uint64_t remaining = length;
             while (remaining > 0)
@@ -156,17 +155,14 @@ namespace fep
                 const uint32_t fragment_size = std::min<uint32_t>(static_cast<uint32_t>(remaining), fragmentation_boundary);
                 fragment->size = htole32(fragment_size);
 
-                // copy chunk from sample
-                ::memcpy(dest, source, fragment_size);
-
                 // transmit the fragment, abort on error
-                if (!transmitFragment(_buffer, fragment_size + sizeof(Fragment)))
+                if (!transmitFragmentV(fragment, source, fragment_size))
                 {
                     break;
                 }
 
                 // increment source pointer by the amount of data we just transmitted
-                source = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(source) + static_cast<uintptr_t>(fragment_size));
+                source += fragment_size;
 
                 // increment fragment index, decrement remaining data
                 fragment->index = htole16(le16toh(fragment->index) + 1);
@@ -182,6 +178,21 @@ namespace fep
         /// @param length Length of the fragment to be transmitted
         /// @return Returns true if the fragment was transmitted (sample transmission will stop if false is returned!)
         virtual bool transmitFragment(void* fragment, uint32_t length) noexcept = 0;
+
+        /// Gather transport call - override it if the transport is able to send the fragment header
+        /// and the payload from separate memory (e.g. sendmsg with an io vector).
+        /// The default implementation copies the payload behind the header into the fragment buffer
+        /// and calls \ref transmitFragment.
+        /// @param header Fragment header, only valid during the call (the next fragment reuses it)
+        /// @param payload Slice of the sample memory, valid until \ref transmitSample returns
+        /// @param length Length of the payload
+        /// @return Returns true if the fragment was transmitted (sample transmission will stop if false is returned!)
+        virtual bool transmitFragmentV(const Fragment* header, const void* payload, uint32_t length) noexcept
+        {
+            (void)header;
+            ::memcpy(_buffer + sizeof(Fragment), payload, length);
+            return transmitFragment(_buffer, length + sizeof(Fragment));
+        }
     };
 
 
@@ -189,16 +200,48 @@ namespace fep
 #pragma GCC diagnostic ignored "-Wattributes" // standard type attributes are ignored when used in templates
 #endif
 
-    /// Abstract class implementing defragmentation of input chunks into whole samples
+    /**
+    * Abstract class implementing defragmentation of input chunks into whole samples.
+    * Samples are reassembled in slots taken from a preallocated slab, one slot per sample in
+    * progress. Hence fragments of several senders may interleave and the fragments of a sample
+    * may arrive in any order. A sample is given up (and counted as lost) if the next sample of
+    * its sender starts, if it is not completed within the reassembly timeout or if its slot is
+    * needed for a newer sample.
+    */
     template<uint8_t protocol_version, uint32_t fragmentation_boundary>
     class DefragmentingReader
     {
         /// @cond nodoc
         DefragmentingReader(const DefragmentingReader&) = delete;
         DefragmentingReader& operator=(DefragmentingReader&) = delete;
-        std::vector<uint8_t> _buffer;
-        std::map<uint64_t, uint32_t> _current_sample_numbers;
-        uint32_t _remaining_sample_size;
+
+        struct Slot
+        {
+            bool in_use;
+            uint64_t sender_id;
+            uint32_t sample_number;
+            uint32_t sample_size;
+            uint32_t fragment_count;
+            uint32_t received_count;
+            std::chrono::steady_clock::time_point started;
+            std::vector<uint64_t> received;
+            std::vector<uint8_t> buffer;
+        };
+
+        struct Sender
+        {
+            uint64_t id;
+            uint32_t newest_sample_number;
+            std::chrono::steady_clock::time_point newest_started;
+        };
+
+        std::vector<Slot> _slots;
+        std::vector<Sender> _senders;
+        size_t _last_slot;
+        size_t _last_sender;
+        std::chrono::steady_clock::duration _timeout;
+        std::atomic<uint64_t> _lost_samples;
+        std::atomic<uint64_t> _partial_samples;
         /// @endcond
 
 #if defined(__GNUC__) && (__GNUC__ == 5) && defined(__QNX__)
@@ -210,17 +253,47 @@ namespace fep
         virtual ~DefragmentingReader() = default;
 
         /// CTOR
-        DefragmentingReader() :
-            _remaining_sample_size(0)
+        /// @param slot_count Number of samples that can be reassembled at the same time
+        explicit DefragmentingReader(size_t slot_count = 4) :
+            _slots(std::max<size_t>(slot_count, 1)),
+            _last_slot(0),
+            _last_sender(0),
+            _timeout(std::chrono::seconds(1)),
+            _lost_samples(0),
+            _partial_samples(0)
+        {
+            for (Slot& slot : _slots)
+            {
+                slot.in_use = false;
+                // bitmap for the maximum number of fragments and at least one fragment worth of payload
+                slot.received.reserve(65536 / 64);
+                slot.buffer.reserve(fragmentation_boundary);
+            }
+        }
+
+        /// Sets the time after which an incomplete sample is given up (default: 1s)
+        /// @param timeout The reassembly timeout
+        void setReassemblyTimeout(std::chrono::steady_clock::duration timeout)
+        {
+            _timeout = timeout;
+        }
+
+        /// @return Number of samples that were not received (not a single fragment or incomplete)
+        uint64_t getLostSampleCount() const
+        {
+            return _lost_samples;
+        }
+
+        /// @return Number of samples that were given up although some of their fragments were received
+        uint64_t getPartialSampleCount() const
         {
-            // preallocate at least one fragment worth of payload
-            _buffer.resize(fragmentation_boundary);
+            return _partial_samples;
         }
 
         /// Receive a fragment to be reassembled into a complete sample
         /// @param fragment Fragment memory
         /// @param length Length of the fragment
-        /// @return Returns the number of lost samples between the last and current fragment received
+        /// @return Returns the number of samples detected as lost while processing the fragment
         uint32_t receiveFragment(const void* fragment, uint32_t length)
         {
             if (!fragment || length < sizeof(Fragment)) return 0;
@@ -231,43 +304,54 @@ namespace fep
                 return 0;
             }
 
-            uint32_t& current_sample_number = _current_sample_numbers[fragment_->sender_id];            
+            const uint64_t sender_id = le64toh(fragment_->sender_id);
+            const uint32_t sample_number = le32toh(fragment_->sample_number);
+            const uint32_t sample_size = le32toh(fragment_->sample_size);
+            const uint32_t size = le32toh(fragment_->size);
+            const uint64_t destination = static_cast<uint64_t>(le16toh(fragment_->index)) * fragmentation_boundary;
+
+            // the fragment has to fit the layout produced by the FragmentingWriter
+            if (sample_size == 0 || size > length - sizeof(Fragment) || destination + size > sample_size
+                || (size != fragmentation_boundary && destination + size != sample_size)
+                || (sample_size - 1) / fragmentation_boundary >= 65536)
+            {
+                return 0;
+            }
+
             uint32_t lost = 0;
-            if (le32toh(fragment_->sample_number) != current_sample_number)
+            Slot* slot = &_slots[_last_slot];
+            if (!slot->in_use || slot->sender_id != sender_id || slot->sample_number != sample_number)
             {
-                if (_remaining_sample_size != 0)
+                slot = findSlot(sender_id, sample_number);
+                if (!slot)
                 {
-                    if (current_sample_number > le32toh(fragment_->sample_number))
-                    {
-                        lost = 1;
-                    }
-                    else
+                    slot = startSample(sender_id, sample_number, sample_size, lost);
+                    if (!slot)
                     {
-                        lost = le32toh(fragment_->sample_number) - current_sample_number;
+                        return lost;
                     }
                 }
-
-                current_sample_number = le32toh(fragment_->sample_number);
-                _remaining_sample_size = le32toh(fragment_->sample_size);
-                _buffer.resize(_remaining_sample_size);
+                _last_slot = static_cast<size_t>(slot - &_slots[0]);
             }
-
-            if (_remaining_sample_size >= le32toh(fragment_->size))
+            if (slot->sample_size != sample_size)
             {
-                // always check if size and index checks out
-                uint64_t destination = le16toh(fragment_->index) * fragmentation_boundary;
-                if (destination + le32toh(fragment_->size) <= _buffer.size())
-                {
-                    const uintptr_t source = reinterpret_cast<uintptr_t>(fragment) + sizeof(Fragment);
-                    ::memcpy(reinterpret_cast<void*>(&_buffer[destination]),
-                        reinterpret_cast<const void*>(source), le32toh(fragment_->size));
-                    _remaining_sample_size -= le32toh(fragment_->size);
-                }
+                return lost;
             }
 
-            if (_remaining_sample_size == 0)
+            const uint16_t index = le16toh(fragment_->index);
+            uint64_t& received = slot->received[index / 64];
+            const uint64_t bit = static_cast<uint64_t>(1) << (index % 64);
+            if ((received & bit) == 0)
             {
-                receiveSample(reinterpret_cast<const void*>(&_buffer[0]), le32toh(fragment_->sample_size));
+                received |= bit;
+                const uintptr_t source = reinterpret_cast<uintptr_t>(fragment) + sizeof(Fragment);
+                ::memcpy(reinterpret_cast<void*>(&slot->buffer[destination]),
+                    reinterpret_cast<const void*>(source), size);
+                if (++slot->received_count == slot->fragment_count)
+                {
+                    slot->in_use = false;
+                    receiveSampleBuffer(slot->buffer);
+                }
             }
 
             return lost;
@@ -278,6 +362,106 @@ namespace fep
         /// @param sample Sample memory (valid only during invocation!)
         /// @param length Length of the sample
         virtual void receiveSample(const void* sample, uint32_t length) noexcept = 0;
+
+        /// Sample handler receiving the reassembly buffer itself. The implementation may take over
+        /// the buffer (e.g. by swapping it with an empty one), the reader will allocate a new one.
+        /// The default implementation calls \ref receiveSample.
+        /// @param sample Buffer containing the sample (its size is the size of the sample)
+        virtual void receiveSampleBuffer(std::vector<uint8_t>& sample) noexcept
+        {
+            receiveSample(sample.data(), static_cast<uint32_t>(sample.size()));
+        }
+
+    private:
+        /// @cond nodoc
+        Slot* findSlot(uint64_t sender_id, uint32_t sample_number)
+        {
+            for (Slot& slot : _slots)
+            {
+                if (slot.in_use && slot.sender_id == sender_id && slot.sample_number == sample_number)
+                {
+                    return &slot;
+                }
+            }
+            return nullptr;
+        }
+
+        void dropSlot(Slot& slot, uint32_t& lost)
+        {
+            slot.in_use = false;
+            ++lost;
+            ++_lost_samples;
+            ++_partial_samples;
+        }
+
+        Slot* startSample(uint64_t sender_id, uint32_t sample_number, uint32_t sample_size, uint32_t& lost)
+        {
+            if (_last_sender >= _senders.size() || _senders[_last_sender].id != sender_id)
+            {
+                _last_sender = 0;
+                while (_last_sender < _senders.size() && _senders[_last_sender].id != sender_id)
+                {
+                    ++_last_sender;
+                }
+                if (_last_sender == _senders.size())
+                {
+                    // first sample of this sender, nothing can have been lost before
+                    _senders.push_back(Sender{ sender_id, sample_number - 1, {} });
+                }
+            }
+
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            Sender& sender = _senders[_last_sender];
+            const int32_t distance = static_cast<int32_t>(sample_number - sender.newest_sample_number);
+            if (distance <= 0 && distance > -64 && now - sender.newest_started <= _timeout)
+            {
+                // late fragment of a sample that was completed or given up already
+                return nullptr;
+            }
+            if (distance > 0)
+            {
+                lost += static_cast<uint32_t>(distance - 1);
+                _lost_samples += static_cast<uint32_t>(distance - 1);
+            }
+            // otherwise the sender was restarted and numbers its samples from the beginning
+            sender.newest_sample_number = sample_number;
+            sender.newest_started = now;
+            Slot* free_slot = nullptr;
+            Slot* oldest_slot = nullptr;
+            for (Slot& slot : _slots)
+            {
+                if (slot.in_use && (slot.sender_id == sender_id || now - slot.started > _timeout))
+                {
+                    // older samples of the same sender will not be completed anymore
+                    dropSlot(slot, lost);
+                }
+                if (!slot.in_use)
+                {
+                    free_slot = free_slot ? free_slot : &slot;
+                }
+                else if (!oldest_slot || slot.started < oldest_slot->started)
+                {
+                    oldest_slot = &slot;
+                }
+            }
+            if (!free_slot)
+            {
+                free_slot = oldest_slot;
+                dropSlot(*free_slot, lost);
+            }
+
+            free_slot->in_use = true;
+            free_slot->sender_id = sender_id;
+            free_slot->sample_number = sample_number;
+            free_slot->sample_size = sample_size;
+            free_slot->fragment_count = (sample_size - 1) / fragmentation_boundary + 1;
+            free_slot->received_count = 0;
+            free_slot->started = now;
+            free_slot->received.assign((free_slot->fragment_count + 63) / 64, 0);
+            free_slot->buffer.resize(sample_size);
+            return free_slot;
+        }
+        /// @endcond
     };
 }
 #endif //_FEP_DDS_FRAGMENTATION_H_
@@ -0,0 +1,149 @@
+/**
+ * Implementation of the latency histogram of received signals.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <limits>
+
+#include "transmission_adapter/fep_latency_histogram.h"
+
+namespace fep
+{
+namespace
+{
+    /// Number of bits addressing the sub buckets
+    const unsigned int s_nSubBucketBits = 3;
+
+    /// @return Position of the highest set bit of nValue (which must not be 0)
+    unsigned int HighestBit(uint64_t nValue)
+    {
+        unsigned int nBit = 0;
+        while (nValue >>= 1)
+        {
+            ++nBit;
+        }
+        return nBit;
+    }
+
+    /// @return The value at the given rank of the sorted values
+    uint64_t GetValueAtRank(const uint64_t* pBuckets, uint64_t nRank, uint64_t nMax)
+    {
+        uint64_t nCumulated = 0;
+        for (size_t szIndex = 0; szIndex < cLatencyHistogram::s_szBuckets; ++szIndex)
+        {
+            nCumulated += pBuckets[szIndex];
+            if (nCumulated >= nRank)
+            {
+                const uint64_t nUpper = cLatencyHistogram::GetBucketUpperBound(szIndex);
+                return nUpper < nMax ? nUpper : nMax;
+            }
+        }
+        return nMax;
+    }
+}
+
+cLatencyHistogram::cLatencyHistogram()
+{
+    Reset();
+}
+
+size_t cLatencyHistogram::GetBucketIndex(uint64_t nValue)
+{
+    if (nValue < s_szSubBuckets)
+    {
+        return static_cast<size_t>(nValue);
+    }
+    const unsigned int nExponent = HighestBit(nValue);
+    const size_t szSubBucket =
+        static_cast<size_t>(nValue >> (nExponent - s_nSubBucketBits)) & (s_szSubBuckets - 1);
+    return (nExponent - s_nSubBucketBits + 1) * s_szSubBuckets + szSubBucket;
+}
+
+uint64_t cLatencyHistogram::GetBucketUpperBound(size_t szIndex)
+{
+    if (szIndex < s_szSubBuckets)
+    {
+        return szIndex;
+    }
+    const unsigned int nShift = static_cast<unsigned int>(szIndex / s_szSubBuckets) - 1;
+    const uint64_t nLower = (s_szSubBuckets + szIndex % s_szSubBuckets) << nShift;
+    return nLower + ((static_cast<uint64_t>(1) << nShift) - 1);
+}
+
+void cLatencyHistogram::Record(uint64_t nValue)
+{
+    m_anBuckets[GetBucketIndex(nValue)].fetch_add(1, std::memory_order_relaxed);
+    m_nSum.fetch_add(nValue, std::memory_order_relaxed);
+    uint64_t nMin = m_nMin.load(std::memory_order_relaxed);
+    while (nValue < nMin
+        && !m_nMin.compare_exchange_weak(nMin, nValue, std::memory_order_relaxed))
+    {
+    }
+    uint64_t nMax = m_nMax.load(std::memory_order_relaxed);
+    while (nValue > nMax
+        && !m_nMax.compare_exchange_weak(nMax, nValue, std::memory_order_relaxed))
+    {
+    }
+}
+
+void cLatencyHistogram::Reset()
+{
+    for (size_t szIndex = 0; szIndex < s_szBuckets; ++szIndex)
+    {
+        m_anBuckets[szIndex].store(0, std::memory_order_relaxed);
+    }
+    m_nSum.store(0, std::memory_order_relaxed);
+    m_nMin.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    m_nMax.store(0, std::memory_order_relaxed);
+}
+
+void cLatencyHistogram::GetSummary(tLatencySummary& oSummary) const
+{
+    oSummary = tLatencySummary();
+
+    // the count is taken from the copied buckets so the percentiles are consistent
+    uint64_t anBuckets[s_szBuckets];
+    uint64_t nCount = 0;
+    for (size_t szIndex = 0; szIndex < s_szBuckets; ++szIndex)
+    {
+        anBuckets[szIndex] = m_anBuckets[szIndex].load(std::memory_order_relaxed);
+        nCount += anBuckets[szIndex];
+    }
+    if (0 == nCount)
+    {
+        return;
+    }
+
+    oSummary.nCount = nCount;
+    oSummary.nMin = m_nMin.load(std::memory_order_relaxed);
+    oSummary.nMax = m_nMax.load(std::memory_order_relaxed);
+    if (oSummary.nMin > oSummary.nMax)
+    {
+        // reset concurrently
+        oSummary.nMin = oSummary.nMax;
+    }
+    oSummary.nMean = m_nSum.load(std::memory_order_relaxed) / nCount;
+    // rank of the q-th quantile is ceil(q * count), at least 1
+    oSummary.nP50 = GetValueAtRank(anBuckets, (nCount * 500 + 999) / 1000, oSummary.nMax);
+    oSummary.nP90 = GetValueAtRank(anBuckets, (nCount * 900 + 999) / 1000, oSummary.nMax);
+    oSummary.nP99 = GetValueAtRank(anBuckets, (nCount * 990 + 999) / 1000, oSummary.nMax);
+    oSummary.nP999 = GetValueAtRank(anBuckets, (nCount * 999 + 999) / 1000, oSummary.nMax);
+}
+}
@@ -0,0 +1,120 @@
+/**
+ * Declaration of the latency histogram of received signals.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_LATENCY_HISTOGRAM_H_
+#define _FEP_LATENCY_HISTOGRAM_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "fep_participant_export.h"
+
+namespace fep
+{
+    /// Summary of the values recorded by a \ref cLatencyHistogram (all 0 if nothing was recorded)
+    struct tLatencySummary
+    {
+        /// Number of recorded values
+        uint64_t nCount = 0;
+        /// Smallest recorded value
+        uint64_t nMin = 0;
+        /// Largest recorded value
+        uint64_t nMax = 0;
+        /// Mean of the recorded values
+        uint64_t nMean = 0;
+        /// Median
+        uint64_t nP50 = 0;
+        /// 90th percentile
+        uint64_t nP90 = 0;
+        /// 99th percentile
+        uint64_t nP99 = 0;
+        /// 99.9th percentile
+        uint64_t nP999 = 0;
+    };
+
+    /**
+     * Histogram with logarithmic buckets, each power of two is split into 8 linear sub buckets.
+     * Values below 8 are counted exactly, larger ones with a relative error of at most 12.5%.
+     * The full range of uint64_t is covered by a fixed number of buckets, so recording never
+     * allocates and costs a few relaxed atomic operations. Recording is safe from any thread,
+     * the summary of a histogram that is recorded into concurrently is approximate.
+     */
+    class FEP_PARTICIPANT_EXPORT cLatencyHistogram
+    {
+    public:
+        /// Number of linear sub buckets per power of two
+        static const size_t s_szSubBuckets = 8;
+        /// Number of buckets
+        static const size_t s_szBuckets = (64 - 2) * s_szSubBuckets;
+
+    public:
+        /// CTOR
+        cLatencyHistogram();
+
+        /**
+         * @brief Record Adds a value to the histogram
+         * @param [in] nValue The value
+         */
+        void Record(uint64_t nValue);
+
+        /// Discards all recorded values
+        void Reset();
+
+        /**
+         * @brief GetSummary Computes the summary of the recorded values. The percentiles
+         * are reported as the upper bound of the bucket they fall into (at most the maximum).
+         * @param [out] oSummary The summary
+         */
+        void GetSummary(tLatencySummary& oSummary) const;
+
+        /**
+         * @brief GetBucketIndex Returns the bucket a value is counted in
+         * @param [in] nValue The value
+         * @return Index of the bucket
+         */
+        static size_t GetBucketIndex(uint64_t nValue);
+
+        /**
+         * @brief GetBucketUpperBound Returns the largest value counted in a bucket
+         * @param [in] szIndex Index of the bucket
+         * @return The largest value of the bucket
+         */
+        static uint64_t GetBucketUpperBound(size_t szIndex);
+
+    private:
+        cLatencyHistogram(const cLatencyHistogram&);
+        cLatencyHistogram& operator=(const cLatencyHistogram&);
+
+    private:
+        /// Number of values per bucket
+        std::atomic<uint64_t> m_anBuckets[s_szBuckets];
+        /// Sum of the recorded values
+        std::atomic<uint64_t> m_nSum;
+        /// Smallest recorded value
+        std::atomic<uint64_t> m_nMin;
+        /// Largest recorded value
+        std::atomic<uint64_t> m_nMax;
+    };
+}
+
+#endif // _FEP_LATENCY_HISTOGRAM_H_
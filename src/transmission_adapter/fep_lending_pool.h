@@ -0,0 +1,113 @@
+/**
+ * Declaration of the class template cLendingPool.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_LENDING_POOL_H_
+#define _FEP_LENDING_POOL_H_
+
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+#include <a_util/concurrency/fast_mutex.h>
+
+namespace fep
+{
+    /**
+     * Pool of objects that are lent to another party (e.g. a driver thread) and returned by a
+     * plain release function. Returned objects are reused, so lending is free of allocations once
+     * the pool is warmed up. Every lent object keeps the pool alive, objects may therefore be
+     * returned after the owner of the pool is gone.
+     *
+     * @tparam T Type of the lent objects, destroyed along with the pool
+     */
+    template <typename T>
+    class cLendingPool
+    {
+    public:
+        /// A lent object
+        struct tLent
+        {
+            /// The object
+            T oValue;
+            /// Pool the object returns to, only set while the object is lent
+            std::shared_ptr<cLendingPool> pPool;
+        };
+
+        /// DTOR
+        ~cLendingPool()
+        {
+            for (typename std::vector<tLent*>::iterator it = m_vecFree.begin(); it != m_vecFree.end(); ++it)
+            {
+                delete *it;
+            }
+        }
+
+        /**
+         * Takes a returned object out of the pool or creates a new one
+         * @param [in] pPool The pool
+         * @returns The object to be lent, NULL if out of memory
+         */
+        static tLent* Lend(const std::shared_ptr<cLendingPool>& pPool)
+        {
+            tLent* pLent = NULL;
+            {
+                std::unique_lock<a_util::concurrency::fast_mutex> oGuard(pPool->m_oGuard);
+                if (!pPool->m_vecFree.empty())
+                {
+                    pLent = pPool->m_vecFree.back();
+                    pPool->m_vecFree.pop_back();
+                }
+            }
+            if (NULL == pLent)
+            {
+                pLent = new (std::nothrow) tLent();
+            }
+            if (NULL != pLent)
+            {
+                pLent->pPool = pPool;
+            }
+            return pLent;
+        }
+
+        /**
+         * Returns a lent object to its pool, the signature matches the release functions of the
+         * transmission driver interfaces
+         * @param [in] pLent The lent object (tLent)
+         */
+        static void Release(void* pLent)
+        {
+            tLent* pReleased = static_cast<tLent*>(pLent);
+            std::shared_ptr<cLendingPool> pPool;
+            pPool.swap(pReleased->pPool);
+            std::unique_lock<a_util::concurrency::fast_mutex> oGuard(pPool->m_oGuard);
+            pPool->m_vecFree.push_back(pReleased);
+        }
+
+    private:
+        /// Guard for the returned objects
+        a_util::concurrency::fast_mutex m_oGuard;
+        /// Returned objects
+        std::vector<tLent*> m_vecFree;
+    };
+}
+
+#endif // _FEP_LENDING_POOL_H_
@@ -23,9 +23,16 @@
 #include <cstddef>
 #include <memory>
 #include <thread>
-#include <a_util/concurrency/semaphore.h>
+#include <a_util/concurrency.h>
 #include <a_util/result/result_type.h>
+#ifdef WIN32
+#   include <windows.h>
+#elif defined(__linux__)
+#   include <pthread.h>
+#   include <sched.h>
+#endif
 
+#include "_common/fep_lock_free_queue.h"
 #include "transmission_adapter/fep_receiver.h"
 #include "fep_errors.h"
 #include "fep_queue_manager.h"
@@ -33,106 +40,355 @@
 
 namespace fep
 {
+    /// Capacity of the job queue of every worker
+    static const size_t s_szJobQueueCapacity = 1024;
+    /// Maximum time an idle worker sleeps before looking for jobs again
+    static const timestamp_t s_tmIdleTimeout = 1000 * 100;
+    /// Manager the current thread is a worker of (NULL for all other threads)
+    static thread_local const cQueueManager* t_pWorkerOf = NULL;
+
     class cQueueWorker
     {
         friend class cQueueManager;
 
     public:
-        cQueueWorker(cQueueManager* pFepQueueManager);
+        cQueueWorker(cQueueManager* pFepQueueManager, size_t nIndex, int32_t nCpu);
 
     public:
+        void Start();
         void ThreadFunc();
+        void WakeUp();
+        void WaitForJobs();
 
     private:
         cQueueManager* m_pFepQueueManager;
+        size_t m_nIndex;
+        int32_t m_nCpu;
+        cLockFreeQueue<cDataReceiver*> m_qJobs;
+        std::atomic<bool> m_bSleeping;
+        bool m_bWakeUp;
+        a_util::concurrency::mutex m_mtxWakeUp;
+        a_util::concurrency::condition_variable m_cvWakeUp;
         a_util::concurrency::semaphore m_oShutdown;
         a_util::memory::unique_ptr<a_util::concurrency::thread> m_pThread;
     };
 
+static void PinCurrentThread(int32_t nCpu)
+{
+#ifdef WIN32
+    ::SetThreadAffinityMask(::GetCurrentThread(), static_cast<DWORD_PTR>(1) << nCpu);
+#elif defined(__linux__)
+    cpu_set_t oCpuSet;
+    CPU_ZERO(&oCpuSet);
+    CPU_SET(nCpu, &oCpuSet);
+    pthread_setaffinity_np(pthread_self(), sizeof(oCpuSet), &oCpuSet);
+#else
+    // pinning is not supported on this platform
+    (void)nCpu;
+#endif
+}
+
 cQueueManager::cQueueManager() :
-    m_qJobQueue(),
-    m_vecWorkerThreads()
+    m_bJobQueueActive(false),
+    m_vecWorkerThreads(),
+    m_bBusyPolling(false),
+    m_nWaitingProducers(0),
+    m_szSpilledJobs(0)
 {
 }
 
 cQueueManager::~cQueueManager()
 {
     Destroy();
+    DeleteWorkers();
 }
 
-fep::Result cQueueManager::Create(int32_t nWorkerThreads)
+fep::Result cQueueManager::Create(int32_t nWorkerThreads,
+    const std::vector<int32_t>& vecCpuAffinity, bool bBusyPolling)
 {
-    m_bJobQueueActive= true;
+    // workers of a previous run are kept until now since receivers may still have
+    // been enqueueing jobs while the manager was destroyed
+    DeleteWorkers();
+    m_bBusyPolling = bBusyPolling;
 
     for(int32_t i = 0; i < nWorkerThreads; i++)
     {
-        cQueueWorker* pFepQueueWorker = new cQueueWorker(this);
+        int32_t nCpu = vecCpuAffinity.empty() ? -1 : vecCpuAffinity[i % vecCpuAffinity.size()];
+        cQueueWorker* pFepQueueWorker = new cQueueWorker(this, static_cast<size_t>(i), nCpu);
         m_vecWorkerThreads.push_back(pFepQueueWorker);
     }
 
+    m_bJobQueueActive= true;
+
+    // start the threads not before all workers exist - they steal from each other
+    for(std::vector<cQueueWorker*>::iterator it = m_vecWorkerThreads.begin(); it != m_vecWorkerThreads.end(); ++it)
+    {
+        (*it)->Start();
+    }
+
     return ERR_NOERROR;
 }
 
 fep::Result cQueueManager::Destroy()
 {
+    m_bJobQueueActive= false;
+
+    // release the driver threads waiting for room in the job queues
+    {
+        a_util::concurrency::unique_lock<a_util::concurrency::mutex> oGuard(m_mtxJobTaken);
+        m_cvJobTaken.notify_all();
+    }
+
     // Signal all threads shutdown
     for(std::vector<cQueueWorker*>::iterator it = m_vecWorkerThreads.begin(); it != m_vecWorkerThreads.end(); ++it)
     {
         cQueueWorker* pFepWorker = (*it);
         pFepWorker->m_oShutdown.notify();
+        pFepWorker->WakeUp();
     }
 
-    // Join and delete all threads
+    // Join all threads and clear the queues
     for(std::vector<cQueueWorker*>::iterator it = m_vecWorkerThreads.begin(); it != m_vecWorkerThreads.end(); ++it)
     {
         cQueueWorker* pFepWorker = (*it);
-        pFepWorker->m_pThread->join();
-        delete pFepWorker;
+        if (pFepWorker->m_pThread)
+        {
+            pFepWorker->m_pThread->join();
+            pFepWorker->m_pThread.reset();
+        }
+        cDataReceiver* pDataReceiver;
+        while(pFepWorker->m_qJobs.TryDequeue(pDataReceiver))
+        {
+            //we just want to clear the queue
+        }
+    }
+    {
+        a_util::concurrency::unique_lock<a_util::concurrency::mutex> oGuard(m_mtxSpilledJobs);
+        m_qSpilledJobs.clear();
+        m_szSpilledJobs = 0;
     }
 
+    return ERR_NOERROR;
+}
+
+void cQueueManager::DeleteWorkers()
+{
+    for(std::vector<cQueueWorker*>::iterator it = m_vecWorkerThreads.begin(); it != m_vecWorkerThreads.end(); ++it)
+    {
+        delete (*it);
+    }
     m_vecWorkerThreads.clear();
+}
 
-    m_bJobQueueActive= false;
-    cDataReceiver* pDataReceiver;
-    while(m_qJobQueue.TryDequeue(pDataReceiver, (1000*100)))
+size_t cQueueManager::GetHomeWorker(const cDataReceiver* pDataReceiver) const
+{
+    // mix the pointer bits, the lower ones are always zero due to alignment
+    uint64_t nHash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pDataReceiver));
+    nHash ^= nHash >> 33;
+    nHash *= 0xff51afd7ed558ccdULL;
+    nHash ^= nHash >> 33;
+    return static_cast<size_t>(nHash % m_vecWorkerThreads.size());
+}
+
+bool cQueueManager::TryEnqueueJob(cDataReceiver* pDataReceiver, size_t& nTarget)
+{
+    size_t nHome = GetHomeWorker(pDataReceiver);
+    nTarget = nHome;
+    // if the home queue is full hand the job to the next worker
+    while (!m_vecWorkerThreads[nTarget]->m_qJobs.Enqueue(pDataReceiver))
     {
-        //we just want to clear the queue
+        nTarget = (nTarget + 1) % m_vecWorkerThreads.size();
+        if (nTarget == nHome)
+        {
+            return false;
+        }
     }
-    return ERR_NOERROR;
+    return true;
+}
+
+bool cQueueManager::IsWorkerThread() const
+{
+    return t_pWorkerOf == this;
 }
 
 void cQueueManager::EnqueueJob(cDataReceiver* pDataReceiver)
 {
-    if (m_bJobQueueActive)
+    if (!m_bJobQueueActive || m_vecWorkerThreads.empty())
+    {
+        return;
+    }
+
+    size_t nTarget = 0;
+    if (!TryEnqueueJob(pDataReceiver, nTarget))
+    {
+        if (IsWorkerThread())
+        {
+            // the workers are the ones emptying the queues - a worker must never wait for them
+            a_util::concurrency::unique_lock<a_util::concurrency::mutex> oGuard(m_mtxSpilledJobs);
+            m_qSpilledJobs.push_back(pDataReceiver);
+            m_szSpilledJobs++;
+            nTarget = GetHomeWorker(pDataReceiver);
+        }
+        else
+        {
+            // all queues are full - wait until a worker took a job instead of spinning
+            a_util::concurrency::unique_lock<a_util::concurrency::mutex> oGuard(m_mtxJobTaken);
+            m_nWaitingProducers++;
+            // pairs with the fence in NotifyJobTaken: either the worker sees us waiting or we see the room
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool bEnqueued = TryEnqueueJob(pDataReceiver, nTarget);
+            while (!bEnqueued && m_bJobQueueActive)
+            {
+                m_cvJobTaken.wait_for(oGuard, a_util::chrono::microseconds(s_tmIdleTimeout));
+                bEnqueued = TryEnqueueJob(pDataReceiver, nTarget);
+            }
+            m_nWaitingProducers--;
+            if (!bEnqueued)
+            {
+                return;
+            }
+        }
+    }
+
+    if (!m_bBusyPolling)
+    {
+        // pairs with the fence in WaitForJobs: either the worker sees the job or we see it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        cQueueWorker* pTarget = m_vecWorkerThreads[nTarget];
+        if (pTarget->m_bSleeping)
+        {
+            pTarget->WakeUp();
+        }
+        else
+        {
+            // the home worker is busy - let an idle one steal the job
+            for (std::vector<cQueueWorker*>::iterator it = m_vecWorkerThreads.begin(); it != m_vecWorkerThreads.end(); ++it)
+            {
+                if ((*it)->m_bSleeping)
+                {
+                    (*it)->WakeUp();
+                    break;
+                }
+            }
+        }
+    }
+}
+
+bool cQueueManager::TryGetJob(size_t nWorker, cDataReceiver*& pDataReceiver)
+{
+    size_t nWorkers = m_vecWorkerThreads.size();
+    for (size_t i = 0; i < nWorkers; ++i)
+    {
+        if (m_vecWorkerThreads[(nWorker + i) % nWorkers]->m_qJobs.TryDequeue(pDataReceiver))
+        {
+            NotifyJobTaken();
+            return true;
+        }
+    }
+    if (0 < m_szSpilledJobs)
+    {
+        a_util::concurrency::unique_lock<a_util::concurrency::mutex> oGuard(m_mtxSpilledJobs);
+        if (!m_qSpilledJobs.empty())
+        {
+            pDataReceiver = m_qSpilledJobs.front();
+            m_qSpilledJobs.pop_front();
+            m_szSpilledJobs--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void cQueueManager::NotifyJobTaken()
+{
+    // pairs with the fence in EnqueueJob
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (0 < m_nWaitingProducers)
+    {
+        a_util::concurrency::unique_lock<a_util::concurrency::mutex> oGuard(m_mtxJobTaken);
+        m_cvJobTaken.notify_all();
+    }
+}
+
+bool cQueueManager::HasPendingJobs() const
+{
+    for (std::vector<cQueueWorker*>::const_iterator it = m_vecWorkerThreads.begin(); it != m_vecWorkerThreads.end(); ++it)
     {
-        m_qJobQueue.Enqueue(pDataReceiver);
+        if (!(*it)->m_qJobs.IsEmpty())
+        {
+            return true;
+        }
     }
+    return 0 < m_szSpilledJobs;
 }
 
-fep::Result cQueueManager::DoWork()
+fep::Result cQueueManager::DoWork(cQueueWorker* pWorker)
 {
     cDataReceiver* pDataReceiver = NULL;
-    if(true == m_qJobQueue.TryDequeue(pDataReceiver, (1000 * 100)))
+    if (TryGetJob(pWorker->m_nIndex, pDataReceiver))
     {
         pDataReceiver->DoJob();
     }
+    else if (m_bBusyPolling)
+    {
+        a_util::concurrency::this_thread::yield();
+    }
+    else
+    {
+        pWorker->WaitForJobs();
+    }
 
     return ERR_NOERROR;
 }
 
-cQueueWorker::cQueueWorker(cQueueManager* pFeQueueManager)
-    : m_pFepQueueManager(pFeQueueManager), m_oShutdown()
+cQueueWorker::cQueueWorker(cQueueManager* pFeQueueManager, size_t nIndex, int32_t nCpu)
+    : m_pFepQueueManager(pFeQueueManager), m_nIndex(nIndex), m_nCpu(nCpu),
+      m_qJobs(s_szJobQueueCapacity), m_bSleeping(false), m_bWakeUp(false), m_oShutdown()
+{
+}
+
+void cQueueWorker::Start()
 {
     m_pThread.reset(new a_util::concurrency::thread(&cQueueWorker::ThreadFunc, this));
 }
 
 void cQueueWorker::ThreadFunc()
 {
+    t_pWorkerOf = m_pFepQueueManager;
+    if (0 <= m_nCpu)
+    {
+        PinCurrentThread(m_nCpu);
+    }
+
     fep::Result nResult= ERR_NOERROR;
     while (fep::isOk(nResult) && !m_oShutdown.is_set())
     {
-        nResult= m_pFepQueueManager->DoWork();
+        nResult= m_pFepQueueManager->DoWork(this);
+    }
+}
+
+void cQueueWorker::WakeUp()
+{
+    a_util::concurrency::unique_lock<a_util::concurrency::mutex> oGuard(m_mtxWakeUp);
+    m_bWakeUp = true;
+    m_cvWakeUp.notify_one();
+}
+
+void cQueueWorker::WaitForJobs()
+{
+    m_bSleeping = true;
+    // pairs with the fence in cQueueManager::EnqueueJob
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!m_pFepQueueManager->HasPendingJobs() && !m_oShutdown.is_set())
+    {
+        a_util::concurrency::unique_lock<a_util::concurrency::mutex> oGuard(m_mtxWakeUp);
+        if (!m_bWakeUp)
+        {
+            m_cvWakeUp.wait_for(oGuard, a_util::chrono::microseconds(s_tmIdleTimeout));
+        }
+        m_bWakeUp = false;
     }
+    m_bSleeping = false;
 }
 
 }
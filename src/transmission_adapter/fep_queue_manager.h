@@ -22,11 +22,14 @@
 #ifndef _MANAGER_HEADER_
 #define _MANAGER_HEADER_ 
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <vector>
+#include <a_util/concurrency.h>
 
 #include "fep_result_decl.h"
-#include "_common/fep_waitable_queue.h"
 
 namespace fep
 {
@@ -37,7 +40,10 @@ namespace fep
      * Manage Fep  workers
      *
      * The Fep manager serves as a manager and container for the worker threads.
-     * It implements a manager/worker design pattern.
+     * It implements a work stealing scheduler: every worker owns a job queue and every
+     * receiver is hashed to a home worker, so the samples of a signal are usually processed
+     * by the same thread. A worker running out of jobs steals from the queues of the others.
+     * Workers can be pinned to CPUs and can busy-poll instead of sleeping.
      */
     class cQueueManager
     {
@@ -59,10 +65,15 @@ namespace fep
         /**
          * This method \c Create will set up all needed internal elements.
          * @param [in] nWorkerThreads The number of worker threads to be created
+         * @param [in] vecCpuAffinity CPUs the workers are pinned to (worker i is pinned to
+         *                            vecCpuAffinity[i % size]). Empty for no pinning.
+         * @param [in] bBusyPolling  If true, idle workers poll for jobs instead of sleeping
          *
          * @return Standard result code.
          */
-        fep::Result Create(int32_t nWorkerThreads);
+        fep::Result Create(int32_t nWorkerThreads,
+            const std::vector<int32_t>& vecCpuAffinity = std::vector<int32_t>(),
+            bool bBusyPolling = false);
 
         /**
          * This method \c Create will release all internal resources.
@@ -73,7 +84,10 @@ namespace fep
 
         /**
          * The method \c EnqueueJob will push a pointer to a cDataReceiver into
-         * the JobQueue.
+         * the job queue of its home worker.
+         * If the queues of all workers are full, the calling (driver) thread waits until a
+         * worker took a job. A worker thread does not wait for itself, its job is put into
+         * an unbounded spill queue instead.
          *
          * @param  [in] pParticipant The pointer to the cDataReceiver
          */
@@ -82,20 +96,86 @@ namespace fep
     private:
         /**
          * The function of the receive thread. Will try to dequeue a pointer
-         * from the JobQueue and call the \ref cDataReceiver::DoJob 
-         * method of the corresponding cDataReceiver.
+         * from the own job queue (or steal one from another worker) and call the
+         * \ref cDataReceiver::DoJob method of the corresponding cDataReceiver.
+         * Waits for new jobs if there are none.
          *
+         * @param [in] pWorker The calling worker
          * @return Standard result code.
          */
-        fep::Result DoWork();
+        fep::Result DoWork(cQueueWorker* pWorker);
+
+        /**
+         * Tries to dequeue a job, starting at the queue of the given worker.
+         *
+         * @param [in] nWorker Index of the calling worker
+         * @param [out] pDataReceiver The job
+         * @retval true A job was found
+         * @retval false All queues are empty
+         */
+        bool TryGetJob(size_t nWorker, cDataReceiver*& pDataReceiver);
+
+        /**
+         * Tries to push a job into the queue of any worker, starting at the home worker.
+         *
+         * @param [in] pDataReceiver The job
+         * @param [out] nTarget Index of the worker that got the job
+         * @retval true The job was enqueued
+         * @retval false The queues of all workers are full
+         */
+        bool TryEnqueueJob(cDataReceiver* pDataReceiver, size_t& nTarget);
+
+        /**
+         * Wakes up the driver threads waiting for room in the job queues (if any).
+         */
+        void NotifyJobTaken();
+
+        /**
+         * Checks whether the calling thread is one of the workers.
+         *
+         * @retval true Called by a worker
+         */
+        bool IsWorkerThread() const;
+
+        /**
+         * Checks whether any worker has pending jobs.
+         *
+         * @retval true At least one queue is not empty
+         */
+        bool HasPendingJobs() const;
+
+        /**
+         * Returns the home worker of a receiver.
+         *
+         * @param [in] pDataReceiver The receiver
+         * @return Index of the worker
+         */
+        size_t GetHomeWorker(const cDataReceiver* pDataReceiver) const;
+
+        /**
+         * Deletes all workers. The threads must have been joined already.
+         */
+        void DeleteWorkers();
 
     private:
         /// Flag to determine if enqueue should be enabled
-        bool m_bJobQueueActive;
-        /// Queue containing the jobs to be done by the worker threads
-        cWaitableQueue<cDataReceiver*> m_qJobQueue;
+        std::atomic<bool> m_bJobQueueActive;
         /// Vector containing the worker threads
         std::vector<cQueueWorker*> m_vecWorkerThreads;
+        /// Flag indicating that idle workers poll instead of sleeping
+        bool m_bBusyPolling;
+        /// Number of driver threads waiting for room in the job queues
+        std::atomic<int32_t> m_nWaitingProducers;
+        /// Guards the waiting of the driver threads
+        a_util::concurrency::mutex m_mtxJobTaken;
+        /// Signalled when a worker took a job while driver threads are waiting
+        a_util::concurrency::condition_variable m_cvJobTaken;
+        /// Number of jobs in m_qSpilledJobs
+        std::atomic<size_t> m_szSpilledJobs;
+        /// Guards m_qSpilledJobs
+        a_util::concurrency::mutex m_mtxSpilledJobs;
+        /// Jobs enqueued by workers while all job queues were full
+        std::deque<cDataReceiver*> m_qSpilledJobs;
     };
 }
 
@@ -35,6 +35,7 @@
 #include <serialization/serialization.h>
 
 #include "_common/fep_optional.h"
+#include "fep3/components/clock/clock_service_intf.h"
 #include "fep3/components/legacy/property_tree/fep_module_header_config.h"
 #include "fep3/components/legacy/property_tree/fep_propertytree_intf.h"
 #include "fep_errors.h"
@@ -44,8 +45,11 @@
 #include "incident_handler/fep_incident_codes.h"
 #include "incident_handler/fep_incident_handler.h"
 #include "incident_handler/fep_severity_level.h"
+#include "perfmeasure/fep_trace.h"
 #include "signal_registry/fep_signal_struct.h"
 #include "transmission_adapter/fep_data_sample_factory.h"
+#include "transmission_adapter/fep_data_sample_view.h"
+#include "transmission_adapter/fep_delta_codec.h"
 #include "transmission_adapter/fep_options_factory.h"
 #include "transmission_adapter/fep_preparation_data_listener_intf.h"
 #include "transmission_adapter/fep_receive_intf.h"
@@ -64,6 +68,8 @@ class IPreparationDataSample;
 a_util::concurrency::fast_mutex cDataReceiver::ms_oStaticDDLSync;
 static uint32_t s_nDefaultSampleAllocationCount = 256;
 static uint32_t s_nDefaultRawSampleAllocationCount = 20;
+// one view is held as current sample, one is being dispatched - the rest is spare
+static uint32_t s_nZeroCopyViewCount = 4;
 
 cDataReceiver::cDataReceiver() :
     m_pPropertyTree(NULL),
@@ -71,10 +77,23 @@ cDataReceiver::cDataReceiver() :
     m_pDriver(NULL),
     m_pDriverReceiver(NULL),
     m_pQueueManager(NULL),
+    m_nReceivedSamples(0),
+    m_nReceivedBytes(0),
+    m_nDroppedSamples(0),
+    m_nConflatedSamples(0),
+    m_bConflate(false),
+    m_pClockService(NULL),
+    m_nLastSequence(0),
+    m_nSequenceGaps(0),
     m_pCurrentDataSample(NULL),
+    m_pCurrentView(NULL),
+    m_bZeroCopy(false),
     m_bDisableDdlSerialization(false),
     m_szSignalSize(0),
-    m_bRaw(false)
+    m_bRaw(false),
+    m_nDeltaSequence(0),
+    m_bDeltaChainValid(false),
+    m_bDeltaSampleDiscarded(false)
 {
 }
 
@@ -96,10 +115,22 @@ cDataReceiver::~cDataReceiver()
     }
     FlushQueue(true);
 
+    if (NULL != m_pCurrentView)
+    {
+        ReleaseView(m_pCurrentView);
+        m_pCurrentView = NULL;
+    }
+    cDataSampleView* pView;
+    while (m_qViewPool.TryDequeue(pView))
+    {
+        delete pView;
+    }
+
     sDataContainer* pDataItem;
 
     while(m_qPreAllocQueue.TryDequeue(pDataItem))
     {
+        // lent driver buffers were handed back by FlushQueue, so pData is either ours or NULL
         ::free(pDataItem->pData);
         delete pDataItem;
     }
@@ -123,6 +154,7 @@ fep::Result cDataReceiver::Create(ITransmissionDriver* pDriver, fep::IPropertyTr
     m_strSignalName = oSignal.strSignalName;
     m_bDisableDdlSerialization = (oSignal.eSerialization == fep::SER_Raw);
     m_bRaw = oSignal.bIsRaw.GetValue();
+    m_bConflate = oSignal.bConflate.GetValue();
     m_strSignalType = oSignal.strSignalType;
     m_szSignalSize = oSignal.szSampleSize;
     if (0 == m_szSignalSize)
@@ -168,6 +200,9 @@ fep::Result cDataReceiver::Create(ITransmissionDriver* pDriver, fep::IPropertyTr
             nResult = m_oCodecFactory.isValid().getErrorCode();
             if (fep::isOk(nResult))
             {
+                // types the plan cannot handle are deserialized by the generic codec
+                m_oCodecPlan.Create(m_oCodecFactory, pDescription->getStructByName(oSignal.strSignalType));
+
                 cDataSampleFactory::CreateSample(&m_pCurrentDataSample);
                 /* To ensure size is set to size of user data (without any sync-flags,
                 * etc.) a new cMediaCoder and IMediaSerializer is created and used
@@ -216,30 +251,73 @@ fep::Result cDataReceiver::Create(ITransmissionDriver* pDriver, fep::IPropertyTr
         }
         if (fep::isOk(nResult))
         {
+            nResult = m_pDriver->CreateReceiver(m_pDriverReceiver, m_oSignalOptions);
+        }
+        if (fep::isOk(nResult))
+        {
+            // Zero copy reception is only possible if the received data is not deserialized.
+            // It is silently disabled if the driver is not able to lend its buffers and for
+            // bundled signals (their samples are copied out of the bundle).
+            if (oSignal.bZeroCopy.GetValue() && m_bDisableDdlSerialization
+                && oSignal.strBundleId.GetValue().empty())
+            {
+                m_bZeroCopy = fep::isOk(m_pDriverReceiver->SetZeroCopyReceiver(
+                    cDataReceiver::EnqueueReceivedBuffer, reinterpret_cast<void*>(this)));
+            }
+            // every container is either free or queued, so the queues can never overflow
+            m_qPreAllocQueue.Initialize(preallocated_samples_count);
+            m_qReceiveQueue.Initialize(preallocated_samples_count);
             for (unsigned int i = 0; i < preallocated_samples_count; ++i)
             {
                 sDataContainer* pDataContainer = new sDataContainer;
-                pDataContainer->szCapacity = m_szSignalSize + sizeof(cFepDataHeader);
-                pDataContainer->szSize = m_szSignalSize + sizeof(cFepDataHeader);
-                pDataContainer->pData = ::malloc(pDataContainer->szCapacity);
-                if (NULL == pDataContainer->pData)
+                pDataContainer->pRelease = NULL;
+                pDataContainer->pReleaseContext = NULL;
+                pDataContainer->pNext = NULL;
+                if (m_bZeroCopy)
                 {
-                    nResult = ERR_MEMORY;
-                    break;
+                    // the container will refer to the driver buffer
+                    pDataContainer->szCapacity = 0;
+                    pDataContainer->szSize = 0;
+                    pDataContainer->pData = NULL;
                 }
                 else
                 {
-                    m_qPreAllocQueue.Enqueue(pDataContainer);
+                    // room for the wall clock stamp the sender might append
+                    pDataContainer->szCapacity = m_szSignalSize + sizeof(cFepDataHeader)
+                        + header::s_szLatencyStampSize;
+                    pDataContainer->szSize = pDataContainer->szCapacity;
+                    pDataContainer->pData = ::malloc(pDataContainer->szCapacity);
+                    if (NULL == pDataContainer->pData)
+                    {
+                        delete pDataContainer;
+                        nResult = ERR_MEMORY;
+                        break;
+                    }
+                }
+                m_qPreAllocQueue.Enqueue(pDataContainer);
+            }
+            if (m_bZeroCopy)
+            {
+                m_qViewPool.Initialize(s_nZeroCopyViewCount);
+                for (unsigned int i = 0; i < s_nZeroCopyViewCount; ++i)
+                {
+                    m_qViewPool.Enqueue(new cDataSampleView());
                 }
             }
         }
-        if (fep::isOk(nResult))
-        {
-            nResult = m_pDriver->CreateReceiver(m_pDriverReceiver, m_oSignalOptions);
-        }
-        if (fep::isOk(nResult))
+        if (fep::isOk(nResult) && !m_bZeroCopy)
         {
             nResult = m_pDriverReceiver->SetReceiver(cDataReceiver::EnqueueReceivedData, reinterpret_cast<void*>(this));
+            if (fep::isOk(nResult))
+            {
+                // optional - drivers without batch reception keep using the single sample callback
+                fep::Result nBatchResult = m_pDriverReceiver->SetBatchReceiver(
+                    cDataReceiver::EnqueueReceivedBatch, reinterpret_cast<void*>(this));
+                if (fep::isFailed(nBatchResult) && nBatchResult != ERR_NOT_SUPPORTED)
+                {
+                    nResult = nBatchResult;
+                }
+            }
         }
     }
     return nResult;
@@ -250,7 +328,8 @@ fep::Result cDataReceiver::GatherSignalOptions(cSignalOptions& oDriverSignalOpti
     fep::Result nResult = ERR_NOERROR;
     // offset for data header
     if (!(oDriverSignalOptions.SetOption("SignalName", oSignal.strSignalName)
-        && oDriverSignalOptions.SetOption("SignalSize", m_szSignalSize + sizeof(cFepDataHeader))))
+        && oDriverSignalOptions.SetOption("SignalSize",
+            m_szSignalSize + sizeof(cFepDataHeader) + header::s_szLatencyStampSize)))
     {
         nResult = ERR_FAILED;
     }
@@ -308,6 +387,8 @@ fep::Result cDataReceiver::Mute()
 
 fep::Result cDataReceiver::Unmute()
 {
+    // the samples sent while muted are no gap
+    m_nLastSequence.store(0, std::memory_order_relaxed);
     return m_pDriverReceiver->Unmute();
 }
 
@@ -322,7 +403,7 @@ fep::Result cDataReceiver::FlushQueue(bool no_lock)
     sDataContainer* pDataItem;
     while(m_qReceiveQueue.TryDequeue(pDataItem))
     {
-        m_qPreAllocQueue.Enqueue(pDataItem);
+        ReleaseContainer(pDataItem);
     }
     if (!no_lock)
     {
@@ -331,46 +412,391 @@ fep::Result cDataReceiver::FlushQueue(bool no_lock)
     return ERR_NOERROR;
 }
 
+cDataReceiver::sDataContainer* cDataReceiver::CopyToContainer(const void* pData, size_t szSize)
+{
+    m_nReceivedSamples.fetch_add(1, std::memory_order_relaxed);
+    m_nReceivedBytes.fetch_add(szSize, std::memory_order_relaxed);
+    TrackArrival(pData, szSize);
+    sDataContainer* pDataContainer;
+    if (!TakeFreeContainer(pDataContainer))
+    {
+        // all containers are in use - the workers cannot keep up
+        m_nDroppedSamples++;
+        return NULL;
+    }
+
+    if (m_bRaw)
+    {
+        if (szSize > pDataContainer->szCapacity)
+        {
+            pDataContainer->pData = realloc(pDataContainer->pData, szSize);
+            pDataContainer->szCapacity = szSize;
+        }
+    }
+    else
+    {
+        if (szSize > m_szSignalSize + sizeof(cFepDataHeader) + GetLatencyStampSize(pData, szSize))
+        {
+            INVOKE_INCIDENT(m_pIncidentInvocationHandler,
+                fep::FSI_TRANSM_RX_WRONG_SAMPLE_SIZE, fep::SL_Critical_Local,
+                a_util::strings::format("Sample has unexpected size (Expected %d, got %d). (Instance %s::%s)",
+                m_szSignalSize + sizeof(cFepDataHeader), szSize,
+                GetModuleName(), m_strSignalName.c_str()).c_str());
+            m_qPreAllocQueue.Enqueue(pDataContainer);
+            m_nDroppedSamples++;
+            return NULL;
+        }
+    }
+
+    if (!a_util::memory::copy(pDataContainer->pData, pDataContainer->szCapacity, pData, szSize))
+    {
+        m_qPreAllocQueue.Enqueue(pDataContainer);
+        m_nDroppedSamples++;
+        return NULL;
+    }
+    pDataContainer->szSize = szSize;
+    pDataContainer->pNext = NULL;
+    return pDataContainer;
+}
+
 void cDataReceiver::EnqueueReceivedData(void* pInstance, const void* pData, size_t szSize)
 {
+    FEP_TRACE_INSTANT("ReceiveSample", "transmission");
     cDataReceiver* pReceiver = reinterpret_cast<cDataReceiver*>(pInstance);
-    sDataContainer* pDataContainer;
-    if(pReceiver->m_qPreAllocQueue.TryDequeue(pDataContainer))
-    {   
-        if(pReceiver->m_bRaw)
+    sDataContainer* pDataContainer = pReceiver->CopyToContainer(pData, szSize);
+    if (NULL != pDataContainer)
+    {
+        if (pReceiver->m_qReceiveQueue.Enqueue(pDataContainer))
         {
-            if(szSize > pDataContainer->szCapacity)
-            {
-                pDataContainer->pData = realloc(pDataContainer->pData, szSize);
-                pDataContainer->szCapacity = szSize;
-            }
+            pReceiver->m_pQueueManager->EnqueueJob(pReceiver);
         }
         else
         {
-            if(szSize > pReceiver->m_szSignalSize + sizeof(cFepDataHeader))
-            {
+            pReceiver->m_qPreAllocQueue.Enqueue(pDataContainer);
+        }
+    }
+}
 
-                INVOKE_INCIDENT(pReceiver->m_pIncidentInvocationHandler,
-                    fep::FSI_TRANSM_RX_WRONG_SAMPLE_SIZE, fep::SL_Critical_Local,
-                    a_util::strings::format("Sample has unexpected size (Expected %d, got %d). (Instance %s::%s)",
-                    pReceiver->m_szSignalSize + sizeof(cFepDataHeader), szSize,
-                    pReceiver->GetModuleName(), pReceiver->m_strSignalName.c_str()).c_str());
-                return;
-            }
+void cDataReceiver::EnqueueReceivedBatch(void* pInstance, const IReceive::tReceivedBuffer* pBuffers,
+    size_t szCount)
+{
+    FEP_TRACE_INSTANT_VALUE("ReceiveBatch", "transmission", szCount);
+    cDataReceiver* pReceiver = reinterpret_cast<cDataReceiver*>(pInstance);
+    // chain the containers in reception order, the chain is enqueued as a single item
+    sDataContainer* pFirst = NULL;
+    sDataContainer* pLast = NULL;
+    for (size_t i = 0; i < szCount; ++i)
+    {
+        sDataContainer* pDataContainer = pReceiver->CopyToContainer(pBuffers[i].pData, pBuffers[i].szSize);
+        if (NULL == pDataContainer)
+        {
+            continue;
+        }
+        if (NULL == pLast)
+        {
+            pFirst = pDataContainer;
+        }
+        else
+        {
+            pLast->pNext = pDataContainer;
         }
+        pLast = pDataContainer;
+    }
 
-        if(a_util::memory::copy(pDataContainer->pData, pDataContainer->szCapacity, pData, szSize))
+    if (NULL != pFirst)
+    {
+        if (pReceiver->m_qReceiveQueue.Enqueue(pFirst))
+        {
+            pReceiver->m_pQueueManager->EnqueueJob(pReceiver);
+        }
+        else
         {
-            pDataContainer->szSize = szSize;
+            pReceiver->ReleaseContainer(pFirst);
+        }
+    }
+}
+
+void cDataReceiver::EnqueueReceivedBuffer(void* pInstance, const void* pData, size_t szSize,
+    IReceive::tReleaseFuncPtr pRelease, void* pReleaseContext)
+{
+    FEP_TRACE_INSTANT("ReceiveSample", "transmission");
+    cDataReceiver* pReceiver = reinterpret_cast<cDataReceiver*>(pInstance);
+    pReceiver->m_nReceivedSamples.fetch_add(1, std::memory_order_relaxed);
+    pReceiver->m_nReceivedBytes.fetch_add(szSize, std::memory_order_relaxed);
+    pReceiver->TrackArrival(pData, szSize);
+    sDataContainer* pDataContainer;
+    if (pReceiver->TakeFreeContainer(pDataContainer))
+    {
+        pDataContainer->pData = const_cast<void*>(pData);
+        pDataContainer->szSize = szSize;
+        pDataContainer->szCapacity = szSize;
+        pDataContainer->pRelease = pRelease;
+        pDataContainer->pReleaseContext = pReleaseContext;
 
-            pReceiver->m_qReceiveQueue.Enqueue(pDataContainer);
+        if (pReceiver->m_qReceiveQueue.Enqueue(pDataContainer))
+        {
             pReceiver->m_pQueueManager->EnqueueJob(pReceiver);
         }
         else
         {
-            pReceiver->m_qPreAllocQueue.Enqueue(pDataContainer);
+            pReceiver->ReleaseContainer(pDataContainer);
         }
     }
+    else
+    {
+        // all containers are in use - drop the sample just like EnqueueReceivedData does
+        pRelease(pReleaseContext);
+        pReceiver->m_nDroppedSamples++;
+    }
+}
+
+uint64_t cDataReceiver::GetDroppedSampleCount() const
+{
+    return m_nDroppedSamples;
+}
+
+uint64_t cDataReceiver::GetQueueOverflowCount() const
+{
+    return m_qReceiveQueue.GetOverflowCount();
+}
+
+uint64_t cDataReceiver::GetConflatedSampleCount() const
+{
+    return m_nConflatedSamples;
+}
+
+void cDataReceiver::GetStatistics(tTransportStatistics& oStatistics) const
+{
+    oStatistics.strSignalName = m_strSignalName;
+    oStatistics.nSamples = m_nReceivedSamples.load(std::memory_order_relaxed);
+    oStatistics.nBytes = m_nReceivedBytes.load(std::memory_order_relaxed);
+    oStatistics.nDroppedSamples = m_nDroppedSamples;
+    oStatistics.nQueueOverflows = m_qReceiveQueue.GetOverflowCount();
+    oStatistics.nConflatedSamples = m_nConflatedSamples;
+    oStatistics.nDefragmentationLosses =
+        (NULL != m_pDriverReceiver) ? m_pDriverReceiver->GetLostSampleCount() : 0;
+    oStatistics.nQueueHighWaterMark = m_qReceiveQueue.GetHighWaterMark();
+    oStatistics.nFailedTransmissions = 0;
+    oStatistics.nCodecTimeTotal_ns = m_oDecodeTime.GetTotal();
+    oStatistics.nCodecTimeMax_ns = m_oDecodeTime.GetMax();
+    oStatistics.nSequenceGaps = m_nSequenceGaps.load(std::memory_order_relaxed);
+    m_oLatency.GetSummary(oStatistics.oLatency_us);
+    m_oWallClockLatency.GetSummary(oStatistics.oWallClockLatency_ns);
+}
+
+void cDataReceiver::SetClockService(IClockService* pClockService)
+{
+    a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxClockService);
+    m_pClockService.store(pClockService, std::memory_order_release);
+}
+
+void cDataReceiver::ResetLatencyStatistics()
+{
+    m_oLatency.Reset();
+    m_oWallClockLatency.Reset();
+    m_nLastSequence.store(0, std::memory_order_relaxed);
+    m_nSequenceGaps.store(0, std::memory_order_relaxed);
+}
+
+size_t cDataReceiver::GetLatencyStampSize(const void* pData, size_t szSize)
+{
+    if (szSize < sizeof(cFepDataHeader) + header::s_szLatencyStampSize
+        || 0 == (reinterpret_cast<const cFepDataHeader*>(pData)->m_nSerAndByteOrderFlags
+            & header::LATENCY_STAMP))
+    {
+        return 0;
+    }
+    return header::s_szLatencyStampSize;
+}
+
+void cDataReceiver::TrackArrival(const void* pData, size_t szSize)
+{
+    if (szSize < sizeof(cFepDataHeader))
+    {
+        return;
+    }
+    const cFepDataHeader* pFepDataHeader = reinterpret_cast<const cFepDataHeader*>(pData);
+    const header::ByteOrderAndSerialization nByteOrderFlag =
+        header::GetByteOrderFlag(pFepDataHeader->m_nSerAndByteOrderFlags);
+
+    if (0 != GetLatencyStampSize(pData, szSize))
+    {
+        int64_t nStamp = 0;
+        a_util::memory::copy(&nStamp, sizeof(nStamp),
+            static_cast<const uint8_t*>(pData) + szSize - header::s_szLatencyStampSize,
+            header::s_szLatencyStampSize);
+        const int64_t nLatency = GetWallClockStamp()
+            - header::ConvertToCorrectByteorder(nStamp, nByteOrderFlag);
+        if (nLatency >= 0)
+        {
+            m_oWallClockLatency.Record(static_cast<uint64_t>(nLatency));
+        }
+    }
+
+    // the lock is only taken if the latency is measured at all
+    if (NULL != m_pClockService.load(std::memory_order_acquire))
+    {
+        timestamp_t nNow = 0;
+        {
+            a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxClockService);
+            IClockService* pClockService = m_pClockService.load(std::memory_order_relaxed);
+            if (NULL != pClockService)
+            {
+                nNow = pClockService->getTime();
+            }
+        }
+        // samples stamped ahead of the clock (or before it was started) are not recorded
+        const int64_t nSendTimeStamp =
+            header::ConvertToCorrectByteorder(pFepDataHeader->m_nSendTimeStamp, nByteOrderFlag);
+        if (0 < nNow && nSendTimeStamp <= nNow)
+        {
+            m_oLatency.Record(static_cast<uint64_t>(nNow - nSendTimeStamp));
+        }
+    }
+
+    const uint16_t nSequence =
+        header::ConvertToCorrectByteorder(pFepDataHeader->m_nSequence, nByteOrderFlag);
+    if (0 == nSequence)
+    {
+        // not counted by the sender
+        return;
+    }
+    // the driver hands over the samples of a signal one after the other
+    const uint16_t nLastSequence = m_nLastSequence.load(std::memory_order_relaxed);
+    if (0 != nLastSequence)
+    {
+        uint32_t nDistance = static_cast<uint16_t>(nSequence - nLastSequence);
+        if (nSequence < nLastSequence)
+        {
+            // 0 is skipped on wrap around
+            --nDistance;
+        }
+        if (0 == nDistance || nDistance >= 0x8000)
+        {
+            // duplicate or late sample, the gap was counted already
+            return;
+        }
+        m_nSequenceGaps.fetch_add(nDistance - 1, std::memory_order_relaxed);
+    }
+    m_nLastSequence.store(nSequence, std::memory_order_relaxed);
+}
+
+bool cDataReceiver::TakeFreeContainer(sDataContainer*& pDataContainer)
+{
+    if (m_qPreAllocQueue.TryDequeue(pDataContainer))
+    {
+        return true;
+    }
+    sDataContainer* pOldest;
+    if (m_bConflate && m_qReceiveQueue.TryDequeue(pOldest))
+    {
+        // the oldest pending sample makes room for the new one. The delta chain is left to
+        // the workers, they resync at the next keyframe.
+        DiscardContainer(pOldest, false);
+        return m_qPreAllocQueue.TryDequeue(pDataContainer);
+    }
+    return false;
+}
+
+cDataReceiver::sDataContainer* cDataReceiver::Conflate(sDataContainer* pDataItem)
+{
+    sDataContainer* pNewer;
+    while (m_qReceiveQueue.TryDequeue(pNewer))
+    {
+        DiscardContainer(pDataItem, true);
+        pDataItem = pNewer;
+    }
+    // only the last sample of a batch is the newest one
+    while (NULL != pDataItem->pNext)
+    {
+        sDataContainer* pNext = pDataItem->pNext;
+        pDataItem->pNext = NULL;
+        DiscardContainer(pDataItem, true);
+        pDataItem = pNext;
+    }
+    return pDataItem;
+}
+
+void cDataReceiver::DiscardContainer(sDataContainer* pDataItem, bool bSyncDelta)
+{
+    for (sDataContainer* pItem = pDataItem; NULL != pItem; pItem = pItem->pNext)
+    {
+        m_nConflatedSamples++;
+        if (pItem->szSize < sizeof(cFepDataHeader))
+        {
+            continue;
+        }
+        // no deserialization, only the delta reference is kept up to date
+        const cFepDataHeader* pFepDataHeader = reinterpret_cast<const cFepDataHeader*>(pItem->pData);
+        uint8_t nDeltaFlag = header::GetDeltaFlag(pFepDataHeader->m_nSerAndByteOrderFlags);
+        uint8_t nByteOrderFlag = header::GetByteOrderFlag(pFepDataHeader->m_nSerAndByteOrderFlags);
+        if (0 != nDeltaFlag && !bSyncDelta)
+        {
+            m_bDeltaSampleDiscarded = true;
+        }
+        else if (0 != nDeltaFlag && 0 != nByteOrderFlag)
+        {
+            void* pData = pItem->pData;
+            size_t szSize = pItem->szSize - GetLatencyStampSize(pItem->pData, pItem->szSize);
+            DecodeDelta(pData, szSize, nDeltaFlag, nByteOrderFlag);
+        }
+    }
+    ReleaseContainer(pDataItem);
+}
+
+void cDataReceiver::ReleaseContainer(sDataContainer* pDataItem)
+{
+    while (NULL != pDataItem)
+    {
+        sDataContainer* pNext = pDataItem->pNext;
+        pDataItem->pNext = NULL;
+        if (NULL != pDataItem->pRelease)
+        {
+            pDataItem->pRelease(pDataItem->pReleaseContext);
+            pDataItem->pRelease = NULL;
+            pDataItem->pReleaseContext = NULL;
+            pDataItem->pData = NULL;
+            pDataItem->szSize = 0;
+            pDataItem->szCapacity = 0;
+        }
+        m_qPreAllocQueue.Enqueue(pDataItem);
+        pDataItem = pNext;
+    }
+}
+
+void cDataReceiver::ReleaseView(cDataSampleView* pView)
+{
+    if (pView->Release())
+    {
+        m_qViewPool.Enqueue(pView);
+    }
+}
+
+void cDataReceiver::ProcessLentBuffer(sDataContainer* pDataItem)
+{
+    cDataSampleView* pView = NULL;
+    if (pDataItem->szSize >= sizeof(cFepDataHeader) && m_qViewPool.TryDequeue(pView))
+    {
+        // the view takes over the driver buffer, the dispatch reference is dropped after processing
+        pView->Wrap(static_cast<char*>(pDataItem->pData) + sizeof(cFepDataHeader),
+            pDataItem->szSize - sizeof(cFepDataHeader)
+                - GetLatencyStampSize(pDataItem->pData, pDataItem->szSize),
+            pDataItem->pRelease, pDataItem->pReleaseContext);
+        pDataItem->pRelease = NULL;
+        pDataItem->pReleaseContext = NULL;
+
+        Process(pDataItem->pData, pDataItem->szSize, pView);
+
+        pDataItem->pData = NULL;
+        pDataItem->szSize = 0;
+        pDataItem->szCapacity = 0;
+        ReleaseView(pView);
+    }
+    else
+    {
+        // no view available - fall back to copying, the container hands the buffer back
+        Process(pDataItem->pData, pDataItem->szSize);
+    }
 }
 
 fep::Result cDataReceiver::RegisterListener(IPreparationDataListener* pListener)
@@ -418,25 +844,46 @@ fep::Result cDataReceiver::UnregisterListener(IPreparationDataListener* pListene
 void cDataReceiver::DoJob()
 {
     //try to enter processing in this reader
-    if (m_mtxJob.try_lock())
+    //Receiver is locked by another worker so do nothing otherwise
+    while (m_mtxJob.try_lock())
     {
         sDataContainer* pDataItem;
         //process until queue is empty
         while (m_qReceiveQueue.TryDequeueAndUnlockGuardIfEmpty(pDataItem, m_mtxJob))
         {
-            Process(pDataItem->pData, pDataItem->szSize);
-            m_qPreAllocQueue.Enqueue(pDataItem);
+            if (m_bConflate)
+            {
+                pDataItem = Conflate(pDataItem);
+            }
+            if (NULL != pDataItem->pRelease)
+            {
+                ProcessLentBuffer(pDataItem);
+            }
+            else
+            {
+                // a batch is a chain of containers
+                for (sDataContainer* pItem = pDataItem; NULL != pItem; pItem = pItem->pNext)
+                {
+                    Process(pItem->pData, pItem->szSize);
+                }
+            }
+            ReleaseContainer(pDataItem);
+        }
+        // A sample enqueued after the queue was found empty but before the job was unlocked
+        // was dropped by the try_lock of its own job - so look again.
+        if (m_qReceiveQueue.IsEmpty())
+        {
+            break;
         }
-    }
-    else
-    {
-        //Receiver is locked by another worker so do nothing
     }
 }
 
-fep::Result cDataReceiver::Process(void *pData, size_t szSize)
+fep::Result cDataReceiver::Process(void *pData, size_t szSize, cDataSampleView* pView)
 {
+    FEP_TRACE_SPAN("ProcessSample", "transmission");
+    const cCodecTimeCounter::tClock::time_point tmDecodeStart = cCodecTimeCounter::tClock::now();
     bool bSync = false;
+    bool bUseView = false;
     uint64_t nFrameId = 0;
     uint64_t nSampleNumberInFrame = 0;
     int64_t nSendTimeStamp = 0;
@@ -445,7 +892,9 @@ fep::Result cDataReceiver::Process(void *pData, size_t szSize)
         const cFepDataHeader* pFepDataHeader = reinterpret_cast<const cFepDataHeader*>
             (pData);
 
-        uint8_t nMajorVersion = pFepDataHeader->m_nMajorVersion;
+        // the extended format flag is known to this participant
+        uint8_t nMajorVersion = static_cast<uint8_t>(
+            pFepDataHeader->m_nMajorVersion & ~header::s_nExtendedFormatVersionFlag);
         bSync = (0 != pFepDataHeader->m_nSync) ? true : false;
         if(nMajorVersion != FEP_SDK_PARTICIPANT_VERSION_MAJOR )
         {
@@ -471,6 +920,25 @@ fep::Result cDataReceiver::Process(void *pData, size_t szSize)
             return ERR_INVALID_FLAGS;
         }
 
+        // the wall clock stamp was evaluated on arrival already
+        szSize -= GetLatencyStampSize(pData, szSize);
+
+        header::ByteOrderAndSerialization nDeltaFlag = header::GetDeltaFlag(nSerAndByteOrderFlags);
+        if (0 != nDeltaFlag)
+        {
+            void* pEncodedData = pData;
+            fep::Result nDeltaResult = DecodeDelta(pData, szSize, nDeltaFlag, nByteOrderFlag);
+            if (fep::isFailed(nDeltaResult))
+            {
+                return nDeltaResult;
+            }
+            if (pEncodedData != pData)
+            {
+                // the reconstructed sample is no driver buffer
+                pView = NULL;
+            }
+        }
+
         // we check the byteorder and convert if necessary
         nFrameId = header::ConvertToCorrectByteorder(pFepDataHeader->m_nFrameId, nByteOrderFlag);
         nSampleNumberInFrame = header::ConvertToCorrectByteorder(pFepDataHeader->m_nSampleNumber,
@@ -482,7 +950,10 @@ fep::Result cDataReceiver::Process(void *pData, size_t szSize)
         {
             if(m_bRaw)
             {
-                m_pCurrentDataSample->AdaptSize(szSize-sizeof(cFepDataHeader));
+                if (NULL == pView)
+                {
+                    m_pCurrentDataSample->AdaptSize(szSize-sizeof(cFepDataHeader));
+                }
             }
             else
             {
@@ -511,15 +982,26 @@ fep::Result cDataReceiver::Process(void *pData, size_t szSize)
             }
             else
             {
-                ddl::Decoder oDec = m_oCodecFactory.makeDecoderFor(static_cast<char*>(pData) + sizeof(cFepDataHeader),
-                    szSize - sizeof(cFepDataHeader), ddl::serialized);
-                a_util::memory::MemoryBuffer oDest(m_pCurrentDataSample->GetPtr(), m_pCurrentDataSample->GetCapacity());
-                ddl::serialization::transform_to_buffer(oDec, oDest);
+                if (!m_oCodecPlan.IsValid() || fep::isFailed(m_oCodecPlan.Deserialize(
+                    static_cast<char*>(pData) + sizeof(cFepDataHeader), szSize - sizeof(cFepDataHeader),
+                    m_pCurrentDataSample->GetPtr(), m_pCurrentDataSample->GetCapacity())))
+                {
+                    ddl::Decoder oDec = m_oCodecFactory.makeDecoderFor(static_cast<char*>(pData) + sizeof(cFepDataHeader),
+                        szSize - sizeof(cFepDataHeader), ddl::serialized);
+                    a_util::memory::MemoryBuffer oDest(m_pCurrentDataSample->GetPtr(), m_pCurrentDataSample->GetCapacity());
+                    ddl::serialization::transform_to_buffer(oDec, oDest);
+                }
             }
         }
         else if(nSerializationFlag == header::SERIALIZATION_RAW)
         {
-            if (m_bDisableDdlSerialization && (nByteOrderFlag == header::GetLocalSystemByteorder()))
+            if (m_bDisableDdlSerialization && (nByteOrderFlag == header::GetLocalSystemByteorder())
+                && NULL != pView)
+            {
+                // the data can be used as is - no copy needed
+                bUseView = true;
+            }
+            else if (m_bDisableDdlSerialization && (nByteOrderFlag == header::GetLocalSystemByteorder()))
             {
                 cMutexGuard oLockGuard(m_oCurrentSampleMutex);
                 a_util::memory::copy(m_pCurrentDataSample->GetPtr(), m_pCurrentDataSample->GetCapacity(), static_cast<char*>(pData) + sizeof(cFepDataHeader),
@@ -549,15 +1031,107 @@ fep::Result cDataReceiver::Process(void *pData, size_t szSize)
         }
     }
 
+    // the listeners are not part of the decoding
+    m_oDecodeTime.Add(tmDecodeStart);
+
+    if (bUseView)
+    {
+        pView->SetSignalHandle(this);
+        pView->SetSyncFlag(bSync);
+        pView->SetFrameId(nFrameId);
+        pView->SetSampleNumberInFrame(static_cast<uint16_t>(nSampleNumberInFrame));
+        pView->SetTime(nSendTimeStamp);
+
+        cMutexGuard oLockGuard(m_oCurrentSampleMutex);
+        // the view stays referenced as current sample until the next sample arrives
+        pView->AddRef();
+        if (NULL != m_pCurrentView)
+        {
+            ReleaseView(m_pCurrentView);
+        }
+        m_pCurrentView = pView;
+        return UpdateListeners(pView);
+    }
+
     m_pCurrentDataSample->SetSyncFlag(bSync);
     m_pCurrentDataSample->SetFrameId(nFrameId);
     m_pCurrentDataSample->SetSampleNumberInFrame(static_cast<uint16_t>(nSampleNumberInFrame));
     m_pCurrentDataSample->SetTime(nSendTimeStamp);
 
     cMutexGuard oLockGuard(m_oCurrentSampleMutex);
+    if (NULL != m_pCurrentView)
+    {
+        ReleaseView(m_pCurrentView);
+        m_pCurrentView = NULL;
+    }
     return UpdateListeners(m_pCurrentDataSample);
 }
 
+fep::Result cDataReceiver::DecodeDelta(void*& pData, size_t& szSize,
+    uint8_t nDeltaFlag, uint8_t nByteOrderFlag)
+{
+    const cFepDataHeader* pFepDataHeader = reinterpret_cast<const cFepDataHeader*>(pData);
+    const uint8_t* pSample = static_cast<const uint8_t*>(pData);
+    uint16_t nSequence = header::ConvertToCorrectByteorder(pFepDataHeader->m_nSequence,
+        static_cast<header::ByteOrderAndSerialization>(nByteOrderFlag));
+
+    if (header::DELTA_KEYFRAME == nDeltaFlag)
+    {
+        m_vecDeltaReference.assign(pSample, pSample + szSize);
+        m_nDeltaSequence = nSequence;
+        m_bDeltaChainValid = true;
+        return ERR_NOERROR;
+    }
+    if (header::DELTA_ENCODED != nDeltaFlag)
+    {
+        INVOKE_INCIDENT(m_pIncidentInvocationHandler,
+            fep::FSI_TRANSM_FEP_PROTO_CORRUPT_HEADER, fep::SL_Critical_Local,
+            a_util::strings::format("Received a package with corrupt header. (Instance %s::%s)",
+            GetModuleName(), m_strSignalName.c_str()).c_str());
+        return ERR_INVALID_FLAGS;
+    }
+    if (!m_bDeltaChainValid)
+    {
+        // the gap was reported already, wait for the next keyframe
+        return ERR_OUT_OF_SYNC;
+    }
+    if (header::NextSequence(m_nDeltaSequence) != nSequence)
+    {
+        m_bDeltaChainValid = false;
+        if (m_bDeltaSampleDiscarded.exchange(false))
+        {
+            // conflated on arrival, counted already
+            return ERR_OUT_OF_SYNC;
+        }
+        INVOKE_INCIDENT(m_pIncidentInvocationHandler,
+            fep::FSI_TRANSM_RX_MISSING_DATASAMPLE, fep::SL_Warning,
+            a_util::strings::format(
+            "Missed a sample of a delta encoded signal, dropping samples until the next keyframe. "
+            "(Instance %s::%s)", GetModuleName(), m_strSignalName.c_str()).c_str());
+        return ERR_OUT_OF_SYNC;
+    }
+    if (!delta::ApplyDelta(m_vecDeltaReference.data() + sizeof(cFepDataHeader),
+        m_vecDeltaReference.size() - sizeof(cFepDataHeader),
+        pSample + sizeof(cFepDataHeader), szSize - sizeof(cFepDataHeader)))
+    {
+        m_bDeltaChainValid = false;
+        INVOKE_INCIDENT(m_pIncidentInvocationHandler,
+            fep::FSI_TRANSM_FEP_PROTO_CORRUPT_HEADER, fep::SL_Critical_Local,
+            a_util::strings::format(
+            "Received a corrupt delta, dropping samples until the next keyframe. (Instance %s::%s)",
+            GetModuleName(), m_strSignalName.c_str()).c_str());
+        return ERR_INVALID_FLAGS;
+    }
+
+    // the reconstructed sample carries the header of the delta
+    a_util::memory::copy(m_vecDeltaReference.data(), m_vecDeltaReference.size(),
+        pSample, sizeof(cFepDataHeader));
+    m_nDeltaSequence = nSequence;
+    pData = m_vecDeltaReference.data();
+    szSize = m_vecDeltaReference.size();
+    return ERR_NOERROR;
+}
+
 fep::Result cDataReceiver::UpdateListeners(IPreparationDataSample* poSample)
 {
     a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxListener);
@@ -573,6 +1147,10 @@ fep::Result cDataReceiver::UpdateListeners(IPreparationDataSample* poSample)
 fep::Result cDataReceiver::GetCurrentSample(fep::IPreparationDataSample* pSample)
 {
     cMutexGuard m_oLockGuard(m_oCurrentSampleMutex);
+    if (NULL != m_pCurrentView)
+    {
+        return m_pCurrentView->CopyTo(*pSample);
+    }
     return m_pCurrentDataSample->CopyTo(*pSample);
 }
 
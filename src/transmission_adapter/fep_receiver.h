@@ -18,29 +18,36 @@
 #ifndef _FEP_DATA_RECEIVER_H_
 #define _FEP_DATA_RECEIVER_H_
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <vector>
 #include <codec/codec_factory.h>
 #include <a_util/concurrency/detail/fast_mutex_decl.h>
 
-#include "_common/fep_locked_queue.h"
+#include "_common/fep_lock_free_queue.h"
 #include "fep_participant_export.h"
 #include "fep_result_decl.h"
+#include "transmission_adapter/fep_codec_plan.h"
+#include "transmission_adapter/fep_latency_histogram.h"
+#include "transmission_adapter/fep_receive_intf.h"
 #include "transmission_adapter/fep_signal_options.h"
+#include "transmission_adapter/fep_transport_statistics.h"
 
 namespace fep
 {
+    class IClockService;
     class IIncidentInvocationHandler;
     class IPreparationDataListener;
     class IPreparationDataSample;
     class IPropertyTree;
-    class IReceive;
     class ITransmissionDataSample;
     class ITransmissionDriver;
 
     //\cond nodoc
+    class cDataSampleView;
     class cQueueManager;
     struct tSignal;
     //\endond
@@ -62,6 +69,12 @@ namespace fep
             size_t szCapacity;
             /// pointer to actual received dat
             void* pData;
+            /// release function of the driver if pData is a lent driver buffer, NULL otherwise
+            IReceive::tReleaseFuncPtr pRelease;
+            /// context to be passed to pRelease
+            void* pReleaseContext;
+            /// next container of the same received batch (NULL for the last one)
+            sDataContainer* pNext;
         };
 
     public:
@@ -100,13 +113,34 @@ namespace fep
          * @param szSize Size of the received data
          */
         static void EnqueueReceivedData(void* pInstance, const void* pData, size_t szSize);
+        /**
+         * @brief EnqueueReceivedBatch  Enqueue several samples received at once.
+         * The whole batch is enqueued as one job, so the worker is woken up only once.
+         * @param pInstance Instance of Object to be called
+         * @param pBuffers Array of received buffers
+         * @param szCount Number of buffers in \a pBuffers
+         */
+        static void EnqueueReceivedBatch(void* pInstance, const IReceive::tReceivedBuffer* pBuffers,
+            size_t szCount);
+        /**
+         * @brief EnqueueReceivedBuffer  Enqueue a buffer lent by the driver (zero copy reception)
+         * @param pInstance Instance of Object to be called
+         * @param pData Void Pointer to the received data
+         * @param szSize Size of the received data
+         * @param pRelease Function handing the buffer back to the driver
+         * @param pReleaseContext Context to be passed to \a pRelease
+         */
+        static void EnqueueReceivedBuffer(void* pInstance, const void* pData, size_t szSize,
+            IReceive::tReleaseFuncPtr pRelease, void* pReleaseContext);
         /**
          * @brief Process Processes the incoming data
          * @param pData Pointer to the actual data
          * @param szSize Size of received data
+         * @param pView View wrapped around \a pData if it is a lent driver buffer. If given and
+         *        no conversion is necessary the view is handed to the listeners instead of a copy.
          * @return Standard Error Code
          */
-        fep::Result Process(void *pData, size_t szSize);
+        fep::Result Process(void *pData, size_t szSize, cDataSampleView* pView = NULL);
         /**
          * @brief UpdateListeners Updates the registered listeners
          * @param poSample Data Sample that was received
@@ -151,6 +185,45 @@ namespace fep
          * @return Standard Error Code
          */
         fep::Result FlushQueue(bool no_lock=false);
+
+        /**
+         * @brief GetDroppedSampleCount Returns the number of received samples that were dropped
+         * because no free container was available or the sample was malformed
+         * @return Number of dropped samples
+         */
+        uint64_t GetDroppedSampleCount() const;
+
+        /**
+         * @brief GetQueueOverflowCount Returns the number of samples rejected by the
+         * (bounded) receive queue
+         * @return Number of rejected samples
+         */
+        uint64_t GetQueueOverflowCount() const;
+
+        /**
+         * @brief GetConflatedSampleCount Returns the number of received samples that were
+         * discarded unprocessed in favour of a newer one (conflation enabled only)
+         * @return Number of conflated samples
+         */
+        uint64_t GetConflatedSampleCount() const;
+
+        /**
+         * @brief GetStatistics Takes a snapshot of the transport counters of this signal
+         * @param [out] oStatistics The counters
+         */
+        void GetStatistics(tTransportStatistics& oStatistics) const;
+
+        /**
+         * @brief SetClockService Sets the clock the latency in simulation time is measured with.
+         * Returns once no arriving sample is measured with the previous clock anymore.
+         * @param pClockService The clock service, NULL to stop measuring
+         */
+        void SetClockService(IClockService* pClockService);
+
+        /**
+         * @brief ResetLatencyStatistics Discards the collected latencies and sequence gaps
+         */
+        void ResetLatencyStatistics();
     private:
         /**
          * @brief GatherSignalOptions Collects the Signal options for this signal and stores it
@@ -165,6 +238,79 @@ namespace fep
         * @return Module Name
         */
         const char* GetModuleName();
+        /**
+         * @brief CopyToContainer Copies received data into a free preallocated container
+         * @param pData Void Pointer to the received data
+         * @param szSize Size of the received data
+         * @return The filled container, NULL if the sample was dropped
+         */
+        sDataContainer* CopyToContainer(const void* pData, size_t szSize);
+        /**
+         * @brief TrackArrival Records the latency and checks the sequence number of a sample
+         * handed over by the driver
+         * @param pData Void Pointer to the received data
+         * @param szSize Size of the received data
+         */
+        void TrackArrival(const void* pData, size_t szSize);
+        /**
+         * @brief GetLatencyStampSize Returns the size of the wall clock stamp trailing a sample
+         * @param pData Void Pointer to the received data
+         * @param szSize Size of the received data
+         * @return Size of the stamp, 0 if the sample is not stamped
+         */
+        static size_t GetLatencyStampSize(const void* pData, size_t szSize);
+        /**
+         * @brief TakeFreeContainer Takes a free container from the preallocation queue. If none
+         * is left and conflation is enabled, the oldest pending sample is discarded to free one.
+         * @param [out] pDataContainer The free container
+         * @return true if a container is available, false if the sample has to be dropped
+         */
+        bool TakeFreeContainer(sDataContainer*& pDataContainer);
+        /**
+         * @brief Conflate Discards every pending sample but the newest one
+         * @param pDataItem Item dequeued for processing
+         * @return The item holding only the newest sample
+         */
+        sDataContainer* Conflate(sDataContainer* pDataItem);
+        /**
+         * @brief DiscardContainer Discards the samples of a container (chain) without processing
+         * them and recycles the container
+         * @param pDataItem Container to be discarded
+         * @param bSyncDelta Apply contained deltas so the delta encoding stays in sync
+         *                   (worker side only, the job has to be locked). Otherwise discarded
+         *                   samples of a delta encoded signal are only marked, the worker
+         *                   drops the following deltas until the next keyframe.
+         */
+        void DiscardContainer(sDataContainer* pDataItem, bool bSyncDelta);
+        /**
+         * @brief ProcessLentBuffer Processes a buffer lent by the driver and hands it back
+         * @param pDataItem Container referring to the driver buffer
+         */
+        void ProcessLentBuffer(sDataContainer* pDataItem);
+        /**
+         * @brief ReleaseContainer Hands a lent driver buffer back (if any) and returns
+         * the container to the preallocation queue
+         * @param pDataItem Container to be recycled
+         */
+        void ReleaseContainer(sDataContainer* pDataItem);
+        /**
+         * @brief ReleaseView Drops a reference to a view and recycles it if it was the last one
+         * @param pView The view
+         */
+        void ReleaseView(cDataSampleView* pView);
+        /**
+         * @brief DecodeDelta Keeps the keyframes of a delta encoded signal and reconstructs
+         * the samples from their deltas
+         * @param [in,out] pData The received sample, afterwards the reconstructed sample
+         * @param [in,out] szSize Size of the received sample, afterwards of the reconstructed one
+         * @param nDeltaFlag Delta flag of the received sample (keyframe or delta)
+         * @param nByteOrderFlag Byte order of the received sample
+         * @retval ERR_NOERROR The sample can be processed
+         * @retval ERR_OUT_OF_SYNC A previous sample is missing, the delta cannot be applied
+         * @retval ERR_INVALID_FLAGS The delta is corrupt
+         */
+        fep::Result DecodeDelta(void*& pData, size_t& szSize,
+            uint8_t nDeltaFlag, uint8_t nByteOrderFlag);
 
     private:
         /// typedef for a vector of listeners
@@ -182,9 +328,33 @@ namespace fep
         /// Pointer to the receiver object from the driver
         IReceive* m_pDriverReceiver;
         ///Queue storing the received data
-        cLockedQueue<sDataContainer*> m_qReceiveQueue;
+        cLockFreeQueue<sDataContainer*> m_qReceiveQueue;
         ///Queue storing the empty preallocated samples
-        cLockedQueue<sDataContainer*> m_qPreAllocQueue;
+        cLockFreeQueue<sDataContainer*> m_qPreAllocQueue;
+        /// Number of samples handed over by the driver
+        std::atomic<uint64_t> m_nReceivedSamples;
+        /// Number of bytes handed over by the driver
+        std::atomic<uint64_t> m_nReceivedBytes;
+        /// Time spent decoding the received samples
+        cCodecTimeCounter m_oDecodeTime;
+        /// Number of received samples that were dropped
+        std::atomic<uint64_t> m_nDroppedSamples;
+        /// Number of received samples that were discarded in favour of a newer one
+        std::atomic<uint64_t> m_nConflatedSamples;
+        /// Flag indicating that only the newest pending sample is processed
+        bool m_bConflate;
+        /// Clock the latency in simulation time is measured with (NULL: not measured)
+        std::atomic<IClockService*> m_pClockService;
+        /// Held while the clock is used, so it is not destroyed in between
+        a_util::concurrency::fast_mutex m_mtxClockService;
+        /// Latency of the received samples in simulation time (us)
+        cLatencyHistogram m_oLatency;
+        /// Latency of the received samples in wall clock time (ns, stamped samples only)
+        cLatencyHistogram m_oWallClockLatency;
+        /// Sequence number of the last sample handed over by the driver (0: none yet)
+        std::atomic<uint16_t> m_nLastSequence;
+        /// Number of samples missing in the sequence
+        std::atomic<uint64_t> m_nSequenceGaps;
         /// The pointer to the queue manager
         cQueueManager* m_pQueueManager;
         /// The listeners registered at this class.
@@ -197,8 +367,16 @@ namespace fep
         ITransmissionDataSample * m_pCurrentDataSample;
         /// The mutex guarding the current data sample
         a_util::concurrency::mutex m_oCurrentSampleMutex;
+        /// The last received sample if it was received without copy (NULL otherwise)
+        cDataSampleView* m_pCurrentView;
+        /// Unused views for zero copy reception
+        cLockFreeQueue<cDataSampleView*> m_qViewPool;
+        /// Flag indicating that the driver lends its buffers (zero copy reception)
+        bool m_bZeroCopy;
         /// DDL Codec Factory
         ddl::CodecFactory m_oCodecFactory;
+        /// Precompiled deserialization plan (invalid if the generic codec has to be used)
+        cCodecPlan m_oCodecPlan;
         /// Serialization Flag
         bool m_bDisableDdlSerialization;
         /// Create() is calling static methods and classes of the OODDL -> libfepcore
@@ -214,6 +392,14 @@ namespace fep
         size_t m_szSignalSize;
         /// Flag indicating that the signal is of raw type
         bool m_bRaw;
+        /// Last sample of a delta encoded signal (header and reconstructed payload)
+        std::vector<uint8_t> m_vecDeltaReference;
+        /// Sequence number of the delta reference
+        uint16_t m_nDeltaSequence;
+        /// Flag indicating that the delta reference is complete and deltas can be applied
+        bool m_bDeltaChainValid;
+        /// Flag indicating that the driver thread discarded a sample of the delta chain
+        std::atomic<bool> m_bDeltaSampleDiscarded;
         /// Options for the Driver
         cSignalOptions m_oSignalOptions;
     };
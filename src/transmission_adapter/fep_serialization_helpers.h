@@ -44,9 +44,54 @@ namespace fep
             SERIALIZATION_DDL = 0x04, ///< Use DDL serialization mode
             SERIALIZATION_RAW = 0x08, ///< Use No/Raw serialization mode
             SERIALIZATION_MASK 
-                = SERIALIZATION_DDL | SERIALIZATION_RAW ///< Mask serialization modes
+                = SERIALIZATION_DDL | SERIALIZATION_RAW, ///< Mask serialization modes
+
+            DELTA_KEYFRAME = 0x10, ///< Full sample (re)starting a chain of delta encoded samples
+            DELTA_ENCODED = 0x20, ///< Payload is a delta against the previous sample of the chain
+            DELTA_MASK
+                = DELTA_KEYFRAME | DELTA_ENCODED, ///< Mask for delta encoding flags
+
+            LATENCY_STAMP = 0x40 ///< A monotonic wall clock stamp trails the sample
         };
 
+        /// Size of the wall clock stamp trailing a sample flagged with LATENCY_STAMP
+        /// (steady clock in ns as int64, in the byte order of the sample)
+        static const size_t s_szLatencyStampSize = sizeof(int64_t);
+
+        /**
+        * Set in the major version of samples using header features that participants of the
+        * same major version knowing only the serialization and byte order flags cannot decode
+        * (see DELTA_MASK and LATENCY_STAMP). Those participants reject such samples as samples of another major
+        * version instead of handing them to their listeners as they are.
+        */
+        static const uint8_t s_nExtendedFormatVersionFlag = 0x80;
+
+        /**
+        * Returns the sequence number following the given one.
+        * 0 is skipped on wrap around since it marks samples without sequence number.
+        * @param [in] nSequence The current sequence number
+        * @return The next sequence number
+        */
+        inline uint16_t NextSequence(uint16_t nSequence)
+        {
+            return (0xFFFF == nSequence) ? 1 : static_cast<uint16_t>(nSequence + 1);
+        }
+
+        /**
+        * Extract the delta encoding flag out of the integer value
+        * @param [in] nByteOrderAndSerialization Integer value defining byte 
+        *             order and serialization used in FEP data header
+        * @return Contained delta encoding flag
+        * @retval 0 if the sample is not part of a delta encoded chain
+        * @retval DELTA_KEYFRAME if the sample is a keyframe
+        * @retval DELTA_ENCODED if the payload is a delta
+        */
+        inline ByteOrderAndSerialization GetDeltaFlag(uint8_t nByteOrderAndSerialization)
+        {
+            return static_cast<ByteOrderAndSerialization>
+                (nByteOrderAndSerialization & DELTA_MASK);
+        }
+
         /**
         * Extract the serialization mode out of the integer value
         * @param [in] nByteOrderAndSerialization Integer value defining byte 
@@ -154,6 +199,27 @@ namespace fep
           return nResult;
         }
 
+        /**
+        * Swap/Change byte order of the given value
+        * If the value is little endian the result is the proper big endian value.
+        * If the value is big endian the result is the proper little endian value.
+        * @param [in] nValue to convert
+        * @return input parameter value with changed byte order
+        */
+        static inline int32_t SwapByteorder(const int32_t& nValue)
+        {
+          int32_t nResult;
+          uint8_t* nResultPtr= reinterpret_cast<uint8_t*>(&nResult);
+          const uint8_t* nValuePtr = reinterpret_cast<const uint8_t*>(&nValue);
+
+          nResultPtr[0] = nValuePtr[3];
+          nResultPtr[1] = nValuePtr[2];
+          nResultPtr[2] = nValuePtr[1];
+          nResultPtr[3] = nValuePtr[0];
+
+          return nResult;
+        }
+
         /**
         * Swap/Change byte order of the given value
         * If the value is little endian the result is the proper big endian value.
@@ -234,8 +300,9 @@ namespace fep
         uint8_t  m_nSerAndByteOrderFlags;
         /// Sync flag
         uint8_t  m_nSync;
-        /// Yet unused. Used for alignment of the header
-        uint16_t m_nUnused;
+        /// Sequence number of the samples of a signal (see header::NextSequence), 0 if the
+        /// samples are not counted (bundled samples; older participants always send 0)
+        uint16_t m_nSequence;
         /// Sample number, sample in frame
         uint16_t m_nSampleNumber;
         /// Current frame id
@@ -243,6 +310,55 @@ namespace fep
         /// Timestamp
         int64_t m_nSendTimeStamp;
     };
+
+    /**
+     * FEP bundle header structure
+     * This structure is heading a bundle of several FEP data samples sent as one
+     * transmission (see cSignalBundle). It is followed by \c m_nCount entries, each
+     * made of a \ref cFepBundleEntryHeader and the payload of the sample.
+     * All fields are in the byte order given by \c m_nByteOrderFlags.
+     */
+    struct cFepBundleHeader
+    {
+        /// Major version of the sender
+        uint8_t  m_nMajorVersion;
+        /// Minor version of the sender
+        uint8_t  m_nMinorVersion;
+        /// Byte order of the bundle (only the byte order bits are used)
+        /// @see ByteOrderAndSerialization
+        uint8_t  m_nByteOrderFlags;
+        /// Version of the bundle layout
+        uint8_t  m_nBundleVersion;
+        /// Number of entries
+        uint16_t m_nCount;
+        /// Yet unused. Used for alignment of the header
+        uint16_t m_nUnused;
+        /// Frame id shared by all entries
+        uint64_t m_nFrameId;
+        /// Timestamp all entry timestamps are relative to
+        int64_t  m_nBaseTimeStamp;
+    };
+
+    /**
+     * Compact per sample header inside a bundle, replacing the \ref cFepDataHeader
+     * of a single transmission
+     */
+    struct cFepBundleEntryHeader
+    {
+        /// Identifier of the signal (hash of the signal name)
+        uint32_t m_nSignalId;
+        /// Timestamp of the sample relative to \c cFepBundleHeader::m_nBaseTimeStamp
+        int32_t  m_nTimeOffset;
+        /// Size of the payload following the entry header
+        uint16_t m_nSize;
+        /// Sample number, sample in frame
+        uint16_t m_nSampleNumber;
+        /// Flag used to define serialization and byte order of the sample
+        /// @see ByteOrderAndSerialization
+        uint8_t  m_nSerAndByteOrderFlags;
+        /// Sync flag
+        uint8_t  m_nSync;
+    };
 #pragma pack(pop)
 }
 
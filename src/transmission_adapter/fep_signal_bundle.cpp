@@ -0,0 +1,492 @@
+/**
+ * Implementation of the Classes cBundleTransmitter and cBundleReceiver.
+ *
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <a_util/concurrency/fast_mutex.h>
+#include <a_util/strings/strings_format.h>
+
+#include "_common/fep_optional.h"
+#include "fep_errors.h"
+#include "fep_sdk_participant_version.h"
+#include "fep_transmission_adapter_common.h"
+#include "incident_handler/fep_incident_codes.h"
+#include "incident_handler/fep_incident_handler.h"
+#include "incident_handler/fep_severity_level.h"
+#include "signal_registry/fep_signal_struct.h"
+#include "transmission_adapter/fep_options_factory.h"
+#include "transmission_adapter/fep_receive_intf.h"
+#include "transmission_adapter/fep_receiver.h"
+#include "transmission_adapter/fep_serialization_helpers.h"
+#include "transmission_adapter/fep_signal_bundle.h"
+#include "transmission_adapter/fep_transmission_driver_intf.h"
+#include "transmission_adapter/fep_transmit_intf.h"
+
+using namespace fep;
+
+typedef a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> tBundleLock;
+
+/**
+ * Collects the driver options of a bundle. The QoS is taken from the given member signal.
+ * @param [out] oDriverSignalOptions cSignalOptions object that is filled with options
+ * @param [in] oSignal Struct describing the member signal
+ * @return Standard Error Code
+ */
+static fep::Result GatherBundleOptions(cSignalOptions& oDriverSignalOptions, const tSignal& oSignal)
+{
+    fep::Result nResult = ERR_NOERROR;
+    if (!(oDriverSignalOptions.SetOption("SignalName", bundle::GetChannelName(oSignal.strBundleId.GetValue()))
+        && oDriverSignalOptions.SetOption("SignalSize", bundle::s_szMaxBundleSize)))
+    {
+        nResult = ERR_FAILED;
+    }
+    else
+    {
+        // the number of bundled samples changes from transmission to transmission
+        oDriverSignalOptions.SetOption("IsVariableSignalSize", true);
+
+        if (!oDriverSignalOptions.SetOption("IsReliable", oSignal.bIsReliable.GetValue()))
+        {
+            if (oSignal.bIsReliable.IsSet())
+            {
+                nResult = ERR_NOT_SUPPORTED;
+            }
+        }
+    }
+    return nResult;
+}
+
+cBundleTransmitter::cBundleTransmitter() :
+    m_nMemberCount(0),
+    m_nPendingCount(0),
+    m_szUsed(0),
+    m_nFrameId(0),
+    m_nBaseTimeStamp(0),
+    m_pDriver(NULL),
+    m_pDriverTransmitter(NULL),
+    m_pIncidentInvocationHandler(NULL)
+{
+}
+
+cBundleTransmitter::~cBundleTransmitter()
+{
+    if (NULL != m_pDriverTransmitter)
+    {
+        m_pDriver->DestroyTransmitter(m_pDriverTransmitter);
+    }
+}
+
+fep::Result cBundleTransmitter::Create(ITransmissionDriver* pDriver,
+    fep::IIncidentInvocationHandler* pIncidentInvocationHandler,
+    const tSignal& oSignal)
+{
+    if (NULL == pDriver || NULL == pIncidentInvocationHandler)
+    {
+        return ERR_POINTER;
+    }
+    m_pDriver = pDriver;
+    m_pIncidentInvocationHandler = pIncidentInvocationHandler;
+    m_strBundleId = oSignal.strBundleId.GetValue();
+
+    cOptionsFactory oSignalOptionsFactory;
+    oSignalOptionsFactory.Initialize(m_pDriver);
+    cSignalOptions oSignalOptions = oSignalOptionsFactory.GetSignalOptions();
+    fep::Result nResult = GatherBundleOptions(oSignalOptions, oSignal);
+    if (fep::isOk(nResult))
+    {
+        m_vecBundle.resize(bundle::s_szMaxBundleSize);
+        m_szUsed = sizeof(cFepBundleHeader);
+        nResult = m_pDriver->CreateTransmitter(m_pDriverTransmitter, oSignalOptions);
+    }
+    return nResult;
+}
+
+fep::Result cBundleTransmitter::AddMember(const std::string& strSignalName, size_t& nSlot)
+{
+    tBundleLock oSync(m_oBundleMutex);
+    const uint32_t nSignalId = bundle::GetSignalId(strSignalName);
+    size_t nFreeSlot = m_vecMembers.size();
+    for (size_t nIdx = 0; nIdx < m_vecMembers.size(); ++nIdx)
+    {
+        if (!m_vecMembers[nIdx].bUsed)
+        {
+            nFreeSlot = std::min(nFreeSlot, nIdx);
+        }
+        else if (m_vecMembers[nIdx].nSignalId == nSignalId)
+        {
+            // the receiving side could not tell the signals apart
+            INVOKE_INCIDENT(m_pIncidentInvocationHandler, FSI_GENERAL_WARNING, SL_Critical_Local,
+                a_util::strings::format("Signals %s and %s cannot be transmitted in the same bundle %s",
+                m_vecMembers[nIdx].strSignalName.c_str(), strSignalName.c_str(),
+                m_strBundleId.c_str()).c_str());
+            return ERR_RESOURCE_IN_USE;
+        }
+    }
+    if (nFreeSlot == m_vecMembers.size())
+    {
+        m_vecMembers.push_back(tMember());
+    }
+    tMember& oMember = m_vecMembers[nFreeSlot];
+    oMember.strSignalName = strSignalName;
+    oMember.nSignalId = nSignalId;
+    oMember.bUsed = true;
+    oMember.bPending = false;
+    ++m_nMemberCount;
+    nSlot = nFreeSlot;
+    return ERR_NOERROR;
+}
+
+void cBundleTransmitter::RemoveMember(size_t nSlot)
+{
+    tBundleLock oSync(m_oBundleMutex);
+    if (nSlot < m_vecMembers.size() && m_vecMembers[nSlot].bUsed)
+    {
+        if (m_vecMembers[nSlot].bPending)
+        {
+            TransmitPending();
+        }
+        m_vecMembers[nSlot].bUsed = false;
+        m_vecMembers[nSlot].strSignalName.clear();
+        --m_nMemberCount;
+    }
+}
+
+bool cBundleTransmitter::IsEmpty() const
+{
+    return 0 == m_nMemberCount;
+}
+
+fep::Result cBundleTransmitter::Append(size_t nSlot, const void* pSample, size_t szSample)
+{
+    if (szSample < sizeof(cFepDataHeader))
+    {
+        return ERR_INVALID_ARG;
+    }
+    const size_t szPayload = szSample - sizeof(cFepDataHeader);
+    const size_t szEntry = sizeof(cFepBundleEntryHeader) + szPayload;
+    if (szPayload > std::numeric_limits<uint16_t>::max()
+        || sizeof(cFepBundleHeader) + szEntry > bundle::s_szMaxBundleSize)
+    {
+        return ERR_INVALID_ARG;
+    }
+    const cFepDataHeader* pHeader = static_cast<const cFepDataHeader*>(pSample);
+
+    fep::Result nResult = ERR_NOERROR;
+    tBundleLock oSync(m_oBundleMutex);
+    if (nSlot >= m_vecMembers.size() || !m_vecMembers[nSlot].bUsed)
+    {
+        return ERR_INVALID_INDEX;
+    }
+    tMember& oMember = m_vecMembers[nSlot];
+
+    if (0 != m_nPendingCount)
+    {
+        const int64_t nTimeOffset = pHeader->m_nSendTimeStamp - m_nBaseTimeStamp;
+        if (oMember.bPending
+            || pHeader->m_nFrameId != m_nFrameId
+            || nTimeOffset < std::numeric_limits<int32_t>::min()
+            || nTimeOffset > std::numeric_limits<int32_t>::max()
+            || m_szUsed + szEntry > m_vecBundle.size())
+        {
+            nResult = TransmitPending();
+        }
+    }
+    if (0 == m_nPendingCount)
+    {
+        m_nFrameId = pHeader->m_nFrameId;
+        m_nBaseTimeStamp = pHeader->m_nSendTimeStamp;
+    }
+
+    cFepBundleEntryHeader* pEntry = reinterpret_cast<cFepBundleEntryHeader*>(&m_vecBundle[m_szUsed]);
+    pEntry->m_nSignalId = oMember.nSignalId;
+    pEntry->m_nTimeOffset = static_cast<int32_t>(pHeader->m_nSendTimeStamp - m_nBaseTimeStamp);
+    pEntry->m_nSize = static_cast<uint16_t>(szPayload);
+    pEntry->m_nSampleNumber = pHeader->m_nSampleNumber;
+    pEntry->m_nSerAndByteOrderFlags = pHeader->m_nSerAndByteOrderFlags;
+    pEntry->m_nSync = pHeader->m_nSync;
+    ::memcpy(&m_vecBundle[m_szUsed + sizeof(cFepBundleEntryHeader)], pHeader + 1, szPayload);
+    m_szUsed += szEntry;
+    oMember.bPending = true;
+    ++m_nPendingCount;
+
+    if (m_nPendingCount == m_nMemberCount)
+    {
+        fep::Result nTransmitResult = TransmitPending();
+        if (fep::isOk(nResult))
+        {
+            nResult = nTransmitResult;
+        }
+    }
+    return nResult;
+}
+
+fep::Result cBundleTransmitter::Flush()
+{
+    tBundleLock oSync(m_oBundleMutex);
+    return TransmitPending();
+}
+
+fep::Result cBundleTransmitter::TransmitPending()
+{
+    if (0 == m_nPendingCount)
+    {
+        return ERR_NOERROR;
+    }
+
+    cFepBundleHeader* pBundleHeader = reinterpret_cast<cFepBundleHeader*>(&m_vecBundle[0]);
+    pBundleHeader->m_nMajorVersion = FEP_SDK_PARTICIPANT_VERSION_MAJOR;
+    pBundleHeader->m_nMinorVersion = FEP_SDK_PARTICIPANT_VERSION_MINOR;
+    pBundleHeader->m_nByteOrderFlags = static_cast<uint8_t>(header::GetLocalSystemByteorder());
+    pBundleHeader->m_nBundleVersion = bundle::s_nBundleVersion;
+    pBundleHeader->m_nCount = static_cast<uint16_t>(m_nPendingCount);
+    pBundleHeader->m_nUnused = 0x00;
+    pBundleHeader->m_nFrameId = m_nFrameId;
+    pBundleHeader->m_nBaseTimeStamp = m_nBaseTimeStamp;
+
+    fep::Result nResult = m_pDriverTransmitter->Transmit(&m_vecBundle[0], m_szUsed);
+    if (fep::isFailed(nResult))
+    {
+        INVOKE_INCIDENT(m_pIncidentInvocationHandler,
+            fep::FSI_TRANSM_DATA_TX_FAILED,
+            fep::SL_Critical_Local, a_util::strings::format(
+            "Failed to write bundle %s to bus", m_strBundleId.c_str()).c_str());
+        nResult = ERR_FAILED;
+    }
+
+    for (std::vector<tMember>::iterator it = m_vecMembers.begin(); it != m_vecMembers.end(); ++it)
+    {
+        it->bPending = false;
+    }
+    m_nPendingCount = 0;
+    m_szUsed = sizeof(cFepBundleHeader);
+    return nResult;
+}
+
+fep::Result cBundleTransmitter::Enable()
+{
+    return m_pDriverTransmitter->Enable();
+}
+
+fep::Result cBundleTransmitter::Disable()
+{
+    fep::Result nResult = Flush();
+    fep::Result nDisableResult = m_pDriverTransmitter->Disable();
+    return fep::isOk(nResult) ? nDisableResult : nResult;
+}
+
+cBundleReceiver::cBundleReceiver() :
+    m_pDriver(NULL),
+    m_pDriverReceiver(NULL),
+    m_pIncidentInvocationHandler(NULL)
+{
+}
+
+cBundleReceiver::~cBundleReceiver()
+{
+    if (NULL != m_pDriverReceiver)
+    {
+        m_pDriver->DestroyReceiver(m_pDriverReceiver);
+    }
+}
+
+fep::Result cBundleReceiver::Create(ITransmissionDriver* pDriver,
+    fep::IIncidentInvocationHandler* pIncidentInvocationHandler,
+    const tSignal& oSignal)
+{
+    if (NULL == pDriver || NULL == pIncidentInvocationHandler)
+    {
+        return ERR_POINTER;
+    }
+    m_pDriver = pDriver;
+    m_pIncidentInvocationHandler = pIncidentInvocationHandler;
+    m_strBundleId = oSignal.strBundleId.GetValue();
+
+    cOptionsFactory oSignalOptionsFactory;
+    oSignalOptionsFactory.Initialize(m_pDriver);
+    cSignalOptions oSignalOptions = oSignalOptionsFactory.GetSignalOptions();
+    fep::Result nResult = GatherBundleOptions(oSignalOptions, oSignal);
+    if (fep::isOk(nResult))
+    {
+        m_vecSample.reserve(bundle::s_szMaxBundleSize);
+        nResult = m_pDriver->CreateReceiver(m_pDriverReceiver, oSignalOptions);
+    }
+    if (fep::isOk(nResult))
+    {
+        nResult = m_pDriverReceiver->SetReceiver(cBundleReceiver::ReceiveBundle, reinterpret_cast<void*>(this));
+    }
+    return nResult;
+}
+
+bool cBundleReceiver::CompareMember(const tMember& oLeft, const tMember& oRight)
+{
+    return oLeft.nSignalId < oRight.nSignalId;
+}
+
+fep::Result cBundleReceiver::AddMember(const std::string& strSignalName, cDataReceiver* pReceiver)
+{
+    tMember oMember;
+    oMember.nSignalId = bundle::GetSignalId(strSignalName);
+    oMember.strSignalName = strSignalName;
+    oMember.pReceiver = pReceiver;
+    oMember.bMuted = false;
+
+    tBundleLock oSync(m_oBundleMutex);
+    std::vector<tMember>::iterator itPos = std::lower_bound(m_vecMembers.begin(), m_vecMembers.end(),
+        oMember, &cBundleReceiver::CompareMember);
+    if (itPos != m_vecMembers.end() && itPos->nSignalId == oMember.nSignalId
+        && itPos->strSignalName != strSignalName)
+    {
+        INVOKE_INCIDENT(m_pIncidentInvocationHandler, FSI_GENERAL_WARNING, SL_Critical_Local,
+            a_util::strings::format("Signals %s and %s cannot be received from the same bundle %s",
+            itPos->strSignalName.c_str(), strSignalName.c_str(), m_strBundleId.c_str()).c_str());
+        return ERR_RESOURCE_IN_USE;
+    }
+    m_vecMembers.insert(itPos, oMember);
+    return ERR_NOERROR;
+}
+
+bool cBundleReceiver::RemoveMember(cDataReceiver* pReceiver)
+{
+    tBundleLock oSync(m_oBundleMutex);
+    for (std::vector<tMember>::iterator it = m_vecMembers.begin(); it != m_vecMembers.end(); ++it)
+    {
+        if (it->pReceiver == pReceiver)
+        {
+            m_vecMembers.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void cBundleReceiver::MuteMember(cDataReceiver* pReceiver, bool bMute)
+{
+    tBundleLock oSync(m_oBundleMutex);
+    for (std::vector<tMember>::iterator it = m_vecMembers.begin(); it != m_vecMembers.end(); ++it)
+    {
+        if (it->pReceiver == pReceiver)
+        {
+            it->bMuted = bMute;
+        }
+    }
+}
+
+bool cBundleReceiver::IsEmpty() const
+{
+    return m_vecMembers.empty();
+}
+
+fep::Result cBundleReceiver::Enable()
+{
+    return m_pDriverReceiver->Enable();
+}
+
+fep::Result cBundleReceiver::Disable()
+{
+    return m_pDriverReceiver->Disable();
+}
+
+void cBundleReceiver::ReceiveBundle(void* pInstance, const void* pData, size_t szSize)
+{
+    reinterpret_cast<cBundleReceiver*>(pInstance)->Dispatch(pData, szSize);
+}
+
+void cBundleReceiver::Dispatch(const void* pData, size_t szSize)
+{
+    if (NULL == pData || szSize < sizeof(cFepBundleHeader))
+    {
+        return;
+    }
+    const uint8_t* pCursor = static_cast<const uint8_t*>(pData);
+    const uint8_t* const pEnd = pCursor + szSize;
+    const cFepBundleHeader* pBundleHeader = reinterpret_cast<const cFepBundleHeader*>(pCursor);
+    const header::ByteOrderAndSerialization eByteOrder =
+        header::GetByteOrderFlag(pBundleHeader->m_nByteOrderFlags);
+    if (0 == eByteOrder || bundle::s_nBundleVersion != pBundleHeader->m_nBundleVersion)
+    {
+        INVOKE_INCIDENT(m_pIncidentInvocationHandler,
+            fep::FSI_TRANSM_FEP_PROTO_CORRUPT_HEADER, fep::SL_Critical_Local,
+            a_util::strings::format("Received a bundle with corrupt header (Bundle %s)",
+            m_strBundleId.c_str()).c_str());
+        return;
+    }
+    const uint16_t nCount = header::ConvertToCorrectByteorder(pBundleHeader->m_nCount, eByteOrder);
+    const int64_t nBaseTimeStamp = header::ConvertToCorrectByteorder(pBundleHeader->m_nBaseTimeStamp, eByteOrder);
+    pCursor += sizeof(cFepBundleHeader);
+
+    tBundleLock oSync(m_oBundleMutex);
+    for (uint16_t nEntry = 0; nEntry < nCount; ++nEntry)
+    {
+        if (pCursor + sizeof(cFepBundleEntryHeader) > pEnd)
+        {
+            break;
+        }
+        const cFepBundleEntryHeader* pEntry = reinterpret_cast<const cFepBundleEntryHeader*>(pCursor);
+        const size_t szPayload = header::ConvertToCorrectByteorder(pEntry->m_nSize, eByteOrder);
+        const uint8_t* pPayload = pCursor + sizeof(cFepBundleEntryHeader);
+        if (pPayload + szPayload > pEnd)
+        {
+            INVOKE_INCIDENT(m_pIncidentInvocationHandler,
+                fep::FSI_TRANSM_FEP_PROTO_CORRUPT_HEADER, fep::SL_Critical_Local,
+                a_util::strings::format("Received a truncated bundle (Bundle %s)",
+                m_strBundleId.c_str()).c_str());
+            break;
+        }
+        pCursor = pPayload + szPayload;
+
+        tMember oKey;
+        oKey.nSignalId = header::ConvertToCorrectByteorder(pEntry->m_nSignalId, eByteOrder);
+        std::pair<std::vector<tMember>::const_iterator, std::vector<tMember>::const_iterator> oRange =
+            std::equal_range(m_vecMembers.begin(), m_vecMembers.end(), oKey, &cBundleReceiver::CompareMember);
+        if (oRange.first == oRange.second)
+        {
+            // not subscribed by this participant
+            continue;
+        }
+
+        // rebuild the sample as it would have been transmitted on its own (sender byte order)
+        m_vecSample.resize(sizeof(cFepDataHeader) + szPayload);
+        cFepDataHeader* pHeader = reinterpret_cast<cFepDataHeader*>(&m_vecSample[0]);
+        pHeader->m_nMajorVersion = pBundleHeader->m_nMajorVersion;
+        pHeader->m_nMinorVersion = pBundleHeader->m_nMinorVersion;
+        pHeader->m_nSerAndByteOrderFlags = pEntry->m_nSerAndByteOrderFlags;
+        pHeader->m_nSync = pEntry->m_nSync;
+        pHeader->m_nSequence = 0x00;
+        pHeader->m_nSampleNumber = pEntry->m_nSampleNumber;
+        pHeader->m_nFrameId = pBundleHeader->m_nFrameId;
+        pHeader->m_nSendTimeStamp = header::ConvertToCorrectByteorder(static_cast<int64_t>(nBaseTimeStamp
+            + header::ConvertToCorrectByteorder(pEntry->m_nTimeOffset, eByteOrder)), eByteOrder);
+        if (0 != szPayload)
+        {
+            ::memcpy(&m_vecSample[sizeof(cFepDataHeader)], pPayload, szPayload);
+        }
+
+        for (std::vector<tMember>::const_iterator it = oRange.first; it != oRange.second; ++it)
+        {
+            if (!it->bMuted)
+            {
+                cDataReceiver::EnqueueReceivedData(it->pReceiver, &m_vecSample[0], m_vecSample.size());
+            }
+        }
+    }
+}
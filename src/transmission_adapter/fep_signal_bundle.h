@@ -0,0 +1,317 @@
+/**
+ * Declaration of the Classes cBundleTransmitter and cBundleReceiver.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_SIGNAL_BUNDLE_H_
+#define _FEP_SIGNAL_BUNDLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <a_util/concurrency/detail/fast_mutex_decl.h>
+
+#include "fep_result_decl.h"
+#include "transmission_adapter/fep_signal_options.h"
+
+namespace fep
+{
+    class IIncidentInvocationHandler;
+    class IReceive;
+    class ITransmissionDriver;
+    class ITransmit;
+    class cDataReceiver;
+
+    //\cond nodoc
+    struct tSignal;
+    //\endcond nodoc
+
+    namespace bundle
+    {
+        /// Maximum size of a bundle (including all headers)
+        static const size_t s_szMaxBundleSize = 62 * 1024;
+        /// Version of the bundle layout
+        static const uint8_t s_nBundleVersion = 1;
+
+        /**
+         * Returns the id of a signal inside a bundle (FNV-1a hash of the signal name).
+         * The id is computed on both sides, so no negotiation is needed.
+         * @param [in] strSignalName Name of the signal
+         * @return The signal id
+         */
+        inline uint32_t GetSignalId(const std::string& strSignalName)
+        {
+            uint32_t nHash = 2166136261u;
+            for (std::string::const_iterator it = strSignalName.begin(); it != strSignalName.end(); ++it)
+            {
+                nHash ^= static_cast<uint8_t>(*it);
+                nHash *= 16777619u;
+            }
+            return nHash;
+        }
+
+        /**
+         * Returns the name of the driver signal a bundle is transmitted with
+         * @param [in] strBundleId Id of the bundle
+         * @return The driver signal name
+         */
+        inline std::string GetChannelName(const std::string& strBundleId)
+        {
+            return "_fep_bundle_" + strBundleId;
+        }
+    }
+
+    /**
+     * @brief The cBundleTransmitter class
+     * Collects the samples of several output signals and transmits them as one driver sample.
+     * Each sample is stored with a \ref cFepBundleEntryHeader instead of its full
+     * \ref cFepDataHeader. The members of a bundle are \ref cTransmitter objects that hand
+     * over their completely prepared samples via \ref Append.
+     */
+    class cBundleTransmitter
+    {
+        /// A member signal of the bundle
+        struct tMember
+        {
+            /// Name of the signal
+            std::string strSignalName;
+            /// Id of the signal inside the bundle
+            uint32_t nSignalId;
+            /// Flag indicating that the slot is in use
+            bool bUsed;
+            /// Flag indicating that a sample of this member is waiting in the bundle
+            bool bPending;
+        };
+
+    public:
+        /*
+        * CTOR
+        */
+        cBundleTransmitter();
+
+        /*
+        * DTOR
+        */
+        ~cBundleTransmitter();
+
+        /**
+         * @brief Create Creates the driver transmitter of the bundle
+         * @param pDriver Pointer to Transmission Driver
+         * @param pIncidentInvocationHandler Pointer to incident invocation Handler
+         * @param oSignal The first member signal, it defines the bundle id and the QoS
+         * @return Standard Error Code
+         */
+        fep::Result Create(ITransmissionDriver* pDriver,
+            fep::IIncidentInvocationHandler* pIncidentInvocationHandler,
+            const tSignal& oSignal);
+
+        /**
+         * @brief AddMember Adds a signal to the bundle
+         * @param strSignalName Name of the signal
+         * @param nSlot [out] Slot of the member, to be passed to \ref Append
+         * @return Standard Error Code
+         * @retval ERR_RESOURCE_IN_USE The signal id is already used by another signal of the bundle
+         */
+        fep::Result AddMember(const std::string& strSignalName, size_t& nSlot);
+
+        /**
+         * @brief RemoveMember Removes a signal from the bundle, pending samples are transmitted
+         * @param nSlot Slot of the member
+         */
+        void RemoveMember(size_t nSlot);
+
+        /**
+         * @brief IsEmpty Returns whether the bundle has no members left
+         * @return true if the bundle has no members
+         */
+        bool IsEmpty() const;
+
+        /**
+         * @brief Append Adds a sample to the bundle. The bundle is transmitted before if the
+         * member already has a pending sample, the sample belongs to another frame or does not
+         * fit. It is transmitted afterwards if every member has a pending sample.
+         * @param nSlot Slot of the member
+         * @param pSample Sample including the \ref cFepDataHeader (local byte order)
+         * @param szSample Size of the sample
+         * @return Standard Error Code
+         * @retval ERR_INVALID_ARG The sample is too large for a bundle
+         */
+        fep::Result Append(size_t nSlot, const void* pSample, size_t szSample);
+
+        /**
+         * @brief Flush Transmits all pending samples
+         * @return Standard Error Code
+         */
+        fep::Result Flush();
+
+        /// Enable the driver transmitter
+        fep::Result Enable();
+        /// Disable the driver transmitter
+        fep::Result Disable();
+
+    private:
+        /**
+         * @brief TransmitPending Transmits the pending samples (the mutex has to be locked)
+         * @return Standard Error Code
+         */
+        fep::Result TransmitPending();
+
+    private:
+        /// Id of the bundle
+        std::string m_strBundleId;
+        /// Members of the bundle, slots are reused but never moved
+        std::vector<tMember> m_vecMembers;
+        /// Number of used slots
+        size_t m_nMemberCount;
+        /// Number of pending samples
+        size_t m_nPendingCount;
+        /// The bundle being filled
+        std::vector<uint8_t> m_vecBundle;
+        /// Used bytes of the bundle
+        size_t m_szUsed;
+        /// Frame id of the pending samples
+        uint64_t m_nFrameId;
+        /// Timestamp of the first pending sample
+        int64_t m_nBaseTimeStamp;
+        /// Guards the bundle against concurrent transmitters
+        a_util::concurrency::fast_mutex m_oBundleMutex;
+        /// Driver
+        ITransmissionDriver* m_pDriver;
+        /// TransmitObject provided by the driver
+        ITransmit* m_pDriverTransmitter;
+        /// Pointer to the instance of the private IncidentInvocationHandler interface
+        fep::IIncidentInvocationHandler* m_pIncidentInvocationHandler;
+    };
+
+    /**
+     * @brief The cBundleReceiver class
+     * Receives the bundles with a given id and hands every contained sample to the
+     * \ref cDataReceiver of the signal, just as if it had been received on its own.
+     */
+    class cBundleReceiver
+    {
+        /// A member signal of the bundle
+        struct tMember
+        {
+            /// Id of the signal inside the bundle
+            uint32_t nSignalId;
+            /// Name of the signal
+            std::string strSignalName;
+            /// Receiver of the signal
+            cDataReceiver* pReceiver;
+            /// Flag indicating that the signal is muted
+            bool bMuted;
+        };
+
+    public:
+        /*
+        * CTOR
+        */
+        cBundleReceiver();
+
+        /*
+        * DTOR
+        */
+        ~cBundleReceiver();
+
+        /**
+         * @brief Create Creates the driver receiver of the bundle
+         * @param pDriver Pointer to Transmission Driver
+         * @param pIncidentInvocationHandler Pointer to incident invocation Handler
+         * @param oSignal The first member signal, it defines the bundle id and the QoS
+         * @return Standard Error Code
+         */
+        fep::Result Create(ITransmissionDriver* pDriver,
+            fep::IIncidentInvocationHandler* pIncidentInvocationHandler,
+            const tSignal& oSignal);
+
+        /**
+         * @brief AddMember Adds a receiver to the bundle
+         * @param strSignalName Name of the signal
+         * @param pReceiver Receiver of the signal
+         * @return Standard Error Code
+         * @retval ERR_RESOURCE_IN_USE The signal id is already used by another signal of the bundle
+         */
+        fep::Result AddMember(const std::string& strSignalName, cDataReceiver* pReceiver);
+
+        /**
+         * @brief RemoveMember Removes a receiver from the bundle
+         * @param pReceiver Receiver of the signal
+         * @return true if the receiver was a member of the bundle
+         */
+        bool RemoveMember(cDataReceiver* pReceiver);
+
+        /**
+         * @brief MuteMember Mutes or unmutes a member
+         * @param pReceiver Receiver of the signal
+         * @param bMute true to mute, false to unmute
+         */
+        void MuteMember(cDataReceiver* pReceiver, bool bMute);
+
+        /**
+         * @brief IsEmpty Returns whether the bundle has no members left
+         * @return true if the bundle has no members
+         */
+        bool IsEmpty() const;
+
+        /// Enable the driver receiver
+        fep::Result Enable();
+        /// Disable the driver receiver
+        fep::Result Disable();
+
+        /**
+         * @brief ReceiveBundle Callback of the driver receiver
+         * @param pInstance Instance of Object to be called
+         * @param pData Void Pointer to the received bundle
+         * @param szSize Size of the received bundle
+         */
+        static void ReceiveBundle(void* pInstance, const void* pData, size_t szSize);
+
+    private:
+        /**
+         * @brief Dispatch Unpacks a bundle and hands the samples to the receivers
+         * @param pData Pointer to the received bundle
+         * @param szSize Size of the received bundle
+         */
+        void Dispatch(const void* pData, size_t szSize);
+
+        /// Orders members by signal id
+        static bool CompareMember(const tMember& oLeft, const tMember& oRight);
+
+    private:
+        /// Id of the bundle
+        std::string m_strBundleId;
+        /// Members of the bundle sorted by signal id
+        std::vector<tMember> m_vecMembers;
+        /// Buffer the samples are rebuilt in (header + payload)
+        std::vector<uint8_t> m_vecSample;
+        /// Guards the members against concurrent (un)registration
+        a_util::concurrency::fast_mutex m_oBundleMutex;
+        /// Driver
+        ITransmissionDriver* m_pDriver;
+        /// ReceiveObject provided by the driver
+        IReceive* m_pDriverReceiver;
+        /// Pointer to the instance of the private IncidentInvocationHandler interface
+        fep::IIncidentInvocationHandler* m_pIncidentInvocationHandler;
+    };
+}
+
+#endif // _FEP_SIGNAL_BUNDLE_H_
@@ -18,10 +18,12 @@
 /// Someone should add a header here some time
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <sys/types.h>
 #include <a_util/memory/memory.h>
 #include <a_util/regex/regularexpression.h>
+#include <a_util/strings/strings_convert_decl.h>
 #include <a_util/strings/strings_format.h>
 #include <a_util/strings/strings_functions.h>
 #include <a_util/system/system.h>
@@ -44,6 +46,7 @@
 #include "messages/fep_command_get_schedule.h"
 #include "messages/fep_command_get_signal_info.h"
 #include "messages/fep_command_intf.h"
+#include "messages/fep_command_listener.h"
 #include "messages/fep_command_mapping_configuration.h"
 #include "messages/fep_command_mute_signal.h"
 #include "messages/fep_command_name_change.h"
@@ -54,9 +57,12 @@
 #include "messages/fep_command_signal_description.h"
 #include "messages/fep_command_unreg_prop_listener.h"
 #include "messages/fep_message.h"
+#include "messages/fep_message_binary_codec.h"
 #include "messages/fep_message_intf.h"
+#include "messages/fep_message_routing.h"
 #include "messages/fep_notification_incident.h"
 #include "messages/fep_notification_intf.h"
+#include "messages/fep_notification_listener.h"
 #include "messages/fep_notification_name_changed.h"
 #include "messages/fep_notification_prop_changed.h"
 #include "messages/fep_notification_property.h"
@@ -72,6 +78,7 @@
 #include "transmission_adapter/fep_preparation_data_sample_intf.h"
 #include "transmission_adapter/fep_receive_intf.h"
 #include "transmission_adapter/fep_receiver.h"
+#include "transmission_adapter/fep_signal_bundle.h"
 #include "transmission_adapter/fep_signal_direction.h"
 #include "transmission_adapter/fep_transmission.h"
 #include "transmission_adapter/fep_transmission_driver_intf.h"
@@ -82,6 +89,11 @@
 #ifdef WITH_ZYRE
 #include "transmission_adapter/zmq/fep_zmq_driver.h"
 #endif
+#ifdef __linux__
+#include "transmission_adapter/shm/fep_shm_driver.h"
+#include "transmission_adapter/udp/fep_udp_driver.h"
+#endif
+#include "transmission_adapter/inproc/fep_inproc_driver.h"
 
 #if __GNUC__
 // Avoid lots of warnings in libjson
@@ -99,6 +111,8 @@ const uint32_t fep::cTransmissionAdapter::s_nMessageStringLength = 2097152;
 /* constants used in this module only */
 static uint32_t s_nPreAllocCount = 100;
 static const int32_t s_nNumberOfWorkers = 4;
+/// Time the driver gets to connect a new transmitter to an inbox (like the message channel at setup)
+static const int32_t s_nInboxConnectTime_ms = 500;
 
 namespace fep
 {
@@ -110,12 +124,103 @@ namespace fep
         {
             size_t szSize;
             char strMessage[fep::cTransmissionAdapter::s_nMessageStringLength];
+            /// Task to be run instead of a message (see DispatchToMessageWorker)
+            std::function<void()> fnTask;
         };
     }
 
 using namespace detail;
 
+/// Removes the announcement of the inbox from the header of a JSON message
+static std::string RemoveInboxRouting(const char* strMessage)
+{
+    JSONNode oMessageNode = libjson::parse(std::string(strMessage));
+    JSONNode::iterator oHeaderNodeIter = oMessageNode.find("Header");
+    if (oMessageNode.end() != oHeaderNodeIter)
+    {
+        JSONNode::iterator oFieldIter = oHeaderNodeIter->find(cMessageRouting::s_strRoutingField);
+        if (oHeaderNodeIter->end() != oFieldIter)
+        {
+            oHeaderNodeIter->erase(oFieldIter);
+        }
+    }
+    return libjson::to_std_string(oMessageNode.write_formatted());
+}
+
+/// Checks whether a message to the given receiver (may contain wildcards) is addressed to the module
+static bool IsAddressedTo(std::string strReceiver, const char* strModuleName)
+{
+    // most messages are sent to everyone or to a single participant, spare the regex then
+    if ("*" == strReceiver || strReceiver == strModuleName)
+    {
+        return true;
+    }
+    a_util::strings::replace(strReceiver, "*", ".*");
+    a_util::strings::replace(strReceiver, "?", ".");
+    a_util::regex::RegularExpression oReceiverFilter(strReceiver);
+    return oReceiverFilter.fullMatch(strModuleName);
+}
+
+/// Provides the messages decoded by cMessageBinaryCodec to the listeners of the adapter
+class cTransmissionAdapter::cBinaryMessageDispatcher :
+    public cCommandListener, public cNotificationListener
+{
+public:
+    /// CTOR
+    explicit cBinaryMessageDispatcher(cTransmissionAdapter& oAdapter) : m_oAdapter(oAdapter)
+    {
+    }
+
+public: // implements ICommandListener
+    fep::Result Update(ICustomCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IControlCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(ISetPropertyCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IGetPropertyCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IDeletePropertyCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IRegPropListenerCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IUnregPropListenerCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IGetSignalInfoCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IResolveSignalTypeCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(ISignalDescriptionCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IMappingConfigurationCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(INameChangeCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IMuteSignalCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IGetScheduleCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+    fep::Result Update(IRPCCommand const * poCommand) { return m_oAdapter.ProvideCommand(poCommand); }
+
+public: // implements INotificationListener
+    fep::Result Update(IStateNotification const * poNotification)
+    {
+        m_oAdapter.UpdatePeers(poNotification);
+        return m_oAdapter.ProvideNotification(poNotification);
+    }
+    fep::Result Update(IIncidentNotification const * poNotification) { return m_oAdapter.ProvideNotification(poNotification); }
+    fep::Result Update(IPropertyNotification const * poNotification) { return m_oAdapter.ProvideNotification(poNotification); }
+    fep::Result Update(IPropertyChangedNotification const * poNotification) { return m_oAdapter.ProvideNotification(poNotification); }
+    fep::Result Update(IRegPropListenerAckNotification const * poNotification) { return m_oAdapter.ProvideNotification(poNotification); }
+    fep::Result Update(IUnregPropListenerAckNotification const * poNotification) { return m_oAdapter.ProvideNotification(poNotification); }
+    fep::Result Update(ISignalInfoNotification const * poNotification) { return m_oAdapter.ProvideNotification(poNotification); }
+    fep::Result Update(ISignalDescriptionNotification const * poNotification) { return m_oAdapter.ProvideNotification(poNotification); }
+    fep::Result Update(IResultCodeNotification const * poNotification) { return m_oAdapter.ProvideNotification(poNotification); }
+    fep::Result Update(INameChangedNotification const * poNotification)
+    {
+        m_oAdapter.UpdatePeers(poNotification);
+        return m_oAdapter.ProvideNotification(poNotification);
+    }
+    fep::Result Update(IScheduleNotification const * poNotification) { return m_oAdapter.ProvideNotification(poNotification); }
+
+private:
+    /// The adapter
+    cTransmissionAdapter& m_oAdapter;
+};
+
 cTransmissionAdapter::cTransmissionAdapter() :
+    m_pClockService(NULL),
+    m_nStatisticsMirrorPeriod_ms(0),
+    m_nMessageEncoding(ME_Negotiated),
+    m_bMessageInbox(true),
+    m_pInboxReceiver(NULL),
+    m_bInboxOpen(false),
     m_poTransmissionDriver(NULL),
     m_pMessageTransmitter(NULL),
     m_pMessageReceiver(NULL),
@@ -151,6 +256,31 @@ fep::Result cTransmissionAdapter::Setup(fep::IPropertyTree* pPropertyTree,
     m_oModuleOptions = oModuleOptions;
     nResult = m_pPropertyTree->SetPropertyValue(
         fep::component_config::g_strTxAdapterPath_nNumberOfWorkerThreads, s_nNumberOfWorkers);
+    if (fep::isOk(nResult))
+    {
+        nResult = m_pPropertyTree->SetPropertyValue(
+            fep::component_config::g_strTxAdapterPath_strWorkerCpuAffinity, "");
+    }
+    if (fep::isOk(nResult))
+    {
+        nResult = m_pPropertyTree->SetPropertyValue(
+            fep::component_config::g_strTxAdapterPath_bWorkerBusyPolling, false);
+    }
+    if (fep::isOk(nResult))
+    {
+        nResult = m_pPropertyTree->SetPropertyValue(
+            fep::component_config::g_strTxAdapterPath_nStatisticsMirrorPeriod, 0);
+    }
+    if (fep::isOk(nResult))
+    {
+        nResult = m_pPropertyTree->SetPropertyValue(
+            fep::component_config::g_strTxAdapterPath_strMessageEncoding, "negotiated");
+    }
+    if (fep::isOk(nResult))
+    {
+        nResult = m_pPropertyTree->SetPropertyValue(
+            fep::component_config::g_strTxAdapterPath_bMessageInbox, true);
+    }
     //Select Driver 
     if(fep::isOk(nResult))
     {
@@ -192,6 +322,35 @@ fep::Result cTransmissionAdapter::Setup(fep::IPropertyTree* pPropertyTree,
                     break;
                 }
 #endif
+#ifdef __linux__
+                case fep::TT_SHM:
+                {
+                    m_poTransmissionDriver = new shm::cShmDriver();
+                    if (NULL == m_poTransmissionDriver)
+                    {
+                        nResult = ERR_MEMORY;
+                    }
+                    break;
+                }
+                case fep::TT_UDP:
+                {
+                    m_poTransmissionDriver = new udp::cUdpDriver();
+                    if (NULL == m_poTransmissionDriver)
+                    {
+                        nResult = ERR_MEMORY;
+                    }
+                    break;
+                }
+#endif
+                case fep::TT_INPROC:
+                {
+                    m_poTransmissionDriver = new inproc::cInProcDriver();
+                    if (NULL == m_poTransmissionDriver)
+                    {
+                        nResult = ERR_MEMORY;
+                    }
+                    break;
+                }
                 default:
                 {
                     nResult = ERR_INVALID_ARG;
@@ -317,6 +476,16 @@ fep::Result cTransmissionAdapter::CreateMessageChannel()
         }
         nResult = m_pMessageReceiver->SetReceiver(ReceiveMessage, this);
     }
+    if (fep::isOk(nResult))
+    {
+        const char* strModuleName = GetModuleName();
+        if (fep::isFailed(UpdateInbox(strModuleName ? strModuleName : m_oModuleOptions.GetParticipantName())))
+        {
+            // the others keep sending to the broadcast channel, the inbox is not announced
+            INVOKE_INCIDENT(m_pIncidentInvocationHandler, FSI_GENERAL_WARNING, SL_Warning,
+                "Creating the inbox failed - messages are received on the broadcast channel only.");
+        }
+    }
     //Giving the participants time to find each other
     a_util::system::sleepMilliseconds(500);
     // Creating message worker thread
@@ -341,6 +510,7 @@ fep::Result cTransmissionAdapter::DestroyMessageChannel()
         m_pMessageThread.reset();
     }
     m_oShutdownSignal.reset();
+    DestroyInboxes();
     nResult = m_poTransmissionDriver->DestroyReceiver(m_pMessageReceiver);
     nResult = m_poTransmissionDriver->DestroyTransmitter(m_pMessageTransmitter);
 
@@ -367,7 +537,7 @@ fep::Result cTransmissionAdapter::GatherMessageSignalOptions()
         INVOKE_INCIDENT(m_pIncidentInvocationHandler, FSI_GENERAL_WARNING, SL_Warning,
             "The transmission driver can not transmit reliable. Creating message channel anyway!\n")
     }
-    std::string strSignalName ="command";
+    std::string strSignalName = cMessageRouting::s_strBroadcastChannel;
 
     if(!m_oMessageSignalOptions.SetOption("SignalName", strSignalName))
     {
@@ -403,7 +573,31 @@ fep::Result cTransmissionAdapter::CreateQueueManager()
     {
         nNumberOfThreads = s_nNumberOfWorkers;
     }
-    nResult = m_oQueueManager.Create(nNumberOfThreads);
+
+    std::vector<int32_t> vecCpuAffinity;
+    const char* strCpuAffinity = NULL;
+    if (fep::isOk(m_pPropertyTree->GetPropertyValue(
+        fep::component_config::g_strTxAdapterPath_strWorkerCpuAffinity, strCpuAffinity)) && strCpuAffinity)
+    {
+        std::vector<std::string> vecCpus = a_util::strings::split(strCpuAffinity, ",");
+        for (std::vector<std::string>::iterator it = vecCpus.begin(); it != vecCpus.end(); ++it)
+        {
+            std::string strCpu = a_util::strings::trim(*it);
+            if (a_util::strings::isInt32(strCpu))
+            {
+                vecCpuAffinity.push_back(a_util::strings::toInt32(strCpu));
+            }
+        }
+    }
+
+    bool bBusyPolling = false;
+    if (fep::isFailed(m_pPropertyTree->GetPropertyValue(
+        fep::component_config::g_strTxAdapterPath_bWorkerBusyPolling, bBusyPolling)))
+    {
+        bBusyPolling = false;
+    }
+
+    nResult = m_oQueueManager.Create(nNumberOfThreads, vecCpuAffinity, bBusyPolling);
     return nResult;
 }
 
@@ -432,19 +626,37 @@ fep::Result cTransmissionAdapter::Destroy()
         m_oAdapterMutex.lock();
         m_oContForkMutex.lock();
 
-        std::vector<cDataReceiver*>::iterator itReceivers = m_vecDataReceiver.begin();
-        for (; itReceivers != m_vecDataReceiver.end(); ++itReceivers)
+        // bundles are dispatching to the receivers, so they have to go first
+        for (std::map<std::string, cBundleReceiver*>::iterator itBundle = m_mapBundleReceivers.begin();
+            itBundle != m_mapBundleReceivers.end(); ++itBundle)
+        {
+            delete itBundle->second;
+        }
+        m_mapBundleReceivers.clear();
+
         {
-            delete (*itReceivers);
+            tMutexLockGuard oSignalListGuard(m_oSignalListMutex);
+            std::vector<cDataReceiver*>::iterator itReceivers = m_vecDataReceiver.begin();
+            for (; itReceivers != m_vecDataReceiver.end(); ++itReceivers)
+            {
+                delete (*itReceivers);
+            }
+            m_vecDataReceiver.clear();
+
+            std::vector<cTransmitter*>::iterator itTransmitters = m_vecDataTransmitter.begin();
+            for (; itTransmitters != m_vecDataTransmitter.end(); ++itTransmitters)
+            {
+                delete (*itTransmitters);
+            }
+            m_vecDataTransmitter.clear();
         }
-        m_vecDataReceiver.clear();
 
-        std::vector<cTransmitter*>::iterator itTransmitters = m_vecDataTransmitter.begin();
-        for (; itTransmitters != m_vecDataTransmitter.end(); ++itTransmitters)
+        for (std::map<std::string, cBundleTransmitter*>::iterator itBundle = m_mapBundleTransmitters.begin();
+            itBundle != m_mapBundleTransmitters.end(); ++itBundle)
         {
-            delete (*itTransmitters);
+            delete itBundle->second;
         }
-        m_vecDataTransmitter.clear();
+        m_mapBundleTransmitters.clear();
 
         fep::Result nLocalRes = m_poTransmissionDriver->Deinitialize();
         if(fep::isFailed(nLocalRes))
@@ -466,6 +678,37 @@ fep::Result cTransmissionAdapter::Enable()
     {
         m_bGlobalDisabled = false;
         nResult = CreateQueueManager();
+        int32_t nMirrorPeriod = 0;
+        if (fep::isFailed(m_pPropertyTree->GetPropertyValue(
+            fep::component_config::g_strTxAdapterPath_nStatisticsMirrorPeriod, nMirrorPeriod)))
+        {
+            nMirrorPeriod = 0;
+        }
+        m_nStatisticsMirrorPeriod_ms = std::max<int32_t>(nMirrorPeriod, 0);
+        const char* strEncoding = NULL;
+        int32_t nEncoding = ME_Negotiated;
+        if (fep::isOk(m_pPropertyTree->GetPropertyValue(
+            fep::component_config::g_strTxAdapterPath_strMessageEncoding, strEncoding)) && strEncoding)
+        {
+            if (a_util::strings::isEqual(strEncoding, "json"))
+            {
+                nEncoding = ME_Json;
+            }
+            else if (a_util::strings::isEqual(strEncoding, "binary"))
+            {
+                nEncoding = ME_Binary;
+            }
+        }
+        m_nMessageEncoding = nEncoding;
+        bool bMessageInbox = true;
+        if (fep::isFailed(m_pPropertyTree->GetPropertyValue(
+            fep::component_config::g_strTxAdapterPath_bMessageInbox, bMessageInbox)))
+        {
+            bMessageInbox = true;
+        }
+        m_bMessageInbox = bMessageInbox;
+        // latencies are collected per run, the previous one might have used another clock
+        ResetLatencyStatistics();
         std::vector<cDataReceiver*>::iterator itReceivers = m_vecDataReceiver.begin();
         for(; itReceivers != m_vecDataReceiver.end(); ++itReceivers)
         {
@@ -482,6 +725,22 @@ fep::Result cTransmissionAdapter::Enable()
                 nResult = ERR_FAILED;
             }
         }
+        for (std::map<std::string, cBundleReceiver*>::iterator itBundle = m_mapBundleReceivers.begin();
+            itBundle != m_mapBundleReceivers.end(); ++itBundle)
+        {
+            if (fep::isFailed(itBundle->second->Enable()))
+            {
+                nResult = ERR_FAILED;
+            }
+        }
+        for (std::map<std::string, cBundleTransmitter*>::iterator itBundle = m_mapBundleTransmitters.begin();
+            itBundle != m_mapBundleTransmitters.end(); ++itBundle)
+        {
+            if (fep::isFailed(itBundle->second->Enable()))
+            {
+                nResult = ERR_FAILED;
+            }
+        }
     }
     return nResult;
 }
@@ -516,6 +775,22 @@ fep::Result cTransmissionAdapter::Disable()
                 nResult = ERR_FAILED;
             }
         }
+        for (std::map<std::string, cBundleReceiver*>::iterator itBundle = m_mapBundleReceivers.begin();
+            itBundle != m_mapBundleReceivers.end(); ++itBundle)
+        {
+            if (fep::isFailed(itBundle->second->Disable()))
+            {
+                nResult = ERR_FAILED;
+            }
+        }
+        for (std::map<std::string, cBundleTransmitter*>::iterator itBundle = m_mapBundleTransmitters.begin();
+            itBundle != m_mapBundleTransmitters.end(); ++itBundle)
+        {
+            if (fep::isFailed(itBundle->second->Disable()))
+            {
+                nResult = ERR_FAILED;
+            }
+        }
     }
     return nResult;
 }
@@ -550,14 +825,34 @@ void cTransmissionAdapter::LogMessage(void* pInstance, const char* strMessage, c
 
 void cTransmissionAdapter::ThreadFunc()
 {
+    std::chrono::steady_clock::time_point tmNextMirror = std::chrono::steady_clock::now();
     while (!m_oShutdownSignal.is_set())
     {
         cMessageContainer* pMessageItem;
         if(true == m_qReceiveQueue.TryDequeue(pMessageItem, (100 * 1000)))
         {
-            Update(static_cast<char *>(pMessageItem->strMessage));
+            if (pMessageItem->fnTask)
+            {
+                pMessageItem->fnTask();
+                pMessageItem->fnTask = std::function<void()>();
+            }
+            else if (cMessageBinaryCodec::IsBinary(pMessageItem->strMessage, pMessageItem->szSize))
+            {
+                UpdateBinary(pMessageItem->strMessage, pMessageItem->szSize);
+            }
+            else
+            {
+                Update(static_cast<char *>(pMessageItem->strMessage));
+            }
             m_qPreAllocQueue.Enqueue(pMessageItem);
         }
+
+        const int32_t nMirrorPeriod = m_nStatisticsMirrorPeriod_ms;
+        if (0 < nMirrorPeriod && std::chrono::steady_clock::now() >= tmNextMirror)
+        {
+            MirrorTransportStatistics();
+            tmNextMirror = std::chrono::steady_clock::now() + std::chrono::milliseconds(nMirrorPeriod);
+        }
     }
 }
 
@@ -653,10 +948,6 @@ fep::Result cTransmissionAdapter::Update(char const * strMessage)
     fep::Result nResult = ERR_NOERROR;
     cMessage oMessage(strMessage);
     uint8_t nMajorVer = oMessage.GetMajorVersion();
-    std::string strReceiver = oMessage.GetReceiver();
-    a_util::strings::replace(strReceiver, "*", ".*");
-    a_util::strings::replace(strReceiver, "?", ".");
-    a_util::regex::RegularExpression oReceiverFilter(strReceiver);
     const char* strModuleName = GetModuleName();
     if (!strModuleName)
     {
@@ -665,12 +956,33 @@ fep::Result cTransmissionAdapter::Update(char const * strMessage)
 
     if (isOk(nResult))
     {
-        if (oReceiverFilter.fullMatch(strModuleName) && !a_util::strings::isEqual(strModuleName, oMessage.GetSender()))
+        if (IsAddressedTo(oMessage.GetReceiver(), strModuleName) && !a_util::strings::isEqual(strModuleName, oMessage.GetSender()))
         {
             if ((FEP_SDK_PARTICIPANT_VERSION_MAJOR == nMajorVer))
             {
                 // Identify the type of the message
                 JSONNode oMessageNode = libjson::parse(std::string(strMessage));
+                // the header announces whether the sender decodes binary messages and
+                // listens on its inbox
+                JSONNode::iterator oHeaderNodeIter = oMessageNode.find("Header");
+                if (oMessageNode.end() != oHeaderNodeIter)
+                {
+                    uint8_t nCapabilities = 0;
+                    JSONNode::iterator oFieldIter =
+                        oHeaderNodeIter->find(cMessageBinaryCodec::s_strEncodingsField);
+                    if (oHeaderNodeIter->end() != oFieldIter && std::string::npos !=
+                        oFieldIter->as_string().find(cMessageBinaryCodec::s_strBinaryEncoding))
+                    {
+                        nCapabilities |= PC_Binary;
+                    }
+                    oFieldIter = oHeaderNodeIter->find(cMessageRouting::s_strRoutingField);
+                    if (oHeaderNodeIter->end() != oFieldIter && std::string::npos !=
+                        oFieldIter->as_string().find(cMessageRouting::s_strInboxRouting))
+                    {
+                        nCapabilities |= PC_Inbox;
+                    }
+                    SetPeerCapabilities(oMessage.GetSender(), PC_Binary | PC_Inbox, nCapabilities);
+                }
                 JSONNode::iterator oCommandNodeIter = oMessageNode.find("Command");
                 if (oMessageNode.end() != oCommandNodeIter)
                 {
@@ -790,6 +1102,7 @@ fep::Result cTransmissionAdapter::Update(char const * strMessage)
                             {
                                 // It's a state notification
                                 cStateNotification oNoti(strMessage);
+                                UpdatePeers(&oNoti);
                                 nResult = ProvideNotification(&oNoti);
                             }
                             else if (a_util::strings::isEqual(strNot.c_str(), "property"))
@@ -808,6 +1121,7 @@ fep::Result cTransmissionAdapter::Update(char const * strMessage)
                             {
                                 // It's a name changed notification
                                 cNameChangedNotification oNoti(strMessage);
+                                UpdatePeers(&oNoti);
                                 nResult = ProvideNotification(&oNoti);
                             }
                             else if (a_util::strings::isEqual(strNot.c_str(), "reg_prop_listener_ack"))
@@ -867,6 +1181,223 @@ fep::Result cTransmissionAdapter::Update(char const * strMessage)
     return nResult;
 }
 
+fep::Result cTransmissionAdapter::UpdateBinary(const void* pMessage, size_t szSize)
+{
+    cMessageBinaryCodec::tHeader sHeader;
+    fep::Result nResult = cMessageBinaryCodec::DecodeHeader(pMessage, szSize, sHeader);
+    const char* strModuleName = GetModuleName();
+    if (fep::isOk(nResult) && !strModuleName)
+    {
+        nResult = ERR_UNEXPECTED;
+    }
+
+    if (fep::isOk(nResult) && !a_util::strings::isEqual(strModuleName, sHeader.strSender.c_str()))
+    {
+        // whoever sends binary messages decodes them as well
+        SetPeerCapabilities(sHeader.strSender, PC_Binary, PC_Binary);
+        if (IsAddressedTo(sHeader.strReceiver, strModuleName))
+        {
+            if (FEP_SDK_PARTICIPANT_VERSION_MAJOR == sHeader.nMajorVersion)
+            {
+                cBinaryMessageDispatcher oDispatcher(*this);
+                nResult = cMessageBinaryCodec::Decode(pMessage, szSize, sHeader, oDispatcher, oDispatcher);
+            }
+            else
+            {
+                INVOKE_INCIDENT(m_pIncidentInvocationHandler, FSI_TRANSM_MESSAGE_MAJOR_VERSION_FAILED, fep::SL_Warning,
+                    a_util::strings::format(
+                        "Received a message from a different FEP SDK major version - "
+                        "dropping message! (Received version: %d - Own version: %d)",
+                        sHeader.nMajorVersion, FEP_SDK_PARTICIPANT_VERSION_MAJOR).c_str());
+            }
+        }
+    }
+    return nResult;
+}
+
+void cTransmissionAdapter::SetPeerCapabilities(const std::string& strParticipant,
+    uint8_t nMask, uint8_t nCapabilities)
+{
+    bool bNewInbox = false;
+    {
+        std::lock_guard<std::mutex> oLock(m_oPeersMutex);
+        // a capability might be gone as well, the participant might have been restarted with an older version
+        uint8_t& nPeerCapabilities = m_mapPeerCapabilities[strParticipant];
+        bNewInbox = 0 == (nPeerCapabilities & PC_Inbox) && 0 != (nCapabilities & nMask & PC_Inbox);
+        nPeerCapabilities = static_cast<uint8_t>((nPeerCapabilities & ~nMask) | (nCapabilities & nMask));
+    }
+    if (bNewInbox && m_bMessageInbox)
+    {
+        // created ahead of the first message, the driver needs some time to connect it
+        CreateInboxTransmitter(strParticipant);
+    }
+}
+
+bool cTransmissionAdapter::HasPeerCapability(const char* strParticipant, uint8_t nCapability)
+{
+    std::lock_guard<std::mutex> oLock(m_oPeersMutex);
+    std::map<std::string, uint8_t>::const_iterator itPeer = m_mapPeerCapabilities.find(strParticipant);
+    return m_mapPeerCapabilities.end() != itPeer && 0 != (itPeer->second & nCapability);
+}
+
+bool cTransmissionAdapter::IsBinaryReceiver(const char* strReceiver)
+{
+    switch (m_nMessageEncoding)
+    {
+        case ME_Binary:
+            return true;
+        case ME_Negotiated:
+            // a wildcard might address participants that only decode JSON
+            return cMessageRouting::IsSingleReceiver(strReceiver)
+                && HasPeerCapability(strReceiver, PC_Binary);
+        default:
+            return false;
+    }
+}
+
+fep::Result cTransmissionAdapter::TransmitToReceiver(const char* strReceiver,
+    const void* pData, size_t szSize)
+{
+    if (!m_bMessageInbox || !cMessageRouting::IsSingleReceiver(strReceiver)
+        || !HasPeerCapability(strReceiver, PC_Inbox))
+    {
+        return m_pMessageTransmitter->Transmit(pData, szSize);
+    }
+
+    bool bCreate = false;
+    {
+        // held while transmitting, the transmitter is destroyed when the receiver leaves
+        std::lock_guard<std::mutex> oLock(m_oInboxMutex);
+        tInboxTransmitters::const_iterator itTransmitter = m_mapInboxTransmitters.find(strReceiver);
+        if (m_mapInboxTransmitters.end() == itTransmitter)
+        {
+            // the inbox was announced while sending to inboxes was switched off
+            bCreate = true;
+        }
+        else if (std::chrono::steady_clock::now() >= itTransmitter->second.tmUsable)
+        {
+            return itTransmitter->second.pTransmitter->Transmit(pData, szSize);
+        }
+    }
+    if (bCreate)
+    {
+        CreateInboxTransmitter(strReceiver);
+    }
+    // the broadcast channel reaches the receiver as well until its inbox is connected
+    return m_pMessageTransmitter->Transmit(pData, szSize);
+}
+
+void cTransmissionAdapter::CreateInboxTransmitter(const std::string& strParticipant)
+{
+    std::lock_guard<std::mutex> oLock(m_oInboxMutex);
+    if (!m_poTransmissionDriver || !m_pMessageTransmitter
+        || m_mapInboxTransmitters.end() != m_mapInboxTransmitters.find(strParticipant))
+    {
+        return;
+    }
+
+    cSignalOptions oOptions = m_oMessageSignalOptions;
+    oOptions.SetOption("SignalName", cMessageRouting::GetInboxChannel(strParticipant));
+    tInboxTransmitter sInbox;
+    sInbox.pTransmitter = NULL;
+    if (fep::isOk(m_poTransmissionDriver->CreateTransmitter(sInbox.pTransmitter, oOptions)) && sInbox.pTransmitter)
+    {
+        sInbox.pTransmitter->Enable();
+        sInbox.tmUsable = std::chrono::steady_clock::now() + std::chrono::milliseconds(s_nInboxConnectTime_ms);
+        m_mapInboxTransmitters[strParticipant] = sInbox;
+    }
+}
+
+void cTransmissionAdapter::RemovePeer(const std::string& strParticipant)
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oPeersMutex);
+        m_mapPeerCapabilities.erase(strParticipant);
+    }
+    std::lock_guard<std::mutex> oLock(m_oInboxMutex);
+    tInboxTransmitters::iterator itTransmitter = m_mapInboxTransmitters.find(strParticipant);
+    if (m_mapInboxTransmitters.end() != itTransmitter)
+    {
+        m_poTransmissionDriver->DestroyTransmitter(itTransmitter->second.pTransmitter);
+        m_mapInboxTransmitters.erase(itTransmitter);
+    }
+}
+
+void cTransmissionAdapter::UpdatePeers(IStateNotification const * pNotification)
+{
+    if (FS_SHUTDOWN == pNotification->GetState())
+    {
+        RemovePeer(pNotification->GetSender());
+    }
+}
+
+void cTransmissionAdapter::UpdatePeers(INameChangedNotification const * pNotification)
+{
+    RemovePeer(pNotification->GetOldParticipantName());
+}
+
+fep::Result cTransmissionAdapter::UpdateInbox(const char* strModuleName)
+{
+    if (!strModuleName)
+    {
+        return ERR_POINTER;
+    }
+    std::lock_guard<std::mutex> oLock(m_oInboxMutex);
+    if (m_pInboxReceiver && m_strInboxName == strModuleName)
+    {
+        return ERR_NOERROR;
+    }
+
+    m_bInboxOpen = false;
+    if (m_pInboxReceiver)
+    {
+        m_poTransmissionDriver->DestroyReceiver(m_pInboxReceiver);
+        m_pInboxReceiver = NULL;
+    }
+    m_strInboxName.clear();
+    cSignalOptions oOptions = m_oMessageSignalOptions;
+    oOptions.SetOption("SignalName", cMessageRouting::GetInboxChannel(strModuleName));
+    fep::Result nResult = m_poTransmissionDriver->CreateReceiver(m_pInboxReceiver, oOptions);
+    if (fep::isOk(nResult) && !m_pInboxReceiver)
+    {
+        nResult = ERR_POINTER;
+    }
+    if (fep::isOk(nResult))
+    {
+        m_pInboxReceiver->Enable();
+        nResult = m_pInboxReceiver->SetReceiver(ReceiveMessage, this);
+    }
+    if (fep::isOk(nResult))
+    {
+        m_strInboxName = strModuleName;
+        m_bInboxOpen = true;
+    }
+    else if (m_pInboxReceiver)
+    {
+        m_poTransmissionDriver->DestroyReceiver(m_pInboxReceiver);
+        m_pInboxReceiver = NULL;
+    }
+    return nResult;
+}
+
+void cTransmissionAdapter::DestroyInboxes()
+{
+    std::lock_guard<std::mutex> oLock(m_oInboxMutex);
+    m_bInboxOpen = false;
+    if (m_pInboxReceiver)
+    {
+        m_poTransmissionDriver->DestroyReceiver(m_pInboxReceiver);
+        m_pInboxReceiver = NULL;
+    }
+    m_strInboxName.clear();
+    for (tInboxTransmitters::iterator itTransmitter = m_mapInboxTransmitters.begin();
+        itTransmitter != m_mapInboxTransmitters.end(); ++itTransmitter)
+    {
+        m_poTransmissionDriver->DestroyTransmitter(itTransmitter->second.pTransmitter);
+    }
+    m_mapInboxTransmitters.clear();
+}
+
 fep::Result cTransmissionAdapter::UnregisterNotificationListener(INotificationListener * poStatusListener)
 {
     tMutexLockGuard oAdapterGuard(m_oAdapterMutex);
@@ -916,6 +1447,11 @@ fep::Result fep::cTransmissionAdapter::MuteSignal(handle_t hSignalHandle)
         if ((*it) == hSignalHandle)
         {
             reinterpret_cast<cDataReceiver*>(*it)->Mute();
+            for (std::map<std::string, cBundleReceiver*>::iterator itBundle = m_mapBundleReceivers.begin();
+                itBundle != m_mapBundleReceivers.end(); ++itBundle)
+            {
+                itBundle->second->MuteMember(*it, true);
+            }
             nResult = ERR_NOERROR;
         }
     }
@@ -944,6 +1480,11 @@ fep::Result fep::cTransmissionAdapter::UnmuteSignal(handle_t hSignalHandle)
         if ((*it) == hSignalHandle)
         {
             reinterpret_cast<cDataReceiver*>(*it)->Unmute();
+            for (std::map<std::string, cBundleReceiver*>::iterator itBundle = m_mapBundleReceivers.begin();
+                itBundle != m_mapBundleReceivers.end(); ++itBundle)
+            {
+                itBundle->second->MuteMember(*it, false);
+            }
             nResult = ERR_NOERROR;
         }
     }
@@ -973,25 +1514,33 @@ fep::Result cTransmissionAdapter::RegisterSignal(const tSignal &oSignal,
         {
             if (SD_Output == oSignal.eDirection)
         {
-                cTransmitter* poTransmitter = new cTransmitter();
+                cBundleTransmitter* pBundle = NULL;
+                if (!oSignal.strBundleId.GetValue().empty())
+                {
+                    nResult = GetBundleTransmitter(oSignal, pBundle);
+                }
+                cTransmitter* poTransmitter = fep::isOk(nResult) ? new cTransmitter() : NULL;
                 if ((NULL != poTransmitter))
                 {
                     nResult = poTransmitter->Create(m_poTransmissionDriver,
                         m_pPropertyTree,
                         m_pIncidentInvocationHandler,
-                        oSignal);
+                        oSignal,
+                        pBundle);
 
                     if (fep::isOk(nResult))
                     {
+                        tMutexLockGuard oSignalListGuard(m_oSignalListMutex);
                         m_vecDataTransmitter.push_back(poTransmitter);
                         hSignalHandle = static_cast<void*>(poTransmitter);
                     }
                     else
                     {
                         delete poTransmitter;
+                        ReleaseBundles();
                     }
                 }
-                else
+                else if (fep::isOk(nResult))
                 {
                     nResult = ERR_MEMORY;
                 }
@@ -1007,14 +1556,22 @@ fep::Result cTransmissionAdapter::RegisterSignal(const tSignal &oSignal,
                         &m_oQueueManager,
                         oSignal);
 
+                    if (fep::isOk(nResult) && !oSignal.strBundleId.GetValue().empty())
+                    {
+                        nResult = AddToBundleReceiver(oSignal, poDataReceiver);
+                    }
+
                     if (fep::isOk(nResult))
                     {
+                        tMutexLockGuard oSignalListGuard(m_oSignalListMutex);
+                        poDataReceiver->SetClockService(m_pClockService);
                         m_vecDataReceiver.push_back(poDataReceiver);
                         hSignalHandle = static_cast<void*>(poDataReceiver);
                     }
                     else
                     {
                         delete poDataReceiver;
+                        ReleaseBundles();
                     }
                 }
                 else
@@ -1041,11 +1598,17 @@ fep::Result cTransmissionAdapter::UnregisterSignal(handle_t hSignalHandle)
     fep::Result nResult = ERR_NOT_FOUND;
     if(m_bInitialized)
     {
+        tMutexLockGuard oSignalListGuard(m_oSignalListMutex);
         for(std::vector<cDataReceiver*>::iterator it = m_vecDataReceiver.begin();
             it != m_vecDataReceiver.end(); ++it)
         {
             if(hSignalHandle == static_cast<void*>(*it))
             {
+                for (std::map<std::string, cBundleReceiver*>::iterator itBundle = m_mapBundleReceivers.begin();
+                    itBundle != m_mapBundleReceivers.end(); ++itBundle)
+                {
+                    itBundle->second->RemoveMember(*it);
+                }
                 delete (*it);
                 m_vecDataReceiver.erase(it);
                 nResult = ERR_NOERROR;
@@ -1066,6 +1629,10 @@ fep::Result cTransmissionAdapter::UnregisterSignal(handle_t hSignalHandle)
                 }
             }
         }
+        if(fep::isOk(nResult))
+        {
+            ReleaseBundles();
+        }
     }
     else
     {
@@ -1142,6 +1709,223 @@ fep::Result cTransmissionAdapter::TransmitData(fep::IPreparationDataSample* poPr
     return nResult;
 }
 
+fep::Result cTransmissionAdapter::DispatchToMessageWorker(const std::function<void()>& fnTask)
+{
+    if (!m_pMessageThread)
+    {
+        return ERR_NOT_INITIALISED;
+    }
+    cMessageContainer* pMsgContainer;
+    if (!m_qPreAllocQueue.TryDequeue(pMsgContainer))
+    {
+        return ERR_MEMORY;
+    }
+    pMsgContainer->szSize = 0;
+    pMsgContainer->fnTask = fnTask;
+    m_qReceiveQueue.Enqueue(pMsgContainer);
+    return ERR_NOERROR;
+}
+
+fep::Result cTransmissionAdapter::FlushSignalBundles()
+{
+    fep::Result nResult = ERR_NOERROR;
+    if(m_bInitialized)
+    {
+        if(!m_bGlobalDisabled)
+        {
+            for (std::map<std::string, cBundleTransmitter*>::iterator itBundle = m_mapBundleTransmitters.begin();
+                itBundle != m_mapBundleTransmitters.end(); ++itBundle)
+            {
+                if (fep::isFailed(itBundle->second->Flush()))
+                {
+                    nResult = ERR_FAILED;
+                }
+            }
+        }
+    }
+    else
+    {
+        nResult = ERR_NOT_INITIALISED;
+    }
+    return nResult;
+}
+
+fep::Result cTransmissionAdapter::GetTransportStatistics(std::vector<tTransportStatistics>& vecInputs,
+    std::vector<tTransportStatistics>& vecOutputs)
+{
+    tMutexLockGuard oSignalListGuard(m_oSignalListMutex);
+    vecInputs.resize(m_vecDataReceiver.size());
+    for (size_t nIdx = 0; nIdx < m_vecDataReceiver.size(); ++nIdx)
+    {
+        m_vecDataReceiver[nIdx]->GetStatistics(vecInputs[nIdx]);
+    }
+    vecOutputs.resize(m_vecDataTransmitter.size());
+    for (size_t nIdx = 0; nIdx < m_vecDataTransmitter.size(); ++nIdx)
+    {
+        m_vecDataTransmitter[nIdx]->GetStatistics(vecOutputs[nIdx]);
+    }
+    return ERR_NOERROR;
+}
+
+void cTransmissionAdapter::ResetLatencyStatistics()
+{
+    tMutexLockGuard oSignalListGuard(m_oSignalListMutex);
+    for (std::vector<cDataReceiver*>::iterator it = m_vecDataReceiver.begin();
+        it != m_vecDataReceiver.end(); ++it)
+    {
+        (*it)->ResetLatencyStatistics();
+    }
+}
+
+void cTransmissionAdapter::SetClockService(IClockService* pClockService)
+{
+    tMutexLockGuard oSignalListGuard(m_oSignalListMutex);
+    m_pClockService = pClockService;
+    for (std::vector<cDataReceiver*>::iterator it = m_vecDataReceiver.begin();
+        it != m_vecDataReceiver.end(); ++it)
+    {
+        (*it)->SetClockService(pClockService);
+    }
+}
+
+/// Writes a single transport counter into the property tree
+static fep::Result MirrorCounter(fep::IPropertyTree* pPropertyTree, const std::string& strSignalPath,
+    const char* strCounter, uint64_t nValue)
+{
+    // int32 properties would overflow, doubles are exact up to 2^53
+    return pPropertyTree->SetPropertyValue((strSignalPath + strCounter).c_str(),
+        static_cast<double>(nValue));
+}
+
+fep::Result cTransmissionAdapter::MirrorTransportStatistics()
+{
+    if (NULL == m_pPropertyTree)
+    {
+        return ERR_NOT_INITIALISED;
+    }
+    std::vector<tTransportStatistics> vecInputs;
+    std::vector<tTransportStatistics> vecOutputs;
+    fep::Result nResult = GetTransportStatistics(vecInputs, vecOutputs);
+
+    for (std::vector<tTransportStatistics>::const_iterator it = vecInputs.begin();
+        fep::isOk(nResult) && it != vecInputs.end(); ++it)
+    {
+        const std::string strPath = a_util::strings::format("%s.Input.%s.",
+            fep::component_config::g_strTxAdapterPath_Statistics, it->strSignalName.c_str());
+        nResult = MirrorCounter(m_pPropertyTree, strPath, "nSamples", it->nSamples);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nBytes", it->nBytes);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nDroppedSamples", it->nDroppedSamples);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nQueueOverflows", it->nQueueOverflows);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nConflatedSamples", it->nConflatedSamples);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nDefragmentationLosses", it->nDefragmentationLosses);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nQueueHighWaterMark", it->nQueueHighWaterMark);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nDecodeTimeTotal_ns", it->nCodecTimeTotal_ns);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nDecodeTimeMax_ns", it->nCodecTimeMax_ns);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nSequenceGaps", it->nSequenceGaps);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nLatencyP50_us", it->oLatency_us.nP50);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nLatencyP99_us", it->oLatency_us.nP99);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nLatencyMax_us", it->oLatency_us.nMax);
+    }
+    for (std::vector<tTransportStatistics>::const_iterator it = vecOutputs.begin();
+        fep::isOk(nResult) && it != vecOutputs.end(); ++it)
+    {
+        const std::string strPath = a_util::strings::format("%s.Output.%s.",
+            fep::component_config::g_strTxAdapterPath_Statistics, it->strSignalName.c_str());
+        nResult = MirrorCounter(m_pPropertyTree, strPath, "nSamples", it->nSamples);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nBytes", it->nBytes);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nFailedTransmissions", it->nFailedTransmissions);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nEncodeTimeTotal_ns", it->nCodecTimeTotal_ns);
+        nResult |= MirrorCounter(m_pPropertyTree, strPath, "nEncodeTimeMax_ns", it->nCodecTimeMax_ns);
+    }
+    return nResult;
+}
+
+fep::Result cTransmissionAdapter::GetBundleTransmitter(const tSignal& oSignal, cBundleTransmitter*& pBundle)
+{
+    fep::Result nResult = ERR_NOERROR;
+    const std::string strBundleId = oSignal.strBundleId.GetValue();
+    std::map<std::string, cBundleTransmitter*>::iterator itBundle = m_mapBundleTransmitters.find(strBundleId);
+    if (itBundle != m_mapBundleTransmitters.end())
+    {
+        pBundle = itBundle->second;
+    }
+    else
+    {
+        pBundle = new cBundleTransmitter();
+        nResult = pBundle->Create(m_poTransmissionDriver, m_pIncidentInvocationHandler, oSignal);
+        if (fep::isOk(nResult))
+        {
+            m_mapBundleTransmitters[strBundleId] = pBundle;
+        }
+        else
+        {
+            delete pBundle;
+            pBundle = NULL;
+        }
+    }
+    return nResult;
+}
+
+fep::Result cTransmissionAdapter::AddToBundleReceiver(const tSignal& oSignal, cDataReceiver* pReceiver)
+{
+    fep::Result nResult = ERR_NOERROR;
+    const std::string strBundleId = oSignal.strBundleId.GetValue();
+    cBundleReceiver* pBundle = NULL;
+    std::map<std::string, cBundleReceiver*>::iterator itBundle = m_mapBundleReceivers.find(strBundleId);
+    if (itBundle != m_mapBundleReceivers.end())
+    {
+        pBundle = itBundle->second;
+    }
+    else
+    {
+        pBundle = new cBundleReceiver();
+        nResult = pBundle->Create(m_poTransmissionDriver, m_pIncidentInvocationHandler, oSignal);
+        if (fep::isOk(nResult))
+        {
+            m_mapBundleReceivers[strBundleId] = pBundle;
+        }
+        else
+        {
+            delete pBundle;
+        }
+    }
+    if (fep::isOk(nResult))
+    {
+        nResult = pBundle->AddMember(oSignal.strSignalName, pReceiver);
+    }
+    return nResult;
+}
+
+void cTransmissionAdapter::ReleaseBundles()
+{
+    for (std::map<std::string, cBundleTransmitter*>::iterator itBundle = m_mapBundleTransmitters.begin();
+        itBundle != m_mapBundleTransmitters.end();)
+    {
+        if (itBundle->second->IsEmpty())
+        {
+            delete itBundle->second;
+            m_mapBundleTransmitters.erase(itBundle++);
+        }
+        else
+        {
+            ++itBundle;
+        }
+    }
+    for (std::map<std::string, cBundleReceiver*>::iterator itBundle = m_mapBundleReceivers.begin();
+        itBundle != m_mapBundleReceivers.end();)
+    {
+        if (itBundle->second->IsEmpty())
+        {
+            delete itBundle->second;
+            m_mapBundleReceivers.erase(itBundle++);
+        }
+        else
+        {
+            ++itBundle;
+        }
+    }
+}
+
 fep::Result cTransmissionAdapter::TransmitCommand(ICommand* poCommand)
 {
     return TransmitMessage(poCommand);
@@ -1149,6 +1933,11 @@ fep::Result cTransmissionAdapter::TransmitCommand(ICommand* poCommand)
 
 fep::Result cTransmissionAdapter::TransmitNotification(INotification const * pNotification)
 {
+    if (m_bInitialized && dynamic_cast<INameChangedNotification const *>(pNotification))
+    {
+        // the participant was renamed, its inbox has to follow
+        UpdateInbox(pNotification->GetSender());
+    }
     return TransmitMessage(pNotification);
 }
 
@@ -1157,8 +1946,32 @@ fep::Result cTransmissionAdapter::TransmitMessage(IMessage const *pMessage)
     fep::Result nResult = ERR_NOERROR;
     if(m_bInitialized)
     {
-        const char *strMessage = pMessage->ToString();
-        size_t szMsgLength  = a_util::strings::getLength(strMessage);
+        const void* pData = NULL;
+        size_t szMsgLength = 0;
+        size_t szSize = 0;
+        std::vector<uint8_t> vecBinary;
+        std::string strWithoutInbox;
+        if (IsBinaryReceiver(pMessage->GetReceiver())
+            && fep::isOk(cMessageBinaryCodec::Encode(pMessage, vecBinary)))
+        {
+            pData = vecBinary.data();
+            szMsgLength = vecBinary.size();
+            szSize = szMsgLength;
+        }
+        else
+        {
+            // messages without binary encoding are sent as JSON including the terminating zero
+            const char *strMessage = pMessage->ToString();
+            if (!m_bInboxOpen)
+            {
+                // the others must not send to an inbox nobody listens on
+                strWithoutInbox = RemoveInboxRouting(strMessage);
+                strMessage = strWithoutInbox.c_str();
+            }
+            pData = strMessage;
+            szMsgLength = a_util::strings::getLength(strMessage);
+            szSize = szMsgLength + 1;
+        }
         if (s_nMessageStringLength < szMsgLength)
         {
             INVOKE_INCIDENT(m_pIncidentInvocationHandler,
@@ -1169,7 +1982,7 @@ fep::Result cTransmissionAdapter::TransmitMessage(IMessage const *pMessage)
 
         if(fep::isOk(nResult))
         {
-            nResult = m_pMessageTransmitter->Transmit(static_cast<const void *>(strMessage), szMsgLength+1);
+            nResult = TransmitToReceiver(pMessage->GetReceiver(), pData, szSize);
 
             if(fep::isOk(nResult))
             {
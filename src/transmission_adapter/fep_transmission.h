@@ -18,8 +18,12 @@
 #ifndef _FEP_TRANSMISSION_H_
 #define _FEP_TRANSMISSION_H_
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -42,20 +46,26 @@
 #include "transmission_adapter/fep_options_factory.h"
 #include "transmission_adapter/fep_signal_options.h"
 #include "transmission_adapter/fep_transmission_adapter_intf.h"
+#include "transmission_adapter/fep_transport_statistics.h"
 
 namespace fep
 {
+    class IClockService;
     class ICommand;
     class IIncidentInvocationHandler;
     class IMessage;
+    class INameChangedNotification;
     class INotification;
     class INotificationListener;
     class IPreparationDataListener;
     class IPreparationDataSample;
     class IPropertyTree;
     class IReceive;
+    class IStateNotification;
     class ITransmissionDriver;
     class ITransmit;
+    class cBundleReceiver;
+    class cBundleTransmitter;
     class cDataReceiver;
     class cTransmitter;
     struct tSignal;
@@ -92,6 +102,32 @@ namespace fep
         virtual fep::Result RegisterCommandListener(ICommandListener* const poCommandListener) =0;
         /// @copydoc ICommandAccess::UnregisterCommandListener
         virtual fep::Result UnregisterCommandListener(ICommandListener* const poCommandListener) =0;
+
+    public:
+        /**
+         * Transmits the samples of all bundled signals that are still waiting for the
+         * rest of their bundle (see \ref cUserSignalOptions::SetBundleId).
+         * @return Standard Error Code
+         */
+        virtual fep::Result FlushSignalBundles()
+        {
+            return ERR_NOERROR;
+        }
+
+        /**
+         * Runs a task on the message worker thread, in order with the received messages.
+         * The command listeners are called by the same thread, so the task never runs
+         * concurrently to them. A task that is not run (the message channel is destroyed
+         * first) is destroyed only.
+         * @param [in] fnTask The task
+         * @retval ERR_NOERROR The task is queued
+         * @retval ERR_NOT_INITIALISED There is no message worker thread
+         * @retval ERR_MEMORY All message buffers are in use, the task is dropped
+         */
+        virtual fep::Result DispatchToMessageWorker(const std::function<void()>& fnTask)
+        {
+            return ERR_NOT_SUPPORTED;
+        }
     };
 
     /**
@@ -153,6 +189,10 @@ namespace fep
         fep::Result MuteSignal(handle_t hSignalHandle);
         /// @copydoc IPreparationDataAccess::UnmuteSignal
         fep::Result UnmuteSignal(handle_t hSignalHandle);
+        /// @copydoc ITransmissionAdapterPrivate::FlushSignalBundles
+        fep::Result FlushSignalBundles();
+        /// @copydoc ITransmissionAdapterPrivate::DispatchToMessageWorker
+        fep::Result DispatchToMessageWorker(const std::function<void()>& fnTask);
 
 
     public:
@@ -163,6 +203,32 @@ namespace fep
         fep::Result Update(char const * strMessage);
 
     private:
+        /// Provides a binary encoded message (see cMessageBinaryCodec) to the listeners
+        fep::Result UpdateBinary(const void* pMessage, size_t szSize);
+        /// Records the capabilities (tPeerCapability) a participant announced, only the
+        /// capabilities in nMask are changed
+        void SetPeerCapabilities(const std::string& strParticipant, uint8_t nMask, uint8_t nCapabilities);
+        /// Checks whether a participant announced the given capability
+        bool HasPeerCapability(const char* strParticipant, uint8_t nCapability);
+        /// Checks whether a message to the given receiver is sent binary
+        bool IsBinaryReceiver(const char* strReceiver);
+        /// Transmits a message to the inbox of the given receiver if it has one, to the
+        /// broadcast channel otherwise
+        fep::Result TransmitToReceiver(const char* strReceiver, const void* pData, size_t szSize);
+        /// Creates the transmitter to the inbox of another participant
+        void CreateInboxTransmitter(const std::string& strParticipant);
+        /// Forgets the capabilities of a participant and destroys the transmitter to its inbox
+        void RemovePeer(const std::string& strParticipant);
+        /// Removes a participant shutting down from the peers
+        void UpdatePeers(IStateNotification const * pNotification);
+        /// Removes the old name of a renamed participant from the peers
+        void UpdatePeers(INameChangedNotification const * pNotification);
+        /// Creates the inbox of the participant, an existing inbox is replaced if the
+        /// participant was renamed since. The inbox is only announced if this succeeded.
+        fep::Result UpdateInbox(const char* strModuleName);
+        /// Destroys the inbox of the participant and the transmitters to the inboxes of others
+        void DestroyInboxes();
+
         /// This method template provides a command of type \c T to all registered listeners
         template <typename T>
         fep::Result ProvideCommand(T const * pCommand);
@@ -176,6 +242,36 @@ namespace fep
         fep::Result Enable();
         /// Disable Transrmission
         fep::Result Disable();
+
+    public:
+        /**
+        * \brief GetTransportStatistics Takes a snapshot of the transport counters of all
+        * registered signals
+        * @param [out] vecInputs Statistics of the input signals
+        * @param [out] vecOutputs Statistics of the output signals
+        * @returns Standard Error Code
+        */
+        fep::Result GetTransportStatistics(std::vector<tTransportStatistics>& vecInputs,
+            std::vector<tTransportStatistics>& vecOutputs);
+        /**
+        * \brief MirrorTransportStatistics Writes the transport counters of all registered signals
+        * into the property tree (see \ref FEP_TX_ADAPTER_STATISTICS_PATH). The message worker
+        * thread does so periodically if \ref FEP_TX_ADAPTER_STATISTICS_MIRROR_PERIOD_PATH is set.
+        * @returns Standard Error Code
+        */
+        fep::Result MirrorTransportStatistics();
+        /**
+        * \brief ResetLatencyStatistics Discards the latencies and sequence gaps collected for
+        * all input signals. Called whenever the adapter is enabled.
+        */
+        void ResetLatencyStatistics();
+        /**
+        * \brief SetClockService Sets the clock the latency of the input signals is measured
+        * with in simulation time
+        * @param [in] pClockService The clock service, NULL to stop measuring (the clock service
+        *                           has to stay valid until it is replaced)
+        */
+        void SetClockService(IClockService* pClockService);
     private:
         /// Transfer driver options from cModuleOptions to cDriverOptions
         fep::Result GatherDriverOptions();
@@ -202,6 +298,24 @@ namespace fep
         * @returns list of network interfaces
         */
         std::string GetNetworkInterfaceList();
+        /**
+        * \brief GetBundleTransmitter Returns the bundle of an output signal, the bundle is created if needed
+        * @param [in] oSignal Struct describing the signal
+        * @param [out] pBundle The bundle
+        * @returns Standard Error Code
+        */
+        fep::Result GetBundleTransmitter(const tSignal& oSignal, cBundleTransmitter*& pBundle);
+        /**
+        * \brief AddToBundleReceiver Adds an input signal to its bundle, the bundle is created if needed
+        * @param [in] oSignal Struct describing the signal
+        * @param [in] pReceiver Receiver of the signal
+        * @returns Standard Error Code
+        */
+        fep::Result AddToBundleReceiver(const tSignal& oSignal, cDataReceiver* pReceiver);
+        /**
+        * \brief ReleaseBundles Destroys the bundles without members
+        */
+        void ReleaseBundles();
 
     public:
         /// The pointer to the queue manager
@@ -216,6 +330,33 @@ namespace fep
         typedef a_util::concurrency::recursive_mutex tMutex;
         /// Typedef forlock guard
         typedef a_util::concurrency::unique_lock<tMutex> tMutexLockGuard;
+        /// Encodings of the sent messages, see \ref FEP_TX_ADAPTER_MESSAGE_ENCODING_PATH
+        enum tMessageEncoding
+        {
+            ME_Json,
+            ME_Negotiated,
+            ME_Binary
+        };
+        /// Capabilities of other participants, announced in the header of their messages
+        enum tPeerCapability
+        {
+            /// The participant decodes binary messages (see cMessageBinaryCodec)
+            PC_Binary = 0x01,
+            /// The participant listens on its inbox (see cMessageRouting)
+            PC_Inbox = 0x02
+        };
+        /// Transmitter to the inbox of another participant
+        struct tInboxTransmitter
+        {
+            /// The transmitter
+            ITransmit* pTransmitter;
+            /// Point in time the driver is expected to have connected the transmitter
+            std::chrono::steady_clock::time_point tmUsable;
+        };
+        /// Typedef for the transmitters to the inboxes, by participant
+        typedef std::map<std::string, tInboxTransmitter> tInboxTransmitters;
+        /// Provides decoded binary messages to the listeners of the adapter
+        class cBinaryMessageDispatcher;
 
     private:
         /// The status listeners.
@@ -226,6 +367,30 @@ namespace fep
         tMutex m_oContForkMutex;
         /// Mutex to guard the adapter during destruction (all callbacks must have returned)
         tMutex m_oAdapterMutex;
+        /// Mutex to guard the receiver and transmitter lists against concurrent statistics queries
+        tMutex m_oSignalListMutex;
+        /// Clock the latency of the input signals is measured with (guarded by m_oSignalListMutex)
+        IClockService* m_pClockService;
+        /// Period the transport statistics are mirrored into the property tree with (0: disabled)
+        std::atomic<int32_t> m_nStatisticsMirrorPeriod_ms;
+        /// Encoding of the sent messages (a tMessageEncoding)
+        std::atomic<int32_t> m_nMessageEncoding;
+        /// Mutex to guard the capabilities of the other participants
+        std::mutex m_oPeersMutex;
+        /// Capabilities (tPeerCapability) the other participants announced
+        std::map<std::string, uint8_t> m_mapPeerCapabilities;
+        /// Switch to send addressed messages to the inbox of the receiver
+        std::atomic<bool> m_bMessageInbox;
+        /// Mutex to guard the inboxes
+        std::mutex m_oInboxMutex;
+        /// Receiver of the inbox of the participant
+        IReceive* m_pInboxReceiver;
+        /// Name of the participant the inbox was created for
+        std::string m_strInboxName;
+        /// Flag indicating that the inbox is open, the sent messages announce it only then
+        std::atomic<bool> m_bInboxOpen;
+        /// Transmitters to the inboxes of other participants
+        tInboxTransmitters m_mapInboxTransmitters;
         /// ModuleOptions
         cModuleOptions m_oModuleOptions;
         ///Transmission Driver <- The thing doing the actual work
@@ -258,6 +423,10 @@ namespace fep
         std::vector<cDataReceiver*> m_vecDataReceiver;
         //Transmitter Map
         std::vector<cTransmitter*> m_vecDataTransmitter;
+        /// Bundles of output signals by bundle id
+        std::map<std::string, cBundleTransmitter*> m_mapBundleTransmitters;
+        /// Bundles of input signals by bundle id
+        std::map<std::string, cBundleReceiver*> m_mapBundleReceivers;
         ///Flag indicating that an internal driver is used
         bool m_bInternalDriver;
         /// Flag indicating that transmission adapter is initialized
@@ -37,6 +37,11 @@ char const * fep::cFEPTransmissionType::ToString(const fep::eFEPTransmissionType
 #ifdef WITH_ZYRE
         ENUM_TRANSMISSION_TYPE_CASE(ZMQ);
 #endif
+#ifdef __linux__
+        ENUM_TRANSMISSION_TYPE_CASE(SHM);
+        ENUM_TRANSMISSION_TYPE_CASE(UDP);
+#endif
+        ENUM_TRANSMISSION_TYPE_CASE(INPROC);
     }
     return 0;
 }
@@ -56,6 +61,11 @@ fep::Result fep::cFEPTransmissionType::FromString(char const * strTransmissionTy
 #ifdef WITH_ZYRE
         ENUM_TRANSMISSION_TYPE_FROM_STRING_COMPARE(ZMQ);
 #endif
+#ifdef __linux__
+        ENUM_TRANSMISSION_TYPE_FROM_STRING_COMPARE(SHM);
+        ENUM_TRANSMISSION_TYPE_FROM_STRING_COMPARE(UDP);
+#endif
+        ENUM_TRANSMISSION_TYPE_FROM_STRING_COMPARE(INPROC);
         if (a_util::strings::isEqual(strTransmissionType, s_strDefaultString))
         {
             eTransmissionType= eDefaultTransmissionType;
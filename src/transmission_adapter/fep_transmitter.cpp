@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <memory>
 #include <mutex>
+#include <utility>
 #include <a_util/concurrency/fast_mutex.h>
 #include <a_util/memory/memory.h>
 #include <a_util/result/result_type.h>
@@ -40,10 +41,13 @@
 #include "incident_handler/fep_incident_codes.h"
 #include "incident_handler/fep_incident_handler.h"
 #include "incident_handler/fep_severity_level.h"
+#include "perfmeasure/fep_trace.h"
 #include "signal_registry/fep_signal_struct.h"
+#include "transmission_adapter/fep_delta_codec.h"
 #include "transmission_adapter/fep_options_factory.h"
 #include "transmission_adapter/fep_preparation_data_sample_intf.h"
 #include "transmission_adapter/fep_serialization_helpers.h"
+#include "transmission_adapter/fep_signal_bundle.h"
 #include "transmission_adapter/fep_signal_serialization.h"
 #include "transmission_adapter/fep_transmission_driver_intf.h"
 #include "transmission_adapter/fep_transmit_intf.h"
@@ -58,10 +62,21 @@ a_util::concurrency::fast_mutex cTransmitter::ms_oStaticDDLSync;
 
 cTransmitter::cTransmitter():
     m_pSendSample{ 0, nullptr },
+    m_pSendBufferPool(std::make_shared<tSendBufferPool>()),
     m_pDriver(NULL),
     m_pDriverTransmitter(NULL),
+    m_pBundle(NULL),
+    m_nBundleSlot(0),
+    m_bMuted(false),
     m_bDisableDdlSerialization(false),
     m_bRaw(false),
+    m_nDeltaKeyframeInterval(0),
+    m_nSamplesSinceKeyframe(0),
+    m_nSequence(0),
+    m_szLatencyStampSize(0),
+    m_nTransmittedSamples(0),
+    m_nTransmittedBytes(0),
+    m_nFailedTransmissions(0),
     m_szSignalSize(0),
     m_pPropertyTreePrivate(NULL),
     m_pIncidentInvocationHandler(NULL)
@@ -82,12 +97,17 @@ cTransmitter::~cTransmitter()
     {
         m_pDriver->DestroyTransmitter(m_pDriverTransmitter);
     }
+    if (NULL != m_pBundle)
+    {
+        m_pBundle->RemoveMember(m_nBundleSlot);
+    }
 }
 
 fep::Result cTransmitter::Create(ITransmissionDriver* pDriver,
     fep::IPropertyTree* pPropertyTreePrivate,
     fep::IIncidentInvocationHandler* pIncidentInvocationHandler,
-    const tSignal& oSignal)
+    const tSignal& oSignal,
+    cBundleTransmitter* pBundle)
 {
     if (!pPropertyTreePrivate || !pIncidentInvocationHandler)
     { 
@@ -102,6 +122,11 @@ fep::Result cTransmitter::Create(ITransmissionDriver* pDriver,
     m_strSignalName = oSignal.strSignalName;
     m_bDisableDdlSerialization = (oSignal.eSerialization == fep::SER_Raw);
     m_bRaw = oSignal.bIsRaw.GetValue();
+    // bundle entries carry no delta sequence - bundled signals are always sent completely
+    m_nDeltaKeyframeInterval = (NULL == pBundle) ? oSignal.nDeltaKeyframeInterval.GetValue() : 0;
+    // bundle entries have no room for the stamp either
+    m_szLatencyStampSize = (NULL == pBundle && oSignal.bLatencyStamp.GetValue())
+        ? header::s_szLatencyStampSize : 0;
     m_szSignalSize = oSignal.szSampleSize;
     if (0 == m_szSignalSize)
     {
@@ -119,7 +144,7 @@ fep::Result cTransmitter::Create(ITransmissionDriver* pDriver,
     {
 
         m_pSendSample.szSize = sizeof(cFepDataHeader) + m_szSignalSize;
-        m_pSendSample.pData = malloc(m_pSendSample.szSize);
+        m_pSendSample.pData = malloc(m_pSendSample.szSize + m_szLatencyStampSize);
         if (NULL == m_pSendSample.pData)
         {
             nResult = ERR_MEMORY;
@@ -151,12 +176,29 @@ fep::Result cTransmitter::Create(ITransmissionDriver* pDriver,
 
             m_oCodecFactory = ddl::CodecFactory(oSignal.strSignalType.c_str(), oDDLPrinter.getXML().c_str());
             nResult = m_oCodecFactory.isValid().getErrorCode();
+            if (fep::isOk(nResult))
+            {
+                // types the plan cannot handle are serialized by the generic codec
+                m_oCodecPlan.Create(m_oCodecFactory, pDescription->getStructByName(oSignal.strSignalType));
+            }
 
             oImporter.destroyDDL();
         }
         if (fep::isOk(nResult))
         {
-            nResult = m_pDriver->CreateTransmitter(m_pDriverTransmitter, m_oSignalOptions);
+            if (NULL != pBundle)
+            {
+                // the bundle owns the driver transmitter
+                nResult = pBundle->AddMember(m_strSignalName, m_nBundleSlot);
+                if (fep::isOk(nResult))
+                {
+                    m_pBundle = pBundle;
+                }
+            }
+            else
+            {
+                nResult = m_pDriver->CreateTransmitter(m_pDriverTransmitter, m_oSignalOptions);
+            }
         }
     }
     return nResult;
@@ -164,16 +206,22 @@ fep::Result cTransmitter::Create(ITransmissionDriver* pDriver,
 
 fep::Result cTransmitter::TransmitData(IPreparationDataSample const * pSample)
 {
+    FEP_TRACE_SPAN("TransmitSample", "transmission");
     fep::Result nResult = ERR_NOERROR;
     nResult = FillFepDataHeader(pSample);
 
     a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxTransmission);      
 
+    const cCodecTimeCounter::tClock::time_point tmEncodeStart = cCodecTimeCounter::tClock::now();
     if(false == m_bDisableDdlSerialization)
     {
-        ddl::Decoder oDec =
-            m_oCodecFactory.makeDecoderFor(pSample->GetPtr(), pSample->GetSize());
-        ddl::serialization::transform_to_buffer(oDec, m_oSerializedSample);
+        if (!m_oCodecPlan.IsValid() || fep::isFailed(m_oCodecPlan.Serialize(pSample->GetPtr(),
+            pSample->GetSize(), m_oSerializedSample.getPtr(), m_oSerializedSample.getSize())))
+        {
+            ddl::Decoder oDec =
+                m_oCodecFactory.makeDecoderFor(pSample->GetPtr(), pSample->GetSize());
+            ddl::serialization::transform_to_buffer(oDec, m_oSerializedSample);
+        }
     }
     else
     {
@@ -182,10 +230,65 @@ fep::Result cTransmitter::TransmitData(IPreparationDataSample const * pSample)
             pSample->GetPtr(), pSample->GetSize());
     }
 
-    if(fep::isOk(nResult))
+    if (fep::isOk(nResult) && NULL != m_pBundle)
+    {
+        m_oEncodeTime.Add(tmEncodeStart);
+        // muted members are left out of the bundle
+        if (!m_bMuted)
+        {
+            if (fep::isOk(m_pBundle->Append(m_nBundleSlot, m_pSendSample.pData, m_pSendSample.szSize)))
+            {
+                m_nTransmittedSamples.fetch_add(1, std::memory_order_relaxed);
+                m_nTransmittedBytes.fetch_add(m_pSendSample.szSize, std::memory_order_relaxed);
+            }
+            else
+            {
+                m_nFailedTransmissions.fetch_add(1, std::memory_order_relaxed);
+                INVOKE_INCIDENT(m_pIncidentInvocationHandler,
+                    fep::FSI_TRANSM_DATA_TX_FAILED,
+                    fep::SL_Critical_Local, a_util::strings::format(
+                    "Failed to bundle data (Instance %s::%s)",
+                    GetModuleName(), m_strSignalName.c_str()).c_str());
+                nResult = ERR_FAILED;
+            }
+        }
+    }
+    else if(fep::isOk(nResult))
     {
-        if (fep::isFailed(m_pDriverTransmitter->Transmit(static_cast<void*>(m_pSendSample.pData),m_pSendSample.szSize)))
+        if (!m_bMuted)
+        {
+            // the muted driver transmitter drops the sample, so it does not count as gap
+            m_nSequence = header::NextSequence(m_nSequence);
+            reinterpret_cast<cFepDataHeader*>(m_pSendSample.pData)->m_nSequence = m_nSequence;
+        }
+        size_t szTransmitSize = m_pSendSample.szSize;
+        if (0 != m_nDeltaKeyframeInterval)
+        {
+            szTransmitSize = DeltaEncodeSendSample();
+        }
+        m_oEncodeTime.Add(tmEncodeStart);
+        if (0 != m_szLatencyStampSize)
+        {
+            // stamped as late as possible, the buffer has room for the stamp behind the sample
+            const int64_t nStamp = GetWallClockStamp();
+            a_util::memory::copy(static_cast<uint8_t*>(m_pSendSample.pData) + szTransmitSize,
+                m_szLatencyStampSize, &nStamp, sizeof(nStamp));
+            szTransmitSize += m_szLatencyStampSize;
+        }
+        if (fep::isOk(TransmitSendSample(szTransmitSize)))
         {
+            // the muted driver transmitter drops the sample
+            if (!m_bMuted)
+            {
+                m_nTransmittedSamples.fetch_add(1, std::memory_order_relaxed);
+                m_nTransmittedBytes.fetch_add(szTransmitSize, std::memory_order_relaxed);
+            }
+        }
+        else
+        {
+            m_nFailedTransmissions.fetch_add(1, std::memory_order_relaxed);
+            // the receivers will miss this sample, so the next one has to be a keyframe
+            m_vecDeltaReference.clear();
             INVOKE_INCIDENT(m_pIncidentInvocationHandler,
                 fep::FSI_TRANSM_DATA_TX_FAILED,
                 fep::SL_Critical_Local, a_util::strings::format(
@@ -197,6 +300,94 @@ fep::Result cTransmitter::TransmitData(IPreparationDataSample const * pSample)
     return nResult;
 }
 
+void cTransmitter::GetStatistics(tTransportStatistics& oStatistics) const
+{
+    oStatistics.strSignalName = m_strSignalName;
+    oStatistics.nSamples = m_nTransmittedSamples.load(std::memory_order_relaxed);
+    oStatistics.nBytes = m_nTransmittedBytes.load(std::memory_order_relaxed);
+    oStatistics.nDroppedSamples = 0;
+    oStatistics.nQueueOverflows = 0;
+    oStatistics.nConflatedSamples = 0;
+    oStatistics.nDefragmentationLosses = 0;
+    oStatistics.nQueueHighWaterMark = 0;
+    oStatistics.nFailedTransmissions = m_nFailedTransmissions.load(std::memory_order_relaxed);
+    oStatistics.nCodecTimeTotal_ns = m_oEncodeTime.GetTotal();
+    oStatistics.nCodecTimeMax_ns = m_oEncodeTime.GetMax();
+}
+
+size_t cTransmitter::DeltaEncodeSendSample()
+{
+    const size_t szPayload = m_pSendSample.szSize - sizeof(cFepDataHeader);
+    uint8_t* pPayload = static_cast<uint8_t*>(m_pSendSample.pData) + sizeof(cFepDataHeader);
+    cFepDataHeader* pFepDataHeader = reinterpret_cast<cFepDataHeader*>(m_pSendSample.pData);
+
+    if (m_bMuted)
+    {
+        // the driver drops the sample, start over with a keyframe once unmuted
+        m_vecDeltaReference.clear();
+        return m_pSendSample.szSize;
+    }
+
+    size_t szDelta = 0;
+    bool bDelta = false;
+    if (0 != szPayload && m_vecDeltaReference.size() == szPayload
+        && m_nSamplesSinceKeyframe < m_nDeltaKeyframeInterval)
+    {
+        // a delta is only worth it if it is smaller than the sample
+        m_vecDeltaBuffer.resize(szPayload - 1);
+        bDelta = delta::EncodeDelta(m_vecDeltaReference.data(), pPayload, szPayload,
+            m_vecDeltaBuffer.data(), m_vecDeltaBuffer.size(), szDelta);
+    }
+    else
+    {
+        m_vecDeltaReference.assign(pPayload, pPayload + szPayload);
+    }
+
+    if (bDelta)
+    {
+        a_util::memory::copy(pPayload, szPayload, m_vecDeltaBuffer.data(), szDelta);
+        pFepDataHeader->m_nSerAndByteOrderFlags |= header::DELTA_ENCODED;
+        ++m_nSamplesSinceKeyframe;
+        return sizeof(cFepDataHeader) + szDelta;
+    }
+    pFepDataHeader->m_nSerAndByteOrderFlags |= header::DELTA_KEYFRAME;
+    m_nSamplesSinceKeyframe = 1;
+    return m_pSendSample.szSize;
+}
+
+fep::Result cTransmitter::TransmitSendSample(size_t szSize)
+{
+    // the next sample needs a buffer of the same size while this one is lent
+    tSendBufferPool::tLent* pSpare = tSendBufferPool::Lend(m_pSendBufferPool);
+    if (NULL != pSpare && pSpare->oValue.oData.szSize != m_pSendSample.szSize)
+    {
+        sDataContainer& oSpare = pSpare->oValue.oData;
+        ::free(oSpare.pData);
+        oSpare.pData = malloc(m_pSendSample.szSize + m_szLatencyStampSize);
+        oSpare.szSize = (NULL == oSpare.pData) ? 0 : m_pSendSample.szSize;
+    }
+    if (NULL == pSpare || NULL == pSpare->oValue.oData.pData)
+    {
+        // out of memory, the driver has to copy the sample
+        if (NULL != pSpare)
+        {
+            tSendBufferPool::Release(pSpare);
+        }
+        return m_pDriverTransmitter->Transmit(static_cast<void*>(m_pSendSample.pData), szSize);
+    }
+
+    std::swap(pSpare->oValue.oData, m_pSendSample);
+    m_oSerializedSample.attach(static_cast<char *>(m_pSendSample.pData) + sizeof(cFepDataHeader),
+        m_pSendSample.szSize - sizeof(cFepDataHeader));
+    return m_pDriverTransmitter->TransmitZeroCopy(pSpare->oValue.oData.pData, szSize,
+        &tSendBufferPool::Release, pSpare);
+}
+
+cTransmitter::tSendBuffer::~tSendBuffer()
+{
+    ::free(oData.pData);
+}
+
 fep::Result cTransmitter::FillFepDataHeader(IPreparationDataSample const * pSample)
 {
     fep::Result nResult = ERR_NOERROR;
@@ -208,7 +399,8 @@ fep::Result cTransmitter::FillFepDataHeader(IPreparationDataSample const * pSamp
         {
             m_pSendSample.szSize = 0;
             ::free(m_pSendSample.pData);
-            m_pSendSample.pData = malloc(pSample->GetSize() + sizeof(cFepDataHeader));
+            m_pSendSample.pData = malloc(pSample->GetSize() + sizeof(cFepDataHeader)
+                + m_szLatencyStampSize);
             if(NULL == m_pSendSample.pData)
             {
                 nResult = ERR_MEMORY;
@@ -235,6 +427,11 @@ fep::Result cTransmitter::FillFepDataHeader(IPreparationDataSample const * pSamp
         //fill header
         cFepDataHeader* pFepDataHeader = reinterpret_cast<cFepDataHeader*>(m_pSendSample.pData);
         pFepDataHeader->m_nMajorVersion = FEP_SDK_PARTICIPANT_VERSION_MAJOR;
+        if (0 != m_nDeltaKeyframeInterval || 0 != m_szLatencyStampSize)
+        {
+            // older receivers would hand out the deltas or the stamps as part of the samples
+            pFepDataHeader->m_nMajorVersion |= header::s_nExtendedFormatVersionFlag;
+        }
         uint8_t nSerAndByteOrderFlags = 0x00;
         if(true == m_bDisableDdlSerialization)
         {
@@ -245,10 +442,14 @@ fep::Result cTransmitter::FillFepDataHeader(IPreparationDataSample const * pSamp
             nSerAndByteOrderFlags |= header::SERIALIZATION_DDL;
         }
         nSerAndByteOrderFlags |= header::GetLocalSystemByteorder();
+        if (0 != m_szLatencyStampSize)
+        {
+            nSerAndByteOrderFlags |= header::LATENCY_STAMP;
+        }
 
         pFepDataHeader->m_nSerAndByteOrderFlags = nSerAndByteOrderFlags;
         pFepDataHeader->m_nSync= pSample->GetSyncFlag();
-        pFepDataHeader->m_nUnused = 0x00;
+        pFepDataHeader->m_nSequence = 0x00;
         pFepDataHeader->m_nSampleNumber= pSample->GetSampleNumberInFrame();
         pFepDataHeader->m_nFrameId= pSample->GetFrameId();
         pFepDataHeader->m_nSendTimeStamp = pSample->GetTime();
@@ -259,20 +460,39 @@ fep::Result cTransmitter::FillFepDataHeader(IPreparationDataSample const * pSamp
 
 fep::Result cTransmitter::Enable()
 {
+    if (NULL == m_pDriverTransmitter)
+    {
+        // bundled signals are enabled along with their bundle
+        return ERR_NOERROR;
+    }
     return m_pDriverTransmitter->Enable();
 }
 
 fep::Result cTransmitter::Disable()
 {
+    if (NULL == m_pDriverTransmitter)
+    {
+        return ERR_NOERROR;
+    }
     return m_pDriverTransmitter->Disable();
 }
 
 fep::Result cTransmitter::Mute()
 {
+    m_bMuted = true;
+    if (NULL == m_pDriverTransmitter)
+    {
+        return ERR_NOERROR;
+    }
     return m_pDriverTransmitter->Mute();
 }
 fep::Result cTransmitter::Unmute()
 {
+    m_bMuted = false;
+    if (NULL == m_pDriverTransmitter)
+    {
+        return ERR_NOERROR;
+    }
     return m_pDriverTransmitter->Unmute();
 }
 
@@ -290,15 +510,18 @@ fep::Result cTransmitter::GatherSignalOptions(cSignalOptions & oDriverSignalOpti
     // Mandatory Options! (Every Driver must support them)
     // offset in size for data header
     if (!(oDriverSignalOptions.SetOption("SignalName", oSignal.strSignalName)
-        && oDriverSignalOptions.SetOption("SignalSize", m_szSignalSize + sizeof(cFepDataHeader))))
+        && oDriverSignalOptions.SetOption("SignalSize",
+            m_szSignalSize + sizeof(cFepDataHeader) + m_szLatencyStampSize)))
     {
         nResult = ERR_FAILED;
     }
     else //These are QoS-Settings (only signal error when they were actively set)
     {
-        if (!oDriverSignalOptions.SetOption("IsVariableSignalSize", oSignal.bIsRaw.GetValue()))
+        // delta frames are shorter than the signal size
+        const bool bIsVariableSignalSize = oSignal.bIsRaw.GetValue() || 0 != m_nDeltaKeyframeInterval;
+        if (!oDriverSignalOptions.SetOption("IsVariableSignalSize", bIsVariableSignalSize))
         {
-            if (oSignal.bIsRaw.IsSet())
+            if (oSignal.bIsRaw.IsSet() || 0 != m_nDeltaKeyframeInterval)
             {
                 nResult = ERR_NOT_SUPPORTED;
             }
@@ -18,14 +18,21 @@
 #ifndef _FEP_DATA_TRANSMITTER_H_
 #define _FEP_DATA_TRANSMITTER_H_
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 #include <a_util/concurrency/detail/fast_mutex_decl.h>
 #include <a_util/memory/memorybuffer.h>
 #include <codec/codec_factory.h>
 
 #include "fep_result_decl.h"
+#include "transmission_adapter/fep_codec_plan.h"
+#include "transmission_adapter/fep_lending_pool.h"
 #include "transmission_adapter/fep_signal_options.h"
+#include "transmission_adapter/fep_transport_statistics.h"
 
 namespace fep
 {
@@ -34,6 +41,7 @@ namespace fep
     class IPropertyTree;
     class ITransmissionDriver;
     class ITransmit;
+    class cBundleTransmitter;
 
     //\cond nodoc
     struct tSignal;
@@ -75,12 +83,14 @@ namespace fep
          * @param pIncidentInvocationHandler Pointer to incident invocation Handler
          * @param oOptions  Driver Signal Options
          * @param oSignal Struct describing the signal.
+         * @param pBundle Bundle the samples are appended to, NULL to transmit them on their own
          * @return Standard Error Code
          */
         fep::Result Create(ITransmissionDriver* pDriver,
                         fep::IPropertyTree* pPropertyTreePrivate,
                         fep::IIncidentInvocationHandler* pIncidentInvocationHandler,
-                        const tSignal& oSignal);
+                        const tSignal& oSignal,
+                        cBundleTransmitter* pBundle = NULL);
         fep::Result TransmitData(IPreparationDataSample const * pSample);
         /// Enable the transmitter/signal
         fep::Result Enable();
@@ -91,6 +101,12 @@ namespace fep
         ///Unmute the transmitter/signal
         fep::Result Unmute();
 
+        /**
+         * @brief GetStatistics Takes a snapshot of the transport counters of this signal
+         * @param [out] oStatistics The counters
+         */
+        void GetStatistics(tTransportStatistics& oStatistics) const;
+
     private:
 
         ///
@@ -114,14 +130,45 @@ namespace fep
         */
         fep::Result GatherSignalOptions(cSignalOptions & oDriverSignalOptions, const tSignal &oSignal);
 
+        /**
+        * @brief DeltaEncodeSendSample Replaces the payload of the send sample by its delta
+        * against the previous sample if that is smaller and no keyframe is due, and marks the
+        * header accordingly (delta encoding has to be enabled)
+        * @return Number of bytes of the send sample to be transmitted
+        */
+        size_t DeltaEncodeSendSample();
+
+        /**
+        * @brief TransmitSendSample Lends the send sample to the driver transmitter and continues
+        * with a buffer the driver released before
+        * @param szSize Number of bytes of the send sample to be transmitted
+        * @return Standard Error Code
+        */
+        fep::Result TransmitSendSample(size_t szSize);
+
+        /// Send sample lent to the driver transmitter
+        struct tSendBuffer
+        {
+            /// DTOR
+            ~tSendBuffer();
+            /// The lent sample
+            sDataContainer oData = { 0, nullptr };
+        };
+        /// Pool of the send samples that are lent to the driver transmitter
+        typedef cLendingPool<tSendBuffer> tSendBufferPool;
+
     private:
         // Mediadescription handling
         /// DDL Codec Factory
         ddl::CodecFactory m_oCodecFactory;
+        /// Precompiled serialization plan (invalid if the generic codec has to be used)
+        cCodecPlan m_oCodecPlan;
         /// Serialization buffer for serialized sample
         a_util::memory::MemoryBuffer m_oSerializedSample;
         ///Container for the sample to be send
         sDataContainer m_pSendSample;
+        /// Send samples released by the driver transmitter
+        std::shared_ptr<tSendBufferPool> m_pSendBufferPool;
         /// Create() is calling static methods and classes of the OODDL -> libfepcore
         /// is shared code and will be used concurrently, especially when using
         /// ADTF-FEP-Filter-Modules! This is supposed to be guarding this against multiple
@@ -131,12 +178,38 @@ namespace fep
         a_util::concurrency::fast_mutex m_mtxTransmission;
         ///Driver
         ITransmissionDriver* m_pDriver;
-        /// TransmitObject provided by the driver
+        /// TransmitObject provided by the driver (NULL for bundled signals)
         ITransmit* m_pDriverTransmitter;
+        /// Bundle the samples are appended to (NULL if not bundled)
+        cBundleTransmitter* m_pBundle;
+        /// Slot of the signal inside the bundle
+        size_t m_nBundleSlot;
+        /// Flag indicating that the (bundled) signal is muted
+        bool m_bMuted;
         /// Flag showing if DDL serialization is enabled or not
         bool m_bDisableDdlSerialization;
         /// Flag indicating that this is a raw signal without a ddl
         bool m_bRaw;
+        /// Number of samples between two keyframes of the delta encoding (0: disabled)
+        uint32_t m_nDeltaKeyframeInterval;
+        /// Number of samples transmitted since the last keyframe
+        uint32_t m_nSamplesSinceKeyframe;
+        /// Sequence number of the last transmitted sample
+        uint16_t m_nSequence;
+        /// Size of the wall clock stamp appended to each sample (0 if not stamped)
+        size_t m_szLatencyStampSize;
+        /// Payload of the previous sample, the reference of the delta encoding
+        std::vector<uint8_t> m_vecDeltaReference;
+        /// Buffer the delta is encoded into
+        std::vector<uint8_t> m_vecDeltaBuffer;
+        /// Number of transmitted samples (handed to the driver or appended to the bundle)
+        std::atomic<uint64_t> m_nTransmittedSamples;
+        /// Number of transmitted bytes
+        std::atomic<uint64_t> m_nTransmittedBytes;
+        /// Number of samples that could not be transmitted
+        std::atomic<uint64_t> m_nFailedTransmissions;
+        /// Time spent encoding the samples
+        cCodecTimeCounter m_oEncodeTime;
         ///Signal name
         std::string m_strSignalName;
         ///Signal Options
@@ -0,0 +1,137 @@
+/**
+ * Declaration of the transport statistics of signals.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_TRANSPORT_STATISTICS_H_
+#define _FEP_TRANSPORT_STATISTICS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "transmission_adapter/fep_latency_histogram.h"
+
+namespace fep
+{
+    /**
+     * Snapshot of the transport counters of a signal. The counters are collected since the
+     * signal was registered, counters not applicable to the direction of the signal stay 0.
+     * The sequence gaps and latencies are collected since the adapter was enabled last.
+     */
+    struct tTransportStatistics
+    {
+        /// Name of the signal
+        std::string strSignalName;
+        /// Number of transmitted (output) or received (input) samples
+        uint64_t nSamples = 0;
+        /// Number of bytes of these samples (including the FEP data header)
+        uint64_t nBytes = 0;
+        /// Received samples dropped because no free container was left or they were malformed
+        uint64_t nDroppedSamples = 0;
+        /// Received samples rejected by the full receive queue
+        uint64_t nQueueOverflows = 0;
+        /// Received samples discarded unprocessed in favour of a newer one (conflation only)
+        uint64_t nConflatedSamples = 0;
+        /// Samples the driver gave up while reassembling their fragments
+        uint64_t nDefragmentationLosses = 0;
+        /// Highest number of items that were pending in the receive queue at once
+        uint64_t nQueueHighWaterMark = 0;
+        /// Samples the driver failed to transmit
+        uint64_t nFailedTransmissions = 0;
+        /// Total time spent decoding (input) or encoding (output) the samples in ns
+        uint64_t nCodecTimeTotal_ns = 0;
+        /// Longest time spent decoding or encoding a single sample in ns
+        uint64_t nCodecTimeMax_ns = 0;
+        /// Received samples missing in the sequence of the sender (lost or reordered)
+        uint64_t nSequenceGaps = 0;
+        /// Latency of the received samples in simulation time in us (arrival against send time)
+        tLatencySummary oLatency_us;
+        /// Latency of the received samples in ns, measured with the monotonic wall clock
+        /// stamped by the sender (only if the sender stamps its samples)
+        tLatencySummary oWallClockLatency_ns;
+    };
+
+    /**
+     * Reads the monotonic wall clock the senders stamp their samples with
+     * (see header::LATENCY_STAMP). The clock is only comparable between processes of the
+     * same host, latencies of samples from other hosts are meaningless.
+     * @return Time of the steady clock in ns
+     */
+    inline int64_t GetWallClockStamp()
+    {
+        return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * Accumulates the time spent decoding or encoding samples. Measuring costs two reads of
+     * the steady clock, so the counter is always on.
+     */
+    class cCodecTimeCounter
+    {
+    public:
+        /// Clock the time is measured with
+        typedef std::chrono::steady_clock tClock;
+
+    public:
+        /// CTOR
+        cCodecTimeCounter() : m_nTotal(0), m_nMax(0)
+        {
+        }
+
+        /**
+         * @brief Add Adds the time elapsed since the given start of the measurement
+         * @param tmStart Start of the measurement
+         */
+        void Add(const tClock::time_point& tmStart)
+        {
+            const uint64_t nElapsed = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(tClock::now() - tmStart).count());
+            m_nTotal.fetch_add(nElapsed, std::memory_order_relaxed);
+            uint64_t nMax = m_nMax.load(std::memory_order_relaxed);
+            while (nElapsed > nMax
+                && !m_nMax.compare_exchange_weak(nMax, nElapsed, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /// @return Total measured time in ns
+        uint64_t GetTotal() const
+        {
+            return m_nTotal.load(std::memory_order_relaxed);
+        }
+
+        /// @return Longest single measurement in ns
+        uint64_t GetMax() const
+        {
+            return m_nMax.load(std::memory_order_relaxed);
+        }
+
+    private:
+        /// Total measured time in ns
+        std::atomic<uint64_t> m_nTotal;
+        /// Longest single measurement in ns
+        std::atomic<uint64_t> m_nMax;
+    };
+}
+
+#endif // _FEP_TRANSPORT_STATISTICS_H_
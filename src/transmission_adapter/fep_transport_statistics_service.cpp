@@ -0,0 +1,167 @@
+/**
+ * Implementation of the RPC service publishing the transport statistics of signals.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#include <vector>
+
+#include "fep_transmission.h"
+#include "fep_transport_statistics.h"
+#include "fep_transport_statistics_service.h"
+
+namespace fep
+{
+namespace detail
+{
+
+/// Joins the signal names of the given statistics to a comma separated list
+static std::string JoinSignalNames(const std::vector<tTransportStatistics>& vecStatistics)
+{
+    std::string strNames;
+    for (std::vector<tTransportStatistics>::const_iterator it = vecStatistics.begin();
+        it != vecStatistics.end(); ++it)
+    {
+        if (!strNames.empty())
+        {
+            strNames += ",";
+        }
+        strNames += it->strSignalName;
+    }
+    return strNames;
+}
+
+/// Looks up the statistics of the given signal, returns NULL if there is no such signal
+static const tTransportStatistics* FindSignal(const std::vector<tTransportStatistics>& vecStatistics,
+    const std::string& strSignalName)
+{
+    for (std::vector<tTransportStatistics>::const_iterator it = vecStatistics.begin();
+        it != vecStatistics.end(); ++it)
+    {
+        if (it->strSignalName == strSignalName)
+        {
+            return &(*it);
+        }
+    }
+    return NULL;
+}
+
+/// Converts a latency summary to its JSON representation
+static Json::Value ToJson(const tLatencySummary& oSummary)
+{
+    Json::Value oValue(Json::objectValue);
+    oValue["count"] = Json::UInt64(oSummary.nCount);
+    oValue["min"] = Json::UInt64(oSummary.nMin);
+    oValue["max"] = Json::UInt64(oSummary.nMax);
+    oValue["mean"] = Json::UInt64(oSummary.nMean);
+    oValue["p50"] = Json::UInt64(oSummary.nP50);
+    oValue["p90"] = Json::UInt64(oSummary.nP90);
+    oValue["p99"] = Json::UInt64(oSummary.nP99);
+    oValue["p999"] = Json::UInt64(oSummary.nP999);
+    return oValue;
+}
+
+RPCTransportStatisticsServer::RPCTransportStatisticsServer(cTransmissionAdapter& oAdapter)
+    : m_pAdapter(&oAdapter)
+{
+}
+
+std::string RPCTransportStatisticsServer::getSignalsIn()
+{
+    std::vector<tTransportStatistics> vecInputs;
+    std::vector<tTransportStatistics> vecOutputs;
+    m_pAdapter->GetTransportStatistics(vecInputs, vecOutputs);
+    return JoinSignalNames(vecInputs);
+}
+
+std::string RPCTransportStatisticsServer::getSignalsOut()
+{
+    std::vector<tTransportStatistics> vecInputs;
+    std::vector<tTransportStatistics> vecOutputs;
+    m_pAdapter->GetTransportStatistics(vecInputs, vecOutputs);
+    return JoinSignalNames(vecOutputs);
+}
+
+Json::Value RPCTransportStatisticsServer::getSignalInStatistics(const std::string& signal_name)
+{
+    std::vector<tTransportStatistics> vecInputs;
+    std::vector<tTransportStatistics> vecOutputs;
+    m_pAdapter->GetTransportStatistics(vecInputs, vecOutputs);
+
+    Json::Value oValue(Json::objectValue);
+    const tTransportStatistics* pStatistics = FindSignal(vecInputs, signal_name);
+    if (pStatistics)
+    {
+        oValue["samples"] = Json::UInt64(pStatistics->nSamples);
+        oValue["bytes"] = Json::UInt64(pStatistics->nBytes);
+        oValue["dropped_samples"] = Json::UInt64(pStatistics->nDroppedSamples);
+        oValue["queue_overflows"] = Json::UInt64(pStatistics->nQueueOverflows);
+        oValue["conflated_samples"] = Json::UInt64(pStatistics->nConflatedSamples);
+        oValue["defragmentation_losses"] = Json::UInt64(pStatistics->nDefragmentationLosses);
+        oValue["queue_high_water_mark"] = Json::UInt64(pStatistics->nQueueHighWaterMark);
+        oValue["decode_time_total_ns"] = Json::UInt64(pStatistics->nCodecTimeTotal_ns);
+        oValue["decode_time_max_ns"] = Json::UInt64(pStatistics->nCodecTimeMax_ns);
+    }
+    return oValue;
+}
+
+Json::Value RPCTransportStatisticsServer::getSignalOutStatistics(const std::string& signal_name)
+{
+    std::vector<tTransportStatistics> vecInputs;
+    std::vector<tTransportStatistics> vecOutputs;
+    m_pAdapter->GetTransportStatistics(vecInputs, vecOutputs);
+
+    Json::Value oValue(Json::objectValue);
+    const tTransportStatistics* pStatistics = FindSignal(vecOutputs, signal_name);
+    if (pStatistics)
+    {
+        oValue["samples"] = Json::UInt64(pStatistics->nSamples);
+        oValue["bytes"] = Json::UInt64(pStatistics->nBytes);
+        oValue["failed_transmissions"] = Json::UInt64(pStatistics->nFailedTransmissions);
+        oValue["encode_time_total_ns"] = Json::UInt64(pStatistics->nCodecTimeTotal_ns);
+        oValue["encode_time_max_ns"] = Json::UInt64(pStatistics->nCodecTimeMax_ns);
+    }
+    return oValue;
+}
+
+Json::Value RPCTransportStatisticsServer::getSignalInLatency(const std::string& signal_name)
+{
+    std::vector<tTransportStatistics> vecInputs;
+    std::vector<tTransportStatistics> vecOutputs;
+    m_pAdapter->GetTransportStatistics(vecInputs, vecOutputs);
+
+    Json::Value oValue(Json::objectValue);
+    const tTransportStatistics* pStatistics = FindSignal(vecInputs, signal_name);
+    if (pStatistics)
+    {
+        oValue["sequence_gaps"] = Json::UInt64(pStatistics->nSequenceGaps);
+        oValue["latency_us"] = ToJson(pStatistics->oLatency_us);
+        oValue["wall_clock_latency_ns"] = ToJson(pStatistics->oWallClockLatency_ns);
+    }
+    return oValue;
+}
+
+int RPCTransportStatisticsServer::resetLatency()
+{
+    m_pAdapter->ResetLatencyStatistics();
+    return 0;
+}
+
+} // namespace detail
+} // namespace fep
@@ -0,0 +1,69 @@
+/**
+ * Declaration of the RPC service publishing the transport statistics of signals.
+ *
+ * @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ *
+ */
+
+#ifndef _FEP_TRANSPORT_STATISTICS_SERVICE_H_
+#define _FEP_TRANSPORT_STATISTICS_SERVICE_H_
+
+#include <string>
+#include <json/value.h>
+#include <rpc_pkg/rpc_server.h>
+
+#include "fep3/components/rpc/fep_rpc.h"
+#include "fep3/rpc_components/transport_statistics/transport_statistics_service.h"
+#include "fep3/rpc_components/transport_statistics/transport_statistics_rpc_intf_def.h"
+
+namespace fep
+{
+    class cTransmissionAdapter;
+
+namespace detail
+{
+    /**
+     * RPC server publishing the transport statistics collected by the transmission adapter.
+     * Every call takes a fresh snapshot of the counters.
+     */
+    class RPCTransportStatisticsServer
+        : public rpc_object_server<rpc_stubs::RPCTransportStatisticsServer, rpc::IRPCTransportStatisticsDef>
+    {
+    public:
+        /**
+         * CTOR
+         * @param [in] oAdapter The transmission adapter whose signals are published
+         */
+        explicit RPCTransportStatisticsServer(cTransmissionAdapter& oAdapter);
+
+    protected:
+        std::string getSignalsIn() override;
+        std::string getSignalsOut() override;
+        Json::Value getSignalInStatistics(const std::string& signal_name) override;
+        Json::Value getSignalOutStatistics(const std::string& signal_name) override;
+        Json::Value getSignalInLatency(const std::string& signal_name) override;
+        int resetLatency() override;
+
+    private:
+        /// The transmission adapter whose signals are published
+        cTransmissionAdapter* m_pAdapter;
+    };
+} // namespace detail
+} // namespace fep
+
+#endif // _FEP_TRANSPORT_STATISTICS_SERVICE_H_
@@ -0,0 +1,74 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#include "fep_errors.h"
+#include "transmission_adapter/fep_signal_options.h"
+#include "transmission_adapter/inproc/fep_inproc_abstract_transceiver.h"
+
+using namespace fep::inproc;
+
+cAbstractInProcTransceiver::cAbstractInProcTransceiver() :
+    m_szSignalSize(0),
+    m_bIsVariableSignalSize(false),
+    m_pLoggingFunc(NULL),
+    m_pCalleeLogging(NULL)
+{
+}
+
+cAbstractInProcTransceiver::~cAbstractInProcTransceiver()
+{
+}
+
+fep::Result cAbstractInProcTransceiver::Initialize(const fep::cSignalOptions& oOptions,
+    const std::string& strModuleName, int dDomainId)
+{
+    fep::Result nResult = fep::ERR_INVALID_ARG;
+    if (!strModuleName.empty()
+        && oOptions.GetOption("SignalName", m_strSignalName)
+        && oOptions.GetOption("SignalSize", m_szSignalSize))
+    {
+        m_strModuleName = strModuleName;
+        if (false == oOptions.GetOption("IsVariableSignalSize", m_bIsVariableSignalSize))
+        {
+            m_bIsVariableSignalSize = false;
+        }
+        m_pChannel = cInProcChannel::Acquire(dDomainId, m_strSignalName);
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+fep::Result cAbstractInProcTransceiver::RegisterLogging(ITransmissionDriver::tLoggingFuncPtr pLoggingFunc,
+    void * pCallee)
+{
+    fep::Result nResult = ERR_INVALID_ARG;
+    if (NULL != pLoggingFunc && NULL != pCallee)
+    {
+        m_pCalleeLogging = pCallee;
+        m_pLoggingFunc = pLoggingFunc;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+void cAbstractInProcTransceiver::LogMessage(const char* strMessage, fep::tSeverityLevel eServLevel)
+{
+    if (NULL != m_pLoggingFunc && NULL != m_pCalleeLogging)
+    {
+        m_pLoggingFunc(m_pCalleeLogging, strMessage, eServLevel);
+    }
+}
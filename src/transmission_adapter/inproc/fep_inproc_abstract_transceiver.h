@@ -0,0 +1,106 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_INPROC_TRANSCEIVER_H_
+#define _FEP_INPROC_TRANSCEIVER_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "fep_result_decl.h"
+#include "incident_handler/fep_severity_level.h"
+#include "transmission_adapter/fep_transmission_driver_intf.h"
+#include "transmission_adapter/inproc/fep_inproc_channel.h"
+
+namespace fep
+{
+    class cSignalOptions;
+
+    namespace inproc
+    {
+        /**
+         * @brief The cAbstractInProcTransceiver class
+         * This is the base class for all in-process receiver and transmitter objects.
+         * It refers to the channel of the signal and provides the logging.
+         */
+        class cAbstractInProcTransceiver
+        {
+        public:
+            /**
+            * CTOR
+            */
+            cAbstractInProcTransceiver();
+
+            /**
+            * DTOR
+            */
+            virtual ~cAbstractInProcTransceiver();
+
+            /**
+            * The method \ref Initialize attaches a Transmitter or Receiver to the channel of the signal
+            *
+            * @param [in] oOptions  SignalOptions
+            * @param [in] strModuleName Name of the fep module
+            * @param [in] dDomainId DomainID
+            * @return Standard Error code
+            * @retval ERR_INVALID_ARG Mandatory options are missing
+            * @retval ERR_NOERROR Everything went fine
+            */
+            virtual fep::Result Initialize(const fep::cSignalOptions& oOptions,
+                const std::string& strModuleName, int dDomainId);
+
+            /**
+            *Register Logging Function
+            * @param [in] pLoggingFunc Pointer to the logging function
+            * @param [in] pCallee Pointer to the object providing the logging callback
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result RegisterLogging(ITransmissionDriver::tLoggingFuncPtr pLoggingFunc, void * pCallee);
+
+        protected:
+            /**
+            * @brief LogMessage Logs error messages to the registered callback
+            * @param strMessage The Message to log
+            * @param eServLevel The serverity of the incident to be reported
+            */
+            void LogMessage(const char* strMessage, fep::tSeverityLevel eServLevel);
+
+        protected:
+            /// Channel of the signal
+            std::shared_ptr<cInProcChannel> m_pChannel;
+            /// Module Name
+            std::string m_strModuleName;
+            /// Signal name
+            std::string m_strSignalName;
+            /// Signal Size
+            size_t m_szSignalSize;
+            /// Flag indicating that signal is of variable size
+            bool m_bIsVariableSignalSize;
+
+        private:
+            //Logging members
+            /// Logging Function pointer
+            ITransmissionDriver::tLoggingFuncPtr m_pLoggingFunc;
+            /// Logging object
+            void* m_pCalleeLogging;
+        };
+    }
+}
+
+#endif //_FEP_INPROC_TRANSCEIVER_H_
@@ -0,0 +1,108 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <a_util/concurrency/fast_mutex.h>
+#include <a_util/strings/strings_format.h>
+
+#include "transmission_adapter/inproc/fep_inproc_channel.h"
+#include "transmission_adapter/inproc/fep_inproc_receiver.h"
+
+using namespace fep::inproc;
+
+namespace
+{
+    /// All channels of the process
+    struct tChannelRegistry
+    {
+        /// Guard for the channel map
+        a_util::concurrency::fast_mutex oGuard;
+        /// Channels by key
+        std::map<std::string, std::weak_ptr<cInProcChannel> > mapChannels;
+    };
+
+    tChannelRegistry& GetRegistry()
+    {
+        // never destroyed, channels might outlive other static objects
+        static tChannelRegistry* s_pRegistry = new tChannelRegistry();
+        return *s_pRegistry;
+    }
+}
+
+std::shared_ptr<cInProcChannel> cInProcChannel::Acquire(int dDomainId, const std::string& strSignalName)
+{
+    const std::string strKey = a_util::strings::format("%d/%s", dDomainId, strSignalName.c_str());
+    tChannelRegistry& oRegistry = GetRegistry();
+    std::unique_lock<a_util::concurrency::fast_mutex> oSync(oRegistry.oGuard);
+    std::weak_ptr<cInProcChannel>& pEntry = oRegistry.mapChannels[strKey];
+    std::shared_ptr<cInProcChannel> pChannel = pEntry.lock();
+    if (!pChannel)
+    {
+        pChannel.reset(new cInProcChannel(strKey));
+        pEntry = pChannel;
+    }
+    return pChannel;
+}
+
+cInProcChannel::cInProcChannel(const std::string& strKey) :
+    m_strKey(strKey)
+{
+}
+
+cInProcChannel::~cInProcChannel()
+{
+    tChannelRegistry& oRegistry = GetRegistry();
+    std::unique_lock<a_util::concurrency::fast_mutex> oSync(oRegistry.oGuard);
+    std::map<std::string, std::weak_ptr<cInProcChannel> >::iterator itEntry =
+        oRegistry.mapChannels.find(m_strKey);
+    // the entry might already refer to a new channel of the same signal
+    if (oRegistry.mapChannels.end() != itEntry && itEntry->second.expired())
+    {
+        oRegistry.mapChannels.erase(itEntry);
+    }
+}
+
+void cInProcChannel::Attach(cInProcReceive* pReceiver)
+{
+    m_oReceiversLock.lock();
+    if (m_vecReceivers.end() == std::find(m_vecReceivers.begin(), m_vecReceivers.end(), pReceiver))
+    {
+        m_vecReceivers.push_back(pReceiver);
+    }
+    m_oReceiversLock.unlock();
+}
+
+void cInProcChannel::Detach(cInProcReceive* pReceiver)
+{
+    // waits for all running deliveries
+    m_oReceiversLock.lock();
+    m_vecReceivers.erase(std::remove(m_vecReceivers.begin(), m_vecReceivers.end(), pReceiver),
+        m_vecReceivers.end());
+    m_oReceiversLock.unlock();
+}
+
+void cInProcChannel::Publish(const void* pData, size_t szSize)
+{
+    m_oReceiversLock.lock_shared();
+    for (std::vector<cInProcReceive*>::iterator it = m_vecReceivers.begin(); it != m_vecReceivers.end(); ++it)
+    {
+        (*it)->Deliver(pData, szSize);
+    }
+    m_oReceiversLock.unlock_shared();
+}
@@ -0,0 +1,99 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_INPROC_CHANNEL_H_
+#define _FEP_INPROC_CHANNEL_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <a_util/concurrency/shared_mutex.h>
+
+namespace fep
+{
+    namespace inproc
+    {
+        class cInProcReceive;
+
+        /**
+         * @brief The cInProcChannel class
+         * Connects all in-process transmitters and receivers of one signal within one domain.
+         * Channels are shared by all drivers of the process and are found by their
+         * domain id and signal name. A channel lives as long as a transceiver refers to it.
+         */
+        class cInProcChannel
+        {
+        public:
+            /**
+            * The method \ref Acquire returns the channel of a signal and creates it if necessary.
+            *
+            * @param [in] dDomainId Domain ID
+            * @param [in] strSignalName Name of the signal
+            * @return The channel (never NULL)
+            */
+            static std::shared_ptr<cInProcChannel> Acquire(int dDomainId, const std::string& strSignalName);
+
+            /**
+            * DTOR
+            */
+            ~cInProcChannel();
+
+            /**
+            * The method \ref Attach adds a receiver to the channel. From then on all samples
+            * published to the channel are delivered to the receiver.
+            *
+            * @param [in] pReceiver The receiver
+            */
+            void Attach(cInProcReceive* pReceiver);
+
+            /**
+            * The method \ref Detach removes a receiver from the channel. When the method returns,
+            * no delivery to the receiver is running anymore.
+            *
+            * @param [in] pReceiver The receiver
+            */
+            void Detach(cInProcReceive* pReceiver);
+
+            /**
+            * The method \ref Publish delivers a sample to all attached receivers. The receivers
+            * are called within the calling thread, the sample is not copied.
+            *
+            * @param [in] pData Pointer to the sample
+            * @param [in] szSize Size of the sample
+            */
+            void Publish(const void* pData, size_t szSize);
+
+        private:
+            /**
+            * CTOR
+            * @param [in] strKey Key of the channel within the registry
+            */
+            explicit cInProcChannel(const std::string& strKey);
+
+        private:
+            /// Key of the channel within the registry
+            std::string m_strKey;
+            /// Lock for the receiver list (shared while publishing)
+            a_util::concurrency::shared_mutex m_oReceiversLock;
+            /// Attached receivers
+            std::vector<cInProcReceive*> m_vecReceivers;
+        };
+    }
+}
+
+#endif //_FEP_INPROC_CHANNEL_H_
@@ -0,0 +1,184 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#include "transmission_adapter/inproc/fep_inproc_driver.h"
+#include <cstddef>                                          // for NULL
+#include <mutex>
+#include <a_util/concurrency/fast_mutex.h>                  // for fast_mut...
+#include <a_util/result/result_type.h>                      // for Result::...
+
+#include "fep_errors.h"                                     // for ERR_FAILED
+#include "fep_inproc_driver_options_verifier.h"             // for cInProcDriv...
+#include "fep_inproc_receiver.h"                            // for cInProcReceive
+#include "fep_inproc_signal_options_verifier.h"             // for cInProcSign...
+#include "fep_inproc_transmitter.h"                         // for cInProcTran...
+#include "transmission_adapter/fep_driver_options.h"        // for cDriverO...
+#include "transmission_adapter/fep_options_verifier_intf.h" // for IOptions...
+#include "transmission_adapter/fep_signal_options.h"        // for cSignalO...
+
+fep::inproc::cInProcDriver::cInProcDriver() :
+    m_dDomainId(0),
+    m_bInitialized(false),
+    m_pLoggingFunc(NULL),
+    m_pCalleeLogging(NULL)
+{
+}
+
+fep::inproc::cInProcDriver::~cInProcDriver()
+{
+    Deinitialize();
+}
+
+fep::Result fep::inproc::cInProcDriver::Initialize(const cDriverOptions oDriverOptions)
+{
+    fep::Result nResult = ERR_NOERROR;
+    if (!oDriverOptions.GetOption("DomainID", m_dDomainId)
+        || !oDriverOptions.GetOption("ModuleName", m_strModuleName))
+    {
+        nResult = ERR_FAILED;
+    }
+    m_bInitialized = fep::isOk(nResult);
+    return nResult;
+}
+
+fep::Result fep::inproc::cInProcDriver::Deinitialize()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxTransceivers);
+    for (std::vector<cInProcReceive*>::iterator it = m_vecReceivers.begin(); it != m_vecReceivers.end(); ++it)
+    {
+        delete *it;
+    }
+    m_vecReceivers.clear();
+
+    for (std::vector<cInProcTransmit*>::iterator it = m_vecTransmitters.begin(); it != m_vecTransmitters.end(); ++it)
+    {
+        delete *it;
+    }
+    m_vecTransmitters.clear();
+    m_bInitialized = false;
+    return ERR_NOERROR;
+}
+
+fep::Result fep::inproc::cInProcDriver::CreateReceiver(IReceive *&pIReceiver, cSignalOptions oOptions)
+{
+    fep::Result nResult = ERR_NOT_INITIALISED;
+    if (m_bInitialized)
+    {
+        cInProcReceive* pReceiver = new cInProcReceive();
+        if (NULL != m_pCalleeLogging && NULL != m_pLoggingFunc)
+        {
+            pReceiver->RegisterLogging(m_pLoggingFunc, m_pCalleeLogging);
+        }
+        nResult = pReceiver->Initialize(oOptions, m_strModuleName, m_dDomainId);
+        if (fep::isOk(nResult))
+        {
+            std::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxTransceivers);
+            m_vecReceivers.push_back(pReceiver);
+            pIReceiver = pReceiver;
+        }
+        else
+        {
+            delete pReceiver;
+        }
+    }
+    return nResult;
+}
+
+fep::Result fep::inproc::cInProcDriver::CreateTransmitter(fep::ITransmit *&pITransmit, cSignalOptions oOptions)
+{
+    fep::Result nResult = ERR_NOT_INITIALISED;
+    if (m_bInitialized)
+    {
+        cInProcTransmit* pTransmitter = new cInProcTransmit();
+        if (NULL != m_pCalleeLogging && NULL != m_pLoggingFunc)
+        {
+            pTransmitter->RegisterLogging(m_pLoggingFunc, m_pCalleeLogging);
+        }
+        nResult = pTransmitter->Initialize(oOptions, m_strModuleName, m_dDomainId);
+        if (fep::isOk(nResult))
+        {
+            std::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxTransceivers);
+            m_vecTransmitters.push_back(pTransmitter);
+            pITransmit = pTransmitter;
+        }
+        else
+        {
+            delete pTransmitter;
+        }
+    }
+    return nResult;
+}
+
+fep::Result fep::inproc::cInProcDriver::DestroyReceiver(IReceive *pIReceiver)
+{
+    fep::Result nResult = ERR_NOT_FOUND;
+    std::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxTransceivers);
+    for (std::vector<cInProcReceive*>::iterator it = m_vecReceivers.begin(); it != m_vecReceivers.end(); ++it)
+    {
+        if (static_cast<IReceive *>(*it) == pIReceiver)
+        {
+            delete (*it);
+            m_vecReceivers.erase(it);
+            nResult = ERR_NOERROR;
+            break;
+        }
+    }
+    return nResult;
+}
+
+fep::Result fep::inproc::cInProcDriver::DestroyTransmitter(ITransmit *pITransmitter)
+{
+    fep::Result nResult = ERR_NOT_FOUND;
+    std::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxTransceivers);
+    for (std::vector<cInProcTransmit*>::iterator it = m_vecTransmitters.begin(); it != m_vecTransmitters.end(); ++it)
+    {
+        if (static_cast<ITransmit *>(*it) == pITransmitter)
+        {
+            delete (*it);
+            m_vecTransmitters.erase(it);
+            nResult = ERR_NOERROR;
+            break;
+        }
+    }
+    return nResult;
+}
+
+fep::IOptionsVerifier * fep::inproc::cInProcDriver::GetSignalOptionsVerifier()
+{
+    static cInProcSignalOptionsVerifier s_SignalOptionsVerifier;
+    return &s_SignalOptionsVerifier;
+}
+
+fep::IOptionsVerifier * fep::inproc::cInProcDriver::GetDriverOptionsVerifier()
+{
+    static cInProcDriverOptionsVerifier s_DriverOptionsVerifier;
+    return &s_DriverOptionsVerifier;
+}
+
+fep::Result fep::inproc::cInProcDriver::RegisterLogging(tLoggingFuncPtr pLoggingFunc, void * pCallee)
+{
+    fep::Result nResult = ERR_INVALID_ARG;
+    if (NULL != pLoggingFunc && NULL != pCallee)
+    {
+        m_pCalleeLogging = pCallee;
+        m_pLoggingFunc = pLoggingFunc;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
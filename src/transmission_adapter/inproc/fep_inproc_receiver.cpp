@@ -0,0 +1,98 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#include <mutex>
+#include <a_util/concurrency/fast_mutex.h>
+#include <a_util/result/result_type.h>
+
+#include "fep_errors.h"
+#include "transmission_adapter/inproc/fep_inproc_receiver.h"
+
+using namespace fep::inproc;
+
+cInProcReceive::cInProcReceive() :
+    m_bIsMuted(false),
+    m_bIsActivated(false),
+    m_pCallback(NULL),
+    m_pCallee(NULL)
+{
+}
+
+cInProcReceive::~cInProcReceive()
+{
+    Disable();
+}
+
+fep::Result cInProcReceive::SetReceiver(tCallbackFuncPtr pCallback, void * pCallee)
+{
+    fep::Result nResult = ERR_POINTER;
+    if ((NULL != pCallback && NULL != pCallee)
+        || (NULL == pCallback && NULL == pCallee))
+    {
+        std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oCallbackGuard);
+        m_pCallback = pCallback;
+        m_pCallee = pCallee;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+fep::Result cInProcReceive::Enable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    if (!m_bIsActivated && m_pChannel)
+    {
+        m_pChannel->Attach(this);
+        m_bIsActivated = true;
+    }
+    return ERR_NOERROR;
+}
+
+fep::Result cInProcReceive::Disable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    if (m_bIsActivated)
+    {
+        m_pChannel->Detach(this);
+        m_bIsActivated = false;
+    }
+    return ERR_NOERROR;
+}
+
+fep::Result cInProcReceive::Mute()
+{
+    m_bIsMuted = true;
+    return ERR_NOERROR;
+}
+
+fep::Result cInProcReceive::Unmute()
+{
+    m_bIsMuted = false;
+    return ERR_NOERROR;
+}
+
+void cInProcReceive::Deliver(const void* pData, size_t szSize)
+{
+    if (!m_bIsMuted)
+    {
+        std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oCallbackGuard);
+        if (NULL != m_pCallback && NULL != m_pCallee)
+        {
+            m_pCallback(m_pCallee, pData, szSize);
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_INPROC_RECEIVE_H_
+#define _FEP_INPROC_RECEIVE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <a_util/concurrency/detail/fast_mutex_decl.h>
+
+#include "fep_result_decl.h"
+#include "fep_inproc_abstract_transceiver.h"
+#include "transmission_adapter/fep_receive_intf.h"
+
+namespace fep
+{
+    namespace inproc
+    {
+        /**
+        * @brief The cInProcReceive class
+        * Implements the IReceive Interface for the in-process driver. While enabled, the
+        * receiver is attached to the channel of the signal and its callback is called by
+        * the transmitting thread.
+        */
+        class cInProcReceive : public IReceive, public cAbstractInProcTransceiver
+        {
+            using IReceive::tCallbackFuncPtr;
+
+            ///@cond nodoc
+            friend class cInProcDriver;
+            friend class cInProcChannel;
+            ///@endcond
+
+        public:
+            /**
+            * The method \ref SetReceiver registers the callback function that is called when data is received.
+            *
+            * @param pCallback Function pointer to callback
+            * @param pCallee Pointer to object providing this callback
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result SetReceiver(tCallbackFuncPtr pCallback, void * pCallee);
+
+            /**
+            * The method \ref Enable attaches the receiver to the channel of the signal. Only samples
+            * transmitted after the receiver was enabled are received.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Enable();
+
+            /**
+            * The method \ref Disable detaches the receiver from the channel of the signal.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Disable();
+
+            /**
+            * The method \ref Mute mutes the receiver so that data is no longer received.
+            * Sample reception with a muted receiver will cause no error report.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Mute();
+
+            /**
+            * The method \ref Unmute unmutes the receiver so that data can be received.
+            * Sample reception with a muted receiver will cause no error report.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Unmute();
+
+        protected:
+            /**
+            * CTOR
+            */
+            cInProcReceive();
+            /**
+            * DTOR
+            */
+            virtual ~cInProcReceive();
+
+        private:
+            /**
+            * The method \ref Deliver is called by the channel for every published sample
+            *
+            * @param [in] pData Pointer to the sample (only valid during the call)
+            * @param [in] szSize Size of the sample
+            */
+            void Deliver(const void* pData, size_t szSize);
+
+        private:
+            /// Flag indicating mute state
+            std::atomic<bool> m_bIsMuted;
+            /// Guard for the enabled flag
+            a_util::concurrency::fast_mutex m_oActivationGuard;
+            /// flag indicating that receiver is attached to the channel
+            bool m_bIsActivated;
+            /// Guard for the callback (samples of several transmitters are delivered one after another)
+            a_util::concurrency::fast_mutex m_oCallbackGuard;
+            /// Callback that is called when data was received
+            tCallbackFuncPtr m_pCallback;
+            /// Pointer to the Object whoms callback is to be called
+            void* m_pCallee;
+        };
+    }
+}
+
+#endif //_FEP_INPROC_RECEIVE_H_
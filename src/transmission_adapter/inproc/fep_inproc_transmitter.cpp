@@ -0,0 +1,88 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#include <mutex>
+#include <string>
+#include <a_util/concurrency/fast_mutex.h>
+#include <a_util/result/result_type.h>
+#include <a_util/strings/strings_format.h>
+
+#include "fep_errors.h"
+#include "transmission_adapter/inproc/fep_inproc_transmitter.h"
+
+using namespace fep::inproc;
+
+cInProcTransmit::cInProcTransmit() :
+    m_bIsMuted(false),
+    m_bIsActivated(false)
+{
+}
+
+cInProcTransmit::~cInProcTransmit()
+{
+}
+
+fep::Result cInProcTransmit::Transmit(const void *pData, size_t szSize)
+{
+    fep::Result nResult = ERR_NOERROR;
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    if (!m_bIsActivated)
+    {
+        LogMessage(a_util::strings::format("%s: Transmission failure - transmitter is not enabled.",
+            m_strSignalName.c_str()).c_str(), fep::SL_Warning);
+        nResult = ERR_INVALID_STATE;
+    }
+    else if (NULL == pData || 0 >= szSize)
+    {
+        nResult = ERR_INVALID_ARG;
+    }
+    else if (!m_bIsVariableSignalSize && szSize != m_szSignalSize)
+    {
+        nResult = ERR_FAILED;
+    }
+    else if (!m_bIsMuted)
+    {
+        m_pChannel->Publish(pData, szSize);
+    }
+    return nResult;
+}
+
+fep::Result cInProcTransmit::Enable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    m_bIsActivated = true;
+    return ERR_NOERROR;
+}
+
+fep::Result cInProcTransmit::Disable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    m_bIsActivated = false;
+    return ERR_NOERROR;
+}
+
+fep::Result cInProcTransmit::Mute()
+{
+    m_bIsMuted = true;
+    return ERR_NOERROR;
+}
+
+fep::Result cInProcTransmit::Unmute()
+{
+    m_bIsMuted = false;
+    return ERR_NOERROR;
+}
@@ -0,0 +1,106 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_INPROC_TRANSMIT_H_
+#define _FEP_INPROC_TRANSMIT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <a_util/concurrency/detail/fast_mutex_decl.h>
+
+#include "fep_result_decl.h"
+#include "fep_inproc_abstract_transceiver.h"
+#include "transmission_adapter/fep_transmit_intf.h"
+
+namespace fep
+{
+    namespace inproc
+    {
+        ///@copydoc ITransmit
+        class cInProcTransmit : public ITransmit, public cAbstractInProcTransceiver
+        {
+            ///@cond nodoc
+            friend class cInProcDriver;
+            ///@endcond
+
+        public:
+            /**
+            * The method \ref Transmit hands a data block of size szSize to all enabled receivers of
+            * the signal. The receivers are called before the method returns.
+            *
+            * @param [in] pData  void pointer to the data
+            * @param [in] szSize size of the data block
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Transmit(const void *pData, size_t szSize);
+
+            /**
+            * The method \ref Enable activates the transmitter so that data can be transmitted.
+            * Sample transmission with a deactivated transmitter will cause an error report.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Enable();
+
+            /**
+            * The method \ref Disable deactivates the transmitter.
+            * Sample transmission with a deactivated transmitter will cause an error report.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Disable();
+
+            /**
+            * The method \ref Mute mutes the transmitter so that data is no longer transmitted.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Mute();
+
+            /**
+            * The method \ref Unmute unmutes the transmitter so that data can be transmitted.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Unmute();
+
+        protected:
+            /**
+            * CTOR
+            */
+            cInProcTransmit();
+
+            /**
+            * DTOR
+            */
+            virtual ~cInProcTransmit();
+
+        private:
+            /// Flag indicating mute state
+            std::atomic<bool> m_bIsMuted;
+            /// Guard for the enabled flag
+            a_util::concurrency::fast_mutex m_oActivationGuard;
+            /// flag indicating that transmitter is activated
+            bool m_bIsActivated;
+        };
+    }
+}
+
+#endif //_FEP_INPROC_TRANSMIT_H_
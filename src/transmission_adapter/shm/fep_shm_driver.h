@@ -0,0 +1,110 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_SHM_DRIVER_H_
+#define _FEP_SHM_DRIVER_H_
+
+#ifdef __linux__
+
+#include <string>
+#include <vector>
+#include <a_util/concurrency/detail/fast_mutex_decl.h>
+
+#include "fep_participant_export.h"
+#include "fep_result_decl.h"
+#include "transmission_adapter/fep_transmission_driver_intf.h"
+
+namespace fep
+{
+    class IOptionsVerifier;
+    class IReceive;
+    class ITransmit;
+    class cDriverOptions;
+    class cSignalOptions;
+
+    namespace shm
+    {
+        class cShmReceive;
+        class cShmTransmit;
+
+        /**
+        * Transmission driver for participants running on the same host. Every signal is
+        * exchanged via a ring in a POSIX shared memory object (see \ref cShmSegment) that
+        * is found by its name in /dev/shm, no network stack is involved.
+        */
+        class FEP_PARTICIPANT_EXPORT cShmDriver : public ITransmissionDriver
+        {
+        public:
+            /// CTOR
+            cShmDriver();
+
+            /**
+            * DTOR
+            */
+            virtual ~cShmDriver();
+
+            /// @copydoc ITransmissionDriver::Initialize
+            fep::Result Initialize(const cDriverOptions oDriverOptions);
+
+            /// @copydoc ITransmissionDriver::Deinitialize
+            fep::Result Deinitialize();
+
+            /// @copydoc ITransmissionDriver::CreateReceiver
+            fep::Result CreateReceiver(IReceive *&pIReceiver, const cSignalOptions oOptions);
+
+            /// @copydoc ITransmissionDriver::CreateTransmitter
+            fep::Result CreateTransmitter(ITransmit *&pITransmit, const cSignalOptions oOptions);
+
+            /// @copydoc ITransmissionDriver::DestroyReceiver
+            fep::Result DestroyReceiver(IReceive *pIReceiver);
+
+            /// @copydoc ITransmissionDriver::DestroyTransmitter
+            fep::Result DestroyTransmitter(ITransmit *pITransmiter);
+
+            /// @copydoc ITransmissionDriver::GetSignalOptionsVerifier
+            IOptionsVerifier * GetSignalOptionsVerifier();
+
+            /// @copydoc ITransmissionDriver::GetDriverOptionsVerifier
+            IOptionsVerifier * GetDriverOptionsVerifier();
+
+            /// @copydoc ITransmissionDriver::RegisterLogging
+            fep::Result RegisterLogging(tLoggingFuncPtr pLoggingFunc, void * pCallee);
+
+        private:
+            /// Mutex protecting the receiver and transmitter lists
+            a_util::concurrency::fast_mutex m_mtxTransceivers;
+            /// List of Receivers
+            std::vector<cShmReceive*> m_vecReceivers;
+            /// List of Transmitters
+            std::vector<cShmTransmit*> m_vecTransmitters;
+            /// Domain ID
+            int m_dDomainId;
+            /// ModuleName
+            std::string m_strModuleName;
+            /// Flag indicating that the driver is initialized
+            bool m_bInitialized;
+            //Logging members
+            /// Logging Function
+            ITransmissionDriver::tLoggingFuncPtr m_pLoggingFunc;
+            /// Object providing the logging function
+            void* m_pCalleeLogging;
+        };
+    }
+}
+
+#endif // __linux__
+#endif //_FEP_SHM_DRIVER_H_
@@ -0,0 +1,182 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifdef __linux__
+
+#include <mutex>
+#include <string>
+#include <a_util/concurrency/fast_mutex.h>
+#include <a_util/result/result_type.h>
+#include <a_util/strings/strings_format.h>
+
+#include "fep_errors.h"
+#include "transmission_adapter/shm/fep_shm_receiver.h"
+
+using namespace fep::shm;
+
+/// Time the reception thread sleeps at most before checking whether it has to stop
+static const uint32_t s_nWaitTimeoutMs = 50;
+/// Maximum number of samples handed to the batch callback at once
+static const size_t s_nMaxBatchSize = 64;
+
+cShmReceive::cShmReceive() :
+    m_bIsMuted(false),
+    m_bStop(false),
+    m_pCallback(NULL),
+    m_pBatchCallback(NULL),
+    m_pCallee(NULL),
+    m_pBatchCallee(NULL),
+    m_nCursor(0)
+{
+}
+
+cShmReceive::~cShmReceive()
+{
+    Disable();
+}
+
+fep::Result cShmReceive::SetReceiver(tCallbackFuncPtr pCallback, void * pCallee)
+{
+    fep::Result nResult = ERR_POINTER;
+    if ((NULL != pCallback && NULL != pCallee)
+        || (NULL == pCallback && NULL == pCallee))
+    {
+        std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oCallbackGuard);
+        m_pCallback = pCallback;
+        m_pCallee = pCallee;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+fep::Result cShmReceive::SetBatchReceiver(tBatchCallbackFuncPtr pCallback, void * pCallee)
+{
+    fep::Result nResult = ERR_POINTER;
+    if ((NULL != pCallback && NULL != pCallee)
+        || (NULL == pCallback && NULL == pCallee))
+    {
+        std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oCallbackGuard);
+        m_pBatchCallback = pCallback;
+        m_pBatchCallee = pCallee;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+fep::Result cShmReceive::Enable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    if (!m_pReceptionThread)
+    {
+        // samples written while the receiver was disabled are not received
+        m_nCursor = m_oSegment.GetWriteIndex();
+        m_bStop = false;
+        m_pReceptionThread.reset(new std::thread(&cShmReceive::ReceiveSamples, this));
+    }
+    return ERR_NOERROR;
+}
+
+fep::Result cShmReceive::Disable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    if (m_pReceptionThread)
+    {
+        m_bStop = true;
+        m_pReceptionThread->join();
+        m_pReceptionThread.reset();
+    }
+    return ERR_NOERROR;
+}
+
+fep::Result cShmReceive::Mute()
+{
+    m_bIsMuted = true;
+    return ERR_NOERROR;
+}
+
+fep::Result cShmReceive::Unmute()
+{
+    m_bIsMuted = false;
+    return ERR_NOERROR;
+}
+
+void cShmReceive::ReceiveSamples()
+{
+    while (!m_bStop)
+    {
+        // the token has to be taken before reading, so no notification gets lost
+        const uint32_t nToken = m_oSegment.GetNotifyToken();
+
+        m_vecData.clear();
+        m_vecOffsets.clear();
+        while (m_vecOffsets.size() < s_nMaxBatchSize)
+        {
+            const size_t szOffset = m_vecData.size();
+            const cShmSegment::tReadResult eResult = m_oSegment.Read(m_nCursor, m_vecData);
+            if (cShmSegment::RR_Sample == eResult)
+            {
+                m_vecOffsets.push_back(szOffset);
+            }
+            else if (cShmSegment::RR_Lost == eResult)
+            {
+                LogMessage(a_util::strings::format("%s : Samples were overwritten before they could "
+                    "be received - the receiver is too slow.", m_strSignalName.c_str()).c_str(),
+                    fep::SL_Warning);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (m_vecOffsets.empty())
+        {
+            m_oSegment.Wait(nToken, s_nWaitTimeoutMs);
+        }
+        else if (!m_bIsMuted)
+        {
+            DeliverSamples();
+        }
+    }
+}
+
+void cShmReceive::DeliverSamples()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oCallbackGuard);
+    const size_t nCount = m_vecOffsets.size();
+    if (1 < nCount && NULL != m_pBatchCallback && NULL != m_pBatchCallee)
+    {
+        m_vecBatch.resize(nCount);
+        for (size_t nIdx = 0; nIdx < nCount; ++nIdx)
+        {
+            const size_t szEnd = nIdx + 1 < nCount ? m_vecOffsets[nIdx + 1] : m_vecData.size();
+            m_vecBatch[nIdx].pData = m_vecData.data() + m_vecOffsets[nIdx];
+            m_vecBatch[nIdx].szSize = szEnd - m_vecOffsets[nIdx];
+        }
+        m_pBatchCallback(m_pBatchCallee, &m_vecBatch[0], nCount);
+    }
+    else if (NULL != m_pCallback && NULL != m_pCallee)
+    {
+        for (size_t nIdx = 0; nIdx < nCount; ++nIdx)
+        {
+            const size_t szEnd = nIdx + 1 < nCount ? m_vecOffsets[nIdx + 1] : m_vecData.size();
+            m_pCallback(m_pCallee, m_vecData.data() + m_vecOffsets[nIdx], szEnd - m_vecOffsets[nIdx]);
+        }
+    }
+}
+
+#endif // __linux__
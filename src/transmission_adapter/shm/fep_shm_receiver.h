@@ -0,0 +1,161 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_SHM_RECEIVE_H_
+#define _FEP_SHM_RECEIVE_H_
+
+#ifdef __linux__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <a_util/concurrency/detail/fast_mutex_decl.h>
+
+#include "fep_result_decl.h"
+#include "fep_shm_abstract_transceiver.h"
+#include "transmission_adapter/fep_receive_intf.h"
+
+namespace fep
+{
+    namespace shm
+    {
+        /**
+        * @brief The cShmReceive class
+        * Implements the IReceive Interface for the shared memory driver. While enabled, a
+        * reception thread reads the segment of the signal and hands all samples that are
+        * available at once to the batch callback (if registered).
+        */
+        class cShmReceive : public IReceive, public cAbstractShmTransceiver
+        {
+            using IReceive::tCallbackFuncPtr;
+            using IReceive::tBatchCallbackFuncPtr;
+
+            ///@cond nodoc
+            friend class cShmDriver;
+            ///@endcond
+
+        public:
+            /**
+            * The method \ref SetReceiver registers the callback function that is called when data is received.
+            *
+            * @param pCallback Function pointer to callback
+            * @param pCallee Pointer to object providing this callback
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result SetReceiver(tCallbackFuncPtr pCallback, void * pCallee);
+
+            /**
+            * The method \ref SetBatchReceiver registers the callback function that is called when
+            * several samples were read from the segment at once.
+            *
+            * @param pCallback Function pointer to callback
+            * @param pCallee Pointer to object providing this callback
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result SetBatchReceiver(tBatchCallbackFuncPtr pCallback, void * pCallee);
+
+            /**
+            * The method \ref Enable starts the reception thread. Only samples written after
+            * the receiver was enabled are received.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Enable();
+
+            /**
+            * The method \ref Disable stops the reception thread.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Disable();
+
+            /**
+            * The method \ref Mute mutes the receiver so that data is no longer received.
+            * Sample reception with a muted receiver will cause no error report.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Mute();
+
+            /**
+            * The method \ref Unmute unmutes the receiver so that data can be received.
+            * Sample reception with a muted receiver will cause no error report.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Unmute();
+
+        protected:
+            /**
+            * CTOR
+            */
+            cShmReceive();
+            /**
+            * DTOR
+            */
+            virtual ~cShmReceive();
+
+        private:
+            /**
+            * The method \ref ReceiveSamples runs in the reception thread while the receiver is enabled
+            */
+            void ReceiveSamples();
+
+            /**
+            * The method \ref DeliverSamples hands the samples read by the reception thread to the callbacks
+            */
+            void DeliverSamples();
+
+        private:
+            /// Flag indicating mute state
+            std::atomic<bool> m_bIsMuted;
+            /// Guard for the enabled flag and the reception thread
+            a_util::concurrency::fast_mutex m_oActivationGuard;
+            /// Flag indicating that the reception thread has to stop
+            std::atomic<bool> m_bStop;
+            /// Reception thread
+            std::unique_ptr<std::thread> m_pReceptionThread;
+            /// Guard for the callbacks
+            a_util::concurrency::fast_mutex m_oCallbackGuard;
+            /// Callback that is called when data was received
+            tCallbackFuncPtr m_pCallback;
+            /// Batch callback that is called when several samples were received at once
+            tBatchCallbackFuncPtr m_pBatchCallback;
+            /// Pointer to the Object whoms callback is to be called
+            void* m_pCallee;
+            /// Pointer to the Object whoms batch callback is to be called
+            void* m_pBatchCallee;
+            /// Read cursor within the segment
+            uint64_t m_nCursor;
+            /// Samples read by the reception thread (back to back)
+            std::vector<uint8_t> m_vecData;
+            /// Offsets of the samples in m_vecData
+            std::vector<size_t> m_vecOffsets;
+            /// Samples as handed to the batch callback
+            std::vector<tReceivedBuffer> m_vecBatch;
+        };
+    }
+}
+
+#endif // __linux__
+#endif //_FEP_SHM_RECEIVE_H_
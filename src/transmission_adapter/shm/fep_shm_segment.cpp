@@ -0,0 +1,422 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifdef __linux__
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <thread>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <a_util/strings/strings_format.h>
+
+#include "fep_errors.h"
+#include "transmission_adapter/shm/fep_shm_segment.h"
+
+using namespace fep::shm;
+
+/// Magic number of an initialized segment ("FEPS")
+static const uint32_t s_nSegmentMagic = 0x53504546;
+/// Version of the segment layout
+static const uint32_t s_nSegmentVersion = 1;
+/// Size of a slot including its header
+static const uint32_t s_nSlotSize = 4096;
+/// Minimum number of slots of a segment
+static const uint32_t s_nMinSlotCount = 64;
+/// Number of samples of the maximum size that fit into a segment
+static const uint32_t s_nSamplesPerRing = 8;
+/// Number of attempts to attach while other participants create or remove the segment
+static const int s_nOpenAttempts = 10;
+/// Number of yields a transmitter waits for a slot still written by another transmitter
+static const int s_nMaxLockSpins = 1000;
+/// Maximum length of the signal name part of a segment name
+static const size_t s_szMaxNameLength = 200;
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+    "the futex word has to be a plain 32 bit integer");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+    "atomics shared between processes have to be lock free");
+
+cShmSegment::cShmSegment() :
+    m_nFd(-1),
+    m_pHeader(NULL),
+    m_szMapping(0),
+    m_pSlots(NULL),
+    m_nSlotCount(0),
+    m_nSlotSize(0)
+{
+}
+
+cShmSegment::~cShmSegment()
+{
+    Close();
+}
+
+fep::Result cShmSegment::Open(const std::string& strName, size_t szSampleSize)
+{
+    Close();
+
+    const size_t szPayload = s_nSlotSize - sizeof(tSlotHeader);
+    const size_t nSlotsPerSample = std::max<size_t>(1, (szSampleSize + szPayload - 1) / szPayload);
+    const size_t nSlotCount = std::max<size_t>(s_nMinSlotCount, nSlotsPerSample * s_nSamplesPerRing);
+    if (nSlotCount > UINT32_MAX)
+    {
+        return ERR_INVALID_ARG;
+    }
+    const size_t szSegment = sizeof(tSegmentHeader) + nSlotCount * s_nSlotSize;
+
+    fep::Result nResult = ERR_OPEN_FAILED;
+    for (int nAttempt = 0; nAttempt < s_nOpenAttempts && ERR_OPEN_FAILED == nResult; ++nAttempt)
+    {
+        int nFd = shm_open(strName.c_str(), O_RDWR | O_CREAT, 0666);
+        if (nFd < 0)
+        {
+            break;
+        }
+        // the lock serializes initialization, attaching and detaching
+        if (0 != flock(nFd, LOCK_EX))
+        {
+            close(nFd);
+            break;
+        }
+
+        struct stat oStat;
+        if (0 != fstat(nFd, &oStat))
+        {
+            close(nFd);
+            break;
+        }
+        if (0 == oStat.st_nlink)
+        {
+            // the last user removed the segment in the meantime, open a fresh one
+            close(nFd);
+            continue;
+        }
+
+        bool bInitialize = false;
+        size_t szMapping = static_cast<size_t>(oStat.st_size);
+        if (0 == szMapping)
+        {
+            // the creation mode is masked by the umask, participants may run as different users
+            if (0 != fchmod(nFd, 0666) || 0 != ftruncate(nFd, static_cast<off_t>(szSegment)))
+            {
+                shm_unlink(strName.c_str());
+                close(nFd);
+                break;
+            }
+            szMapping = szSegment;
+            bInitialize = true;
+        }
+        else if (szMapping < sizeof(tSegmentHeader))
+        {
+            close(nFd);
+            nResult = ERR_INVALID_FILE;
+            break;
+        }
+
+        void* pMapping = mmap(NULL, szMapping, PROT_READ | PROT_WRITE, MAP_SHARED, nFd, 0);
+        if (MAP_FAILED == pMapping)
+        {
+            close(nFd);
+            break;
+        }
+        tSegmentHeader* pHeader = static_cast<tSegmentHeader*>(pMapping);
+        if (bInitialize)
+        {
+            // the memory is zeroed by ftruncate, which is a valid state for all atomics
+            pHeader->nVersion = s_nSegmentVersion;
+            pHeader->nSlotCount = static_cast<uint32_t>(nSlotCount);
+            pHeader->nSlotSize = s_nSlotSize;
+            pHeader->nMagic = s_nSegmentMagic;
+        }
+        else if (s_nSegmentMagic != pHeader->nMagic || s_nSegmentVersion != pHeader->nVersion
+            || pHeader->nSlotSize <= sizeof(tSlotHeader) || 0 == pHeader->nSlotCount
+            || szMapping != sizeof(tSegmentHeader)
+                + static_cast<size_t>(pHeader->nSlotCount) * pHeader->nSlotSize)
+        {
+            munmap(pMapping, szMapping);
+            close(nFd);
+            nResult = ERR_INVALID_FILE;
+            break;
+        }
+
+        ++pHeader->nUsers;
+        flock(nFd, LOCK_UN);
+
+        m_strName = strName;
+        m_nFd = nFd;
+        m_pHeader = pHeader;
+        m_szMapping = szMapping;
+        m_pSlots = static_cast<uint8_t*>(pMapping) + sizeof(tSegmentHeader);
+        m_nSlotCount = pHeader->nSlotCount;
+        m_nSlotSize = pHeader->nSlotSize;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+void cShmSegment::Close()
+{
+    if (NULL != m_pHeader)
+    {
+        flock(m_nFd, LOCK_EX);
+        if (0 == --m_pHeader->nUsers)
+        {
+            shm_unlink(m_strName.c_str());
+        }
+        flock(m_nFd, LOCK_UN);
+        munmap(m_pHeader, m_szMapping);
+        close(m_nFd);
+
+        m_nFd = -1;
+        m_pHeader = NULL;
+        m_szMapping = 0;
+        m_pSlots = NULL;
+        m_nSlotCount = 0;
+        m_nSlotSize = 0;
+    }
+}
+
+size_t cShmSegment::GetMaxSampleSize() const
+{
+    return (m_nSlotCount / s_nSamplesPerRing) * GetSlotPayload();
+}
+
+fep::Result cShmSegment::Write(const void* pData, size_t szSize)
+{
+    if (NULL == m_pHeader)
+    {
+        return ERR_NOT_INITIALISED;
+    }
+    if (szSize > GetMaxSampleSize())
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    const size_t szPayload = GetSlotPayload();
+    const uint32_t nFragments = static_cast<uint32_t>(std::max<size_t>(1, (szSize + szPayload - 1) / szPayload));
+    const uint8_t* pSource = static_cast<const uint8_t*>(pData);
+    const uint64_t nTicket = m_pHeader->nWriteIndex.fetch_add(nFragments);
+
+    for (uint32_t nFragment = 0; nFragment < nFragments; ++nFragment)
+    {
+        const uint64_t nIndex = nTicket + nFragment;
+        tSlotHeader* pSlot = GetSlot(nIndex);
+
+        // Lock the slot. It is only still locked if this transmitter lapped another one, a
+        // crashed transmitter must not block the slot forever though.
+        uint64_t nSequence = pSlot->nSequence.load(std::memory_order_relaxed);
+        for (int nSpins = 0;;)
+        {
+            if (0 == (nSequence & 1) || nSpins++ >= s_nMaxLockSpins)
+            {
+                if (pSlot->nSequence.compare_exchange_weak(nSequence, 2 * nIndex + 1,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else
+            {
+                std::this_thread::yield();
+                nSequence = pSlot->nSequence.load(std::memory_order_relaxed);
+            }
+        }
+
+        const size_t szOffset = nFragment * szPayload;
+        pSlot->nSampleSize = static_cast<uint32_t>(szSize);
+        pSlot->nFragment = nFragment;
+        pSlot->nFragmentCount = nFragments;
+        ::memcpy(reinterpret_cast<uint8_t*>(pSlot) + sizeof(tSlotHeader), pSource + szOffset,
+            std::min(szPayload, szSize - szOffset));
+        pSlot->nSequence.store(2 * nIndex + 2, std::memory_order_release);
+    }
+
+    m_pHeader->nNotify.fetch_add(1);
+    if (0 < m_pHeader->nWaiters.load())
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_pHeader->nNotify), FUTEX_WAKE,
+            INT_MAX, NULL, NULL, 0);
+    }
+    return ERR_NOERROR;
+}
+
+uint64_t cShmSegment::GetWriteIndex() const
+{
+    return NULL == m_pHeader ? 0 : m_pHeader->nWriteIndex.load(std::memory_order_acquire);
+}
+
+cShmSegment::tReadResult cShmSegment::Read(uint64_t& nCursor, std::vector<uint8_t>& vecBuffer) const
+{
+    if (NULL == m_pHeader)
+    {
+        return RR_Empty;
+    }
+    const uint64_t nWriteIndex = m_pHeader->nWriteIndex.load(std::memory_order_acquire);
+    if (nWriteIndex - nCursor > m_nSlotCount)
+    {
+        SkipLost(nCursor);
+        return RR_Lost;
+    }
+
+    const size_t szPayload = GetSlotPayload();
+    const size_t szStart = vecBuffer.size();
+    while (nCursor < nWriteIndex)
+    {
+        const tSlotHeader* pFirst = GetSlot(nCursor);
+        const uint64_t nFirstSequence = pFirst->nSequence.load(std::memory_order_acquire);
+        if (nFirstSequence < 2 * nCursor + 2)
+        {
+            // not published yet
+            return RR_Empty;
+        }
+        if (nFirstSequence > 2 * nCursor + 2)
+        {
+            SkipLost(nCursor);
+            return RR_Lost;
+        }
+
+        const uint32_t nFragment = pFirst->nFragment;
+        const uint32_t nFragments = pFirst->nFragmentCount;
+        const size_t szSample = pFirst->nSampleSize;
+        if (0 != nFragment)
+        {
+            // the rest of a sample the cursor joined in the middle of
+            ++nCursor;
+            continue;
+        }
+        if (0 == nFragments || nFragments > m_nSlotCount
+            || szSample > static_cast<size_t>(nFragments) * szPayload)
+        {
+            SkipLost(nCursor);
+            return RR_Lost;
+        }
+        if (nCursor + nFragments > nWriteIndex)
+        {
+            return RR_Empty;
+        }
+
+        vecBuffer.resize(szStart + szSample);
+        for (uint32_t nIdx = 0; nIdx < nFragments; ++nIdx)
+        {
+            const uint64_t nIndex = nCursor + nIdx;
+            const tSlotHeader* pSlot = GetSlot(nIndex);
+            const uint64_t nSequence = pSlot->nSequence.load(std::memory_order_acquire);
+            if (nSequence != 2 * nIndex + 2)
+            {
+                vecBuffer.resize(szStart);
+                if (nSequence < 2 * nIndex + 2)
+                {
+                    return RR_Empty;
+                }
+                SkipLost(nCursor);
+                return RR_Lost;
+            }
+
+            const size_t szOffset = nIdx * szPayload;
+            const size_t szChunk = std::min(szPayload, szSample - std::min(szSample, szOffset));
+            const bool bConsistent = pSlot->nFragment == nIdx && pSlot->nFragmentCount == nFragments
+                && pSlot->nSampleSize == szSample;
+            if (bConsistent && 0 < szChunk)
+            {
+                ::memcpy(&vecBuffer[szStart + szOffset],
+                    reinterpret_cast<const uint8_t*>(pSlot) + sizeof(tSlotHeader), szChunk);
+            }
+
+            // the slot must not have been reused while copying
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (!bConsistent || pSlot->nSequence.load(std::memory_order_relaxed) != nSequence)
+            {
+                vecBuffer.resize(szStart);
+                SkipLost(nCursor);
+                return RR_Lost;
+            }
+        }
+        nCursor += nFragments;
+        return RR_Sample;
+    }
+    return RR_Empty;
+}
+
+uint32_t cShmSegment::GetNotifyToken() const
+{
+    return NULL == m_pHeader ? 0 : m_pHeader->nNotify.load();
+}
+
+void cShmSegment::Wait(uint32_t nToken, uint32_t nTimeoutMs) const
+{
+    if (NULL != m_pHeader)
+    {
+        struct timespec oTimeout;
+        oTimeout.tv_sec = nTimeoutMs / 1000;
+        oTimeout.tv_nsec = static_cast<long>(nTimeoutMs % 1000) * 1000000;
+        m_pHeader->nWaiters.fetch_add(1);
+        // returns immediately if a transmitter notified after the token was taken
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_pHeader->nNotify), FUTEX_WAIT,
+            nToken, &oTimeout, NULL, 0);
+        m_pHeader->nWaiters.fetch_sub(1);
+    }
+}
+
+std::string cShmSegment::GetSegmentName(int nDomainId, const std::string& strSignalName)
+{
+    // FNV-1a keeps names apart that only differ in replaced or truncated characters
+    uint32_t nHash = 2166136261u;
+    std::string strSanitized;
+    for (std::string::const_iterator it = strSignalName.begin(); it != strSignalName.end(); ++it)
+    {
+        nHash ^= static_cast<uint8_t>(*it);
+        nHash *= 16777619u;
+        if (strSanitized.size() < s_szMaxNameLength)
+        {
+            const char c = *it;
+            const bool bValid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+                || (c >= '0' && c <= '9') || '_' == c || '-' == c || '.' == c;
+            strSanitized.push_back(bValid ? c : '_');
+        }
+    }
+    return a_util::strings::format("/fep_shm_%d_%s_%08x", nDomainId, strSanitized.c_str(), nHash);
+}
+
+cShmSegment::tSlotHeader* cShmSegment::GetSlot(uint64_t nIndex) const
+{
+    return reinterpret_cast<tSlotHeader*>(m_pSlots + (nIndex % m_nSlotCount) * m_nSlotSize);
+}
+
+size_t cShmSegment::GetSlotPayload() const
+{
+    return m_nSlotSize - sizeof(tSlotHeader);
+}
+
+void cShmSegment::SkipLost(uint64_t& nCursor) const
+{
+    // continue in the middle of the ring, this leaves the transmitters room before
+    // the cursor is overtaken again
+    const uint64_t nWriteIndex = m_pHeader->nWriteIndex.load(std::memory_order_acquire);
+    const uint64_t nRestart = nWriteIndex > m_nSlotCount / 2 ? nWriteIndex - m_nSlotCount / 2 : 0;
+    nCursor = std::max(nCursor + 1, nRestart);
+}
+
+#endif // __linux__
@@ -0,0 +1,213 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_SHM_SEGMENT_H_
+#define _FEP_SHM_SEGMENT_H_
+
+#ifdef __linux__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "fep_result_decl.h"
+
+namespace fep
+{
+    namespace shm
+    {
+        /**
+        * @brief The cShmSegment class
+        * A ring of fixed size slots in a POSIX shared memory object (/dev/shm) used to exchange
+        * the samples of one signal between all participants of a domain on the same host.
+        *
+        * Any number of transmitters and receivers may attach to a segment. Transmitters claim
+        * consecutive slots by incrementing the write index and publish each slot by setting its
+        * sequence number (seqlock), samples larger than a slot span several slots. Receivers keep
+        * their own read cursor and copy the samples out of the ring without any system call.
+        * Waiting receivers are woken up via a futex in the segment header.
+        *
+        * The first participant attaching creates the segment, the last one detaching removes it.
+        */
+        class cShmSegment
+        {
+        public:
+            /// Result of \ref Read
+            enum tReadResult
+            {
+                /// A sample was read
+                RR_Sample,
+                /// No (completely published) sample available
+                RR_Empty,
+                /// Samples were overwritten before they could be read, the cursor was moved on
+                RR_Lost
+            };
+
+        public:
+            /// CTOR
+            cShmSegment();
+
+            /// DTOR
+            ~cShmSegment();
+
+            /**
+            * The method \ref Open attaches to the segment and creates it if it does not exist yet.
+            * The layout of a newly created segment is chosen so that several samples of the given
+            * size fit into the ring.
+            *
+            * @param [in] strName Name of the shared memory object (see \ref GetSegmentName)
+            * @param [in] szSampleSize Maximum size of a sample
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            * @retval ERR_INVALID_FILE  The existing segment has an unknown layout
+            * @retval ERR_OPEN_FAILED  The segment could not be opened or created
+            */
+            fep::Result Open(const std::string& strName, size_t szSampleSize);
+
+            /**
+            * The method \ref Close detaches from the segment and removes it if no other
+            * participant is attached anymore.
+            */
+            void Close();
+
+            /**
+            * @returns the maximum size of a sample that can be written to the segment
+            */
+            size_t GetMaxSampleSize() const;
+
+            /**
+            * The method \ref Write copies a sample into the ring and wakes up waiting receivers.
+            *
+            * @param [in] pData Pointer to the sample
+            * @param [in] szSize Size of the sample
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            * @retval ERR_INVALID_ARG  The sample is larger than \ref GetMaxSampleSize
+            * @retval ERR_NOT_INITIALISED  The segment is not open
+            */
+            fep::Result Write(const void* pData, size_t szSize);
+
+            /**
+            * @returns the index the next sample will be written to, a receiver starts reading there
+            */
+            uint64_t GetWriteIndex() const;
+
+            /**
+            * The method \ref Read appends the next sample at the read cursor to the given buffer
+            * and moves the cursor on.
+            *
+            * @param [in,out] nCursor Read cursor of the receiver
+            * @param [in,out] vecBuffer Buffer the sample is appended to
+            * @returns  see \ref tReadResult
+            */
+            tReadResult Read(uint64_t& nCursor, std::vector<uint8_t>& vecBuffer) const;
+
+            /**
+            * @returns the current notification token to be passed to \ref Wait. The token has to
+            *          be taken before checking for samples so that no notification is missed.
+            */
+            uint32_t GetNotifyToken() const;
+
+            /**
+            * The method \ref Wait blocks until a transmitter notified a new sample after the
+            * token was taken or the timeout expired.
+            *
+            * @param [in] nToken Token returned by \ref GetNotifyToken
+            * @param [in] nTimeoutMs Timeout in milliseconds
+            */
+            void Wait(uint32_t nToken, uint32_t nTimeoutMs) const;
+
+            /**
+            * The method \ref GetSegmentName returns the name of the shared memory object of
+            * a signal. The name is derived from the domain and the signal name only, this
+            * is how the participants find each other.
+            *
+            * @param [in] nDomainId Domain id
+            * @param [in] strSignalName Name of the signal
+            * @returns the name (starting with "/")
+            */
+            static std::string GetSegmentName(int nDomainId, const std::string& strSignalName);
+
+        private:
+            /// Header at the start of every segment
+            struct tSegmentHeader
+            {
+                /// Magic number, set when the segment is initialized
+                uint32_t nMagic;
+                /// Layout version
+                uint32_t nVersion;
+                /// Number of slots
+                uint32_t nSlotCount;
+                /// Size of a slot including its \ref tSlotHeader
+                uint32_t nSlotSize;
+                /// Number of attached participants (only changed under the file lock)
+                uint32_t nUsers;
+                /// Index of the next slot to be claimed by a transmitter
+                alignas(64) std::atomic<uint64_t> nWriteIndex;
+                /// Notification counter (futex word)
+                alignas(64) std::atomic<uint32_t> nNotify;
+                /// Number of receivers waiting on the futex
+                std::atomic<uint32_t> nWaiters;
+            };
+
+            /// Header at the start of every slot
+            struct tSlotHeader
+            {
+                /// 2 * index + 1 while written, 2 * index + 2 once published
+                std::atomic<uint64_t> nSequence;
+                /// Size of the whole sample
+                uint32_t nSampleSize;
+                /// Index of the fragment within the sample
+                uint32_t nFragment;
+                /// Number of fragments (slots) of the sample
+                uint32_t nFragmentCount;
+                /// Reserved
+                uint32_t nReserved;
+            };
+
+            /// @returns the slot for the given index
+            tSlotHeader* GetSlot(uint64_t nIndex) const;
+
+            /// @returns the payload size of a slot
+            size_t GetSlotPayload() const;
+
+            /// Moves the cursor behind the overwritten part of the ring
+            void SkipLost(uint64_t& nCursor) const;
+
+        private:
+            /// Name of the shared memory object
+            std::string m_strName;
+            /// File descriptor of the shared memory object
+            int m_nFd;
+            /// Mapped segment
+            tSegmentHeader* m_pHeader;
+            /// Size of the mapping
+            size_t m_szMapping;
+            /// First slot
+            uint8_t* m_pSlots;
+            /// Number of slots (copied from the header)
+            uint32_t m_nSlotCount;
+            /// Size of a slot (copied from the header)
+            uint32_t m_nSlotSize;
+        };
+    }
+}
+
+#endif // __linux__
+#endif // _FEP_SHM_SEGMENT_H_
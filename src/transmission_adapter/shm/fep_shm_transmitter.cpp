@@ -0,0 +1,115 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifdef __linux__
+
+#include <mutex>
+#include <string>
+#include <a_util/concurrency/fast_mutex.h>
+#include <a_util/result/result_type.h>
+#include <a_util/strings/strings_format.h>
+
+#include "fep_errors.h"
+#include "transmission_adapter/shm/fep_shm_transmitter.h"
+
+using namespace fep::shm;
+
+cShmTransmit::cShmTransmit() :
+    m_bIsMuted(false),
+    m_bIsActivated(false)
+{
+}
+
+cShmTransmit::~cShmTransmit()
+{
+}
+
+fep::Result cShmTransmit::Initialize(const fep::cSignalOptions& oOptions,
+    const std::string& strModuleName, int dDomainId)
+{
+    fep::Result nResult = cAbstractShmTransceiver::Initialize(oOptions, strModuleName, dDomainId);
+    if (fep::isOk(nResult) && m_oSegment.GetMaxSampleSize() < m_szSignalSize)
+    {
+        // the segment was created by a participant expecting smaller samples
+        LogMessage(a_util::strings::format("%s: Shared memory segment only holds samples of up to %u bytes,"
+            " the signal has %u bytes - restart all participants using the signal.",
+            m_strSignalName.c_str(), static_cast<unsigned int>(m_oSegment.GetMaxSampleSize()),
+            static_cast<unsigned int>(m_szSignalSize)).c_str(), fep::SL_Critical_Local);
+        m_oSegment.Close();
+        nResult = ERR_INVALID_ARG;
+    }
+    return nResult;
+}
+
+fep::Result cShmTransmit::Transmit(const void *pData, size_t szSize)
+{
+    fep::Result nResult = ERR_NOERROR;
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    if (!m_bIsActivated)
+    {
+        LogMessage(a_util::strings::format("%s: Transmission failure - transmitter is not enabled.",
+            m_strSignalName.c_str()).c_str(), fep::SL_Warning);
+        nResult = ERR_INVALID_STATE;
+    }
+    else if (NULL == pData || 0 >= szSize)
+    {
+        nResult = ERR_INVALID_ARG;
+    }
+    else if (!m_bIsVariableSignalSize && szSize != m_szSignalSize)
+    {
+        nResult = ERR_FAILED;
+    }
+    else if (!m_bIsMuted)
+    {
+        nResult = m_oSegment.Write(pData, szSize);
+        if (fep::isFailed(nResult))
+        {
+            LogMessage(a_util::strings::format("%s: Transmission failure - sample of %u bytes does not fit"
+                " into the shared memory segment.", m_strSignalName.c_str(),
+                static_cast<unsigned int>(szSize)).c_str(), fep::SL_Warning);
+        }
+    }
+    return nResult;
+}
+
+fep::Result cShmTransmit::Enable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    m_bIsActivated = true;
+    return ERR_NOERROR;
+}
+
+fep::Result cShmTransmit::Disable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    m_bIsActivated = false;
+    return ERR_NOERROR;
+}
+
+fep::Result cShmTransmit::Mute()
+{
+    m_bIsMuted = true;
+    return ERR_NOERROR;
+}
+
+fep::Result cShmTransmit::Unmute()
+{
+    m_bIsMuted = false;
+    return ERR_NOERROR;
+}
+
+#endif // __linux__
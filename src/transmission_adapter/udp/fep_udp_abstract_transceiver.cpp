@@ -0,0 +1,86 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifdef __linux__
+
+#include "fep_errors.h"
+#include "transmission_adapter/fep_signal_options.h"
+#include "transmission_adapter/udp/fep_udp_abstract_transceiver.h"
+
+using namespace fep::udp;
+
+cAbstractUdpTransceiver::cAbstractUdpTransceiver() :
+    m_szBufferSize(0),
+    m_szSignalSize(0),
+    m_bIsVariableSignalSize(false),
+    m_pLoggingFunc(NULL),
+    m_pCalleeLogging(NULL)
+{
+    m_oEndpoint.nGroup = 0;
+    m_oEndpoint.nPort = 0;
+    m_oEndpoint.nSignalHash = 0;
+}
+
+cAbstractUdpTransceiver::~cAbstractUdpTransceiver()
+{
+    m_oSocket.Close();
+}
+
+fep::Result cAbstractUdpTransceiver::Initialize(const fep::cSignalOptions& oOptions,
+    const std::string& strModuleName, int dDomainId, const std::string& strInterface,
+    size_t szBufferSize)
+{
+    fep::Result nResult = fep::ERR_INVALID_ARG;
+    if (!strModuleName.empty()
+        && oOptions.GetOption("SignalName", m_strSignalName)
+        && oOptions.GetOption("SignalSize", m_szSignalSize)
+        && cUdpSocket::GetEndpoint(dDomainId, m_strSignalName, m_oEndpoint))
+    {
+        m_strModuleName = strModuleName;
+        m_strInterface = strInterface;
+        m_szBufferSize = szBufferSize;
+        if (false == oOptions.GetOption("IsVariableSignalSize", m_bIsVariableSignalSize))
+        {
+            m_bIsVariableSignalSize = false;
+        }
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+fep::Result cAbstractUdpTransceiver::RegisterLogging(ITransmissionDriver::tLoggingFuncPtr pLoggingFunc,
+    void * pCallee)
+{
+    fep::Result nResult = ERR_INVALID_ARG;
+    if (NULL != pLoggingFunc && NULL != pCallee)
+    {
+        m_pCalleeLogging = pCallee;
+        m_pLoggingFunc = pLoggingFunc;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+void cAbstractUdpTransceiver::LogMessage(const char* strMessage, fep::tSeverityLevel eServLevel)
+{
+    if (NULL != m_pLoggingFunc && NULL != m_pCalleeLogging)
+    {
+        m_pLoggingFunc(m_pCalleeLogging, strMessage, eServLevel);
+    }
+}
+
+#endif // __linux__
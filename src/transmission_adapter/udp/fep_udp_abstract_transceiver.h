@@ -0,0 +1,119 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_UDP_TRANSCEIVER_H_
+#define _FEP_UDP_TRANSCEIVER_H_
+
+#ifdef __linux__
+
+#include <cstddef>
+#include <string>
+
+#include "fep_result_decl.h"
+#include "incident_handler/fep_severity_level.h"
+#include "transmission_adapter/fep_transmission_driver_intf.h"
+#include "transmission_adapter/udp/fep_udp_header.h"
+#include "transmission_adapter/udp/fep_udp_socket.h"
+
+namespace fep
+{
+    class cSignalOptions;
+
+    namespace udp
+    {
+        /**
+         * @brief The cAbstractUdpTransceiver class
+         * This is the base class for all UDP receiver and transmitter objects.
+         * It determines the multicast address of the signal and provides the logging.
+         */
+        class cAbstractUdpTransceiver
+        {
+        public:
+            /**
+            * CTOR
+            */
+            cAbstractUdpTransceiver();
+
+            /**
+            * DTOR
+            */
+            virtual ~cAbstractUdpTransceiver();
+
+            /**
+            * The method \ref Initialize prepares a Transmitter or Receiver for the signal
+            *
+            * @param [in] oOptions  SignalOptions
+            * @param [in] strModuleName Name of the fep module
+            * @param [in] dDomainId DomainID
+            * @param [in] strInterface Address or name of the network interface (empty for default)
+            * @param [in] szBufferSize Requested size of the socket buffer
+            * @return Standard Error code
+            * @retval ERR_INVALID_ARG Mandatory options are missing or the domain id is out of range
+            * @retval ERR_OPEN_FAILED The socket could not be opened
+            * @retval ERR_NOERROR Everything went fine
+            */
+            virtual fep::Result Initialize(const fep::cSignalOptions& oOptions,
+                const std::string& strModuleName, int dDomainId, const std::string& strInterface,
+                size_t szBufferSize);
+
+            /**
+            *Register Logging Function
+            * @param [in] pLoggingFunc Pointer to the logging function
+            * @param [in] pCallee Pointer to the object providing the logging callback
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result RegisterLogging(ITransmissionDriver::tLoggingFuncPtr pLoggingFunc, void * pCallee);
+
+        protected:
+            /**
+            * @brief LogMessage Logs error messages to the registered callback
+            * @param strMessage The Message to log
+            * @param eServLevel The serverity of the incident to be reported
+            */
+            void LogMessage(const char* strMessage, fep::tSeverityLevel eServLevel);
+
+        protected:
+            /// Socket of the signal
+            cUdpSocket m_oSocket;
+            /// Multicast address of the signal
+            cUdpSocket::tEndpoint m_oEndpoint;
+            /// Address or name of the network interface
+            std::string m_strInterface;
+            /// Requested size of the socket buffer
+            size_t m_szBufferSize;
+            /// Module Name
+            std::string m_strModuleName;
+            /// Signal name
+            std::string m_strSignalName;
+            /// Signal Size
+            size_t m_szSignalSize;
+            /// Flag indicating that signal is of variable size
+            bool m_bIsVariableSignalSize;
+
+        private:
+            //Logging members
+            /// Logging Function pointer
+            ITransmissionDriver::tLoggingFuncPtr m_pLoggingFunc;
+            /// Logging object
+            void* m_pCalleeLogging;
+        };
+    }
+}
+
+#endif // __linux__
+#endif //_FEP_UDP_TRANSCEIVER_H_
@@ -0,0 +1,125 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_UDP_DRIVER_H_
+#define _FEP_UDP_DRIVER_H_
+
+#ifdef __linux__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <a_util/concurrency/detail/fast_mutex_decl.h>
+
+#include "fep_participant_export.h"
+#include "fep_result_decl.h"
+#include "transmission_adapter/fep_transmission_driver_intf.h"
+#include "transmission_adapter/udp/fep_udp_header.h"
+
+namespace fep
+{
+    class IOptionsVerifier;
+    class IReceive;
+    class ITransmit;
+    class cDriverOptions;
+    class cSignalOptions;
+
+    namespace udp
+    {
+        class cUdpReceive;
+        class cUdpTransmit;
+
+        /**
+        * Lightweight transmission driver based on UDP multicast. Every signal is sent to its own
+        * multicast group, so a sample is sent once regardless of the number of receivers.
+        * Samples are fragmented into datagrams (see \ref FragmentingWriter) that are passed to
+        * and taken from the kernel in batches.
+        */
+        class FEP_PARTICIPANT_EXPORT cUdpDriver : public ITransmissionDriver
+        {
+        public:
+            /**
+            * CTOR
+            * @param [in] szSendBufferSize Requested size of the socket send buffer of every transmitter
+            * @param [in] szReceiveBufferSize Requested size of the socket receive buffer of every receiver
+            *             (limited by net.core.rmem_max unless the process has CAP_NET_ADMIN)
+            */
+            cUdpDriver(size_t szSendBufferSize = UDP_DEFAULT_SEND_BUFFER_SIZE,
+                size_t szReceiveBufferSize = UDP_DEFAULT_RECEIVE_BUFFER_SIZE);
+
+            /**
+            * DTOR
+            */
+            virtual ~cUdpDriver();
+
+            /// @copydoc ITransmissionDriver::Initialize
+            fep::Result Initialize(const cDriverOptions oDriverOptions);
+
+            /// @copydoc ITransmissionDriver::Deinitialize
+            fep::Result Deinitialize();
+
+            /// @copydoc ITransmissionDriver::CreateReceiver
+            fep::Result CreateReceiver(IReceive *&pIReceiver, const cSignalOptions oOptions);
+
+            /// @copydoc ITransmissionDriver::CreateTransmitter
+            fep::Result CreateTransmitter(ITransmit *&pITransmit, const cSignalOptions oOptions);
+
+            /// @copydoc ITransmissionDriver::DestroyReceiver
+            fep::Result DestroyReceiver(IReceive *pIReceiver);
+
+            /// @copydoc ITransmissionDriver::DestroyTransmitter
+            fep::Result DestroyTransmitter(ITransmit *pITransmiter);
+
+            /// @copydoc ITransmissionDriver::GetSignalOptionsVerifier
+            IOptionsVerifier * GetSignalOptionsVerifier();
+
+            /// @copydoc ITransmissionDriver::GetDriverOptionsVerifier
+            IOptionsVerifier * GetDriverOptionsVerifier();
+
+            /// @copydoc ITransmissionDriver::RegisterLogging
+            fep::Result RegisterLogging(tLoggingFuncPtr pLoggingFunc, void * pCallee);
+
+        private:
+            /// Mutex protecting the receiver and transmitter lists
+            a_util::concurrency::fast_mutex m_mtxTransceivers;
+            /// List of Receivers
+            std::vector<cUdpReceive*> m_vecReceivers;
+            /// List of Transmitters
+            std::vector<cUdpTransmit*> m_vecTransmitters;
+            /// Domain ID
+            int m_dDomainId;
+            /// ModuleName
+            std::string m_strModuleName;
+            /// Address or name of the network interface (empty for default)
+            std::string m_strInterface;
+            /// Requested size of the socket send buffers
+            size_t m_szSendBufferSize;
+            /// Requested size of the socket receive buffers
+            size_t m_szReceiveBufferSize;
+            /// Flag indicating that the driver is initialized
+            bool m_bInitialized;
+            //Logging members
+            /// Logging Function
+            ITransmissionDriver::tLoggingFuncPtr m_pLoggingFunc;
+            /// Object providing the logging function
+            void* m_pCalleeLogging;
+        };
+    }
+}
+
+#endif // __linux__
+#endif //_FEP_UDP_DRIVER_H_
@@ -0,0 +1,51 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_UDP_HEADER_H_
+#define _FEP_UDP_HEADER_H_
+
+#include <cstdint>
+
+#include "transmission_adapter/fep_fragmentation.h"
+
+#define UDP_DRIVER_PROTOCOL_VERSION 1
+/// largest datagram that does not get fragmented by IP on an ethernet link (1500 - 20 - 8)
+#define UDP_MAX_PACKET_SIZE 1472
+#define UDP_FRAGMENTATION_BOUNDARY (UDP_MAX_PACKET_SIZE - sizeof(fep::udp::tSignalHeader) - sizeof(fep::Fragment))
+/// port of domain 0, the port of every other domain is offset by its domain id
+#define UDP_BASE_PORT 17400
+/// number of datagrams passed to the kernel with one sendmmsg/recvmmsg call
+#define UDP_BATCH_SIZE 64
+#define UDP_DEFAULT_SEND_BUFFER_SIZE (1024 * 1024)
+#define UDP_DEFAULT_RECEIVE_BUFFER_SIZE (8 * 1024 * 1024)
+
+namespace fep
+{
+    namespace udp
+    {
+        /// Precedes every fragment on the wire (little endian), tells signals sharing a group apart
+#pragma pack(push, 1)
+        struct tSignalHeader
+        {
+            /// hash of the signal name
+            uint32_t nSignalHash;
+        };
+#pragma pack(pop)
+    }
+}
+
+#endif //_FEP_UDP_HEADER_H_
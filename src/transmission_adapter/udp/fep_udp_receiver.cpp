@@ -0,0 +1,213 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifdef __linux__
+
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <a_util/concurrency/fast_mutex.h>
+#include <a_util/result/result_type.h>
+#include <a_util/strings/strings_format.h>
+
+#include "fep_errors.h"
+#include "transmission_adapter/udp/fep_udp_receiver.h"
+
+using namespace fep::udp;
+
+/// Time the reception thread waits at most for a datagram before checking whether it has to stop
+static const uint32_t s_nReceiveTimeoutMs = 50;
+
+cUdpReceive::cUdpReceive() :
+    m_bIsMuted(false),
+    m_bStop(false),
+    m_pCallback(NULL),
+    m_pZeroCopyCallback(NULL),
+    m_pBufferPool(std::make_shared<tBufferPool>()),
+    m_pCallee(NULL),
+    m_vecBatchData(UDP_BATCH_SIZE * UDP_MAX_PACKET_SIZE),
+    m_vecIoVectors(UDP_BATCH_SIZE),
+    m_vecMessages(UDP_BATCH_SIZE)
+{
+    memset(&m_vecMessages[0], 0, m_vecMessages.size() * sizeof(mmsghdr));
+    for (size_t nIdx = 0; nIdx < UDP_BATCH_SIZE; ++nIdx)
+    {
+        m_vecIoVectors[nIdx].iov_base = &m_vecBatchData[nIdx * UDP_MAX_PACKET_SIZE];
+        m_vecIoVectors[nIdx].iov_len = UDP_MAX_PACKET_SIZE;
+        m_vecMessages[nIdx].msg_hdr.msg_iov = &m_vecIoVectors[nIdx];
+        m_vecMessages[nIdx].msg_hdr.msg_iovlen = 1;
+    }
+}
+
+cUdpReceive::~cUdpReceive()
+{
+    Disable();
+}
+
+fep::Result cUdpReceive::SetReceiver(tCallbackFuncPtr pCallback, void * pCallee)
+{
+    fep::Result nResult = ERR_POINTER;
+    if ((NULL != pCallback && NULL != pCallee)
+        || (NULL == pCallback && NULL == pCallee))
+    {
+        std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oCallbackGuard);
+        m_pCallback = pCallback;
+        m_pZeroCopyCallback = NULL;
+        m_pCallee = pCallee;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+fep::Result cUdpReceive::SetZeroCopyReceiver(tZeroCopyCallbackFuncPtr pCallback, void * pCallee)
+{
+    fep::Result nResult = ERR_POINTER;
+    if ((NULL != pCallback && NULL != pCallee)
+        || (NULL == pCallback && NULL == pCallee))
+    {
+        std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oCallbackGuard);
+        m_pZeroCopyCallback = pCallback;
+        m_pCallback = NULL;
+        m_pCallee = pCallee;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+fep::Result cUdpReceive::Enable()
+{
+    fep::Result nResult = ERR_NOERROR;
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    if (!m_pReceptionThread)
+    {
+        nResult = m_oSocket.OpenReceiver(m_oEndpoint, m_strInterface, m_szBufferSize, s_nReceiveTimeoutMs);
+        if (fep::isOk(nResult))
+        {
+            if (m_oSocket.GetBufferSize() < m_szBufferSize)
+            {
+                LogMessage(a_util::strings::format("%s: Socket receive buffer limited to %u bytes by the system"
+                    " (net.core.rmem_max), samples might get lost.", m_strSignalName.c_str(),
+                    static_cast<unsigned int>(m_oSocket.GetBufferSize())).c_str(), fep::SL_Info);
+            }
+            m_bStop = false;
+            m_pReceptionThread.reset(new std::thread(&cUdpReceive::ReceiveFragments, this));
+        }
+        else
+        {
+            LogMessage(a_util::strings::format("%s: Unable to join multicast group - %s",
+                m_strSignalName.c_str(), strerror(errno)).c_str(), fep::SL_Critical_Local);
+        }
+    }
+    return nResult;
+}
+
+fep::Result cUdpReceive::Disable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    if (m_pReceptionThread)
+    {
+        m_bStop = true;
+        m_pReceptionThread->join();
+        m_pReceptionThread.reset();
+        m_oSocket.Close();
+    }
+    return ERR_NOERROR;
+}
+
+fep::Result cUdpReceive::Mute()
+{
+    m_bIsMuted = true;
+    return ERR_NOERROR;
+}
+
+fep::Result cUdpReceive::Unmute()
+{
+    m_bIsMuted = false;
+    return ERR_NOERROR;
+}
+
+uint64_t cUdpReceive::GetLostSampleCount() const
+{
+    return getLostSampleCount();
+}
+
+void cUdpReceive::ReceiveFragments()
+{
+    const uint32_t nSignalHash = htole32(m_oEndpoint.nSignalHash);
+    while (!m_bStop)
+    {
+        const unsigned int nCount = m_oSocket.Receive(&m_vecMessages[0], UDP_BATCH_SIZE);
+        uint32_t nLost = 0;
+        for (unsigned int nIdx = 0; nIdx < nCount; ++nIdx)
+        {
+            const msghdr& sMessage = m_vecMessages[nIdx].msg_hdr;
+            const uint8_t* pDatagram = static_cast<const uint8_t*>(sMessage.msg_iov->iov_base);
+            const uint32_t nLength = m_vecMessages[nIdx].msg_len;
+            // foreign or truncated datagrams and signals sharing the multicast group are skipped
+            if (0 == (sMessage.msg_flags & MSG_TRUNC)
+                && sizeof(tSignalHeader) + sizeof(Fragment) <= nLength
+                && 0 == memcmp(pDatagram, &nSignalHash, sizeof(nSignalHash)))
+            {
+                nLost += receiveFragment(pDatagram + sizeof(tSignalHeader),
+                    nLength - static_cast<uint32_t>(sizeof(tSignalHeader)));
+            }
+        }
+        if (0 < nLost)
+        {
+            LogMessage(a_util::strings::format("%s : Lost %u sample(s) due to fragment packet loss",
+                m_strSignalName.c_str(), nLost).c_str(), fep::SL_Warning);
+        }
+    }
+}
+
+void cUdpReceive::receiveSample(const void* sample, uint32_t length) noexcept
+{
+    if (!m_bIsMuted)
+    {
+        std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oCallbackGuard);
+        if (NULL != m_pCallback && NULL != m_pCallee)
+        {
+            m_pCallback(m_pCallee, sample, length);
+        }
+    }
+}
+
+void cUdpReceive::receiveSampleBuffer(std::vector<uint8_t>& sample) noexcept
+{
+    if (!m_bIsMuted)
+    {
+        std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oCallbackGuard);
+        if (NULL != m_pZeroCopyCallback && NULL != m_pCallee)
+        {
+            tBufferPool::tLent* pBuffer = tBufferPool::Lend(m_pBufferPool);
+            if (NULL != pBuffer)
+            {
+                // the reader continues with the capacity of a previously released buffer
+                pBuffer->oValue.swap(sample);
+                m_pZeroCopyCallback(m_pCallee, pBuffer->oValue.data(), pBuffer->oValue.size(),
+                    &tBufferPool::Release, pBuffer);
+            }
+        }
+        else if (NULL != m_pCallback && NULL != m_pCallee)
+        {
+            m_pCallback(m_pCallee, sample.data(), sample.size());
+        }
+    }
+}
+
+#endif // __linux__
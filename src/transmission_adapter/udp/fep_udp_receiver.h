@@ -0,0 +1,178 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_UDP_RECEIVE_H_
+#define _FEP_UDP_RECEIVE_H_
+
+#ifdef __linux__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <a_util/concurrency/detail/fast_mutex_decl.h>
+
+#include "fep_result_decl.h"
+#include "fep_udp_abstract_transceiver.h"
+#include "transmission_adapter/fep_fragmentation.h"
+#include "transmission_adapter/fep_lending_pool.h"
+#include "transmission_adapter/fep_receive_intf.h"
+
+namespace fep
+{
+    namespace udp
+    {
+        using Defragmenter = fep::DefragmentingReader<UDP_DRIVER_PROTOCOL_VERSION, UDP_FRAGMENTATION_BOUNDARY>;
+
+        /**
+        * @brief The cUdpReceive class
+        * Implements the IReceive Interface for the UDP multicast driver. While enabled, the
+        * receiver is member of the multicast group of the signal and a reception thread
+        * reassembles the received fragments.
+        */
+        class cUdpReceive : public IReceive, public cAbstractUdpTransceiver, private Defragmenter
+        {
+            using IReceive::tCallbackFuncPtr;
+            using IReceive::tZeroCopyCallbackFuncPtr;
+
+            ///@cond nodoc
+            friend class cUdpDriver;
+            ///@endcond
+
+        public:
+            /**
+            * The method \ref SetReceiver registers the callback function that is called when data is received.
+            *
+            * @param pCallback Function pointer to callback
+            * @param pCallee Pointer to object providing this callback
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result SetReceiver(tCallbackFuncPtr pCallback, void * pCallee);
+
+            /**
+            * The method \ref SetZeroCopyReceiver registers the callback function that is called when data
+            * is received. The buffer the sample was reassembled in is lent to the callee until it is released.
+            *
+            * @param pCallback Function pointer to callback
+            * @param pCallee Pointer to object providing this callback
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result SetZeroCopyReceiver(tZeroCopyCallbackFuncPtr pCallback, void * pCallee);
+
+            /**
+            * The method \ref Enable joins the multicast group of the signal and starts the
+            * reception thread.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            * @retval ERR_OPEN_FAILED  The socket could not be opened
+            */
+            fep::Result Enable();
+
+            /**
+            * The method \ref Disable stops the reception thread and leaves the multicast group.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Disable();
+
+            /**
+            * The method \ref Mute mutes the receiver so that data is no longer received.
+            * Sample reception with a muted receiver will cause no error report.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Mute();
+
+            /**
+            * The method \ref Unmute unmutes the receiver so that data can be received.
+            * Sample reception with a muted receiver will cause no error report.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Unmute();
+
+            /**
+            * The method \ref GetLostSampleCount returns the number of samples the reassembly
+            * gave up.
+            *
+            * @returns  Number of lost samples
+            */
+            uint64_t GetLostSampleCount() const;
+
+        protected:
+            /**
+            * CTOR
+            */
+            cUdpReceive();
+            /**
+            * DTOR
+            */
+            virtual ~cUdpReceive();
+
+            /// implements DefragmentingReader, hands a reassembled sample to the callback
+            void receiveSample(const void* sample, uint32_t length) noexcept final override;
+
+            /// implements DefragmentingReader, lends the reassembled sample to the zero copy callback
+            void receiveSampleBuffer(std::vector<uint8_t>& sample) noexcept final override;
+
+        private:
+            /// Pool of the reassembly buffers that are lent to the zero copy callee
+            typedef cLendingPool<std::vector<uint8_t>> tBufferPool;
+
+            /**
+            * The method \ref ReceiveFragments runs in the reception thread while the receiver is enabled
+            */
+            void ReceiveFragments();
+
+        private:
+            /// Flag indicating mute state
+            std::atomic<bool> m_bIsMuted;
+            /// Guard for the reception thread
+            a_util::concurrency::fast_mutex m_oActivationGuard;
+            /// Flag indicating that the reception thread has to stop
+            std::atomic<bool> m_bStop;
+            /// Reception thread
+            std::unique_ptr<std::thread> m_pReceptionThread;
+            /// Guard for the callback
+            a_util::concurrency::fast_mutex m_oCallbackGuard;
+            /// Callback that is called when data was received
+            tCallbackFuncPtr m_pCallback;
+            /// Zero copy callback that is called when data was received
+            tZeroCopyCallbackFuncPtr m_pZeroCopyCallback;
+            /// Buffers lent to the zero copy callback
+            std::shared_ptr<tBufferPool> m_pBufferPool;
+            /// Pointer to the Object whoms callback is to be called
+            void* m_pCallee;
+            /// Buffers of the received datagrams
+            std::vector<uint8_t> m_vecBatchData;
+            /// One io vector per datagram
+            std::vector<iovec> m_vecIoVectors;
+            /// Messages passed to recvmmsg
+            std::vector<mmsghdr> m_vecMessages;
+        };
+    }
+}
+
+#endif // __linux__
+#endif //_FEP_UDP_RECEIVE_H_
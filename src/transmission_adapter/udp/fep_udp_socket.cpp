@@ -0,0 +1,237 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifdef __linux__
+
+#include <cerrno>
+#include <cstring>
+#include <thread>
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "fep_errors.h"
+#include "transmission_adapter/udp/fep_udp_header.h"
+#include "transmission_adapter/udp/fep_udp_socket.h"
+
+using namespace fep::udp;
+
+/// number of times a send is retried while the kernel is out of buffers
+static const uint32_t s_nMaxSendRetries = 1000;
+/// first group of the range the signal groups are taken from (239.255.0.0/16, organization local scope)
+static const uint32_t s_nGroupBase = 0xEFFF0000;
+
+/**
+* Resolves the first entry of a comma separated interface list given as address or name
+* @param [in] strInterface The interface list
+* @param [out] oRequest Request with either address or index of the interface set
+*/
+static void ResolveInterface(const std::string& strInterface, ip_mreqn& oRequest)
+{
+    const std::string strFirst = strInterface.substr(0, strInterface.find(','));
+    if (!strFirst.empty())
+    {
+        if (1 != inet_pton(AF_INET, strFirst.c_str(), &oRequest.imr_address))
+        {
+            // unknown names leave the choice to the routing table
+            oRequest.imr_ifindex = static_cast<int>(if_nametoindex(strFirst.c_str()));
+        }
+    }
+}
+
+/**
+* Sets the buffer size of a socket, bypassing the system limit if permitted
+* @param [in] nSocket The socket
+* @param [in] nForceOption SO_SNDBUFFORCE or SO_RCVBUFFORCE
+* @param [in] nOption SO_SNDBUF or SO_RCVBUF
+* @param [in] szBufferSize The requested size
+* @return the effective size
+*/
+static size_t SetBufferSize(int nSocket, int nForceOption, int nOption, size_t szBufferSize)
+{
+    const int nSize = static_cast<int>(szBufferSize);
+    if (0 != setsockopt(nSocket, SOL_SOCKET, nForceOption, &nSize, sizeof(nSize)))
+    {
+        setsockopt(nSocket, SOL_SOCKET, nOption, &nSize, sizeof(nSize));
+    }
+    int nEffectiveSize = 0;
+    socklen_t nLength = sizeof(nEffectiveSize);
+    getsockopt(nSocket, SOL_SOCKET, nOption, &nEffectiveSize, &nLength);
+    // the kernel reports twice the usable size
+    return static_cast<size_t>(nEffectiveSize) / 2;
+}
+
+bool cUdpSocket::GetEndpoint(int dDomainId, const std::string& strSignalName, tEndpoint& oEndpoint)
+{
+    if (0 > dDomainId || 65535 < UDP_BASE_PORT + dDomainId)
+    {
+        return false;
+    }
+    // FNV-1a
+    uint32_t nHash = 2166136261u;
+    for (std::string::const_iterator it = strSignalName.begin(); it != strSignalName.end(); ++it)
+    {
+        nHash = (nHash ^ static_cast<uint8_t>(*it)) * 16777619u;
+    }
+    oEndpoint.nSignalHash = nHash;
+    oEndpoint.nGroup = s_nGroupBase | ((nHash ^ (nHash >> 16)) & 0xFFFF);
+    oEndpoint.nPort = static_cast<uint16_t>(UDP_BASE_PORT + dDomainId);
+    return true;
+}
+
+cUdpSocket::cUdpSocket() :
+    m_nSocket(-1),
+    m_szBufferSize(0)
+{
+}
+
+cUdpSocket::~cUdpSocket()
+{
+    Close();
+}
+
+fep::Result cUdpSocket::OpenTransmitter(const tEndpoint& oEndpoint, const std::string& strInterface,
+    size_t szBufferSize)
+{
+    Close();
+    fep::Result nResult = ERR_OPEN_FAILED;
+    m_nSocket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (0 <= m_nSocket)
+    {
+        ip_mreqn oInterface;
+        memset(&oInterface, 0, sizeof(oInterface));
+        ResolveInterface(strInterface, oInterface);
+        // participants on the same host receive the samples as well
+        const int nLoop = 1;
+        const int nTtl = 1;
+        sockaddr_in oAddress;
+        memset(&oAddress, 0, sizeof(oAddress));
+        oAddress.sin_family = AF_INET;
+        oAddress.sin_addr.s_addr = htonl(oEndpoint.nGroup);
+        oAddress.sin_port = htons(oEndpoint.nPort);
+        if (0 == setsockopt(m_nSocket, IPPROTO_IP, IP_MULTICAST_IF, &oInterface, sizeof(oInterface))
+            && 0 == setsockopt(m_nSocket, IPPROTO_IP, IP_MULTICAST_LOOP, &nLoop, sizeof(nLoop))
+            && 0 == setsockopt(m_nSocket, IPPROTO_IP, IP_MULTICAST_TTL, &nTtl, sizeof(nTtl))
+            && 0 == connect(m_nSocket, reinterpret_cast<const sockaddr*>(&oAddress), sizeof(oAddress)))
+        {
+            m_szBufferSize = SetBufferSize(m_nSocket, SO_SNDBUFFORCE, SO_SNDBUF, szBufferSize);
+            nResult = ERR_NOERROR;
+        }
+        else
+        {
+            Close();
+        }
+    }
+    return nResult;
+}
+
+fep::Result cUdpSocket::OpenReceiver(const tEndpoint& oEndpoint, const std::string& strInterface,
+    size_t szBufferSize, uint32_t nTimeoutMs)
+{
+    Close();
+    fep::Result nResult = ERR_OPEN_FAILED;
+    m_nSocket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (0 <= m_nSocket)
+    {
+        ip_mreqn oMembership;
+        memset(&oMembership, 0, sizeof(oMembership));
+        ResolveInterface(strInterface, oMembership);
+        oMembership.imr_multiaddr.s_addr = htonl(oEndpoint.nGroup);
+        // several receivers of the signal on the same host share the port
+        const int nReuse = 1;
+        // only receive the group of this signal, not every group joined on the port
+        const int nMulticastAll = 0;
+        timeval sTimeout;
+        sTimeout.tv_sec = nTimeoutMs / 1000;
+        sTimeout.tv_usec = (nTimeoutMs % 1000) * 1000;
+        sockaddr_in oAddress;
+        memset(&oAddress, 0, sizeof(oAddress));
+        oAddress.sin_family = AF_INET;
+        oAddress.sin_addr.s_addr = htonl(oEndpoint.nGroup);
+        oAddress.sin_port = htons(oEndpoint.nPort);
+        if (0 == setsockopt(m_nSocket, SOL_SOCKET, SO_REUSEADDR, &nReuse, sizeof(nReuse))
+            && 0 == setsockopt(m_nSocket, IPPROTO_IP, IP_MULTICAST_ALL, &nMulticastAll, sizeof(nMulticastAll))
+            && 0 == setsockopt(m_nSocket, SOL_SOCKET, SO_RCVTIMEO, &sTimeout, sizeof(sTimeout))
+            && 0 == bind(m_nSocket, reinterpret_cast<const sockaddr*>(&oAddress), sizeof(oAddress))
+            && 0 == setsockopt(m_nSocket, IPPROTO_IP, IP_ADD_MEMBERSHIP, &oMembership, sizeof(oMembership)))
+        {
+            m_szBufferSize = SetBufferSize(m_nSocket, SO_RCVBUFFORCE, SO_RCVBUF, szBufferSize);
+            nResult = ERR_NOERROR;
+        }
+        else
+        {
+            Close();
+        }
+    }
+    return nResult;
+}
+
+void cUdpSocket::Close()
+{
+    if (0 <= m_nSocket)
+    {
+        ::close(m_nSocket);
+        m_nSocket = -1;
+    }
+    m_szBufferSize = 0;
+}
+
+bool cUdpSocket::Send(mmsghdr* pMessages, unsigned int nCount)
+{
+    unsigned int nSent = 0;
+    uint32_t nRetries = 0;
+    while (nSent < nCount)
+    {
+        const int nResult = sendmmsg(m_nSocket, pMessages + nSent, nCount - nSent, 0);
+        if (0 < nResult)
+        {
+            nSent += static_cast<unsigned int>(nResult);
+        }
+        else if (0 > nResult && EINTR == errno)
+        {
+            continue;
+        }
+        else if (0 > nResult && (ENOBUFS == errno || EAGAIN == errno) && nRetries < s_nMaxSendRetries)
+        {
+            // the device queue is full, give it a moment to drain
+            ++nRetries;
+            std::this_thread::yield();
+        }
+        else
+        {
+            break;
+        }
+    }
+    return nSent == nCount;
+}
+
+unsigned int cUdpSocket::Receive(mmsghdr* pMessages, unsigned int nCount)
+{
+    // blocks until the first datagram arrived or the timeout elapsed, then takes what is queued
+    const int nResult = recvmmsg(m_nSocket, pMessages, nCount, MSG_WAITFORONE, NULL);
+    return 0 < nResult ? static_cast<unsigned int>(nResult) : 0;
+}
+
+size_t cUdpSocket::GetBufferSize() const
+{
+    return m_szBufferSize;
+}
+
+#endif // __linux__
@@ -0,0 +1,136 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_UDP_SOCKET_H_
+#define _FEP_UDP_SOCKET_H_
+
+#ifdef __linux__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "fep_result_decl.h"
+
+struct mmsghdr;
+
+namespace fep
+{
+    namespace udp
+    {
+        /**
+         * @brief The cUdpSocket class
+         * Multicast socket of one signal. Every signal is sent to its own multicast group
+         * (derived from the signal name) on the port of the domain.
+         */
+        class cUdpSocket
+        {
+        public:
+            /// Multicast address of a signal
+            struct tEndpoint
+            {
+                /// multicast group (host byte order)
+                uint32_t nGroup;
+                /// port (host byte order)
+                uint16_t nPort;
+                /// hash of the signal name (see \ref tSignalHeader)
+                uint32_t nSignalHash;
+            };
+
+            /**
+            * The method \ref GetEndpoint determines the multicast address of a signal
+            *
+            * @param [in] dDomainId Domain ID
+            * @param [in] strSignalName Name of the signal
+            * @param [out] oEndpoint Multicast address of the signal
+            * @return false if the domain id is out of range
+            */
+            static bool GetEndpoint(int dDomainId, const std::string& strSignalName, tEndpoint& oEndpoint);
+
+        public:
+            /// CTOR
+            cUdpSocket();
+
+            /// DTOR
+            ~cUdpSocket();
+
+            /**
+            * The method \ref OpenTransmitter opens a socket sending to the endpoint
+            *
+            * @param [in] oEndpoint Multicast address of the signal
+            * @param [in] strInterface Address or name of the interface to send on (empty for default)
+            * @param [in] szBufferSize Requested size of the socket send buffer
+            * @return Standard Error code
+            * @retval ERR_OPEN_FAILED The socket could not be opened
+            * @retval ERR_NOERROR Everything went fine
+            */
+            fep::Result OpenTransmitter(const tEndpoint& oEndpoint, const std::string& strInterface,
+                size_t szBufferSize);
+
+            /**
+            * The method \ref OpenReceiver opens a socket receiving from the endpoint
+            *
+            * @param [in] oEndpoint Multicast address of the signal
+            * @param [in] strInterface Address or name of the interface to receive on (empty for default)
+            * @param [in] szBufferSize Requested size of the socket receive buffer
+            * @param [in] nTimeoutMs Time \ref Receive waits at most for the first datagram
+            * @return Standard Error code
+            * @retval ERR_OPEN_FAILED The socket could not be opened
+            * @retval ERR_NOERROR Everything went fine
+            */
+            fep::Result OpenReceiver(const tEndpoint& oEndpoint, const std::string& strInterface,
+                size_t szBufferSize, uint32_t nTimeoutMs);
+
+            /// Closes the socket
+            void Close();
+
+            /**
+            * The method \ref Send sends all given datagrams (sendmmsg)
+            *
+            * @param [in] pMessages Datagrams
+            * @param [in] nCount Number of datagrams
+            * @return true if all datagrams were handed to the kernel
+            */
+            bool Send(mmsghdr* pMessages, unsigned int nCount);
+
+            /**
+            * The method \ref Receive waits for datagrams and receives as many as available (recvmmsg)
+            *
+            * @param [in,out] pMessages Buffers for the datagrams
+            * @param [in] nCount Number of buffers
+            * @return Number of received datagrams (0 on timeout or error)
+            */
+            unsigned int Receive(mmsghdr* pMessages, unsigned int nCount);
+
+            /**
+            * The method \ref GetBufferSize returns the effective socket buffer size
+            *
+            * @return Size of the socket send or receive buffer (the kernel might have limited it)
+            */
+            size_t GetBufferSize() const;
+
+        private:
+            /// Socket descriptor
+            int m_nSocket;
+            /// Effective socket buffer size
+            size_t m_szBufferSize;
+        };
+    }
+}
+
+#endif // __linux__
+#endif //_FEP_UDP_SOCKET_H_
@@ -0,0 +1,189 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifdef __linux__
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unistd.h>
+#include <a_util/concurrency/fast_mutex.h>
+#include <a_util/result/result_type.h>
+#include <a_util/strings/strings_format.h>
+
+#include "fep_errors.h"
+#include "transmission_adapter/udp/fep_udp_transmitter.h"
+
+using namespace fep::udp;
+
+/**
+* Creates an id that is unique for every transmitter of the network, it is used by the
+* receivers to tell the fragments of different transmitters apart
+* @return The sender id
+*/
+static uint64_t CreateSenderId()
+{
+    static std::atomic<uint32_t> s_nTransmitterCount(0);
+    char strHostName[256] = { 0 };
+    gethostname(strHostName, sizeof(strHostName) - 1);
+    const uint64_t nHostHash = std::hash<std::string>()(std::string(strHostName));
+    return (nHostHash << 40) ^ (static_cast<uint64_t>(getpid()) << 20) ^ (++s_nTransmitterCount);
+}
+
+cUdpTransmit::cUdpTransmit() :
+    Fragmenter(CreateSenderId()),
+    m_bIsMuted(false),
+    m_bIsActivated(false),
+    m_vecFragment(UDP_MAX_PACKET_SIZE),
+    m_vecFragmentHeaders(UDP_BATCH_SIZE),
+    m_vecIoVectors(3 * UDP_BATCH_SIZE),
+    m_vecMessages(UDP_BATCH_SIZE),
+    m_nBatchCount(0)
+{
+    m_sSignalHeader.nSignalHash = 0;
+    setBuffer(&m_vecFragment[0]);
+    memset(&m_vecMessages[0], 0, m_vecMessages.size() * sizeof(mmsghdr));
+    for (size_t nIdx = 0; nIdx < UDP_BATCH_SIZE; ++nIdx)
+    {
+        m_vecIoVectors[3 * nIdx].iov_base = &m_sSignalHeader;
+        m_vecIoVectors[3 * nIdx].iov_len = sizeof(m_sSignalHeader);
+        m_vecIoVectors[3 * nIdx + 1].iov_base = &m_vecFragmentHeaders[nIdx];
+        m_vecIoVectors[3 * nIdx + 1].iov_len = sizeof(Fragment);
+        m_vecIoVectors[3 * nIdx + 2].iov_base = NULL;
+        m_vecIoVectors[3 * nIdx + 2].iov_len = 0;
+        m_vecMessages[nIdx].msg_hdr.msg_iov = &m_vecIoVectors[3 * nIdx];
+        m_vecMessages[nIdx].msg_hdr.msg_iovlen = 3;
+    }
+}
+
+cUdpTransmit::~cUdpTransmit()
+{
+}
+
+fep::Result cUdpTransmit::Initialize(const fep::cSignalOptions& oOptions,
+    const std::string& strModuleName, int dDomainId, const std::string& strInterface,
+    size_t szBufferSize)
+{
+    fep::Result nResult = cAbstractUdpTransceiver::Initialize(oOptions, strModuleName, dDomainId,
+        strInterface, szBufferSize);
+    if (fep::isOk(nResult))
+    {
+        m_sSignalHeader.nSignalHash = htole32(m_oEndpoint.nSignalHash);
+        nResult = m_oSocket.OpenTransmitter(m_oEndpoint, m_strInterface, m_szBufferSize);
+        if (fep::isFailed(nResult))
+        {
+            LogMessage(a_util::strings::format("%s: Unable to open multicast socket - %s",
+                m_strSignalName.c_str(), strerror(errno)).c_str(), fep::SL_Critical_Local);
+        }
+    }
+    return nResult;
+}
+
+fep::Result cUdpTransmit::Transmit(const void *pData, size_t szSize)
+{
+    fep::Result nResult = ERR_NOERROR;
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    if (!m_bIsActivated)
+    {
+        LogMessage(a_util::strings::format("%s: Transmission failure - transmitter is not enabled.",
+            m_strSignalName.c_str()).c_str(), fep::SL_Warning);
+        nResult = ERR_INVALID_STATE;
+    }
+    else if (NULL == pData || 0 >= szSize)
+    {
+        nResult = ERR_INVALID_ARG;
+    }
+    else if (!m_bIsVariableSignalSize && szSize != m_szSignalSize)
+    {
+        nResult = ERR_FAILED;
+    }
+    else if (!m_bIsMuted)
+    {
+        m_nBatchCount = 0;
+        // the fragmenter hands every fragment to transmitFragment, the last batch is sent here
+        const bool bSent = 0 != transmitSample(pData, static_cast<uint32_t>(szSize)) && Flush();
+        m_nBatchCount = 0;
+        if (!bSent)
+        {
+            LogMessage(a_util::strings::format("%s: Transmission failure - sample of %u bytes could not be sent.",
+                m_strSignalName.c_str(), static_cast<unsigned int>(szSize)).c_str(), fep::SL_Warning);
+            nResult = ERR_FAILED;
+        }
+    }
+    return nResult;
+}
+
+bool cUdpTransmit::transmitFragment(void* fragment, uint32_t length) noexcept
+{
+    // the payload lives in the fragment buffer that is reused for the next fragment
+    const uint8_t* pFragment = static_cast<const uint8_t*>(fragment);
+    return transmitFragmentV(reinterpret_cast<const Fragment*>(pFragment), pFragment + sizeof(Fragment),
+        length - static_cast<uint32_t>(sizeof(Fragment))) && Flush();
+}
+
+bool cUdpTransmit::transmitFragmentV(const Fragment* header, const void* payload, uint32_t length) noexcept
+{
+    // only the header is reused by the fragmenter, the payload is sent from the sample memory
+    m_vecFragmentHeaders[m_nBatchCount] = *header;
+    iovec& sPayload = m_vecIoVectors[3 * m_nBatchCount + 2];
+    sPayload.iov_base = const_cast<void*>(payload);
+    sPayload.iov_len = length;
+    ++m_nBatchCount;
+    return UDP_BATCH_SIZE > m_nBatchCount || Flush();
+}
+
+bool cUdpTransmit::Flush()
+{
+    bool bResult = true;
+    if (0 < m_nBatchCount)
+    {
+        bResult = m_oSocket.Send(&m_vecMessages[0], m_nBatchCount);
+        m_nBatchCount = 0;
+    }
+    return bResult;
+}
+
+fep::Result cUdpTransmit::Enable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    m_bIsActivated = true;
+    return ERR_NOERROR;
+}
+
+fep::Result cUdpTransmit::Disable()
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    m_bIsActivated = false;
+    return ERR_NOERROR;
+}
+
+fep::Result cUdpTransmit::Mute()
+{
+    m_bIsMuted = true;
+    return ERR_NOERROR;
+}
+
+fep::Result cUdpTransmit::Unmute()
+{
+    m_bIsMuted = false;
+    return ERR_NOERROR;
+}
+
+#endif // __linux__
@@ -0,0 +1,149 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+#ifndef _FEP_UDP_TRANSMIT_H_
+#define _FEP_UDP_TRANSMIT_H_
+
+#ifdef __linux__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <a_util/concurrency/detail/fast_mutex_decl.h>
+
+#include "fep_result_decl.h"
+#include "fep_udp_abstract_transceiver.h"
+#include "transmission_adapter/fep_fragmentation.h"
+#include "transmission_adapter/fep_transmit_intf.h"
+
+namespace fep
+{
+    namespace udp
+    {
+        using Fragmenter = fep::FragmentingWriter<UDP_DRIVER_PROTOCOL_VERSION, UDP_FRAGMENTATION_BOUNDARY>;
+
+        ///@copydoc ITransmit
+        class cUdpTransmit : public ITransmit, public cAbstractUdpTransceiver, private Fragmenter
+        {
+            ///@cond nodoc
+            friend class cUdpDriver;
+            ///@endcond
+
+        public:
+            /**
+            * The method \ref Transmit sends a data block of size szSize to the multicast group of
+            * the signal. All fragments of the data block are passed to the kernel at once.
+            *
+            * @param [in] pData  void pointer to the data
+            * @param [in] szSize size of the data block
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Transmit(const void *pData, size_t szSize);
+
+            /**
+            * The method \ref Enable activates the transmitter so that data can be transmitted.
+            * Sample transmission with a deactivated transmitter will cause an error report.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Enable();
+
+            /**
+            * The method \ref Disable deactivates the transmitter.
+            * Sample transmission with a deactivated transmitter will cause an error report.
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Disable();
+
+            /**
+            * The method \ref Mute mutes the transmitter so that data is no longer transmitted.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Mute();
+
+            /**
+            * The method \ref Unmute unmutes the transmitter so that data can be transmitted.
+            *
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result Unmute();
+
+            /**
+            * The method \ref Initialize opens the socket of the transmitter.
+            * @copydetails cAbstractUdpTransceiver::Initialize
+            */
+            fep::Result Initialize(const fep::cSignalOptions& oOptions,
+                const std::string& strModuleName, int dDomainId, const std::string& strInterface,
+                size_t szBufferSize);
+
+        protected:
+            /**
+            * CTOR
+            */
+            cUdpTransmit();
+
+            /**
+            * DTOR
+            */
+            virtual ~cUdpTransmit();
+
+            /// implements FragmentingWriter, not used since every fragment is gathered by transmitFragmentV
+            bool transmitFragment(void* fragment, uint32_t length) noexcept final override;
+
+            /// implements FragmentingWriter, collects the fragments of a sample without copying the payload
+            bool transmitFragmentV(const Fragment* header, const void* payload, uint32_t length) noexcept final override;
+
+        private:
+            /**
+            * The method \ref Flush sends all collected fragments
+            * @return true if all fragments were passed to the kernel
+            */
+            bool Flush();
+
+        private:
+            /// Flag indicating mute state
+            std::atomic<bool> m_bIsMuted;
+            /// Guard for the enabled flag (held during transmission)
+            a_util::concurrency::fast_mutex m_oActivationGuard;
+            /// flag indicating that transmitter is activated
+            bool m_bIsActivated;
+            /// Header preceding every fragment
+            tSignalHeader m_sSignalHeader;
+            /// Fragment buffer of the fragmenter
+            std::vector<uint8_t> m_vecFragment;
+            /// Fragment headers of the collected fragments, the payload stays in the sample memory
+            std::vector<Fragment> m_vecFragmentHeaders;
+            /// Three io vectors (signal header, fragment header and payload) per collected fragment
+            std::vector<iovec> m_vecIoVectors;
+            /// Messages passed to sendmmsg
+            std::vector<mmsghdr> m_vecMessages;
+            /// Number of collected fragments
+            unsigned int m_nBatchCount;
+        };
+    }
+}
+
+#endif // __linux__
+#endif //_FEP_UDP_TRANSMIT_H_
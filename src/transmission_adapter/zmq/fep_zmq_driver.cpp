@@ -18,9 +18,13 @@
 /// Someone should add a header here some time
 
 #include "transmission_adapter/zmq/fep_zmq_driver.h"
+#include <algorithm>                                         // for max, min
 #include <cstddef>                                          // for NULL
+#include <cstdlib>                                           // for strtol
+#include <functional>                                        // for hash
 #include <utility>                                           // for pair
 #include <a_util/concurrency/fast_mutex.h>                   // for fast_mut...
+#include <a_util/process.h>                                  // for getEnvVar
 #include <a_util/result/result_type.h>                       // for Result::...
 #include <a_util/strings/strings_format.h>                   // for format
 #include <a_util/strings/strings_functions.h>                // for compare
@@ -45,11 +49,18 @@ class ITransmit;
 uint32_t fep::zmq::cZMQDriver::s_ZSysUseCount = 0;
 a_util::concurrency::mutex fep::zmq::cZMQDriver::m_mtxSysInit;
 
+/// Upper limit of the reception threads
+static const int s_nMaxReceptionThreads = 64;
+
+fep::zmq::cZMQDriver::tReceptionShard::tReceptionShard() :
+    pNode(NULL),
+    pPoller(NULL)
+{
+}
+
 fep::zmq::cZMQDriver::cZMQDriver() :
     m_ZSysWasInitialized(false),
-    m_pReceiveNode(NULL),
     m_pTransmitNode(NULL),
-    m_pPoller(NULL),
     m_dDomainId(0),
     m_pLoggingFunc(NULL),
     m_pCalleeLogging(NULL)
@@ -78,33 +89,46 @@ fep::Result fep::zmq::cZMQDriver::Initialize(const cDriverOptions oDriverOptions
        
         if (fep::isOk(nResult))
         {
-            //Create new nodes
-            m_pReceiveNode = zyre_new(a_util::strings::format("%s_Recv", m_strModuleName.c_str()).c_str());
-            m_pTransmitNode = zyre_new(a_util::strings::format("%s_Tx", m_strModuleName.c_str()).c_str());
-
-            if (NULL == m_pReceiveNode)
-            {
-                nResult = ERR_FAILED;
-            }
-            if (NULL == m_pTransmitNode)
+            int nReceptionThreads = 0;
+            if (!oDriverOptions.GetOption("ReceptionThreads", nReceptionThreads))
             {
-                nResult = ERR_FAILED;
+                nReceptionThreads = static_cast<int>(strtol(
+                    a_util::process::getEnvVar("FEP_ZMQ_RECEPTION_THREADS", "1").c_str(), NULL, 10));
             }
+            nReceptionThreads = std::max(1, std::min(nReceptionThreads, s_nMaxReceptionThreads));
 
-            if (a_util::result::isOk(nResult))
+            //Create new nodes
+            for (int nShard = 0; nShard < nReceptionThreads && a_util::result::isOk(nResult); ++nShard)
             {
-                //create new poller
-                m_pPoller = zpoller_new(zyre_socket(m_pReceiveNode), NULL);
+                std::unique_ptr<tReceptionShard> pShard(new tReceptionShard());
+                pShard->pNode = zyre_new(0 == nShard
+                    ? a_util::strings::format("%s_Recv", m_strModuleName.c_str()).c_str()
+                    : a_util::strings::format("%s_Recv%d", m_strModuleName.c_str(), nShard).c_str());
+                if (NULL == pShard->pNode)
+                {
+                    nResult = ERR_FAILED;
+                }
+                else
+                {
+                    //create new poller
+                    pShard->pPoller = zpoller_new(zyre_socket(pShard->pNode), NULL);
+                    if (NULL == pShard->pPoller)
+                    {
+                        nResult = ERR_FAILED;
+                    }
+                }
+                m_vecShards.push_back(std::move(pShard));
             }
+            m_pTransmitNode = zyre_new(a_util::strings::format("%s_Tx", m_strModuleName.c_str()).c_str());
 
-            if (NULL == m_pPoller)
+            if (NULL == m_pTransmitNode)
             {
                 nResult = ERR_FAILED;
             }
 
-            if (a_util::result::isOk(nResult))
+            for (size_t nShard = 0; nShard < m_vecShards.size() && a_util::result::isOk(nResult); ++nShard)
             {
-                if (zyre_start(m_pReceiveNode) != 0)
+                if (zyre_start(m_vecShards[nShard]->pNode) != 0)
                 {
                     nResult = ERR_FAILED;
                 }
@@ -114,15 +138,17 @@ fep::Result fep::zmq::cZMQDriver::Initialize(const cDriverOptions oDriverOptions
             {
                 if (zyre_start(m_pTransmitNode) != 0)
                 {
-                    zyre_stop(m_pReceiveNode);
                     nResult = ERR_FAILED;
                 }
             }
 
             if (a_util::result::isOk(nResult))
             {
-                m_pReceptionThread.reset(new std::thread(
-                    &cZMQDriver::ReceiveAndDistributeMessages, this));
+                for (size_t nShard = 0; nShard < m_vecShards.size(); ++nShard)
+                {
+                    m_vecShards[nShard]->pReceptionThread.reset(new std::thread(
+                        &cZMQDriver::ReceiveAndDistributeMessages, this, m_vecShards[nShard].get()));
+                }
             }
         }
     }
@@ -132,19 +158,26 @@ fep::Result fep::zmq::cZMQDriver::Initialize(const cDriverOptions oDriverOptions
 fep::Result fep::zmq::cZMQDriver::Deinitialize()
 {
     m_oShutdownSignal.notify();
-    if(m_pReceptionThread)
+    for (size_t nShard = 0; nShard < m_vecShards.size(); ++nShard)
     {
-        m_pReceptionThread->join();
-        m_pReceptionThread.reset();
+        if (m_vecShards[nShard]->pReceptionThread)
+        {
+            m_vecShards[nShard]->pReceptionThread->join();
+            m_vecShards[nShard]->pReceptionThread.reset();
+        }
     }
     m_oShutdownSignal.reset();
-	a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxRecvMap);
-    std::map<std::string,cZMQReceive*>::iterator it;
-    for(it = m_mapReceiverGroups.begin(); it != m_mapReceiverGroups.end(); ++it)
+    for (size_t nShard = 0; nShard < m_vecShards.size(); ++nShard)
     {
-        delete it->second;
+        tReceptionShard& oShard = *m_vecShards[nShard];
+        a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(oShard.mtxRecvMap);
+        std::unordered_map<std::string, cZMQReceive*>::iterator it;
+        for (it = oShard.mapReceiverGroups.begin(); it != oShard.mapReceiverGroups.end(); ++it)
+        {
+            delete it->second;
+        }
+        oShard.mapReceiverGroups.clear();
     }
-    m_mapReceiverGroups.clear();
 
     vector<cZMQTransmit*>::iterator iter;
     for(iter = m_vecTransmitters.begin(); iter != m_vecTransmitters.end(); ++iter)
@@ -153,31 +186,38 @@ fep::Result fep::zmq::cZMQDriver::Deinitialize()
     }
     m_vecTransmitters.clear();
 
-    // destroy the poller
-    if(NULL != m_pPoller)
-    {
-        zpoller_destroy(&m_pPoller);
-    }
     // gracefully stop zyre
     if(NULL != m_pTransmitNode)
     {
         zyre_stop(m_pTransmitNode);
     }
-    if(NULL != m_pReceiveNode)
+    for (size_t nShard = 0; nShard < m_vecShards.size(); ++nShard)
     {
-        zyre_stop(m_pReceiveNode);
+        tReceptionShard& oShard = *m_vecShards[nShard];
+        // destroy the poller
+        if (NULL != oShard.pPoller)
+        {
+            zpoller_destroy(&oShard.pPoller);
+        }
+        if (NULL != oShard.pNode)
+        {
+            zyre_stop(oShard.pNode);
+        }
     }
-    // destroy the node
+    // destroy the nodes
     if(NULL != m_pTransmitNode)
     {
         zyre_destroy(&m_pTransmitNode);
         m_pTransmitNode= NULL;
     }
-    if(NULL != m_pReceiveNode)
+    for (size_t nShard = 0; nShard < m_vecShards.size(); ++nShard)
     {
-        zyre_destroy(&m_pReceiveNode);
-        m_pReceiveNode= NULL;
+        if (NULL != m_vecShards[nShard]->pNode)
+        {
+            zyre_destroy(&m_vecShards[nShard]->pNode);
+        }
     }
+    m_vecShards.clear();
     // prevent atexit() problems by explicitly shutting down platform
     ZMQSystemDeInit();
     return ERR_NOERROR;
@@ -187,18 +227,27 @@ fep::Result fep::zmq::cZMQDriver::CreateReceiver(IReceive *&pIReceiver, cSignalO
 {
     fep::Result nResult = ERR_FAILED;
     cZMQReceive* pReceiver = new cZMQReceive();
+    std::string strSignalName;
 
+    if (m_vecShards.empty() || !oOptions.GetOption("SignalName", strSignalName))
+    {
+        delete pReceiver;
+        pReceiver = NULL;
+    }
     if(pReceiver)
     {
-        if(fep::isOk(pReceiver->Initialize(oOptions, m_pReceiveNode, m_strModuleName,m_dDomainId)))
+        // the group name is determined by the receiver, it has to match cAbstractZMQTranceiver::Initialize
+        tReceptionShard& oShard = GetShard(a_util::strings::format("FEP_SIG_%d_%s", m_dDomainId,
+            strSignalName.c_str()));
+        if(fep::isOk(pReceiver->Initialize(oOptions, oShard.pNode, m_strModuleName,m_dDomainId)))
         {
             if(NULL != m_pCalleeLogging && NULL != m_pLoggingFunc)
             {
                 if(fep::isOk(nResult = pReceiver->RegisterLogging(m_pLoggingFunc, m_pCalleeLogging)))
                 {
                     nResult = ERR_NOERROR;
-                    a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxRecvMap);
-                    m_mapReceiverGroups[pReceiver->m_strGroupName] = pReceiver;
+                    a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(oShard.mtxRecvMap);
+                    oShard.mapReceiverGroups[pReceiver->m_strGroupName] = pReceiver;
                     pIReceiver = pReceiver;
                 }
             }
@@ -246,13 +295,18 @@ fep::Result fep::zmq::cZMQDriver::DestroyReceiver(IReceive *pIReceiver)
 {
     fep::Result nResult = ERR_NOT_FOUND;
     cZMQReceive* pReceiver = static_cast<cZMQReceive*>(pIReceiver);
-    std::map<std::string,cZMQReceive*>::iterator it;
-	a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxRecvMap);
-    it = m_mapReceiverGroups.find(pReceiver->m_strGroupName);
-    if(it != m_mapReceiverGroups.end())
+    if (NULL != pReceiver && !m_vecShards.empty())
     {
-        delete it->second;
-        m_mapReceiverGroups.erase(it);
+        tReceptionShard& oShard = GetShard(pReceiver->m_strGroupName);
+        std::unordered_map<std::string, cZMQReceive*>::iterator it;
+        a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(oShard.mtxRecvMap);
+        it = oShard.mapReceiverGroups.find(pReceiver->m_strGroupName);
+        if (it != oShard.mapReceiverGroups.end())
+        {
+            delete it->second;
+            oShard.mapReceiverGroups.erase(it);
+            nResult = ERR_NOERROR;
+        }
     }
     return nResult;
 };
@@ -301,29 +355,35 @@ fep::Result fep::zmq::cZMQDriver::RegisterLogging(tLoggingFuncPtr pLoggingFunc,
     return nResult;
 }
 
-void fep::zmq::cZMQDriver::ReceiveAndDistributeMessages()
+fep::zmq::cZMQDriver::tReceptionShard& fep::zmq::cZMQDriver::GetShard(const std::string& strGroupName)
+{
+    return *m_vecShards[std::hash<std::string>()(strGroupName) % m_vecShards.size()];
+}
+
+void fep::zmq::cZMQDriver::ReceiveAndDistributeMessages(tReceptionShard* pShard)
 {
     while (!m_oShutdownSignal.is_set())
     {
-        void* ret = zpoller_wait(m_pPoller, 50);
-        if (zpoller_expired(m_pPoller) || zpoller_terminated(m_pPoller))
+        void* ret = zpoller_wait(pShard->pPoller, 50);
+        if (zpoller_expired(pShard->pPoller) || zpoller_terminated(pShard->pPoller))
         {
             continue;
         }
-        else if (ret == zyre_socket(m_pReceiveNode))
+        else if (ret == zyre_socket(pShard->pNode))
         {
-            zyre_event_t* event = zyre_event_new(m_pReceiveNode);
+            zyre_event_t* event = zyre_event_new(pShard->pNode);
             if (event && !m_oShutdownSignal.is_set())
             {
                 const char*  strType = zyre_event_type(event);
 
                 if (0 == a_util::strings::compare(strType, "SHOUT"))
                 {
-                    const char* strGroup = zyre_event_group(event);
-                    std::map<std::string,cZMQReceive*>::iterator it;
-                    a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxRecvMap);
-                    it = m_mapReceiverGroups.find(strGroup);
-                    if(it != m_mapReceiverGroups.end())
+                    // only this thread uses the key buffer, assign reuses its capacity
+                    pShard->strGroup.assign(zyre_event_group(event));
+                    std::unordered_map<std::string, cZMQReceive*>::iterator it;
+                    a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> oSync(pShard->mtxRecvMap);
+                    it = pShard->mapReceiverGroups.find(pShard->strGroup);
+                    if(it != pShard->mapReceiverGroups.end())
                     {
                         zmsg_t* msg = zyre_event_get_msg(event);
                         it->second->HandleMessage(msg);
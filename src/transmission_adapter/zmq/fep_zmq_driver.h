@@ -21,11 +21,11 @@
 #ifdef WITH_ZYRE
 
 #include <cstdint>
-#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 #include <a_util/concurrency/detail/fast_mutex_decl.h>
 #include <a_util/concurrency/semaphore.h>
@@ -59,7 +59,13 @@ namespace fep
 
         class cZMQReceive;
         class cZMQTransmit;
-        /// this is the transmission adapter for ZMQ usage
+        /**
+        * This is the transmission adapter for ZMQ usage.
+        * Reception is sharded: every reception thread owns a zyre node with its own poller and
+        * receives the groups that are hashed to it. The number of reception threads is taken
+        * from the driver option "ReceptionThreads" or the environment variable
+        * FEP_ZMQ_RECEPTION_THREADS (default 1).
+        */
         class FEP_PARTICIPANT_EXPORT cZMQDriver : public ITransmissionDriver
         {
         public:
@@ -100,11 +106,38 @@ namespace fep
 
 
         private: //Reception-Methods:
+            /// A zyre node receiving a subset of the groups in its own thread
+            struct tReceptionShard
+            {
+                /// CTOR
+                tReceptionShard();
+                /// ZMQ-Reception Node
+                zyre_t* pNode;
+                /// ZMQ-Poller
+                zpoller_t* pPoller;
+                /// Mutex Protecting the receiver map
+                a_util::concurrency::fast_mutex mtxRecvMap;
+                /// Map of Receiver and their group
+                std::unordered_map<std::string, cZMQReceive*> mapReceiverGroups;
+                /// Group name of the received event (reused to avoid allocations during lookup)
+                std::string strGroup;
+                /// Zyre-Message-Reception-Thread
+                std::unique_ptr<std::thread> pReceptionThread;
+            };
+
+            /**
+            * The \ref ReceiveAndDistributeMessages method runs in its own thread per shard and is
+            * responsible for receiving and delivering zyre-messages to the responsible receiver
+            * @param [in] pShard the shard served by the thread
+            */
+            void ReceiveAndDistributeMessages(tReceptionShard* pShard);
+
             /**
-            * The \ref ReceiveAndDistributeMessages method runs in its own thread and is responsible 
-            * for receiving and delivering zyre-messages to the responsible receiver
+            * The method \ref GetShard returns the shard receiving a group
+            * @param [in] strGroupName name of the group
+            * @returns the shard
             */
-            void ReceiveAndDistributeMessages();
+            tReceptionShard& GetShard(const std::string& strGroupName);
 
         private: //static functions
             /**
@@ -140,16 +173,10 @@ namespace fep
             static uint32_t s_ZSysUseCount;
             /// remember initialization
             bool m_ZSysWasInitialized;
-            /// ZMQ-Reception Node
-            zyre_t* m_pReceiveNode;
+            /// Reception shards
+            std::vector<std::unique_ptr<tReceptionShard>> m_vecShards;
             /// ZMQ-Node
             zyre_t* m_pTransmitNode;
-            /// ZMQ-Poller
-            zpoller_t* m_pPoller;
-			/// Mutex Protecting the receiver map
-			a_util::concurrency::fast_mutex m_mtxRecvMap;
-            /// Map of Receiver and their group
-            std::map<std::string,cZMQReceive*> m_mapReceiverGroups;
             /// List of Transmitters
             std::vector<cZMQTransmit*> m_vecTransmitters;
             /// Domain ID
@@ -163,8 +190,6 @@ namespace fep
             ITransmissionDriver::tLoggingFuncPtr m_pLoggingFunc;
             /// Object providing the logging function
             void* m_pCalleeLogging;
-            ///Zyre-Message-Reception-Thread
-            std::unique_ptr<std::thread> m_pReceptionThread;
             /// Shutdown signal
             a_util::concurrency::semaphore m_oShutdownSignal;
         };
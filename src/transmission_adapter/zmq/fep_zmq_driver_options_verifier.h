@@ -57,6 +57,10 @@ namespace fep
                 {
                     bRes = true;
                 }
+                if("ReceptionThreads" == strOptionName)
+                {
+                    bRes = 0 < dValue;
+                }
                 return bRes;
             }
 
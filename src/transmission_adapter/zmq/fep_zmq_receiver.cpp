@@ -35,6 +35,7 @@ cZMQReceive::cZMQReceive():
     m_bIsMuted(false),
     m_bIsActivated(false),
     m_pCallback(NULL),
+    m_pZeroCopyCallback(NULL),
     m_pCallee(NULL),
     m_pLoggingFunc(NULL),
     m_pCalleeLogging(NULL)
@@ -80,12 +81,33 @@ fep::Result cZMQReceive::SetReceiver(tCallbackFuncPtr pCallback, void * pCallee)
         || (NULL == pCallback && NULL == pCallee) )
     {
         m_pCallback = pCallback;
+        m_pZeroCopyCallback = NULL;
         m_pCallee = pCallee;
         nResult = ERR_NOERROR;
     }
     return nResult;
 }
 
+fep::Result cZMQReceive::SetZeroCopyReceiver(tZeroCopyCallbackFuncPtr pCallback, void * pCallee)
+{
+    fep::Result nResult = ERR_POINTER;
+    if( (NULL != pCallback && NULL != pCallee)
+        || (NULL == pCallback && NULL == pCallee) )
+    {
+        m_pZeroCopyCallback = pCallback;
+        m_pCallback = NULL;
+        m_pCallee = pCallee;
+        nResult = ERR_NOERROR;
+    }
+    return nResult;
+}
+
+void cZMQReceive::ReleaseMessage(void* pMessage)
+{
+    zmsg_t* msg = static_cast<zmsg_t*>(pMessage);
+    zmsg_destroy(&msg);
+}
+
 void cZMQReceive::HandleMessage(zmsg_t* msg)
 {
     std::unique_lock<a_util::concurrency::fast_mutex> oSync(m_mtxMsgHandler);
@@ -103,13 +125,35 @@ void cZMQReceive::HandleMessage(zmsg_t* msg)
         {
             void* pData = zframe_data(zmsg_first(msg));
             size_t szMsg = zmsg_content_size(msg);
-            if(NULL != m_pCallback && NULL != m_pCallee)
+            if(NULL != m_pZeroCopyCallback && NULL != m_pCallee)
+            {
+                if (1 != zmsg_size(msg))
+                {
+                    // only a single frame is one contiguous buffer that can be lent
+                    std::string strMsg = a_util::strings::format("%s : Received a message of %d "
+                        "frames in zero copy mode - dropping packet.", m_strSignalName.c_str(),
+                        static_cast<int>(zmsg_size(msg)));
+                    LogMessage(strMsg.c_str(), fep::SL_Warning);
+                }
+                else
+                {
+                    // ownership of the message passes to the callee
+                    zmsg_t* pLentMsg = msg;
+                    msg = NULL;
+                    m_pZeroCopyCallback(m_pCallee, pData, szMsg,
+                        &cZMQReceive::ReleaseMessage, pLentMsg);
+                }
+            }
+            else if(NULL != m_pCallback && NULL != m_pCallee)
             {
                 m_pCallback(m_pCallee, pData, szMsg);
             }
         }
     }
-    zmsg_destroy(&msg);
+    if (NULL != msg)
+    {
+        zmsg_destroy(&msg);
+    }
 }
 
 
@@ -42,6 +42,7 @@ namespace fep
         {
 
             using IReceive::tCallbackFuncPtr;
+            using IReceive::tZeroCopyCallbackFuncPtr;
 
             friend class cZMQDriver;
 
@@ -56,6 +57,18 @@ namespace fep
             */
             fep::Result SetReceiver(tCallbackFuncPtr pCallback, void * pCallee);
 
+            /**
+            * The method \ref SetZeroCopyReceiver registers the callback function that is called when data
+            * is received. The received zmq message is lent to the callee until it is released.
+            * Messages of more than one frame are dropped, they are no contiguous buffer.
+            *
+            * @param pCallback Function pointer to callback
+            * @param pCallee Pointer to object providing this callback
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result SetZeroCopyReceiver(tZeroCopyCallbackFuncPtr pCallback, void * pCallee);
+
             /**
             * The method \ref Enable activates the receiver so that data can be received.
             * Sample reception with a deactivated receiver will cause an error report.
@@ -118,6 +131,12 @@ namespace fep
             fep::Result RegisterLogging(ITransmissionDriver::tLoggingFuncPtr pLoggingFunc, void * pCallee);
 
         private:
+            /**
+            * @brief ReleaseMessage Destroys a zmq message lent by the zero copy callback
+            * @param pMessage The message (zmsg_t*)
+            */
+            static void ReleaseMessage(void* pMessage);
+
             /**
             * @brief LogMessage Logs error messages to the registered callback
             * @param strMessage The Message to log
@@ -135,6 +154,8 @@ namespace fep
             /// Flag indicating receiver is muted
             /// Callback that is called when data was received
             tCallbackFuncPtr m_pCallback;
+            /// Zero copy callback that is called when data was received (alternative to m_pCallback)
+            tZeroCopyCallbackFuncPtr m_pZeroCopyCallback;
             /// Pointer to the Object whoms callback is to be called
             void* m_pCallee;
             //Logging members
@@ -31,8 +31,15 @@
 
 using namespace fep::zmq;
 
+#if defined(CZMQ_BUILD_DRAFT_API) && defined(CZMQ_VERSION) && (CZMQ_VERSION >= CZMQ_MAKE_VERSION(4, 1, 0))
+/// czmq is able to wrap memory of the caller into a frame (zframe_frommem)
+#define FEP_ZMQ_ZERO_COPY_FRAMES
+#endif
+
 cZMQTransmit::cZMQTransmit() : 
     m_bIsMuted(false),
+    m_bIsActivated(false),
+    m_pFramePool(std::make_shared<tFramePool>()),
     m_pLoggingFunc(NULL),
     m_pCalleeLogging(NULL)
 {
@@ -42,13 +49,12 @@ cZMQTransmit::~cZMQTransmit()
 {
 }
 
-fep::Result cZMQTransmit::Transmit(const void *pData, size_t szSize)
+fep::Result cZMQTransmit::CheckTransmission(const void *pData, size_t szSize)
 {
     fep::Result nResult = ERR_NOERROR;
-    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
     if(!m_bIsActivated)
     {
-        LogMessage(a_util::strings::format("%: Transmission failure - transmitter is not enabled.",
+        LogMessage(a_util::strings::format("%s: Transmission failure - transmitter is not enabled.",
             m_strSignalName.c_str()).c_str(), fep::SL_Warning);
         nResult = ERR_INVALID_STATE;
     }
@@ -60,8 +66,14 @@ fep::Result cZMQTransmit::Transmit(const void *pData, size_t szSize)
     {
         nResult= ERR_FAILED;
     }
-    
-    else if(!m_bIsMuted && fep::isOk(nResult))
+    return nResult;
+}
+
+fep::Result cZMQTransmit::Transmit(const void *pData, size_t szSize)
+{
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    fep::Result nResult = CheckTransmission(pData, szSize);
+    if(!m_bIsMuted && fep::isOk(nResult))
     {
         zmsg_t* msg = zmsg_new();
         zmsg_addmem(msg, pData, szSize);
@@ -74,6 +86,54 @@ fep::Result cZMQTransmit::Transmit(const void *pData, size_t szSize)
     return nResult;
 }
 
+fep::Result cZMQTransmit::TransmitZeroCopy(const void *pData, size_t szSize,
+    tReleaseFuncPtr pRelease, void * pContext)
+{
+#ifdef FEP_ZMQ_ZERO_COPY_FRAMES
+    std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
+    fep::Result nResult = CheckTransmission(pData, szSize);
+    if(!m_bIsMuted && fep::isOk(nResult))
+    {
+        zmsg_t* msg = zmsg_new();
+        tFramePool::tLent* pLentFrame = tFramePool::Lend(m_pFramePool);
+        if (NULL != pLentFrame)
+        {
+            // the frame owns the release function from now on, zyre destroys it once the
+            // content was passed on to the peers
+            pLentFrame->oValue.pRelease = pRelease;
+            pLentFrame->oValue.pContext = pContext;
+            pRelease = NULL;
+            zframe_t* pFrame = zframe_frommem(const_cast<void*>(pData), szSize,
+                &cZMQTransmit::DestroyFrame, pLentFrame);
+            zmsg_append(msg, &pFrame);
+        }
+        else
+        {
+            zmsg_addmem(msg, pData, szSize);
+        }
+        if(0 != zyre_shout(m_pNode, m_strGroupName.c_str(), &msg))
+        {
+            nResult = ERR_FAILED;
+        }
+    }
+    if (NULL != pRelease)
+    {
+        pRelease(pContext);
+    }
+    return nResult;
+#else
+    return ITransmit::TransmitZeroCopy(pData, szSize, pRelease, pContext);
+#endif
+}
+
+void cZMQTransmit::DestroyFrame(void** ppHint)
+{
+    tFramePool::tLent* pLentFrame = static_cast<tFramePool::tLent*>(*ppHint);
+    pLentFrame->oValue.pRelease(pLentFrame->oValue.pContext);
+    tFramePool::Release(pLentFrame);
+    *ppHint = NULL;
+}
+
 fep::Result cZMQTransmit::Enable()
 {
     std::unique_lock<a_util::concurrency::fast_mutex> oGuard(m_oActivationGuard);
@@ -19,11 +19,13 @@
 #define _FEP_ZMQ_TRANSMIT_H_
 
 #include <cstddef>
+#include <memory>
 #include <a_util/concurrency/detail/fast_mutex_decl.h>
 
 #include "fep_result_decl.h"
 #include "fep_zmq_abstract_transceiver.h"
 #include "incident_handler/fep_severity_level.h"
+#include "transmission_adapter/fep_lending_pool.h"
 #include "transmission_adapter/fep_transmission_driver_intf.h"
 #include "transmission_adapter/fep_transmit_intf.h"
 
@@ -51,6 +53,21 @@ namespace fep
             */
             fep::Result Transmit(const void *pData, size_t szSize);
 
+            /**
+            * The method \ref TransmitZeroCopy transmits a data block of size szSize. If czmq
+            * provides zero copy frames (draft API of czmq 4.1 and later), the data block is
+            * wrapped into the frame and released once zyre passed it on, otherwise it is copied.
+            *
+            * @param [in] pData  void pointer to the data
+            * @param [in] szSize size of the data block
+            * @param [in] pRelease function releasing the buffer
+            * @param [in] pContext release context to be passed to the release function
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  Everything went fine
+            */
+            fep::Result TransmitZeroCopy(const void *pData, size_t szSize,
+                tReleaseFuncPtr pRelease, void * pContext);
+
             /**
             * The method \ref Enable activates the transmitter so that data can be transmitted.
             * Sample transmission with a deactivated transmitter will cause an error report.
@@ -108,6 +125,36 @@ namespace fep
             void LogMessage(const char* strMessage, fep::tSeverityLevel eServLevel);
             ///@endcond
 
+            /**
+            * The method \ref CheckTransmission checks whether a data block may be transmitted
+            * (the activation guard has to be held)
+            * @param [in] pData  void pointer to the data
+            * @param [in] szSize size of the data block
+            * @returns  Standard result code.
+            * @retval ERR_NOERROR  The data block may be transmitted
+            * @retval ERR_INVALID_STATE  The transmitter is not enabled
+            * @retval ERR_INVALID_ARG  No data
+            * @retval ERR_FAILED  Wrong size
+            */
+            fep::Result CheckTransmission(const void *pData, size_t szSize);
+
+            /// Release function of a lent buffer, kept until zyre destroys the wrapping frame
+            struct tLentFrame
+            {
+                /// function releasing the buffer
+                tReleaseFuncPtr pRelease;
+                /// release context
+                void* pContext;
+            };
+            /// Pool of the release functions of frames in flight
+            typedef cLendingPool<tLentFrame> tFramePool;
+
+            /**
+            * The method \ref DestroyFrame is called by czmq when a zero copy frame is destroyed
+            * @param [in] ppHint pointer to the lent frame (tFramePool::tLent)
+            */
+            static void DestroyFrame(void** ppHint);
+
         private:
             /// Flag indicating mute state
             bool m_bIsMuted;
@@ -115,6 +162,8 @@ namespace fep
             a_util::concurrency::fast_mutex m_oActivationGuard;
             /// flag indicating thtat transmitter is initialized
             bool m_bIsActivated;
+            /// Release functions of the zero copy frames in flight
+            std::shared_ptr<tFramePool> m_pFramePool;
             //Logging members
             /// Logging Function pointer
             ITransmissionDriver::tLoggingFuncPtr m_pLoggingFunc;
@@ -71,6 +71,7 @@ public:
     {
         m_pData = pData;
         m_szSize = szSize;
+        m_vecData.assign(static_cast<const uint8_t*>(pData), static_cast<const uint8_t*>(pData) + szSize);
         return ERR_NOERROR;
     }
 
@@ -107,6 +108,8 @@ public:
     bool m_bMuted;
     const void* m_pData;
     size_t m_szSize;
+    /// copy of the last transmitted data (the sender may free its buffer once Transmit returned)
+    std::vector<uint8_t> m_vecData;
     cSignalOptions m_oOptions;
 };
 
@@ -120,7 +123,9 @@ public:
        m_oOptions(oOptions),
         m_bEnabled(false),
         m_bMuted(false),
-        m_pCallee(NULL)
+        m_pCallee(NULL),
+        m_pZeroCopyCallback(NULL),
+        m_pBatchCallback(NULL)
     {
     }
 
@@ -130,6 +135,20 @@ public:
         return ERR_NOERROR;
     }
 
+    virtual fep::Result SetZeroCopyReceiver(tZeroCopyCallbackFuncPtr pCallback, void * pCallee)
+    {
+        m_pCallee = pCallee;
+        m_pZeroCopyCallback = pCallback;
+        return ERR_NOERROR;
+    }
+
+    virtual fep::Result SetBatchReceiver(tBatchCallbackFuncPtr pCallback, void * pCallee)
+    {
+        m_pCallee = pCallee;
+        m_pBatchCallback = pCallback;
+        return ERR_NOERROR;
+    }
+
     virtual fep::Result Enable()
     {
         m_bEnabled = true;
@@ -162,6 +181,8 @@ public:
     bool m_bEnabled;
     bool m_bMuted;
     void* m_pCallee;
+    tZeroCopyCallbackFuncPtr m_pZeroCopyCallback;
+    tBatchCallbackFuncPtr m_pBatchCallback;
     cSignalOptions m_oOptions;
 };
 
@@ -169,7 +190,8 @@ class cMockTxDriver: public ITransmissionDriver
 {
 public:
     cMockTxDriver() :
-        m_bInitialized(false)
+        m_bInitialized(false),
+        m_bFailInboxReceivers(false)
     {
     }
     
@@ -192,8 +214,19 @@ public:
 
     virtual  fep::Result CreateReceiver(IReceive*& pIReceiver, const cSignalOptions oOptions) 
     {
+        if (m_bFailInboxReceivers && IsInbox(oOptions))
+        {
+            return ERR_FAILED;
+        }
         cMockReceiver* pReceiver = new cMockReceiver(oOptions);
-        m_vecReceivers.push_back(pReceiver);
+        if (IsInbox(oOptions))
+        {
+            m_vecInboxReceivers.push_back(pReceiver);
+        }
+        else
+        {
+            m_vecReceivers.push_back(pReceiver);
+        }
         pIReceiver = pReceiver;
         return ERR_NOERROR;
     }
@@ -201,7 +234,14 @@ public:
     virtual  fep::Result CreateTransmitter(ITransmit*& pITransmit,  const cSignalOptions oOptions) 
     {
         cMockTransmitter* pTransmitter = new cMockTransmitter(oOptions);
-        m_vecTransmitters.push_back(pTransmitter);
+        if (IsInbox(oOptions))
+        {
+            m_vecInboxTransmitters.push_back(pTransmitter);
+        }
+        else
+        {
+            m_vecTransmitters.push_back(pTransmitter);
+        }
         pITransmit = pTransmitter;
         return ERR_NOERROR;
     }
@@ -220,6 +260,15 @@ public:
                 break;
             }
         }
+        for (it = m_vecInboxReceivers.begin(); it != m_vecInboxReceivers.end(); ++it)
+        {
+            if (pIReceiver == static_cast<IReceive*>(*it))
+            {
+                delete (*it);
+                m_vecInboxReceivers.erase(it);
+                break;
+            }
+        }
         return ERR_NOERROR;
     }
 
@@ -238,6 +287,15 @@ public:
                 break;
             }
         }
+        for (it = m_vecInboxTransmitters.begin(); it != m_vecInboxTransmitters.end(); ++it)
+        {
+            if (pITransmiter == static_cast<ITransmit*>(*it))
+            {
+                delete (*it);
+                m_vecInboxTransmitters.erase(it);
+                break;
+            }
+        }
         return ERR_NOERROR;
     }
 
@@ -258,14 +316,28 @@ public:
     return ERR_NOERROR;
 }
 
+private:
+    /// Checks whether the options describe the inbox channel of a participant
+    static bool IsInbox(const cSignalOptions& oOptions)
+    {
+        std::string strSignalName;
+        return oOptions.GetOption("SignalName", strSignalName) && 0 == strSignalName.find("_inbox_");
+    }
+
 public:
     /// List of Receivers
     std::vector<cMockReceiver*> m_vecReceivers;
     /// List of Transmitters
     std::vector<cMockTransmitter*> m_vecTransmitters;
+    /// List of Receivers of inbox channels (kept apart, the indices of the signals stay the same)
+    std::vector<cMockReceiver*> m_vecInboxReceivers;
+    /// List of Transmitters to inbox channels
+    std::vector<cMockTransmitter*> m_vecInboxTransmitters;
     ///Driver Options
     cDriverOptions m_oDriverOptions;
     /// Bool flag indicating that driver was initialized
     bool m_bInitialized;
+    /// Bool flag to let the creation of inbox receivers fail
+    bool m_bFailInboxReceivers;
 };
 #endif  //_FEP_TEST_MOCK_TX_DRIVER_H_INC_
\ No newline at end of file
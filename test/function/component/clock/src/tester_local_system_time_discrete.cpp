@@ -283,4 +283,111 @@ TEST(cLocalSimulationClock, synchronizedOnDemandDiscrete)
         testidx++;
     }
     test_file.close();
-}
\ No newline at end of file
+}
+/**
+ * @req_id "FEPSDK-1125"
+ */
+TEST(cLocalSimulationClock, synchronizedOnDemandDiscreteSlaveStatistics)
+{
+    cModule test_module_clock_client_1;
+    test_module_clock_client_1.Create(cModuleOptions("client_clock_discrete_1", eTimingSupportDefault::timing_FEP_30));
+    IPropertyTree* prop1 = test_module_clock_client_1.GetPropertyTree();
+    prop1->SetPropertyValue(FEP_CLOCKSERVICE_MAIN_CLOCK, FEP_CLOCKSERVICE_MAIN_CLOCK_VALUE_SLAVE_MASTER_ONDEMAND_DISCRETE);
+    prop1->SetPropertyValue(FEP_TIMING_MASTER_PARTICIPANT, "master_clock_statistics");
+
+    cModule test_module_clock_client_2;
+    test_module_clock_client_2.Create(cModuleOptions("client_clock_discrete_2", eTimingSupportDefault::timing_FEP_30));
+    IPropertyTree* prop2 = test_module_clock_client_2.GetPropertyTree();
+    prop2->SetPropertyValue(FEP_CLOCKSERVICE_MAIN_CLOCK, FEP_CLOCKSERVICE_MAIN_CLOCK_VALUE_SLAVE_MASTER_ONDEMAND_DISCRETE);
+    prop2->SetPropertyValue(FEP_TIMING_MASTER_PARTICIPANT, "master_clock_statistics");
+
+    cModule test_module_clock_master;
+    test_module_clock_master.Create(cModuleOptions("master_clock_statistics", eTimingSupportDefault::timing_FEP_30));
+    IPropertyTree* prop_master = test_module_clock_master.GetPropertyTree();
+    prop_master->SetPropertyValue(FEP_CLOCKSERVICE_MAIN_CLOCK, FEP_CLOCKSERVICE_MAIN_CLOCK_VALUE_LOCAL_SYSTEM_SIM_TIME);
+    prop_master->SetPropertyValue(FEP_CLOCKSERVICE_MAIN_CLOCK_SIM_TIME_CYCLE_TIME, 10);
+    prop_master->SetPropertyValue(FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT, 1000);
+
+    for (cModule* module : { &test_module_clock_client_1, &test_module_clock_client_2, &test_module_clock_master })
+    {
+        module->GetStateMachine()->StartupDoneEvent();
+        module->GetStateMachine()->InitializeEvent();
+        module->GetStateMachine()->InitDoneEvent();
+        module->GetStateMachine()->StartEvent();
+        module->WaitForState(tState::FS_RUNNING);
+    }
+
+    a_util::system::sleepMilliseconds(500);
+
+    //check whether the master collected the acknowledgement times of both clients
+    fep::rpc_object_client<fep::rpc_stubs::RPCClockServiceClient, IRPCClockServiceDef> clock_service_client(
+        "master_clock_statistics", IRPCClockServiceDef::DEFAULT_NAME, *getComponent<IRPC>(test_module_clock_client_1));
+    Json::Value statistics = clock_service_client.getSyncSlaveStatistics();
+    ASSERT_GT(statistics["steps"].asUInt64(), 0u);
+    ASSERT_EQ(statistics["late_acks"].asUInt64(), 0u);
+    ASSERT_EQ(statistics["data_acks"].asUInt64(), 0u);
+    const std::string slowest_slave = statistics["last_slowest_slave"].asString();
+    ASSERT_TRUE(slowest_slave == "client_clock_discrete_1" || slowest_slave == "client_clock_discrete_2");
+    ASSERT_GT(statistics["max_slowest_ack_us"].asInt64(), 0);
+    ASSERT_GE(statistics["max_slowest_ack_us"].asInt64(), statistics["last_slowest_ack_us"].asInt64());
+}
+
+/**
+ * @req_id "FEPSDK-1125"
+ */
+TEST(cLocalSimulationClock, synchronizedOnDemandDiscreteDataChannel)
+{
+    //client 1 is stepped by the data channel, client 2 by rpc only
+    cModule test_module_clock_client_1;
+    test_module_clock_client_1.Create(cModuleOptions("client_clock_data_channel_1", eTimingSupportDefault::timing_FEP_30));
+    IPropertyTree* prop1 = test_module_clock_client_1.GetPropertyTree();
+    prop1->SetPropertyValue(FEP_CLOCKSERVICE_MAIN_CLOCK, FEP_CLOCKSERVICE_MAIN_CLOCK_VALUE_SLAVE_MASTER_ONDEMAND_DISCRETE);
+    prop1->SetPropertyValue(FEP_TIMING_MASTER_PARTICIPANT, "master_clock_data_channel");
+    prop1->SetPropertyValue(FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL, true);
+
+    cModule test_module_clock_client_2;
+    test_module_clock_client_2.Create(cModuleOptions("client_clock_data_channel_2", eTimingSupportDefault::timing_FEP_30));
+    IPropertyTree* prop2 = test_module_clock_client_2.GetPropertyTree();
+    prop2->SetPropertyValue(FEP_CLOCKSERVICE_MAIN_CLOCK, FEP_CLOCKSERVICE_MAIN_CLOCK_VALUE_SLAVE_MASTER_ONDEMAND_DISCRETE);
+    prop2->SetPropertyValue(FEP_TIMING_MASTER_PARTICIPANT, "master_clock_data_channel");
+
+    cModule test_module_clock_master;
+    test_module_clock_master.Create(cModuleOptions("master_clock_data_channel", eTimingSupportDefault::timing_FEP_30));
+    IPropertyTree* prop_master = test_module_clock_master.GetPropertyTree();
+    prop_master->SetPropertyValue(FEP_CLOCKSERVICE_MAIN_CLOCK, FEP_CLOCKSERVICE_MAIN_CLOCK_VALUE_LOCAL_SYSTEM_SIM_TIME);
+    prop_master->SetPropertyValue(FEP_CLOCKSERVICE_MAIN_CLOCK_SIM_TIME_CYCLE_TIME, 10);
+    prop_master->SetPropertyValue(FEP_CLOCKSERVICE_MASTER_SYNC_TIMEOUT, 1000);
+    prop_master->SetPropertyValue(FEP_CLOCKSERVICE_SYNC_DATA_CHANNEL, true);
+
+    for (cModule* module : { &test_module_clock_client_1, &test_module_clock_client_2, &test_module_clock_master })
+    {
+        module->GetStateMachine()->StartupDoneEvent();
+        module->GetStateMachine()->InitializeEvent();
+        module->GetStateMachine()->InitDoneEvent();
+        module->GetStateMachine()->StartEvent();
+        module->WaitForState(tState::FS_RUNNING);
+    }
+
+    a_util::system::sleepMilliseconds(500);
+
+    //both clients follow the master
+    ASSERT_GT(getComponent<IClockService>(test_module_clock_client_1)->getTime(), 0);
+    ASSERT_GT(getComponent<IClockService>(test_module_clock_client_2)->getTime(), 0);
+
+    //the acknowledgements of both channels were in time
+    fep::rpc_object_client<fep::rpc_stubs::RPCClockServiceClient, IRPCClockServiceDef> clock_service_client(
+        "master_clock_data_channel", IRPCClockServiceDef::DEFAULT_NAME, *getComponent<IRPC>(test_module_clock_client_1));
+    Json::Value statistics = clock_service_client.getSyncSlaveStatistics();
+    ASSERT_GT(statistics["steps"].asUInt64(), 0u);
+    ASSERT_EQ(statistics["late_acks"].asUInt64(), 0u);
+    const std::string slowest_slave = statistics["last_slowest_slave"].asString();
+    ASSERT_TRUE(slowest_slave == "client_clock_data_channel_1" || slowest_slave == "client_clock_data_channel_2");
+
+    //client 1 was confirmed on the data channel, all its later steps were acknowledged there
+    const uint64_t data_acks = statistics["data_acks"].asUInt64();
+    ASSERT_GT(data_acks, 0u);
+    a_util::system::sleepMilliseconds(200);
+    statistics = clock_service_client.getSyncSlaveStatistics();
+    ASSERT_GT(statistics["data_acks"].asUInt64(), data_acks);
+    ASSERT_EQ(statistics["late_acks"].asUInt64(), 0u);
+}
@@ -0,0 +1,98 @@
+/**
+* Implementation of the tester for the FEP Common Functions and Classes
+*
+* @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*
+*/
+/*
+* Test Case:   TestByteSwap
+* Test Title:  Byte order conversion kernel tests
+* Description: Test the (internal) fep::SwapCopy16/32/64 kernels.
+* Strategy:    Compare every kernel available on this CPU with a byte wise reference for
+*              all element widths, odd element counts and unaligned buffers, and with the
+*              result of the scalar kernel.
+*              
+* Passed If:   no errors occur
+* Ticket:      -
+*/
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "fep_participant_sdk.h"
+#include "_common/fep_byteswap.h"
+using namespace fep;
+
+static const tByteSwapKernel s_aKernels[] = { BSK_Scalar, BSK_SSE2, BSK_AVX2, BSK_NEON };
+
+TEST(cTesterFepCommon, TestByteSwapKernels)
+{
+    const size_t aWidths[] = { 2, 4, 8 };
+    for (size_t nKernel = 0; nKernel < sizeof(s_aKernels) / sizeof(s_aKernels[0]); ++nKernel)
+    {
+        for (size_t nWidth = 0; nWidth < sizeof(aWidths) / sizeof(aWidths[0]); ++nWidth)
+        {
+            const size_t szWidth = aWidths[nWidth];
+            for (size_t nCount = 0; nCount < 67; ++nCount)
+            {
+                // an offset of one byte makes both buffers unaligned
+                for (size_t nOffset = 0; nOffset < 2; ++nOffset)
+                {
+                    std::vector<uint8_t> vecSource(nCount * szWidth + nOffset);
+                    std::vector<uint8_t> vecDest(vecSource.size(), 0);
+                    for (size_t i = 0; i < vecSource.size(); ++i)
+                    {
+                        vecSource[i] = static_cast<uint8_t>(i * 7 + 1);
+                    }
+                    if (!SwapCopyWithKernel(s_aKernels[nKernel], szWidth, &vecDest[0] + nOffset,
+                        &vecSource[0] + nOffset, nCount))
+                    {
+                        // not available on this CPU - only the scalar one has to exist
+                        ASSERT_NE(s_aKernels[nKernel], BSK_Scalar);
+                        continue;
+                    }
+                    std::vector<uint8_t> vecScalar(vecSource.size(), 0);
+                    ASSERT_TRUE(SwapCopyWithKernel(BSK_Scalar, szWidth, &vecScalar[0] + nOffset,
+                        &vecSource[0] + nOffset, nCount));
+                    ASSERT_TRUE(vecDest == vecScalar);
+                    for (size_t nElement = 0; nElement < nCount; ++nElement)
+                    {
+                        for (size_t nByte = 0; nByte < szWidth; ++nByte)
+                        {
+                            ASSERT_EQ(vecDest[nOffset + nElement * szWidth + nByte],
+                                vecSource[nOffset + nElement * szWidth + szWidth - 1 - nByte]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // the dispatched functions use one of the kernels above
+    uint8_t aSource[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    uint8_t aDest[8] = { 0 };
+    SwapCopy64(aDest, aSource, 1);
+    ASSERT_EQ(aDest[0], 8);
+    ASSERT_EQ(aDest[7], 1);
+    SwapCopy32(aDest, aSource, 2);
+    ASSERT_EQ(aDest[0], 4);
+    ASSERT_EQ(aDest[4], 8);
+    SwapCopy16(aDest, aSource, 4);
+    ASSERT_EQ(aDest[0], 2);
+    ASSERT_EQ(aDest[7], 7);
+}
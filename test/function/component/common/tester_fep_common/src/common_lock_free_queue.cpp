@@ -0,0 +1,151 @@
+/**
+* Implementation of the tester for the FEP Common Functions and Classes
+*
+* @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*
+*/
+/*
+* Test Case:   TestLockFreeQueue
+* Test Title:  Lock free queue tests
+* Description: Test the (internal) fep::cLockFreeQueue class.
+* Strategy:    Fill and drain the queue from a single thread to check ordering and the
+*              overflow counter, then run several producers and consumers concurrently.
+*              
+* Passed If:   no errors occur
+* Ticket:      -
+*/
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include <a_util/concurrency.h>
+
+#include "fep_participant_sdk.h"
+#include "_common/fep_lock_free_queue.h"
+using namespace fep;
+
+TEST(cTesterFepCommon, TestLockFreeQueueBounds)
+{
+    cLockFreeQueue<uint32_t> oQueue(5);
+    ASSERT_EQ(oQueue.GetCapacity(), 8);
+    ASSERT_TRUE(oQueue.IsEmpty());
+
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(oQueue.Enqueue(i));
+    }
+    ASSERT_FALSE(oQueue.Enqueue(8));
+    ASSERT_FALSE(oQueue.Enqueue(9));
+    ASSERT_EQ(oQueue.GetOverflowCount(), 2);
+    ASSERT_EQ(oQueue.GetHighWaterMark(), 8);
+    ASSERT_FALSE(oQueue.IsEmpty());
+
+    uint32_t nValue = 0;
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(oQueue.TryDequeue(nValue));
+        ASSERT_EQ(nValue, i);
+    }
+    ASSERT_FALSE(oQueue.TryDequeue(nValue));
+    ASSERT_TRUE(oQueue.IsEmpty());
+    // the high-water mark is kept when the queue drains
+    ASSERT_TRUE(oQueue.Enqueue(1));
+    ASSERT_EQ(oQueue.GetHighWaterMark(), 8);
+    ASSERT_TRUE(oQueue.TryDequeue(nValue));
+
+    // unlocks the guard only if empty
+    a_util::concurrency::fast_mutex oGuard;
+    oGuard.lock();
+    ASSERT_TRUE(oQueue.Enqueue(42));
+    ASSERT_TRUE(oQueue.TryDequeueAndUnlockGuardIfEmpty(nValue, oGuard));
+    ASSERT_EQ(nValue, 42);
+    ASSERT_FALSE(oQueue.TryDequeueAndUnlockGuardIfEmpty(nValue, oGuard));
+    ASSERT_TRUE(oGuard.try_lock());
+    oGuard.unlock();
+
+    // a queue without capacity rejects everything
+    cLockFreeQueue<uint32_t> oEmptyQueue;
+    ASSERT_FALSE(oEmptyQueue.Enqueue(1));
+    ASSERT_EQ(oEmptyQueue.GetOverflowCount(), 1);
+    oEmptyQueue.Initialize(4);
+    ASSERT_TRUE(oEmptyQueue.Enqueue(1));
+    ASSERT_EQ(oEmptyQueue.GetOverflowCount(), 0);
+    ASSERT_EQ(oEmptyQueue.GetHighWaterMark(), 1);
+}
+
+static const uint64_t s_nItemsPerProducer = 100000;
+
+static void ProduceItems(cLockFreeQueue<uint64_t>* pQueue, uint64_t nProducer)
+{
+    for (uint64_t i = 0; i < s_nItemsPerProducer; ++i)
+    {
+        while (!pQueue->Enqueue(nProducer * s_nItemsPerProducer + i))
+        {
+            a_util::concurrency::this_thread::yield();
+        }
+    }
+}
+
+static void ConsumeItems(cLockFreeQueue<uint64_t>* pQueue, std::atomic<uint64_t>* pCount,
+    std::atomic<uint64_t>* pSum, uint64_t nTotal)
+{
+    uint64_t nValue;
+    while (*pCount < nTotal)
+    {
+        if (pQueue->TryDequeue(nValue))
+        {
+            *pSum += nValue;
+            ++(*pCount);
+        }
+    }
+}
+
+TEST(cTesterFepCommon, TestLockFreeQueueConcurrency)
+{
+    const uint64_t nProducers = 3;
+    const uint64_t nConsumers = 2;
+    const uint64_t nTotal = nProducers * s_nItemsPerProducer;
+
+    cLockFreeQueue<uint64_t> oQueue(64);
+    std::atomic<uint64_t> nCount(0);
+    std::atomic<uint64_t> nSum(0);
+
+    std::vector<std::unique_ptr<a_util::concurrency::thread> > vecThreads;
+    for (uint64_t i = 0; i < nConsumers; ++i)
+    {
+        vecThreads.push_back(std::unique_ptr<a_util::concurrency::thread>(
+            new a_util::concurrency::thread(&ConsumeItems, &oQueue, &nCount, &nSum, nTotal)));
+    }
+    for (uint64_t i = 0; i < nProducers; ++i)
+    {
+        vecThreads.push_back(std::unique_ptr<a_util::concurrency::thread>(
+            new a_util::concurrency::thread(&ProduceItems, &oQueue, i)));
+    }
+    for (size_t i = 0; i < vecThreads.size(); ++i)
+    {
+        vecThreads[i]->join();
+    }
+
+    // every item was dequeued exactly once
+    ASSERT_EQ(nCount, nTotal);
+    ASSERT_EQ(nSum, nTotal * (nTotal - 1) / 2);
+    ASSERT_TRUE(oQueue.IsEmpty());
+    ASSERT_GE(oQueue.GetHighWaterMark(), 1);
+    ASSERT_LE(oQueue.GetHighWaterMark(), oQueue.GetCapacity());
+}
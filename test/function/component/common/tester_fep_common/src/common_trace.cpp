@@ -0,0 +1,140 @@
+/**
+* Implementation of the tester for the FEP Common Functions and Classes
+*
+* @file
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*
+*/
+/*
+* Test Case:   TestTrace
+* Test Title:  Tracing tests
+* Description: Test the (internal) fep::trace facility.
+* Strategy:    Record spans and instant events from several threads, export them as
+*              Chrome Trace Event JSON and check the content of the file.
+*              
+* Passed If:   no errors occur
+* Ticket:      -
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "fep_participant_sdk.h"
+#include "perfmeasure/fep_trace.h"
+using namespace fep;
+
+static const char* s_strTraceFile = "tester_fep_common_trace.json";
+
+static std::string ReadTraceFile()
+{
+    std::ifstream oFile(s_strTraceFile);
+    std::stringstream oContent;
+    oContent << oFile.rdbuf();
+    return oContent.str();
+}
+
+static size_t CountOccurrences(const std::string& strText, const std::string& strPattern)
+{
+    size_t szCount = 0;
+    for (size_t szPos = strText.find(strPattern); szPos != std::string::npos;
+        szPos = strText.find(strPattern, szPos + 1))
+    {
+        ++szCount;
+    }
+    return szCount;
+}
+
+static void TracedFunction(int nValue)
+{
+    FEP_TRACE_SPAN("TracedFunction", "tester");
+    FEP_TRACE_INSTANT_VALUE("TracedValue", "tester", nValue);
+}
+
+TEST(cTesterFepCommon, TestTraceDisabled)
+{
+    trace::Disable();
+    trace::Clear();
+    TracedFunction(1);
+
+    ASSERT_EQ(trace::ExportChromeTrace(s_strTraceFile), ERR_NOERROR);
+    std::string strTrace = ReadTraceFile();
+    ASSERT_NE(strTrace.find("\"traceEvents\""), std::string::npos);
+    ASSERT_EQ(strTrace.find("TracedFunction"), std::string::npos);
+    std::remove(s_strTraceFile);
+
+    ASSERT_EQ(trace::ExportChromeTrace(NULL), ERR_POINTER);
+}
+
+TEST(cTesterFepCommon, TestTraceSpansAndInstants)
+{
+    ASSERT_EQ(trace::RegisterTracePoint("TracedFunction", "tester"),
+        trace::RegisterTracePoint("TracedFunction", "tester"));
+    ASSERT_NE(trace::RegisterTracePoint("TracedFunction", "tester"),
+        trace::RegisterTracePoint("TracedFunction", "other"));
+
+    trace::Clear();
+    trace::Enable();
+    std::thread oFirst([]() { TracedFunction(1); });
+    std::thread oSecond([]() { TracedFunction(2); });
+    oFirst.join();
+    oSecond.join();
+    trace::Disable();
+    // not recorded anymore
+    TracedFunction(3);
+
+    ASSERT_EQ(trace::ExportChromeTrace(s_strTraceFile), ERR_NOERROR);
+    std::string strTrace = ReadTraceFile();
+    ASSERT_EQ(CountOccurrences(strTrace, "\"name\":\"TracedFunction\""), 2);
+    ASSERT_EQ(CountOccurrences(strTrace, "\"ph\":\"X\""), 2);
+    ASSERT_EQ(CountOccurrences(strTrace, "\"name\":\"TracedValue\""), 2);
+    ASSERT_EQ(CountOccurrences(strTrace, "\"value\":1}"), 1);
+    ASSERT_EQ(CountOccurrences(strTrace, "\"value\":2}"), 1);
+    ASSERT_EQ(CountOccurrences(strTrace, "\"value\":3}"), 0);
+    std::remove(s_strTraceFile);
+}
+
+TEST(cTesterFepCommon, TestTraceRingOverwritesOldestEvents)
+{
+    trace::Clear();
+    // a new thread gets a ring of 4 events (no ring of that size was released before)
+    trace::Enable(3);
+    std::thread oThread([]()
+    {
+        for (int nValue = 0; nValue < 10; ++nValue)
+        {
+            FEP_TRACE_INSTANT_VALUE("RingValue", "tester", nValue);
+        }
+    });
+    oThread.join();
+    trace::Disable();
+
+    ASSERT_EQ(trace::ExportChromeTrace(s_strTraceFile), ERR_NOERROR);
+    std::string strTrace = ReadTraceFile();
+    ASSERT_EQ(CountOccurrences(strTrace, "\"name\":\"RingValue\""), 4);
+    ASSERT_EQ(CountOccurrences(strTrace, "\"value\":5}"), 0);
+    for (int nValue = 6; nValue < 10; ++nValue)
+    {
+        ASSERT_EQ(CountOccurrences(strTrace, "\"value\":" + std::to_string(nValue) + "}"), 1);
+    }
+    std::remove(s_strTraceFile);
+    trace::Enable(trace::s_szDefaultEventsPerThread);
+    trace::Disable();
+}
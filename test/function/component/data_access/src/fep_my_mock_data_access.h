@@ -39,6 +39,7 @@ public:
         : m_mapSampleBuffers()
         , m_bTransmit(false)
         , m_vecTransmits()
+        , m_nBundleFlushes(0)
     {
 
     }
@@ -84,6 +85,11 @@ public:
         m_vecTransmits.push_back(oEntry);
         return ERR_NOERROR;
     }
+    fep::Result FlushSignalBundles()
+    {
+        m_nBundleFlushes++;
+        return ERR_NOERROR;
+    }
     fep::Result CreateUserDataSample(IUserDataSample*& pSample, const handle_t hSignal = NULL) const
     {
         std::map<handle_t, size_t>::const_iterator it= m_mapOutputSignalSize.find(hSignal);
@@ -108,6 +114,7 @@ public:
     std::map<handle_t, size_t> m_mapOutputSignalSize;
     bool m_bTransmit;
     std::vector<tTransmit> m_vecTransmits;
+    int m_nBundleFlushes;
 };
 
 #endif
\ No newline at end of file
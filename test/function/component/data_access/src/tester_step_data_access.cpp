@@ -257,6 +257,43 @@ TEST_F(cTesterStepDataAccess, TestOutputs)
     ASSERT_EQ(1000 * 1000, m_oDataAccess.m_vecTransmits[1].tmSampleTime);
 }
 
+/*
+* Test Case:   cTesterStepDataAccess.TestOutputsFlushBundles
+* Test ID:     1.4.1
+* Test Title:  Test Step Data Access Signal Bundle Flush
+* Description: Test whether bundled outputs are flushed at the end of the step
+* Strategy:    1) Configure one output
+*              2) Transmit all outputs and check that the signal bundles were flushed
+*              3) Skip the outputs and check that nothing was flushed
+* Passed If:   no errors occur
+* Ticket:      -
+* Requirement: FEP_SDK_???
+*/
+
+/**
+ * @req_id "FEPSDK-1772 FEPSDK-1787"
+ */
+TEST_F(cTesterStepDataAccess, TestOutputsFlushBundles)
+{
+    OutputConfig oOutputConfig = makeOutputConfig(&oOutputConfig);
+    m_oDataAccess.StoreOutputSignalSize(&oOutputConfig, 64);
+    m_pStepAccess->ConfigureOutput("output", oOutputConfig);
+
+    // Shutdown semaphore ... not set for this test
+    a_util::concurrency::semaphore thread_shutdown_semaphore;
+
+    ASSERT_EQ(a_util::result::SUCCESS, m_pStepAccess->ValidateInputs(1000 * 1000, thread_shutdown_semaphore));
+    ASSERT_EQ(a_util::result::SUCCESS, m_pStepAccess->TransmitAllOutputs());
+    ASSERT_TRUE(m_oDataAccess.m_bTransmit);
+    // the output may wait for the rest of its bundle - it has to be flushed with the step
+    ASSERT_EQ(1, m_oDataAccess.m_nBundleFlushes);
+
+    // skipped outputs are not flushed either
+    m_pStepAccess->SetSkip();
+    ASSERT_EQ(a_util::result::SUCCESS, m_pStepAccess->TransmitAllOutputs());
+    ASSERT_EQ(1, m_oDataAccess.m_nBundleFlushes);
+}
+
 /*
 * Test Case:   cTesterStepDataAccess.TestValidationOrder
 * Test ID:     1.5
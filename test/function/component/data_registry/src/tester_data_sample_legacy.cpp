@@ -25,6 +25,9 @@
 #include <fep_participant_sdk.h>
 #include <fep3/components/data_registry/data_registry_fep2/data_sample_fep2.h>
 #include <fep3/base/streamtype/default_streamtype.h>
+#include "fep3/components/data_registry/data_registry_fep2/data_writer_fep2.h"
+#include "function/_common/fep_mock_userdata_access.h"
+#include "transmission_adapter/fep_data_sample.h"
 #include "./../../helper/wait_for_data.hpp"
 
 using namespace fep;
@@ -186,4 +189,81 @@ TEST(DataReaderBacklogTestLegcy, checkBackLogRead)
         //the last read value is now the value before (time has been set to the same as the value )
         ASSERT_EQ(current_val, read_idx);
     }
-}
\ No newline at end of file
+}
+
+/// Data access counting the transmitted samples and the flushes of the signal bundles
+class cBundleCountingDataAccess : public cMockDataAccess
+{
+public:
+    cBundleCountingDataAccess() : m_nTransmits(0), m_nBundleFlushes(0)
+    {
+    }
+    fep::Result CreateUserDataSample(IUserDataSample*& pSample, const handle_t hSignal = NULL) const
+    {
+        pSample = new cDataSample();
+        pSample->SetSignalHandle(hSignal);
+        return ERR_NOERROR;
+    }
+    fep::Result TransmitData(fep::IUserDataSample* poSample, bool bSync)
+    {
+        m_nTransmits++;
+        return ERR_NOERROR;
+    }
+    fep::Result FlushSignalBundles()
+    {
+        m_nBundleFlushes++;
+        return ERR_NOERROR;
+    }
+public:
+    int m_nTransmits;
+    int m_nBundleFlushes;
+};
+
+/// Clock service standing still at 0
+class cFixedClockService : public IClockService
+{
+public:
+    timestamp_t getTime() const { return 0; }
+    timestamp_t getTime(const char*) const { return 0; }
+    IClock::ClockType getType() const { return IClock::ClockType::continuous; }
+    IClock::ClockType getType(const char*) const { return IClock::ClockType::continuous; }
+    fep::Result registerClock(IClock&) { return ERR_NOT_SUPPORTED; }
+    fep::Result unregisterClock(const char*) { return ERR_NOT_SUPPORTED; }
+    std::list<std::string> getClockList() const { return std::list<std::string>(); }
+    fep::Result setMainClock(const char*) { return ERR_NOT_SUPPORTED; }
+    std::string getCurrentMainClock() const { return std::string(); }
+    void registerEventSink(IClock::IEventSink&) {}
+    void unregisterEventSink(IClock::IEventSink&) {}
+};
+
+/**
+ * @req_id ""
+ */
+TEST(DataWriterFEP2Test, flushTransmitsSignalBundles)
+{
+    cBundleCountingDataAccess data_access;
+    cFixedClockService clock_service;
+    handle_t signal_handle = &signal_handle;
+    DataWriterFEP2<fep::detail::DataItemQueue<DataSampleFEP2>> writer(2);
+    ASSERT_TRUE(isOk(writer.init(data_access, signal_handle, clock_service)));
+
+    //nothing written - the bundles of other writers are left alone
+    ASSERT_TRUE(isOk(writer.flush()));
+    ASSERT_EQ(data_access.m_nBundleFlushes, 0);
+
+    //a flushed sample has to leave its bundle as well
+    int32_t value = 5;
+    DataSampleType<int32_t> sample(value);
+    ASSERT_TRUE(isOk(writer.write(sample)));
+    ASSERT_EQ(data_access.m_nTransmits, 0);
+    ASSERT_TRUE(isOk(writer.flush()));
+    ASSERT_EQ(data_access.m_nTransmits, 1);
+    ASSERT_EQ(data_access.m_nBundleFlushes, 1);
+
+    ASSERT_TRUE(isOk(writer.write(sample)));
+    ASSERT_TRUE(isOk(writer.flushFEP22Compatible(10)));
+    ASSERT_EQ(data_access.m_nTransmits, 2);
+    ASSERT_EQ(data_access.m_nBundleFlushes, 2);
+
+    ASSERT_TRUE(isOk(writer.deinit()));
+}
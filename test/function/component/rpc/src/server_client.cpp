@@ -37,6 +37,9 @@
 #pragma warning(disable:4290)
 #endif
 
+#include <future>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 #include "fep_participant_sdk.h"
 
@@ -83,6 +86,52 @@ class cMyServerImpl : public fep::rpc_object_server<test::rpc_stubs::cTestInterf
 
 
 
+class cMyAsyncClient : public fep::rpc_object_client<test::rpc_stubs::cTestInterfaceClient, IMyInterface>
+{
+    public:
+        cMyAsyncClient(const char* strServer, fep::IRPC& oRPC) :
+            fep::rpc_object_client<test::rpc_stubs::cTestInterfaceClient, IMyInterface>(strServer, "testserver", oRPC)
+        {
+        }
+
+        std::future<Json::Value> GetRunlevelAsync()
+        {
+            return callAsync("GetRunlevel", Json::nullValue);
+        }
+
+        std::future<Json::Value> GetRPCIIDForObjectAsync(const std::string& strObject)
+        {
+            Json::Value oParams;
+            oParams["strObject"] = strObject;
+            return callAsync("GetRPCIIDForObject", oParams);
+        }
+};
+
+/// Sends a synchronous request when it receives the response to an asynchronous one
+class cNestedRequest : public fep::IRPCAsyncResponse
+{
+    public:
+        cNestedRequest(cMyAsyncClient& oClient) : m_oClient(oClient)
+        {
+        }
+
+        void OnResponse(fep::Result nResult, const char* strResponse) override
+        {
+            try
+            {
+                m_oRunlevel.set_value(fep::isOk(nResult) ? m_oClient.GetRunlevel() : -1);
+            }
+            catch (...)
+            {
+                m_oRunlevel.set_value(-2);
+            }
+        }
+
+    public:
+        cMyAsyncClient& m_oClient;
+        std::promise<int> m_oRunlevel;
+};
+
 TEST(cRPCTest, TestServerClient)
 {
      fep::cModule oModule;
@@ -110,4 +159,123 @@ TEST(cRPCTest, TestServerClient)
 
      int nLevel = oClientStub.GetRunlevel();
      ASSERT_TRUE(nLevel == 123456);
-}
\ No newline at end of file
+}
+/*
+* Test Case:   TestServerClientTransports
+* Test Title:  Test RPC over the local transport and the command channel
+* Description: Requests are answered over the local socket transport as well as over the
+*              command channel, and a restarted server is reachable again.
+* Strategy:    Send requests with the local transport switched on and off and after the
+*              server participant was destroyed and created again.
+*
+* Passed If:   no errors occur
+*
+* Ticket:      -
+* Requirement:
+*/
+TEST(cRPCTest, TestServerClientTransports)
+{
+     cMyServerImpl myTestServerImpl;  //this must live at least as long as it is registerd
+     fep::cModule oModule;
+     ASSERT_EQ(fep::ERR_NOERROR, oModule.Create(fep::cModuleOptions("fep_server_transports")));
+     oModule.GetStateMachine()->StartupDoneEvent();
+     oModule.WaitForState(fep::FS_IDLE);
+     oModule.GetRPC()->GetRegistry()->RegisterObjectServer("testserver", myTestServerImpl);
+
+     fep::cModule oModuleClient;
+     ASSERT_EQ(fep::ERR_NOERROR, oModuleClient.Create(fep::cModuleOptions("fep_client_transports")));
+     fep::legacy::rpc_object_client<test::rpc_stubs::cTestInterfaceClient, IMyInterface> oClientStub("fep_server_transports", "testserver", oModuleClient);
+     oModuleClient.GetStateMachine()->StartupDoneEvent();
+     oModuleClient.WaitForState(fep::FS_IDLE);
+
+     // the local transport has to be switched on
+     bool bLocalTransport = true;
+     ASSERT_EQ(fep::ERR_NOERROR, oModuleClient.GetPropertyTree()->GetPropertyValue(FEP_RPC_CLIENT_LOCAL_TRANSPORT_PATH, bLocalTransport));
+     ASSERT_FALSE(bLocalTransport);
+     ASSERT_EQ(oClientStub.GetRunlevel(), 123456);
+     ASSERT_EQ(fep::ERR_NOERROR, oModuleClient.GetPropertyTree()->SetPropertyValue(FEP_RPC_CLIENT_LOCAL_TRANSPORT_PATH, true));
+     ASSERT_EQ(oClientStub.GetObjects(), "bla,bla,bla");
+
+     // the cached connection to the server is stale after a restart
+     ASSERT_EQ(fep::ERR_NOERROR, oModule.Destroy());
+     ASSERT_EQ(fep::ERR_NOERROR, oModule.Create(fep::cModuleOptions("fep_server_transports")));
+     oModule.GetStateMachine()->StartupDoneEvent();
+     oModule.WaitForState(fep::FS_IDLE);
+     oModule.GetRPC()->GetRegistry()->RegisterObjectServer("testserver", myTestServerImpl);
+     ASSERT_EQ(oClientStub.GetRPCIIDForObject("test"), "GetRPCIIDForObject: called for test");
+
+     oModule.GetRPC()->GetRegistry()->UnregisterObjectServer("testserver");
+}
+
+/*
+* Test Case:   TestServerClientAsync
+* Test Title:  Test asynchronous RPC requests
+* Description: Several asynchronous requests to several servers are in flight at the same
+*              time and every future receives the response to its own request.
+* Strategy:    Send requests to two servers without waiting, over the local transport and
+*              over the command channel, then collect the responses. Send a synchronous
+*              request from the receiver of an asynchronous response. Send a request to a
+*              participant that does not exist.
+*
+* Passed If:   no errors occur
+*
+* Ticket:      -
+* Requirement:
+*/
+TEST(cRPCTest, TestServerClientAsync)
+{
+     cMyServerImpl myTestServerImpl;  //this must live at least as long as it is registerd
+     fep::cModule oModule1;
+     ASSERT_EQ(fep::ERR_NOERROR, oModule1.Create(fep::cModuleOptions("fep_server_async1")));
+     oModule1.GetStateMachine()->StartupDoneEvent();
+     oModule1.WaitForState(fep::FS_IDLE);
+     oModule1.GetRPC()->GetRegistry()->RegisterObjectServer("testserver", myTestServerImpl);
+
+     cMyServerImpl myTestServerImpl2;
+     fep::cModule oModule2;
+     ASSERT_EQ(fep::ERR_NOERROR, oModule2.Create(fep::cModuleOptions("fep_server_async2")));
+     oModule2.GetStateMachine()->StartupDoneEvent();
+     oModule2.WaitForState(fep::FS_IDLE);
+     oModule2.GetRPC()->GetRegistry()->RegisterObjectServer("testserver", myTestServerImpl2);
+
+     fep::cModule oModuleClient;
+     ASSERT_EQ(fep::ERR_NOERROR, oModuleClient.Create(fep::cModuleOptions("fep_client_async")));
+     oModuleClient.GetStateMachine()->StartupDoneEvent();
+     oModuleClient.WaitForState(fep::FS_IDLE);
+     cMyAsyncClient oClient1("fep_server_async1", *oModuleClient.GetRPC());
+     cMyAsyncClient oClient2("fep_server_async2", *oModuleClient.GetRPC());
+
+     for (bool bLocalTransport : { true, false })
+     {
+         ASSERT_EQ(fep::ERR_NOERROR, oModuleClient.GetPropertyTree()->SetPropertyValue(FEP_RPC_CLIENT_LOCAL_TRANSPORT_PATH, bLocalTransport));
+         std::vector<std::future<Json::Value>> vecResults;
+         for (int nRequest = 0; nRequest < 10; ++nRequest)
+         {
+             cMyAsyncClient& oClient = (nRequest % 2 == 0) ? oClient1 : oClient2;
+             vecResults.push_back(oClient.GetRPCIIDForObjectAsync(std::to_string(nRequest)));
+             vecResults.push_back(oClient.GetRunlevelAsync());
+         }
+         for (int nRequest = 0; nRequest < 10; ++nRequest)
+         {
+             ASSERT_EQ(vecResults.at(2 * nRequest).get().asString(),
+                 "GetRPCIIDForObject: called for " + std::to_string(nRequest));
+             ASSERT_EQ(vecResults.at(2 * nRequest + 1).get().asInt(), 123456);
+         }
+     }
+
+     // the receivers of asynchronous responses are not called by the thread delivering the responses
+     cNestedRequest oNested(oClient1);
+     std::future<int> oNestedRunlevel = oNested.m_oRunlevel.get_future();
+     ASSERT_EQ(fep::ERR_NOERROR, oModuleClient.GetRPC()->SendRequestAsync("fep_server_async1", "testserver",
+         "{\"jsonrpc\":\"2.0\",\"method\":\"GetRunlevel\",\"id\":1}", &oNested));
+     ASSERT_EQ(oNestedRunlevel.get(), 123456);
+
+     // the future of a request nobody answers reports the timeout like the synchronous call
+     ASSERT_EQ(fep::ERR_NOERROR, oModuleClient.GetPropertyTree()->SetPropertyValue(FEP_RPC_CLIENT_REMOTE_TIMEOUT_PATH, 200));
+     cMyAsyncClient oClientMissing("fep_server_missing", *oModuleClient.GetRPC());
+     std::future<Json::Value> oMissing = oClientMissing.GetRunlevelAsync();
+     ASSERT_THROW(oMissing.get(), jsonrpc::JsonRpcException);
+
+     oModule1.GetRPC()->GetRegistry()->UnregisterObjectServer("testserver");
+     oModule2.GetRPC()->GetRegistry()->UnregisterObjectServer("testserver");
+}
@@ -25,6 +25,11 @@ using namespace fep;
 #ifdef WITH_ZYRE
 #include "transmission_adapter/zmq/fep_zmq_driver.h"
 #endif
+#ifdef __linux__
+#include "transmission_adapter/shm/fep_shm_driver.h"
+#include "transmission_adapter/udp/fep_udp_driver.h"
+#endif
+#include "transmission_adapter/inproc/fep_inproc_driver.h"
 #include "transmission_adapter/fep_transmission.h"
 #include "transmission_adapter/fep_serialization_helpers.h"
 #include "signal_registry/fep_signal_struct.h"
@@ -57,6 +62,23 @@ void cDriverTester::TestData(eFEPTransmissionType gs_eDUT)
         break;
     }
 #endif
+#ifdef __linux__
+    case fep::TT_SHM:
+    {
+        m_pDriver = new fep::shm::cShmDriver();
+        break;
+    }
+    case fep::TT_UDP:
+    {
+        m_pDriver = new fep::udp::cUdpDriver();
+        break;
+    }
+#endif
+    case fep::TT_INPROC:
+    {
+        m_pDriver = new fep::inproc::cInProcDriver();
+        break;
+    }
     }
     nResult = m_pFEPModule->Create("test_module", m_pDriver);
     m_pStateMachine = m_pFEPModule->GetStateMachine();
@@ -377,6 +399,23 @@ void cDriverTester::TestRxSampleSizeMismatch(eFEPTransmissionType gs_eDUT)
         break;
     }
 #endif
+#ifdef __linux__
+    case fep::TT_SHM:
+    {
+        m_pDriver = new fep::shm::cShmDriver();
+        break;
+    }
+    case fep::TT_UDP:
+    {
+        m_pDriver = new fep::udp::cUdpDriver();
+        break;
+    }
+#endif
+    case fep::TT_INPROC:
+    {
+        m_pDriver = new fep::inproc::cInProcDriver();
+        break;
+    }
     }
     nResult = m_pFEPModule->Create("test_module", m_pDriver);
     m_pStateMachine = m_pFEPModule->GetStateMachine();
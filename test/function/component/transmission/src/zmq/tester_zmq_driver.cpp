@@ -20,6 +20,7 @@
 *
 */
 
+#include <a_util/process.h>
 #include <gtest/gtest.h>
 #include "fep_participant_sdk.h"
 #include "fep_test_common.h"
@@ -106,4 +107,24 @@ TEST(DriverTester_ZMQ, TestMessageAfterCreate_ZMQ)
 TEST(DriverTester_ZMQ, TestVariableSignalSize_ZMQ)
 {
     cDriverTester::TestVariableSignalSize(fep::TT_ZMQ);
-}
\ No newline at end of file
+}
+/**
+* Test Case:   TestDataShardedReception_ZMQ
+* Test ID:     1.5
+* Test Title:  Test transmission of data with several reception threads
+* Description: Test transmission of data with the ZMQ driver receiving with four zyre nodes
+* Strategy:    The reception is sharded via FEP_ZMQ_RECEPTION_THREADS and the data test is repeated.
+*
+* Passed If:   All data sent while STM is up is also received.
+*
+* Ticket:      -
+*/
+/**
+ * @req_id "FEPSDK-1520 FEPSDK-1521 FEPSDK-1522"
+ */
+TEST(DriverTester_ZMQ, TestDataShardedReception_ZMQ)
+{
+    a_util::process::setEnvVar("FEP_ZMQ_RECEPTION_THREADS", "4");
+    cDriverTester::TestData(fep::TT_ZMQ);
+    a_util::process::setEnvVar("FEP_ZMQ_RECEPTION_THREADS", "1");
+}
@@ -0,0 +1,117 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+/**
+* Test Case:   TestBatchReception
+* Test Title:  Test reception of several samples at once
+* Description: This test checks that a batch of samples handed over by the driver at once
+*              is delivered completely and in order to the listeners.
+* Strategy:    Register a raw input signal at a driver supporting batch reception,
+*              hand over a batch of samples and check the values seen by the listener.
+*              
+* Passed If:   End of test is reached
+*              
+* Ticket:      -
+*/
+#include "test_helper_classes.h"
+#include <cstring>
+
+class cValueListener : public IPreparationDataListener
+{
+public:
+    fep::Result Update(const IPreparationDataSample *poPreparationSample)
+    {
+        m_vecValues.push_back(*static_cast<const uint32_t*>(poPreparationSample->GetPtr()));
+        return ERR_NOERROR;
+    }
+
+    std::vector<uint32_t> m_vecValues;
+};
+
+TEST(cTransmissionAdapterTester, TestBatchReception)
+{
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    cMockTxDriver oDriver;
+    cModuleOptions oOptions;
+    oPropertyTree.m_nWorkerThreads = 4;
+    oPropertyTree.m_strModuleName = "TestInitializationModule";
+    oOptions.SetParticipantName("TestInitializationModule");
+    oOptions.SetDomainId(16);
+
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+
+    handle_t hRecvHandle;
+    handle_t hSendHandle;
+    cValueListener oListener;
+
+    tSignal oTestSignalIn = { "TestSignal1","","",SD_Input,sizeof(uint32_t),false,false,1,SER_Raw,false, true, false, std::string("") };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oTestSignalIn, hRecvHandle));
+    tSignal oTestSignalOut = { "TestSignal1","","",SD_Output,sizeof(uint32_t),false,false,1,SER_Raw,false, true, false, std::string("") };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oTestSignalOut, hSendHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterDataListener(&oListener, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+
+    cMockReceiver* pMockReceiver = oDriver.m_vecReceivers.at(1);
+    ASSERT_TRUE(NULL != pMockReceiver->m_pBatchCallback);
+
+    IPreparationDataSample* pSample;
+    ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pSample));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSize(sizeof(uint32_t)));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSignalHandle(hSendHandle));
+
+    // serialize a burst of samples
+    const uint32_t nBatchSize = 16;
+    std::vector<std::vector<char> > vecData;
+    for (uint32_t i = 0; i < nBatchSize; i++)
+    {
+        *static_cast<uint32_t*>(pSample->GetPtr()) = i;
+        ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample));
+        const char* pData = static_cast<const char*>(oDriver.m_vecTransmitters.at(1)->m_pData);
+        vecData.push_back(std::vector<char>(pData, pData + oDriver.m_vecTransmitters.at(1)->m_szSize));
+    }
+
+    std::vector<IReceive::tReceivedBuffer> vecBuffers(nBatchSize);
+    for (uint32_t i = 0; i < nBatchSize; i++)
+    {
+        vecBuffers[i].pData = &vecData[i][0];
+        vecBuffers[i].szSize = vecData[i].size();
+    }
+
+    // hand over the burst at once, the buffers may be reused right after the call
+    pMockReceiver->m_pBatchCallback(pMockReceiver->m_pCallee, &vecBuffers[0], vecBuffers.size());
+    std::memset(&vecData[0][0], 0, vecData[0].size());
+    a_util::system::sleepMilliseconds(100);
+
+    ASSERT_EQ(oListener.m_vecValues.size(), nBatchSize);
+    for (uint32_t i = 0; i < nBatchSize; i++)
+    {
+        EXPECT_EQ(oListener.m_vecValues[i], i);
+    }
+
+    // single samples are still delivered through the single sample callback
+    cDataReceiver::EnqueueReceivedData(pMockReceiver->m_pCallee, &vecData[1][0], vecData[1].size());
+    a_util::system::sleepMilliseconds(50);
+    ASSERT_EQ(oListener.m_vecValues.size(), nBatchSize + 1);
+    EXPECT_EQ(oListener.m_vecValues.back(), 1);
+
+    //Clean up
+    delete pSample;
+    oAdapter.Disable();
+    oAdapter.Destroy();
+}
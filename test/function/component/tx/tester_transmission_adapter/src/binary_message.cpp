@@ -0,0 +1,167 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+/**
+* Test Case:   TestBinaryMessage
+* Test Title:  Test the binary encoding of messages
+* Description: This test checks that binary encoded messages are decoded into the same
+*              messages and that binary messages are only sent to participants that
+*              announced to decode them.
+* Strategy:    Encode messages binary, feed them to the adapter and compare the received
+*              messages. Transmit messages before and after the receiver announced
+*              the binary encoding and check the encoding of the transmitted message.
+*
+* Passed If:   End of test is reached
+*
+* Ticket:      -
+*/
+#include "test_helper_classes.h"
+#include "messages/fep_message_binary_codec.h"
+
+static const char* s_strModuleName = "TestInitializationModule";
+
+/// Encodes the message binary and feeds it to the adapter
+static void ReceiveBinary(cTransmissionAdapter& oAdapter, const IMessage& oMessage)
+{
+    std::vector<uint8_t> vecBuffer;
+    ASSERT_EQ(a_util::result::SUCCESS, cMessageBinaryCodec::Encode(&oMessage, vecBuffer));
+    ASSERT_TRUE(cMessageBinaryCodec::IsBinary(vecBuffer.data(), vecBuffer.size()));
+    cTransmissionAdapter::ReceiveMessage(&oAdapter, vecBuffer.data(), vecBuffer.size());
+    a_util::system::sleepMilliseconds(100);
+}
+
+TEST(cTransmissionAdapterTester, TestBinaryMessage)
+{
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    cMockTxDriver oDriver;
+    cModuleOptions oOptions;
+    oPropertyTree.m_nWorkerThreads = 4;
+    oPropertyTree.m_strModuleName = s_strModuleName;
+    oOptions.SetParticipantName(s_strModuleName);
+    oOptions.SetDomainId(16);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+
+    cMessageListener oMessageListener("Peer");
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterCommandListener(&oMessageListener));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterNotificationListener(&oMessageListener));
+
+    // decoded messages equal the encoded ones
+    cStateNotification oState(FS_RUNNING, "Peer", "*", 1, 2);
+    ReceiveBinary(oAdapter, oState);
+    EXPECT_STREQ(oState.ToString(), oMessageListener.m_oStateNotification.ToString());
+
+    cControlCommand oControl(CE_Start, "Peer", s_strModuleName, 3, 4);
+    ReceiveBinary(oAdapter, oControl);
+    EXPECT_STREQ(oControl.ToString(), oMessageListener.m_oControlCommand.ToString());
+
+    cSetPropertyCommand oSetDouble(2.5, "Path.fValue", "Peer", s_strModuleName, 5, 6);
+    ReceiveBinary(oAdapter, oSetDouble);
+    EXPECT_STREQ(oSetDouble.ToString(), oMessageListener.m_oSetPropertyCommand.ToString());
+
+    cSetPropertyCommand oSetString("value", "Path.strValue", "Peer", s_strModuleName, 5, 6);
+    ReceiveBinary(oAdapter, oSetString);
+    EXPECT_STREQ(oSetString.ToString(), oMessageListener.m_oSetPropertyCommand.ToString());
+
+    cGetPropertyCommand oGet("Path.Node", "Peer", "Test*", 7, 8);
+    ReceiveBinary(oAdapter, oGet);
+    EXPECT_STREQ(oGet.ToString(), oMessageListener.m_oGetPropertyCommand.ToString());
+
+    cCustomCommand oCustom("Custom", "{\"param1\" : \"test\"}", "Peer", s_strModuleName, 9, 10);
+    ReceiveBinary(oAdapter, oCustom);
+    EXPECT_STREQ(oCustom.ToString(), oMessageListener.m_oCustomCommand.ToString());
+
+    cIncidentNotification oIncident(-42, "Something happened", SL_Warning, "Peer", "*", 11, 12);
+    ReceiveBinary(oAdapter, oIncident);
+    EXPECT_STREQ(oIncident.ToString(), oMessageListener.m_oLogNotification.ToString());
+
+    cResultCodeNotification oResult(123456789012345LL, ERR_NOT_FOUND, "Peer", s_strModuleName, 13, 14);
+    ReceiveBinary(oAdapter, oResult);
+    EXPECT_STREQ(oResult.ToString(), oMessageListener.m_oResultCodeNotification.ToString());
+
+    cNameChangedNotification oNameChanged("OldPeer", "Peer", "*", 15, 16);
+    ReceiveBinary(oAdapter, oNameChanged);
+    EXPECT_STREQ(oNameChanged.ToString(), oMessageListener.m_oNameChangedNotification.ToString());
+
+    // messages to other participants are filtered, a truncated message is dropped
+    const size_t szReceived = oMessageListener.m_szReceiveCounter;
+    ReceiveBinary(oAdapter, cControlCommand(CE_Stop, "Peer", "Other", 17, 18));
+    std::vector<uint8_t> vecBuffer;
+    ASSERT_EQ(a_util::result::SUCCESS, cMessageBinaryCodec::Encode(&oControl, vecBuffer));
+    cTransmissionAdapter::ReceiveMessage(&oAdapter, vecBuffer.data(), vecBuffer.size() - 1);
+    a_util::system::sleepMilliseconds(100);
+    EXPECT_EQ(szReceived, oMessageListener.m_szReceiveCounter);
+
+    // messages carrying a cookie keep the JSON representation
+    cMuteSignalCommand oMute("Signal", SD_Input, true, s_strModuleName, "Peer", 19, 20);
+    EXPECT_EQ(ERR_NOT_SUPPORTED, cMessageBinaryCodec::Encode(&oMute, vecBuffer));
+
+    // JSON is sent until the receiver announced the binary encoding (on the broadcast channel)
+    oPropertyTree.m_bMessageInbox = false;
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+    cMockTransmitter* pTransmitter = oDriver.m_vecTransmitters.at(0);
+    cControlCommand oToPeer(CE_Initialize, s_strModuleName, "NewPeer", 21, 22);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToPeer));
+    EXPECT_EQ(static_cast<uint8_t>('{'), pTransmitter->m_vecData.at(0));
+
+    cStateNotification oAnnouncement(FS_IDLE, "NewPeer", "*", 23, 24);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Update(oAnnouncement.ToString()));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToPeer));
+    ASSERT_TRUE(cMessageBinaryCodec::IsBinary(pTransmitter->m_vecData.data(), pTransmitter->m_vecData.size()));
+    cMessageBinaryCodec::tHeader sHeader;
+    ASSERT_EQ(a_util::result::SUCCESS,
+        cMessageBinaryCodec::DecodeHeader(pTransmitter->m_vecData.data(), pTransmitter->m_vecData.size(), sHeader));
+    EXPECT_EQ(sHeader.strSender, s_strModuleName);
+    EXPECT_EQ(sHeader.strReceiver, "NewPeer");
+    EXPECT_EQ(sHeader.tmTimeStamp, 21);
+
+    // broadcasts stay JSON, participants might not decode binary messages
+    cControlCommand oToAll(CE_Initialize, s_strModuleName, "*", 25, 26);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToAll));
+    EXPECT_EQ(static_cast<uint8_t>('{'), pTransmitter->m_vecData.at(0));
+
+    // a JSON message without the announcement reverts to JSON (e.g. an older participant)
+    std::string strOldMessage = oAnnouncement.ToString();
+    const size_t szField = strOldMessage.find(cMessageBinaryCodec::s_strEncodingsField);
+    ASSERT_NE(std::string::npos, szField);
+    strOldMessage.replace(szField, strlen(cMessageBinaryCodec::s_strEncodingsField), "Unknown");
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Update(strOldMessage.c_str()));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToPeer));
+    EXPECT_EQ(static_cast<uint8_t>('{'), pTransmitter->m_vecData.at(0));
+
+    // "binary" sends every message with a binary encoding binary
+    oPropertyTree.m_strMessageEncoding = "binary";
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Disable());
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToAll));
+    EXPECT_TRUE(cMessageBinaryCodec::IsBinary(pTransmitter->m_vecData.data(), pTransmitter->m_vecData.size()));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oMute));
+    EXPECT_EQ(static_cast<uint8_t>('{'), pTransmitter->m_vecData.at(0));
+
+    // "json" never sends binary messages
+    oPropertyTree.m_strMessageEncoding = "json";
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Disable());
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToAll));
+    EXPECT_EQ(static_cast<uint8_t>('{'), pTransmitter->m_vecData.at(0));
+
+    EXPECT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterCommandListener(&oMessageListener));
+    EXPECT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterNotificationListener(&oMessageListener));
+    oAdapter.Disable();
+    oAdapter.Destroy();
+}
@@ -0,0 +1,124 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+/**
+* Test Case:   TestCodecPlan
+* Test Title:  Test the precompiled (de)serialization plan
+* Description: This test checks that the precompiled plan produces the same result
+*              as the generic DDL codec.
+* Strategy:    Create a plan for a struct with padding and mixed byte orders, serialize and
+*              deserialize a sample with both the plan and the generic codec and compare.
+*              
+* Passed If:   End of test is reached
+*              
+* Ticket:      -
+*/
+#include "test_helper_classes.h"
+#include <codec/codec.h>
+#include <codec/codec_factory.h>
+#include <ddlrepresentation/ddlcomplex.h>
+#include <ddlrepresentation/ddldescription.h>
+#include <ddlrepresentation/ddlimporter.h>
+#include <serialization/serialization.h>
+#include "transmission_adapter/fep_codec_plan.h"
+
+static const std::string s_strMixedDescription = std::string(
+    "<struct alignment=\"8\" name=\"tMixedSignal\" version=\"1\">"
+    "    <element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"ui8Flag\" type=\"tUInt8\" />"
+    "    <element alignment=\"4\" arraysize=\"1\" byteorder=\"BE\" bytepos=\"1\" name=\"ui32Counter\" type=\"tUInt32\" />"
+    "    <element alignment=\"8\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"5\" name=\"f64Value\" type=\"tFloat64\" />"
+    "    <element alignment=\"2\" arraysize=\"5\" byteorder=\"BE\" bytepos=\"13\" name=\"i16Array\" type=\"tInt16\" />"
+    "    <element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"23\" name=\"bValid\" type=\"tBool\" />"
+    "</struct>");
+
+static const std::string s_strDynamicDescription = std::string(
+    "<struct alignment=\"4\" name=\"tDynamicSignal\" version=\"1\">"
+    "    <element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"ui32Count\" type=\"tUInt32\" />"
+    "    <element alignment=\"4\" arraysize=\"ui32Count\" byteorder=\"LE\" bytepos=\"4\" name=\"ui32Values\" type=\"tUInt32\" />"
+    "</struct>");
+
+TEST(cTransmissionAdapterTester, TestCodecPlan)
+{
+    std::string strDDLDesc = a_util::strings::format(s_strDescriptionTemplate.c_str(),
+        (s_strMixedDescription + s_strDynamicDescription).c_str());
+    ddl::DDLImporter oImporter;
+    ASSERT_EQ(a_util::result::SUCCESS, oImporter.setXML(strDDLDesc));
+    ASSERT_EQ(a_util::result::SUCCESS, oImporter.createNew());
+    ddl::DDLDescription* pDescription = oImporter.getDDL();
+    ASSERT_TRUE(NULL != pDescription);
+
+    ddl::CodecFactory oFactory("tMixedSignal", strDDLDesc.c_str());
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+
+    cCodecPlan oPlan;
+    ASSERT_EQ(a_util::result::SUCCESS, oPlan.Create(oFactory, pDescription->getStructByName("tMixedSignal")));
+    ASSERT_TRUE(oPlan.IsValid());
+    ASSERT_EQ(oPlan.GetDeserializedSize(), oFactory.getStaticBufferSize(ddl::deserialized));
+    ASSERT_EQ(oPlan.GetSerializedSize(), oFactory.getStaticBufferSize(ddl::serialized));
+
+    // fill all elements with some values
+    std::vector<uint8_t> vecSample(oPlan.GetDeserializedSize(), 0);
+    {
+        ddl::Codec oCodec = oFactory.makeCodecFor(&vecSample[0], vecSample.size());
+        for (size_t nIdx = 0; nIdx < oCodec.getElementCount(); ++nIdx)
+        {
+            ASSERT_EQ(a_util::result::SUCCESS, oCodec.setElementValue(nIdx,
+                a_util::variant::Variant(static_cast<int32_t>(nIdx * 257 + 3))));
+        }
+    }
+
+    // serialization
+    std::vector<uint8_t> vecExpected(oPlan.GetSerializedSize(), 0);
+    std::vector<uint8_t> vecSerialized(oPlan.GetSerializedSize(), 0);
+    {
+        ddl::Decoder oDec = oFactory.makeDecoderFor(&vecSample[0], vecSample.size());
+        a_util::memory::MemoryBuffer oBuffer(&vecExpected[0], vecExpected.size());
+        ASSERT_EQ(a_util::result::SUCCESS, ddl::serialization::transform_to_buffer(oDec, oBuffer));
+    }
+    ASSERT_EQ(a_util::result::SUCCESS, oPlan.Serialize(&vecSample[0], vecSample.size(),
+        &vecSerialized[0], vecSerialized.size()));
+    EXPECT_EQ(vecExpected, vecSerialized);
+
+    // deserialization (padding is left untouched by both)
+    std::vector<uint8_t> vecExpectedSample(oPlan.GetDeserializedSize(), 0);
+    std::vector<uint8_t> vecDeserialized(oPlan.GetDeserializedSize(), 0);
+    {
+        ddl::Decoder oDec = oFactory.makeDecoderFor(&vecSerialized[0], vecSerialized.size(), ddl::serialized);
+        a_util::memory::MemoryBuffer oBuffer(&vecExpectedSample[0], vecExpectedSample.size());
+        ASSERT_EQ(a_util::result::SUCCESS, ddl::serialization::transform_to_buffer(oDec, oBuffer));
+    }
+    ASSERT_EQ(a_util::result::SUCCESS, oPlan.Deserialize(&vecSerialized[0], vecSerialized.size(),
+        &vecDeserialized[0], vecDeserialized.size()));
+    EXPECT_EQ(vecExpectedSample, vecDeserialized);
+    EXPECT_EQ(vecSample, vecDeserialized);
+
+    // buffers that are too small are rejected
+    EXPECT_EQ(ERR_INVALID_ARG, oPlan.Serialize(&vecSample[0], vecSample.size() - 1,
+        &vecSerialized[0], vecSerialized.size()));
+    EXPECT_EQ(ERR_INVALID_ARG, oPlan.Deserialize(&vecSerialized[0], vecSerialized.size() - 1,
+        &vecDeserialized[0], vecDeserialized.size()));
+
+    // dynamic arrays are left to the generic codec
+    ddl::CodecFactory oDynamicFactory("tDynamicSignal", strDDLDesc.c_str());
+    ASSERT_EQ(a_util::result::SUCCESS, oDynamicFactory.isValid());
+    cCodecPlan oDynamicPlan;
+    EXPECT_EQ(ERR_NOT_SUPPORTED, oDynamicPlan.Create(oDynamicFactory,
+        pDescription->getStructByName("tDynamicSignal")));
+    EXPECT_FALSE(oDynamicPlan.IsValid());
+
+    oImporter.destroyDDL();
+}
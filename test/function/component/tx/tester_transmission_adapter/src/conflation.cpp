@@ -0,0 +1,129 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+/**
+* Test Case:   TestConflation
+* Test Title:  Test latest-value conflation of input signals
+* Description: This test checks that a conflating input signal only processes the newest
+*              pending sample when its listener cannot keep up.
+* Strategy:    Block the listener while a burst of samples (larger than the reception
+*              buffers) is received, release it and check which samples were processed.
+*
+* Passed If:   End of test is reached
+*
+* Ticket:      -
+*/
+#include "test_helper_classes.h"
+#include <atomic>
+
+class cBlockingValueListener : public IPreparationDataListener
+{
+public:
+    cBlockingValueListener() : m_bBlocked(true)
+    {
+    }
+
+    fep::Result Update(const IPreparationDataSample *poPreparationSample)
+    {
+        m_vecValues.push_back(*static_cast<const uint32_t*>(poPreparationSample->GetPtr()));
+        while (m_bBlocked)
+        {
+            a_util::system::sleepMilliseconds(1);
+        }
+        return ERR_NOERROR;
+    }
+
+    std::vector<uint32_t> m_vecValues;
+    std::atomic<bool> m_bBlocked;
+};
+
+TEST(cTransmissionAdapterTester, TestConflation)
+{
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    cMockTxDriver oDriver;
+    cModuleOptions oOptions;
+    oPropertyTree.m_nWorkerThreads = 4;
+    oPropertyTree.m_strModuleName = "TestInitializationModule";
+    oOptions.SetParticipantName("TestInitializationModule");
+    oOptions.SetDomainId(16);
+
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+
+    handle_t hRecvHandle;
+    handle_t hSendHandle;
+    cBlockingValueListener oListener;
+
+    tSignal oTestSignalIn = { "TestSignal1","","",SD_Input,sizeof(uint32_t),false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string(""), 0, true };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oTestSignalIn, hRecvHandle));
+    tSignal oTestSignalOut = { "TestSignal1","","",SD_Output,sizeof(uint32_t),false,false,1,SER_Raw,false, true, false, std::string("") };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oTestSignalOut, hSendHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterDataListener(&oListener, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+
+    cMockReceiver* pMockReceiver = oDriver.m_vecReceivers.at(1);
+    cDataReceiver* pReceiver = static_cast<cDataReceiver*>(pMockReceiver->m_pCallee);
+
+    IPreparationDataSample* pSample;
+    ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pSample));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSize(sizeof(uint32_t)));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSignalHandle(hSendHandle));
+
+    // more samples than reception buffers (20 for raw signals)
+    const uint32_t nBurstSize = 30;
+    std::vector<std::vector<char> > vecData;
+    for (uint32_t i = 0; i < nBurstSize; i++)
+    {
+        *static_cast<uint32_t*>(pSample->GetPtr()) = i;
+        ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample));
+        const char* pData = static_cast<const char*>(oDriver.m_vecTransmitters.at(1)->m_pData);
+        vecData.push_back(std::vector<char>(pData, pData + oDriver.m_vecTransmitters.at(1)->m_szSize));
+    }
+
+    // the listener blocks the first sample, the others pile up meanwhile
+    cDataReceiver::EnqueueReceivedData(pMockReceiver->m_pCallee, &vecData[0][0], vecData[0].size());
+    a_util::system::sleepMilliseconds(50);
+    for (uint32_t i = 1; i < nBurstSize; i++)
+    {
+        cDataReceiver::EnqueueReceivedData(pMockReceiver->m_pCallee, &vecData[i][0], vecData[i].size());
+    }
+    ASSERT_EQ(pReceiver->GetDroppedSampleCount(), 0);
+
+    // only the newest pending sample is processed once the listener returns
+    oListener.m_bBlocked = false;
+    a_util::system::sleepMilliseconds(100);
+    ASSERT_EQ(oListener.m_vecValues.size(), 2);
+    EXPECT_EQ(oListener.m_vecValues[0], 0);
+    EXPECT_EQ(oListener.m_vecValues[1], nBurstSize - 1);
+    EXPECT_EQ(pReceiver->GetConflatedSampleCount(), nBurstSize - 2);
+    EXPECT_EQ(pReceiver->GetDroppedSampleCount(), 0);
+
+    // without backlog every sample is processed
+    cDataReceiver::EnqueueReceivedData(pMockReceiver->m_pCallee, &vecData[3][0], vecData[3].size());
+    a_util::system::sleepMilliseconds(50);
+    cDataReceiver::EnqueueReceivedData(pMockReceiver->m_pCallee, &vecData[4][0], vecData[4].size());
+    a_util::system::sleepMilliseconds(50);
+    ASSERT_EQ(oListener.m_vecValues.size(), 4);
+    EXPECT_EQ(oListener.m_vecValues[3], 4);
+    EXPECT_EQ(pReceiver->GetConflatedSampleCount(), nBurstSize - 2);
+
+    //Clean up
+    delete pSample;
+    oAdapter.Disable();
+    oAdapter.Destroy();
+}
@@ -0,0 +1,271 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+/**
+* Test Case:   TestDeltaEncoding
+* Test Title:  Test delta encoding of large, slowly changing signals
+* Description: This test checks the delta codec and that a delta encoded output signal
+*              is transmitted as keyframes and deltas and reconstructed by the receiver.
+* Strategy:    Encode and apply deltas of sparsely changed buffers. Register a delta encoded
+*              output signal, transmit samples, feed them (or not) to the input signal and
+*              check what the listener receives. Transmit the deltas over the inproc driver,
+*              which rejects samples not matching the signal size of fixed size signals.
+*
+* Passed If:   End of test is reached
+*
+* Ticket:      -
+*/
+#include "test_helper_classes.h"
+#include "transmission_adapter/fep_delta_codec.h"
+#include "transmission_adapter/inproc/fep_inproc_driver.h"
+
+TEST(cTransmissionAdapterTester, TestDeltaCodec)
+{
+    const size_t szSize = 10000;
+    std::vector<uint8_t> vecReference(szSize);
+    std::vector<uint8_t> vecSample(szSize);
+    for (size_t nIdx = 0; nIdx < szSize; ++nIdx)
+    {
+        vecReference[nIdx] = static_cast<uint8_t>(nIdx * 7);
+    }
+    std::vector<uint8_t> vecReceived(vecReference);
+    std::vector<uint8_t> vecDelta(szSize);
+    size_t szDelta = 0;
+
+    // an unchanged sample results in an empty delta
+    vecSample = vecReference;
+    ASSERT_TRUE(delta::EncodeDelta(&vecReference[0], &vecSample[0], szSize, &vecDelta[0], vecDelta.size(), szDelta));
+    ASSERT_EQ(szDelta, 0);
+    ASSERT_TRUE(delta::ApplyDelta(&vecReceived[0], szSize, &vecDelta[0], szDelta));
+    ASSERT_TRUE(vecReceived == vecSample);
+
+    // a few changed bytes (including the first and the last one)
+    srand(42);
+    for (int nRound = 0; nRound < 20; ++nRound)
+    {
+        vecSample[0] ^= 0x01;
+        vecSample[szSize - 1] ^= 0x80;
+        for (int nChange = 0; nChange < 30; ++nChange)
+        {
+            vecSample[rand() % szSize] = static_cast<uint8_t>(rand());
+        }
+        ASSERT_TRUE(delta::EncodeDelta(&vecReference[0], &vecSample[0], szSize, &vecDelta[0], vecDelta.size(), szDelta));
+        ASSERT_LT(szDelta, szSize / 20);
+        ASSERT_TRUE(vecReference == vecSample);
+        ASSERT_TRUE(delta::ApplyDelta(&vecReceived[0], szSize, &vecDelta[0], szDelta));
+        ASSERT_TRUE(vecReceived == vecSample);
+    }
+
+    // a delta not fitting into the destination still updates the reference
+    for (size_t nIdx = 0; nIdx < szSize; ++nIdx)
+    {
+        vecSample[nIdx] = static_cast<uint8_t>(~vecSample[nIdx]);
+    }
+    ASSERT_FALSE(delta::EncodeDelta(&vecReference[0], &vecSample[0], szSize, &vecDelta[0], szSize - 1, szDelta));
+    ASSERT_TRUE(vecReference == vecSample);
+
+    // corrupt deltas are rejected
+    const uint8_t aTruncated[] = { 0x05, 0x80 };
+    ASSERT_FALSE(delta::ApplyDelta(&vecReceived[0], szSize, aTruncated, sizeof(aTruncated)));
+    const uint8_t aTooLong[] = { 0xFF, 0x4E, 0x01, 0xAA };
+    ASSERT_FALSE(delta::ApplyDelta(&vecReceived[0], szSize, aTooLong, sizeof(aTooLong)));
+    const uint8_t aMissingBytes[] = { 0x00, 0x03, 0xAA };
+    ASSERT_FALSE(delta::ApplyDelta(&vecReceived[0], szSize, aMissingBytes, sizeof(aMissingBytes)));
+}
+
+class cDeltaSampleListener : public IPreparationDataListener
+{
+public:
+    fep::Result Update(const IPreparationDataSample *poPreparationSample)
+    {
+        const uint8_t* pData = static_cast<const uint8_t*>(poPreparationSample->GetPtr());
+        m_vecSamples.push_back(std::vector<uint8_t>(pData, pData + poPreparationSample->GetSize()));
+        return ERR_NOERROR;
+    }
+
+    std::vector<std::vector<uint8_t> > m_vecSamples;
+};
+
+TEST(cTransmissionAdapterTester, TestDeltaEncodedSignal)
+{
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    cMockTxDriver oDriver;
+    cModuleOptions oOptions;
+    oPropertyTree.m_nWorkerThreads = 4;
+    oPropertyTree.m_strModuleName = "TestInitializationModule";
+    oOptions.SetParticipantName("TestInitializationModule");
+    oOptions.SetDomainId(16);
+
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+
+    const size_t szSignal = 4096;
+    handle_t hRecvHandle, hSendHandle;
+    cDeltaSampleListener oListener;
+    // receivers decode delta encoded samples without being configured for it
+    tSignal oSignalIn = { "Grid","","",SD_Input,szSignal,false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string(""), 0 };
+    tSignal oSignalOut = { "Grid","","",SD_Output,szSignal,false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string(""), 3 };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalIn, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalOut, hSendHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterDataListener(&oListener, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+
+    // message channel + signal
+    cMockTransmitter* pTransmitter = oDriver.m_vecTransmitters.at(1);
+    cMockReceiver* pReceiver = oDriver.m_vecReceivers.at(1);
+
+    IPreparationDataSample* pSample;
+    ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pSample));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSize(szSignal));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSignalHandle(hSendHandle));
+    uint8_t* pGrid = static_cast<uint8_t*>(pSample->GetPtr());
+    for (size_t nIdx = 0; nIdx < szSignal; ++nIdx)
+    {
+        pGrid[nIdx] = static_cast<uint8_t>(nIdx);
+    }
+
+    // transmits the next sample (changing a few bytes) and returns the delta flag of it
+    std::vector<std::vector<uint8_t> > vecSent;
+    std::vector<uint8_t> vecTransmitted;
+    auto fnTransmit = [&](size_t nChanged) -> uint8_t
+    {
+        pGrid[nChanged] = static_cast<uint8_t>(pGrid[nChanged] + 1);
+        vecSent.push_back(std::vector<uint8_t>(pGrid, pGrid + szSignal));
+        EXPECT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample));
+        // the mock driver keeps the pointer only and the buffer is reused by the next sample
+        const uint8_t* pData = static_cast<const uint8_t*>(pTransmitter->m_pData);
+        vecTransmitted.assign(pData, pData + pTransmitter->m_szSize);
+        return header::GetDeltaFlag(reinterpret_cast<const cFepDataHeader*>(pData)->m_nSerAndByteOrderFlags);
+    };
+    auto fnReceive = [&]()
+    {
+        cDataReceiver::EnqueueReceivedData(pReceiver->m_pCallee, &vecTransmitted[0], vecTransmitted.size());
+        a_util::system::sleepMilliseconds(100);
+    };
+
+    // a keyframe followed by two deltas
+    ASSERT_EQ(fnTransmit(0), header::DELTA_KEYFRAME);
+    ASSERT_EQ(vecTransmitted.size(), sizeof(cFepDataHeader) + szSignal);
+    // older receivers have to reject the samples of the signal
+    ASSERT_EQ(reinterpret_cast<const cFepDataHeader*>(&vecTransmitted[0])->m_nMajorVersion,
+        FEP_SDK_PARTICIPANT_VERSION_MAJOR | header::s_nExtendedFormatVersionFlag);
+    fnReceive();
+    ASSERT_EQ(fnTransmit(100), header::DELTA_ENCODED);
+    ASSERT_LT(vecTransmitted.size(), sizeof(cFepDataHeader) + 16);
+    fnReceive();
+    ASSERT_EQ(fnTransmit(szSignal - 1), header::DELTA_ENCODED);
+    fnReceive();
+    ASSERT_EQ(oListener.m_vecSamples.size(), 3);
+    for (size_t nIdx = 0; nIdx < 3; ++nIdx)
+    {
+        ASSERT_TRUE(oListener.m_vecSamples[nIdx] == vecSent[nIdx]);
+    }
+
+    // a missed delta drops the following ones until the next keyframe
+    ASSERT_EQ(fnTransmit(200), header::DELTA_KEYFRAME);
+    fnReceive();
+    ASSERT_EQ(fnTransmit(300), header::DELTA_ENCODED);
+    ASSERT_EQ(fnTransmit(400), header::DELTA_ENCODED);
+    fnReceive();
+    ASSERT_EQ(oListener.m_vecSamples.size(), 4);
+    ASSERT_EQ(oIncidentHandler.m_nIncidentCode, FSI_TRANSM_RX_MISSING_DATASAMPLE);
+    ASSERT_EQ(fnTransmit(500), header::DELTA_KEYFRAME);
+    fnReceive();
+    ASSERT_EQ(oListener.m_vecSamples.size(), 5);
+    ASSERT_TRUE(oListener.m_vecSamples[4] == vecSent[6]);
+
+    // a sample the delta would not be smaller for is sent as keyframe
+    for (size_t nIdx = 0; nIdx < szSignal; ++nIdx)
+    {
+        pGrid[nIdx] = static_cast<uint8_t>(~pGrid[nIdx]);
+    }
+    ASSERT_EQ(fnTransmit(0), header::DELTA_KEYFRAME);
+    fnReceive();
+    ASSERT_EQ(fnTransmit(600), header::DELTA_ENCODED);
+    fnReceive();
+    ASSERT_EQ(oListener.m_vecSamples.size(), 7);
+    ASSERT_TRUE(oListener.m_vecSamples[6] == vecSent[8]);
+
+    //Clean up
+    delete pSample;
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterDataListener(&oListener, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hSendHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hRecvHandle));
+    oAdapter.Disable();
+    oAdapter.Destroy();
+}
+
+TEST(cTransmissionAdapterTester, TestDeltaEncodedSignalInProc)
+{
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    fep::inproc::cInProcDriver oDriver;
+    cModuleOptions oOptions;
+    oPropertyTree.m_nWorkerThreads = 4;
+    oPropertyTree.m_strModuleName = "TestDeltaInProcModule";
+    oOptions.SetParticipantName("TestDeltaInProcModule");
+    oOptions.SetDomainId(17);
+
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+
+    const size_t szSignal = 4096;
+    handle_t hRecvHandle, hSendHandle;
+    cDeltaSampleListener oListener;
+    // neither signal is raw, so the delta frames must not be checked against the signal size
+    tSignal oSignalIn = { "GridInProc","","",SD_Input,szSignal,false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string(""), 0 };
+    tSignal oSignalOut = { "GridInProc","","",SD_Output,szSignal,false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string(""), 3 };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalIn, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalOut, hSendHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterDataListener(&oListener, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+
+    IPreparationDataSample* pSample;
+    ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pSample));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSize(szSignal));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSignalHandle(hSendHandle));
+    uint8_t* pGrid = static_cast<uint8_t*>(pSample->GetPtr());
+    for (size_t nIdx = 0; nIdx < szSignal; ++nIdx)
+    {
+        pGrid[nIdx] = static_cast<uint8_t>(nIdx);
+    }
+
+    // a keyframe followed by deltas
+    std::vector<std::vector<uint8_t> > vecSent;
+    for (size_t nSample = 0; nSample < 5; ++nSample)
+    {
+        pGrid[nSample * 100] = static_cast<uint8_t>(pGrid[nSample * 100] + 1);
+        vecSent.push_back(std::vector<uint8_t>(pGrid, pGrid + szSignal));
+        ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample));
+        a_util::system::sleepMilliseconds(100);
+    }
+    ASSERT_NE(oIncidentHandler.m_nIncidentCode, FSI_TRANSM_DATA_TX_FAILED);
+    ASSERT_EQ(oListener.m_vecSamples.size(), vecSent.size());
+    for (size_t nIdx = 0; nIdx < vecSent.size(); ++nIdx)
+    {
+        ASSERT_TRUE(oListener.m_vecSamples[nIdx] == vecSent[nIdx]);
+    }
+
+    //Clean up
+    delete pSample;
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterDataListener(&oListener, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hSendHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hRecvHandle));
+    oAdapter.Disable();
+    oAdapter.Destroy();
+}
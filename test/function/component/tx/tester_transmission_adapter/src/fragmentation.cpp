@@ -28,7 +28,10 @@
 */
 #include <gtest/gtest.h>
 #include "transmission_adapter/fep_fragmentation.h"
+#include <chrono>
 #include <string>
+#include <thread>
+#include <vector>
 
 static constexpr unsigned protocol_version = 3;
 
@@ -229,3 +232,222 @@ TEST(cTransmissionAdapterTester, TestFragmentationBenchmark)
     ASSERT_TRUE(receiver._received_n == sample.size());
     ASSERT_TRUE(receiver._received_str == sample);
 }
+
+/// Transmitter keeping every fragment so that the test decides on the order of reception
+template <uint32_t fragmentation_boundary>
+class RecordingTransmitter : public fep::FragmentingWriter<protocol_version, fragmentation_boundary>
+{
+    uint8_t _buffer[sizeof(fep::Fragment) + fragmentation_boundary];
+public:
+    std::vector<std::vector<uint8_t>> _fragments;
+    RecordingTransmitter(uint64_t id) :
+        fep::FragmentingWriter<protocol_version, fragmentation_boundary>(id)
+    {
+        this->setBuffer(&_buffer[0]);
+    }
+
+    bool transmitFragment(void* fragment, uint32_t length) noexcept final override
+    {
+        const uint8_t* data = static_cast<const uint8_t*>(fragment);
+        _fragments.emplace_back(data, data + length);
+        return true;
+    }
+};
+
+/// Receiver collecting all samples
+class CollectingReceiver : public fep::DefragmentingReader<protocol_version, 10>
+{
+public:
+    std::vector<std::string> _samples;
+    using fep::DefragmentingReader<protocol_version, 10>::DefragmentingReader;
+
+    uint32_t receive(const std::vector<uint8_t>& fragment)
+    {
+        return receiveFragment(fragment.data(), static_cast<uint32_t>(fragment.size()));
+    }
+
+protected:
+    void receiveSample(const void* sample, uint32_t length) noexcept final override
+    {
+        _samples.emplace_back(static_cast<const char*>(sample), length);
+    }
+};
+
+/**
+ * @req_id "FEPSDK-1513"
+ */
+TEST(cTransmissionAdapterTester, TestFragmentationInterleavedSenders)
+{
+    RecordingTransmitter<10> transmitter1(1);
+    RecordingTransmitter<10> transmitter2(2);
+    CollectingReceiver receiver;
+
+    ASSERT_EQ(transmitter1.transmitSample("abcdefghijklmnopqrstuvwxyz", 26), 3);
+    ASSERT_EQ(transmitter2.transmitSample("ABCDEFGHIJKLMNOPQRSTUVWXYZ", 26), 3);
+
+    // fragments of both senders alternate
+    for (size_t i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(receiver.receive(transmitter1._fragments[i]), 0);
+        ASSERT_EQ(receiver.receive(transmitter2._fragments[i]), 0);
+    }
+    ASSERT_EQ(receiver._samples.size(), 2);
+    ASSERT_EQ(receiver._samples[0], "abcdefghijklmnopqrstuvwxyz");
+    ASSERT_EQ(receiver._samples[1], "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    ASSERT_EQ(receiver.getLostSampleCount(), 0);
+}
+
+/**
+ * @req_id "FEPSDK-1513"
+ */
+TEST(cTransmissionAdapterTester, TestFragmentationOutOfOrder)
+{
+    RecordingTransmitter<10> transmitter(1);
+    CollectingReceiver receiver;
+
+    ASSERT_EQ(transmitter.transmitSample("abcdefghijklmnopqrstuvwxyz", 26), 3);
+    ASSERT_EQ(receiver.receive(transmitter._fragments[2]), 0);
+    ASSERT_EQ(receiver.receive(transmitter._fragments[0]), 0);
+    // duplicates are ignored
+    ASSERT_EQ(receiver.receive(transmitter._fragments[0]), 0);
+    ASSERT_TRUE(receiver._samples.empty());
+    ASSERT_EQ(receiver.receive(transmitter._fragments[1]), 0);
+    ASSERT_EQ(receiver._samples.size(), 1);
+    ASSERT_EQ(receiver._samples[0], "abcdefghijklmnopqrstuvwxyz");
+
+    // a late duplicate of a completed sample is not received twice
+    ASSERT_EQ(receiver.receive(transmitter._fragments[1]), 0);
+    ASSERT_EQ(receiver._samples.size(), 1);
+
+    // a sample without a single received fragment is counted when the next one starts
+    transmitter._fragments.clear();
+    ASSERT_EQ(transmitter.transmitSample("abc", 3), 1);
+    ASSERT_EQ(transmitter.transmitSample("def", 3), 1);
+    ASSERT_EQ(receiver.receive(transmitter._fragments[1]), 1);
+    ASSERT_EQ(receiver._samples.back(), "def");
+    ASSERT_EQ(receiver.getLostSampleCount(), 1);
+    ASSERT_EQ(receiver.getPartialSampleCount(), 0);
+}
+
+/**
+ * @req_id "FEPSDK-1514"
+ */
+TEST(cTransmissionAdapterTester, TestFragmentationReassemblyLimits)
+{
+    RecordingTransmitter<10> transmitter1(1);
+    RecordingTransmitter<10> transmitter2(2);
+    RecordingTransmitter<10> transmitter3(3);
+    // only two samples can be reassembled at the same time
+    CollectingReceiver receiver(2);
+
+    ASSERT_EQ(transmitter1.transmitSample("abcdefghijklmnopqrstuvwxyz", 26), 3);
+    ASSERT_EQ(transmitter2.transmitSample("abcdefghijklmnopqrstuvwxyz", 26), 3);
+    ASSERT_EQ(transmitter3.transmitSample("abcdefghijklmnopqrstuvwxyz", 26), 3);
+    ASSERT_EQ(receiver.receive(transmitter1._fragments[0]), 0);
+    ASSERT_EQ(receiver.receive(transmitter2._fragments[0]), 0);
+    // the oldest sample in progress has to make room
+    ASSERT_EQ(receiver.receive(transmitter3._fragments[0]), 1);
+    ASSERT_EQ(receiver.receive(transmitter1._fragments[1]), 0);
+    ASSERT_EQ(receiver.receive(transmitter1._fragments[2]), 0);
+    ASSERT_TRUE(receiver._samples.empty());
+    ASSERT_EQ(receiver.getPartialSampleCount(), 1);
+
+    // incomplete samples are given up after the reassembly timeout
+    receiver.setReassemblyTimeout(std::chrono::milliseconds(10));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    transmitter1._fragments.clear();
+    ASSERT_EQ(transmitter1.transmitSample("abc", 3), 1);
+    ASSERT_EQ(receiver.receive(transmitter1._fragments[0]), 2);
+    ASSERT_EQ(receiver._samples.size(), 1);
+    ASSERT_EQ(receiver.getLostSampleCount(), 3);
+    ASSERT_EQ(receiver.getPartialSampleCount(), 3);
+}
+
+/**
+ * @req_id "FEPSDK-1513"
+ */
+TEST(cTransmissionAdapterTester, TestFragmentationBufferOwnership)
+{
+    class OwningReceiver : public fep::DefragmentingReader<protocol_version, 10>
+    {
+    public:
+        std::vector<std::vector<uint8_t>> _samples;
+        uint32_t receive(const std::vector<uint8_t>& fragment)
+        {
+            return receiveFragment(fragment.data(), static_cast<uint32_t>(fragment.size()));
+        }
+
+    protected:
+        void receiveSample(const void*, uint32_t) noexcept final override
+        {
+        }
+
+        void receiveSampleBuffer(std::vector<uint8_t>& sample) noexcept final override
+        {
+            _samples.emplace_back();
+            _samples.back().swap(sample);
+        }
+    };
+
+    RecordingTransmitter<10> transmitter(1);
+    OwningReceiver receiver;
+    ASSERT_EQ(transmitter.transmitSample("abcdefghijklmnopqrstuvwxyz", 26), 3);
+    ASSERT_EQ(transmitter.transmitSample("0123456789ABC", 13), 2);
+    for (const auto& fragment : transmitter._fragments)
+    {
+        ASSERT_EQ(receiver.receive(fragment), 0);
+    }
+    ASSERT_EQ(receiver._samples.size(), 2);
+    ASSERT_EQ(std::string(receiver._samples[0].begin(), receiver._samples[0].end()), "abcdefghijklmnopqrstuvwxyz");
+    ASSERT_EQ(std::string(receiver._samples[1].begin(), receiver._samples[1].end()), "0123456789ABC");
+}
+
+/**
+ * @req_id "FEPSDK-1513"
+ */
+TEST(cTransmissionAdapterTester, TestFragmentationGatherTransmission)
+{
+    /// Transmitter sending header and payload from separate memory
+    class GatheringTransmitter : public fep::FragmentingWriter<protocol_version, 10>
+    {
+        uint8_t _buffer[sizeof(fep::Fragment)];
+    public:
+        std::vector<const void*> _payloads;
+        std::vector<std::vector<uint8_t>> _fragments;
+        GatheringTransmitter() : fep::FragmentingWriter<protocol_version, 10>(1)
+        {
+            setBuffer(&_buffer[0]);
+        }
+
+    protected:
+        bool transmitFragment(void*, uint32_t) noexcept final override
+        {
+            return false;
+        }
+
+        bool transmitFragmentV(const fep::Fragment* header, const void* payload, uint32_t length) noexcept final override
+        {
+            const uint8_t* header_data = reinterpret_cast<const uint8_t*>(header);
+            const uint8_t* payload_data = static_cast<const uint8_t*>(payload);
+            _payloads.push_back(payload);
+            _fragments.emplace_back(header_data, header_data + sizeof(fep::Fragment));
+            _fragments.back().insert(_fragments.back().end(), payload_data, payload_data + length);
+            return true;
+        }
+    };
+
+    const char sample[] = "abcdefghijklmnopqrstuvwxyz";
+    GatheringTransmitter transmitter;
+    CollectingReceiver receiver;
+    ASSERT_EQ(transmitter.transmitSample(sample, 26), 3);
+    // the payload is passed straight from the sample memory
+    ASSERT_EQ(transmitter._payloads[0], &sample[0]);
+    ASSERT_EQ(transmitter._payloads[1], &sample[10]);
+    ASSERT_EQ(transmitter._payloads[2], &sample[20]);
+    for (const auto& fragment : transmitter._fragments)
+    {
+        ASSERT_EQ(receiver.receive(fragment), 0);
+    }
+    ASSERT_EQ(receiver._samples.size(), 1);
+    ASSERT_EQ(receiver._samples[0], "abcdefghijklmnopqrstuvwxyz");
+}
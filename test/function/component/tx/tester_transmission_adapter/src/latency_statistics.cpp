@@ -0,0 +1,269 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+/**
+* Test Case:   TestLatencyStatistics
+* Test Title:  Test the latency histograms and sequence gap counters of input signals
+* Description: This test checks the log-bucketed latency histogram and that a receiver
+*              collects the latency in simulation and wall clock time as well as the gaps
+*              in the sequence of the received samples.
+* Strategy:    Record values into a histogram and check its summary. Register a stamped
+*              output signal, transmit samples, feed some of them to the input signal and
+*              check the statistics of the input signal.
+*
+* Passed If:   End of test is reached
+*
+* Ticket:      -
+*/
+#include "test_helper_classes.h"
+#include "fep3/components/clock/clock_service_intf.h"
+#include "transmission_adapter/fep_latency_histogram.h"
+
+TEST(cTransmissionAdapterTester, TestLatencyHistogram)
+{
+    // small values have buckets of their own, larger ones share a bucket with their neighbours
+    for (uint64_t nValue = 0; nValue < 16; ++nValue)
+    {
+        ASSERT_EQ(cLatencyHistogram::GetBucketIndex(nValue), nValue);
+        ASSERT_EQ(cLatencyHistogram::GetBucketUpperBound(nValue), nValue);
+    }
+    ASSERT_EQ(cLatencyHistogram::GetBucketIndex(16), cLatencyHistogram::GetBucketIndex(17));
+    ASSERT_EQ(cLatencyHistogram::GetBucketUpperBound(cLatencyHistogram::GetBucketIndex(1000)), 1023);
+    ASSERT_EQ(cLatencyHistogram::GetBucketIndex(UINT64_MAX), cLatencyHistogram::s_szBuckets - 1);
+    ASSERT_EQ(cLatencyHistogram::GetBucketUpperBound(cLatencyHistogram::s_szBuckets - 1), UINT64_MAX);
+    for (uint64_t nValue = 1; nValue < UINT64_MAX / 3; nValue = nValue * 3 + 1)
+    {
+        const uint64_t nUpper = cLatencyHistogram::GetBucketUpperBound(
+            cLatencyHistogram::GetBucketIndex(nValue));
+        ASSERT_GE(nUpper, nValue);
+        ASSERT_LE(nUpper - nValue, nValue / 8);
+    }
+
+    cLatencyHistogram oHistogram;
+    tLatencySummary oSummary;
+    oHistogram.GetSummary(oSummary);
+    ASSERT_EQ(oSummary.nCount, 0);
+    ASSERT_EQ(oSummary.nMax, 0);
+
+    for (uint64_t nValue = 1; nValue <= 1000; ++nValue)
+    {
+        oHistogram.Record(nValue);
+    }
+    oHistogram.GetSummary(oSummary);
+    ASSERT_EQ(oSummary.nCount, 1000);
+    ASSERT_EQ(oSummary.nMin, 1);
+    ASSERT_EQ(oSummary.nMax, 1000);
+    ASSERT_EQ(oSummary.nMean, 500);
+    ASSERT_GE(oSummary.nP50, 500);
+    ASSERT_LE(oSummary.nP50, 500 + 500 / 8);
+    ASSERT_GE(oSummary.nP90, 900);
+    ASSERT_LE(oSummary.nP90, 900 + 900 / 8);
+    ASSERT_GE(oSummary.nP99, 990);
+    ASSERT_LE(oSummary.nP99, 1000);
+    ASSERT_EQ(oSummary.nP999, 1000);
+
+    oHistogram.Reset();
+    oHistogram.GetSummary(oSummary);
+    ASSERT_EQ(oSummary.nCount, 0);
+    oHistogram.Record(42);
+    oHistogram.GetSummary(oSummary);
+    ASSERT_EQ(oSummary.nCount, 1);
+    ASSERT_EQ(oSummary.nMin, 42);
+    ASSERT_EQ(oSummary.nP50, 42);
+    ASSERT_EQ(oSummary.nP999, 42);
+}
+
+/// Clock service returning a fixed time
+class cFixedClockService : public IClockService
+{
+public:
+    cFixedClockService() : m_nTime(0)
+    {
+    }
+    timestamp_t getTime() const
+    {
+        return m_nTime;
+    }
+    timestamp_t getTime(const char*) const
+    {
+        return m_nTime;
+    }
+    IClock::ClockType getType() const
+    {
+        return IClock::ClockType::continuous;
+    }
+    IClock::ClockType getType(const char*) const
+    {
+        return IClock::ClockType::continuous;
+    }
+    fep::Result registerClock(IClock&)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+    fep::Result unregisterClock(const char*)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+    std::list<std::string> getClockList() const
+    {
+        return std::list<std::string>();
+    }
+    fep::Result setMainClock(const char*)
+    {
+        return ERR_NOT_SUPPORTED;
+    }
+    std::string getCurrentMainClock() const
+    {
+        return std::string();
+    }
+    void registerEventSink(IClock::IEventSink&)
+    {
+    }
+    void unregisterEventSink(IClock::IEventSink&)
+    {
+    }
+
+    timestamp_t m_nTime;
+};
+
+class cLatencySampleListener : public IPreparationDataListener
+{
+public:
+    fep::Result Update(const IPreparationDataSample *poPreparationSample)
+    {
+        m_vecSizes.push_back(poPreparationSample->GetSize());
+        return ERR_NOERROR;
+    }
+
+    std::vector<size_t> m_vecSizes;
+};
+
+TEST(cTransmissionAdapterTester, TestSignalLatencyStatistics)
+{
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    cMockTxDriver oDriver;
+    cModuleOptions oOptions;
+    cFixedClockService oClock;
+    oPropertyTree.m_nWorkerThreads = 4;
+    oPropertyTree.m_strModuleName = "TestInitializationModule";
+    oOptions.SetParticipantName("TestInitializationModule");
+    oOptions.SetDomainId(16);
+
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+
+    const size_t szSignal = 64;
+    handle_t hRecvHandle, hSendHandle;
+    cLatencySampleListener oListener;
+    tSignal oSignalIn = { "Position","","",SD_Input,szSignal,false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string(""), 0, false };
+    tSignal oSignalOut = { "Position","","",SD_Output,szSignal,false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string(""), 0, false, true };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalIn, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalOut, hSendHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterDataListener(&oListener, hRecvHandle));
+    oAdapter.SetClockService(&oClock);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+
+    // message channel + signal
+    cMockTransmitter* pTransmitter = oDriver.m_vecTransmitters.at(1);
+    cMockReceiver* pReceiver = oDriver.m_vecReceivers.at(1);
+
+    IPreparationDataSample* pSample;
+    ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pSample));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSize(szSignal));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSignalHandle(hSendHandle));
+
+    // transmits a sample sent at the given simulation time and keeps the transmitted bytes
+    std::vector<std::vector<uint8_t> > vecTransmitted;
+    auto fnTransmit = [&](timestamp_t nTime)
+    {
+        pSample->SetTime(nTime);
+        EXPECT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample));
+        const uint8_t* pData = static_cast<const uint8_t*>(pTransmitter->m_pData);
+        vecTransmitted.push_back(std::vector<uint8_t>(pData, pData + pTransmitter->m_szSize));
+    };
+    auto fnReceive = [&](size_t nIdx)
+    {
+        cDataReceiver::EnqueueReceivedData(pReceiver->m_pCallee,
+            &vecTransmitted[nIdx][0], vecTransmitted[nIdx].size());
+        a_util::system::sleepMilliseconds(100);
+    };
+    auto fnGetStatistics = [&]() -> tTransportStatistics
+    {
+        std::vector<tTransportStatistics> vecInputs;
+        std::vector<tTransportStatistics> vecOutputs;
+        EXPECT_EQ(a_util::result::SUCCESS, oAdapter.GetTransportStatistics(vecInputs, vecOutputs));
+        EXPECT_EQ(vecInputs.size(), 1);
+        return vecInputs.at(0);
+    };
+
+    // the samples are numbered and stamped with the wall clock
+    oClock.m_nTime = 1000000;
+    fnTransmit(990000);
+    fnTransmit(995000);
+    fnTransmit(999000);
+    for (size_t nIdx = 0; nIdx < vecTransmitted.size(); ++nIdx)
+    {
+        const cFepDataHeader* pHeader = reinterpret_cast<const cFepDataHeader*>(&vecTransmitted[nIdx][0]);
+        ASSERT_EQ(pHeader->m_nSequence, nIdx + 1);
+        ASSERT_NE(pHeader->m_nSerAndByteOrderFlags & header::LATENCY_STAMP, 0);
+        ASSERT_EQ(pHeader->m_nMajorVersion,
+            FEP_SDK_PARTICIPANT_VERSION_MAJOR | header::s_nExtendedFormatVersionFlag);
+        ASSERT_EQ(vecTransmitted[nIdx].size(),
+            sizeof(cFepDataHeader) + szSignal + header::s_szLatencyStampSize);
+    }
+
+    // the second sample is lost
+    fnReceive(0);
+    fnReceive(2);
+    ASSERT_EQ(oListener.m_vecSizes.size(), 2);
+    // the stamp is no part of the sample handed to the listeners
+    ASSERT_EQ(oListener.m_vecSizes[1], szSignal);
+
+    tTransportStatistics oStatistics = fnGetStatistics();
+    ASSERT_EQ(oStatistics.nSequenceGaps, 1);
+    ASSERT_EQ(oStatistics.oLatency_us.nCount, 2);
+    ASSERT_EQ(oStatistics.oLatency_us.nMin, 1000);
+    ASSERT_EQ(oStatistics.oLatency_us.nMax, 10000);
+    ASSERT_EQ(oStatistics.oWallClockLatency_ns.nCount, 2);
+    ASSERT_GT(oStatistics.oWallClockLatency_ns.nMax, 0);
+
+    // a duplicate is no gap, a sample stamped ahead of the clock is not recorded
+    fnReceive(2);
+    fnTransmit(2000000);
+    fnReceive(3);
+    oStatistics = fnGetStatistics();
+    ASSERT_EQ(oStatistics.nSequenceGaps, 1);
+    ASSERT_EQ(oStatistics.oLatency_us.nCount, 3);
+
+    // restarting discards the collected values
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Disable());
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+    oStatistics = fnGetStatistics();
+    ASSERT_EQ(oStatistics.nSequenceGaps, 0);
+    ASSERT_EQ(oStatistics.oLatency_us.nCount, 0);
+    ASSERT_EQ(oStatistics.oWallClockLatency_ns.nCount, 0);
+
+    //Clean up
+    delete pSample;
+    oAdapter.SetClockService(NULL);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterDataListener(&oListener, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hSendHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hRecvHandle));
+    oAdapter.Disable();
+    oAdapter.Destroy();
+}
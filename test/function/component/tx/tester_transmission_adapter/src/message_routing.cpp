@@ -0,0 +1,142 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+/**
+* Test Case:   TestMessageRouting
+* Test Title:  Test the routing of addressed messages to the inbox of the receiver
+* Description: This test checks that the adapter listens on an inbox of its own and sends
+*              messages addressed to a single participant to the inbox of the participant
+*              once it announced the inbox.
+* Strategy:    Transmit messages to a participant before and after it announced its inbox
+*              and check the channel they are transmitted on. Rename the participant and
+*              check that its inbox follows and is only announced if it could be created.
+*              Let the receiver shut down and check that the transmitter to its inbox is gone.
+*
+* Passed If:   End of test is reached
+*
+* Ticket:      -
+*/
+#include "test_helper_classes.h"
+#include "messages/fep_message_routing.h"
+
+static const char* s_strModuleName = "TestInitializationModule";
+
+/// Returns the name of the channel of a mock receiver or transmitter
+template <typename T>
+static std::string GetChannel(const T* pMock)
+{
+    std::string strSignalName;
+    pMock->m_oOptions.GetOption("SignalName", strSignalName);
+    return strSignalName;
+}
+
+TEST(cTransmissionAdapterTester, TestMessageRouting)
+{
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    cMockTxDriver oDriver;
+    cModuleOptions oOptions;
+    oPropertyTree.m_nWorkerThreads = 4;
+    oPropertyTree.m_strModuleName = s_strModuleName;
+    oOptions.SetParticipantName(s_strModuleName);
+    oOptions.SetDomainId(16);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+
+    // the participant listens on its inbox next to the broadcast channel
+    ASSERT_EQ(oDriver.m_vecReceivers.size(), 1);
+    ASSERT_EQ(oDriver.m_vecInboxReceivers.size(), 1);
+    EXPECT_EQ(GetChannel(oDriver.m_vecReceivers.at(0)), cMessageRouting::s_strBroadcastChannel);
+    EXPECT_EQ(GetChannel(oDriver.m_vecInboxReceivers.at(0)), cMessageRouting::GetInboxChannel(s_strModuleName));
+    EXPECT_TRUE(oDriver.m_vecInboxReceivers.at(0)->m_bEnabled);
+
+    // the broadcast channel is used until the receiver announced its inbox
+    cMockTransmitter* pBroadcast = oDriver.m_vecTransmitters.at(0);
+    cGetPropertyCommand oToPeer("Path.Node", s_strModuleName, "Peer", 1, 2);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToPeer));
+    EXPECT_FALSE(pBroadcast->m_vecData.empty());
+    EXPECT_TRUE(oDriver.m_vecInboxTransmitters.empty());
+
+    cStateNotification oAnnouncement(FS_IDLE, "Peer", "*", 3, 4);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Update(oAnnouncement.ToString()));
+    ASSERT_EQ(oDriver.m_vecInboxTransmitters.size(), 1);
+    cMockTransmitter* pInbox = oDriver.m_vecInboxTransmitters.at(0);
+    EXPECT_EQ(GetChannel(pInbox), cMessageRouting::GetInboxChannel("Peer"));
+    EXPECT_TRUE(pInbox->m_bEnabled);
+
+    // the driver gets some time to connect the inbox
+    pBroadcast->m_vecData.clear();
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToPeer));
+    EXPECT_FALSE(pBroadcast->m_vecData.empty());
+    EXPECT_TRUE(pInbox->m_vecData.empty());
+
+    a_util::system::sleepMilliseconds(600);
+    pBroadcast->m_vecData.clear();
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToPeer));
+    EXPECT_TRUE(pBroadcast->m_vecData.empty());
+    EXPECT_FALSE(pInbox->m_vecData.empty());
+
+    // messages to several participants stay on the broadcast channel
+    pInbox->m_vecData.clear();
+    cGetPropertyCommand oToAll("Path.Node", s_strModuleName, "*", 5, 6);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToAll));
+    cGetPropertyCommand oToSome("Path.Node", s_strModuleName, "Pe?r", 7, 8);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToSome));
+    EXPECT_FALSE(pBroadcast->m_vecData.empty());
+    EXPECT_TRUE(pInbox->m_vecData.empty());
+    EXPECT_EQ(oDriver.m_vecInboxTransmitters.size(), 1);
+
+    // the inbox follows the name of the participant
+    oPropertyTree.m_strModuleName = "Renamed";
+    cNameChangedNotification oRenamed(s_strModuleName, "Renamed", "*", 9, 10);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitNotification(&oRenamed));
+    ASSERT_EQ(oDriver.m_vecInboxReceivers.size(), 1);
+    EXPECT_EQ(GetChannel(oDriver.m_vecInboxReceivers.at(0)), cMessageRouting::GetInboxChannel("Renamed"));
+    std::string strSent(pBroadcast->m_vecData.begin(), pBroadcast->m_vecData.end());
+    EXPECT_NE(strSent.find(cMessageRouting::s_strRoutingField), std::string::npos);
+
+    // an inbox that could not be created is not announced
+    oDriver.m_bFailInboxReceivers = true;
+    oPropertyTree.m_strModuleName = "Unreachable";
+    cNameChangedNotification oUnreachable("Renamed", "Unreachable", "*", 11, 12);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitNotification(&oUnreachable));
+    EXPECT_TRUE(oDriver.m_vecInboxReceivers.empty());
+    strSent.assign(pBroadcast->m_vecData.begin(), pBroadcast->m_vecData.end());
+    EXPECT_NE(strSent.find("Unreachable"), std::string::npos);
+    EXPECT_EQ(strSent.find(cMessageRouting::s_strRoutingField), std::string::npos);
+    oDriver.m_bFailInboxReceivers = false;
+
+    // switched off, addressed messages use the broadcast channel
+    oPropertyTree.m_bMessageInbox = false;
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Disable());
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+    pBroadcast->m_vecData.clear();
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitCommand(&oToPeer));
+    EXPECT_FALSE(pBroadcast->m_vecData.empty());
+    EXPECT_TRUE(pInbox->m_vecData.empty());
+
+    // the transmitter to the inbox is destroyed when the receiver shuts down
+    cStateNotification oShutdown(FS_SHUTDOWN, "Peer", "*", 13, 14);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Update(oShutdown.ToString()));
+    EXPECT_TRUE(oDriver.m_vecInboxTransmitters.empty());
+
+    oAdapter.Disable();
+    oAdapter.Destroy();
+    EXPECT_TRUE(oDriver.m_vecInboxReceivers.empty());
+    EXPECT_TRUE(oDriver.m_vecInboxTransmitters.empty());
+}
@@ -0,0 +1,171 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+/**
+* Test Case:   TestSignalBundling
+* Test Title:  Test transmission of several signals in one bundle
+* Description: This test checks that output signals with the same bundle id are
+*              transmitted as one driver sample and that the receiving side hands
+*              every contained sample to the right listener.
+* Strategy:    Register two bundled input and output signals, transmit samples and
+*              check when the bundle is transmitted and what the listeners receive.
+*
+* Passed If:   End of test is reached
+*
+* Ticket:      -
+*/
+#include "test_helper_classes.h"
+#include "transmission_adapter/fep_signal_bundle.h"
+
+class cBundleValueListener : public IPreparationDataListener
+{
+public:
+    fep::Result Update(const IPreparationDataSample *poPreparationSample)
+    {
+        m_vecValues.push_back(*static_cast<const uint32_t*>(poPreparationSample->GetPtr()));
+        m_vecTimes.push_back(poPreparationSample->GetTime());
+        return ERR_NOERROR;
+    }
+
+    std::vector<uint32_t> m_vecValues;
+    std::vector<timestamp_t> m_vecTimes;
+};
+
+TEST(cTransmissionAdapterTester, TestSignalBundling)
+{
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    cMockTxDriver oDriver;
+    cModuleOptions oOptions;
+    oPropertyTree.m_nWorkerThreads = 4;
+    oPropertyTree.m_strModuleName = "TestInitializationModule";
+    oOptions.SetParticipantName("TestInitializationModule");
+    oOptions.SetDomainId(16);
+
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+
+    handle_t hRecvHandle1, hRecvHandle2;
+    handle_t hSendHandle1, hSendHandle2;
+    cBundleValueListener oListener1, oListener2;
+
+    tSignal oSignalIn1 = { "Bundled1","","",SD_Input,sizeof(uint32_t),false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string("Bundle") };
+    tSignal oSignalIn2 = { "Bundled2","","",SD_Input,sizeof(uint32_t),false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string("Bundle") };
+    tSignal oSignalOut1 = { "Bundled1","","",SD_Output,sizeof(uint32_t),false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string("Bundle") };
+    tSignal oSignalOut2 = { "Bundled2","","",SD_Output,sizeof(uint32_t),false,false,1,SER_Raw,false, true, false, std::string(""), false, std::string("Bundle") };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalIn1, hRecvHandle1));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalIn2, hRecvHandle2));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalOut1, hSendHandle1));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalOut2, hSendHandle2));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterDataListener(&oListener1, hRecvHandle1));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterDataListener(&oListener2, hRecvHandle2));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+
+    // message channel + one driver transmitter shared by both output signals
+    ASSERT_EQ(oDriver.m_vecTransmitters.size(), 2);
+    cMockTransmitter* pBundleTransmitter = oDriver.m_vecTransmitters.at(1);
+    // message channel + one receiver per input signal + one receiver for the bundle
+    ASSERT_EQ(oDriver.m_vecReceivers.size(), 4);
+    cMockReceiver* pBundleReceiver = oDriver.m_vecReceivers.at(2);
+
+    IPreparationDataSample* pSample1;
+    IPreparationDataSample* pSample2;
+    ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pSample1));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample1->SetSize(sizeof(uint32_t)));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample1->SetSignalHandle(hSendHandle1));
+    ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pSample2));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample2->SetSize(sizeof(uint32_t)));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample2->SetSignalHandle(hSendHandle2));
+
+    const size_t szEntry = sizeof(cFepBundleEntryHeader) + sizeof(uint32_t);
+
+    // the bundle is transmitted as soon as every member was written
+    *static_cast<uint32_t*>(pSample1->GetPtr()) = 1;
+    pSample1->SetTime(1000);
+    *static_cast<uint32_t*>(pSample2->GetPtr()) = 2;
+    pSample2->SetTime(1500);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample1));
+    ASSERT_TRUE(NULL == pBundleTransmitter->m_pData);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample2));
+    ASSERT_EQ(pBundleTransmitter->m_szSize, sizeof(cFepBundleHeader) + 2 * szEntry);
+
+    cBundleReceiver::ReceiveBundle(pBundleReceiver->m_pCallee,
+        pBundleTransmitter->m_pData, pBundleTransmitter->m_szSize);
+    a_util::system::sleepMilliseconds(100);
+    ASSERT_EQ(oListener1.m_vecValues.size(), 1);
+    ASSERT_EQ(oListener2.m_vecValues.size(), 1);
+    EXPECT_EQ(oListener1.m_vecValues[0], 1);
+    EXPECT_EQ(oListener1.m_vecTimes[0], 1000);
+    EXPECT_EQ(oListener2.m_vecValues[0], 2);
+    EXPECT_EQ(oListener2.m_vecTimes[0], 1500);
+
+    // writing a member twice transmits the pending bundle first
+    // (the mock driver keeps the pointer only, so the content is already overwritten)
+    pBundleTransmitter->m_pData = NULL;
+    *static_cast<uint32_t*>(pSample1->GetPtr()) = 3;
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample1));
+    ASSERT_TRUE(NULL == pBundleTransmitter->m_pData);
+    *static_cast<uint32_t*>(pSample1->GetPtr()) = 4;
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample1));
+    ASSERT_TRUE(NULL != pBundleTransmitter->m_pData);
+    ASSERT_EQ(pBundleTransmitter->m_szSize, sizeof(cFepBundleHeader) + szEntry);
+
+    // an explicit flush transmits the incomplete bundle
+    pBundleTransmitter->m_pData = NULL;
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.FlushSignalBundles());
+    ASSERT_TRUE(NULL != pBundleTransmitter->m_pData);
+    ASSERT_EQ(pBundleTransmitter->m_szSize, sizeof(cFepBundleHeader) + szEntry);
+    cBundleReceiver::ReceiveBundle(pBundleReceiver->m_pCallee,
+        pBundleTransmitter->m_pData, pBundleTransmitter->m_szSize);
+
+    // nothing is pending anymore
+    pBundleTransmitter->m_pData = NULL;
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.FlushSignalBundles());
+    ASSERT_TRUE(NULL == pBundleTransmitter->m_pData);
+
+    a_util::system::sleepMilliseconds(100);
+    ASSERT_EQ(oListener1.m_vecValues.size(), 2);
+    EXPECT_EQ(oListener1.m_vecValues[1], 4);
+    ASSERT_EQ(oListener2.m_vecValues.size(), 1);
+
+    // a muted input signal does not receive bundled samples
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.MuteSignal(hRecvHandle2));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample1));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample2));
+    cBundleReceiver::ReceiveBundle(pBundleReceiver->m_pCallee,
+        pBundleTransmitter->m_pData, pBundleTransmitter->m_szSize);
+    a_util::system::sleepMilliseconds(100);
+    ASSERT_EQ(oListener1.m_vecValues.size(), 3);
+    ASSERT_EQ(oListener2.m_vecValues.size(), 1);
+
+    // the bundles are destroyed along with their last member
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hSendHandle1));
+    ASSERT_EQ(oDriver.m_vecTransmitters.size(), 2);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hSendHandle2));
+    ASSERT_EQ(oDriver.m_vecTransmitters.size(), 1);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterDataListener(&oListener1, hRecvHandle1));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterDataListener(&oListener2, hRecvHandle2));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hRecvHandle1));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.UnregisterSignal(hRecvHandle2));
+    ASSERT_EQ(oDriver.m_vecReceivers.size(), 1);
+
+    //Clean up
+    delete pSample1;
+    delete pSample2;
+    oAdapter.Disable();
+    oAdapter.Destroy();
+}
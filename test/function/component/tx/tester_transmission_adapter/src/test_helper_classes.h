@@ -414,6 +414,31 @@ public:
 class cMockPropertyTreePrivate : public cMockPropertyTree
 {
 public:
+    cMockPropertyTreePrivate() :
+        m_nWorkerThreads(0),
+        m_bWorkerBusyPolling(false),
+        m_bMessageInbox(true)
+    {
+    }
+
+    fep::Result GetPropertyValue(const char * strPropPath, bool & bValue) const
+    {
+        if (0 == a_util::strings::compare(strPropPath, fep::component_config::g_strTxAdapterPath_bWorkerBusyPolling))
+        {
+            bValue = m_bWorkerBusyPolling;
+            return fep::ERR_NOERROR;
+        }
+        else if (0 == a_util::strings::compare(strPropPath, fep::component_config::g_strTxAdapterPath_bMessageInbox))
+        {
+            bValue = m_bMessageInbox;
+            return fep::ERR_NOERROR;
+        }
+        else
+        {
+            return ERR_NOT_FOUND;
+        }
+    }
+
     fep::Result GetPropertyValue(const char * strPropPath, int32_t & nValue) const
     {
         if (0 == a_util::strings::compare(strPropPath, fep::component_config::g_strTxAdapterPath_nNumberOfWorkerThreads))
@@ -435,6 +460,17 @@ public:
             strValue = m_strModuleName.c_str();
             return fep::ERR_NOERROR;
         }
+        else if (0 == a_util::strings::compare(strPropPath, fep::component_config::g_strTxAdapterPath_strWorkerCpuAffinity))
+        {
+            strValue = m_strWorkerCpuAffinity.c_str();
+            return fep::ERR_NOERROR;
+        }
+        else if (!m_strMessageEncoding.empty() && 0 == a_util::strings::compare(strPropPath,
+            fep::component_config::g_strTxAdapterPath_strMessageEncoding))
+        {
+            strValue = m_strMessageEncoding.c_str();
+            return fep::ERR_NOERROR;
+        }
         else
         {
             return ERR_NOT_FOUND;
@@ -443,6 +479,10 @@ public:
 public:
     int32_t m_nWorkerThreads;
     std::string m_strModuleName;
+    std::string m_strWorkerCpuAffinity;
+    std::string m_strMessageEncoding;
+    bool m_bWorkerBusyPolling;
+    bool m_bMessageInbox;
 };
 
 class cSampleCounter : public IPreparationDataListener
@@ -273,3 +273,81 @@ TEST(cTransmissionAdapterTester, TestWorkerThreads_RTI_DDS)
     //Cleanup Test
     oAdapter.Destroy();
 }
+
+/**
+ * @req_id "FEPSDK-1529"
+ */
+TEST(cTransmissionAdapterTester, TestWorkerThreadsBusyPollingAndAffinity)
+{
+    //Setup Test
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    cMockTxDriver oDriver;
+    cModuleOptions oOptions;
+    // two busy polling workers, both pinned to the first CPU
+    oPropertyTree.m_nWorkerThreads = 2;
+    oPropertyTree.m_strWorkerCpuAffinity = "0, 0";
+    oPropertyTree.m_bWorkerBusyPolling = true;
+    oPropertyTree.m_strModuleName = "test_module";
+    oOptions.SetParticipantName("test_module");
+    oOptions.SetDomainId(16);
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+
+    const uint32_t nSignals = 8;
+    const uint32_t nSamples = 50;
+    std::string strDDLDesc = a_util::strings::format(s_strDescriptionTemplate.c_str(), s_strSignalDescription.c_str());
+    size_t szSample = 0;
+    ASSERT_EQ(a_util::result::SUCCESS, fep::helpers::CalculateSignalSizeFromDescription("tTestSignal", strDDLDesc.c_str(), szSample));
+
+    std::vector<cSampleCounter> vecCounters(nSignals);
+    std::vector<IPreparationDataSample*> vecSamples;
+    for (uint32_t i = 0; i < nSignals; i++)
+    {
+        std::string strName = a_util::strings::format("TestSignal%d", i);
+        handle_t hSendHandle;
+        handle_t hRecvHandle;
+        tSignal oSignalOut = { strName,"tTestSignal",strDDLDesc.c_str(),SD_Output,szSample,false,false,1,SER_Ddl,false, true, false, std::string("") };
+        ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalOut, hSendHandle));
+        tSignal oSignalIn = { strName,"tTestSignal",strDDLDesc.c_str(),SD_Input,szSample,false,false,1,SER_Ddl,false, true, false, std::string("") };
+        ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oSignalIn, hRecvHandle));
+        ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterDataListener(&vecCounters[i], hRecvHandle));
+
+        IPreparationDataSample* pSample;
+        ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pSample));
+        ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSize(sizeof(tData)));
+        ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSignalHandle(hSendHandle));
+        ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSyncFlag(true));
+        vecSamples.push_back(pSample);
+    }
+
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+
+    for (uint32_t nSample = 0; nSample < nSamples; nSample++)
+    {
+        for (uint32_t i = 0; i < nSignals; i++)
+        {
+            //transmitter/receiver at index 0 is the message channel
+            ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(vecSamples[i]));
+            cDataReceiver* pReceiver = reinterpret_cast<fep::cDataReceiver*>(oDriver.m_vecReceivers.at(i + 1)->m_pCallee);
+            pReceiver->EnqueueReceivedData(pReceiver, oDriver.m_vecTransmitters.at(i + 1)->m_pData,
+                oDriver.m_vecTransmitters.at(i + 1)->m_szSize);
+        }
+        a_util::system::sleepMicroseconds(250);
+    }
+
+    //wait so that everything can be received
+    a_util::system::sleepMilliseconds(100);
+
+    for (uint32_t i = 0; i < nSignals; i++)
+    {
+        EXPECT_EQ(vecCounters[i].RcvdSamplesCnt, nSamples);
+    }
+
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Disable());
+    for (uint32_t i = 0; i < nSignals; i++)
+    {
+        delete vecSamples[i];
+    }
+    oAdapter.Destroy();
+}
@@ -0,0 +1,130 @@
+/**
+
+   @copyright
+   @verbatim
+   Copyright @ 2019 Audi AG. All rights reserved.
+   
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+   
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+   
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+/**
+* Test Case:   TestZeroCopyReception
+* Test Title:  Test zero copy reception of raw signals
+* Description: This test checks that buffers lent by the driver are handed to the listeners
+*              without copy and are handed back to the driver as soon as they are not needed anymore.
+* Strategy:    Register a raw input signal with zero copy reception at a driver supporting it,
+*              lend some buffers to the receiver and check the pointers seen by the listener,
+*              the current sample and the number of released buffers.
+*              
+* Passed If:   End of test is reached
+*              
+* Ticket:      -
+*/
+#include "test_helper_classes.h"
+#include <atomic>
+#include <cstring>
+
+static std::atomic<int> s_nReleasedBuffers(0);
+
+static void ReleaseLentBuffer(void* pBuffer)
+{
+    ::free(pBuffer);
+    s_nReleasedBuffers++;
+}
+
+class cPointerListener : public IPreparationDataListener
+{
+public:
+    fep::Result Update(const IPreparationDataSample *poPreparationSample)
+    {
+        m_vecPointers.push_back(poPreparationSample->GetPtr());
+        m_vecSizes.push_back(poPreparationSample->GetSize());
+        return ERR_NOERROR;
+    }
+
+    std::vector<const void*> m_vecPointers;
+    std::vector<size_t> m_vecSizes;
+};
+
+TEST(cTransmissionAdapterTester, TestZeroCopyReception)
+{
+    cTransmissionAdapter oAdapter;
+    cMockIncidentInvocationHandler oIncidentHandler;
+    cMockPropertyTreePrivate oPropertyTree;
+    cMockTxDriver oDriver;
+    cModuleOptions oOptions;
+    oPropertyTree.m_nWorkerThreads = 4;
+    oPropertyTree.m_strModuleName = "TestInitializationModule";
+    oOptions.SetParticipantName("TestInitializationModule");
+    oOptions.SetDomainId(16);
+
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Setup(&oPropertyTree, &oIncidentHandler, oOptions, &oDriver));
+
+    handle_t hRecvHandle;
+    handle_t hSendHandle;
+    cPointerListener oListener;
+
+    tSignal oTestSignalIn = { "TestSignal1","","",SD_Input,0,false,true,1,SER_Raw,false, true, false, std::string(""), true };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oTestSignalIn, hRecvHandle));
+    tSignal oTestSignalOut = { "TestSignal1","","",SD_Output,0,false,true,1,SER_Raw,false, true, false, std::string("") };
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterSignal(oTestSignalOut, hSendHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.RegisterDataListener(&oListener, hRecvHandle));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.Enable());
+
+    cMockReceiver* pMockReceiver = oDriver.m_vecReceivers.at(1);
+    ASSERT_TRUE(NULL != pMockReceiver->m_pZeroCopyCallback);
+
+    IPreparationDataSample* pSample;
+    ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pSample));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSize(sizeof(uint32_t)));
+    ASSERT_EQ(a_util::result::SUCCESS, pSample->SetSignalHandle(hSendHandle));
+
+    // lend three buffers to the receiver
+    std::vector<char*> vecBuffers;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        *static_cast<uint32_t*>(pSample->GetPtr()) = i;
+        ASSERT_EQ(a_util::result::SUCCESS, oAdapter.TransmitData(pSample));
+        size_t szSize = oDriver.m_vecTransmitters.at(1)->m_szSize;
+        char* pBuffer = static_cast<char*>(::malloc(szSize));
+        ::memcpy(pBuffer, oDriver.m_vecTransmitters.at(1)->m_pData, szSize);
+        vecBuffers.push_back(pBuffer);
+        pMockReceiver->m_pZeroCopyCallback(pMockReceiver->m_pCallee, pBuffer, szSize,
+            &ReleaseLentBuffer, pBuffer);
+        a_util::system::sleepMilliseconds(50);
+    }
+
+    // the listener saw the driver buffers themselves
+    ASSERT_EQ(oListener.m_vecPointers.size(), 3);
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(oListener.m_vecPointers[i], vecBuffers[i] + sizeof(cFepDataHeader));
+        EXPECT_EQ(oListener.m_vecSizes[i], sizeof(uint32_t));
+    }
+    // only the most recent sample is still held
+    EXPECT_EQ(s_nReleasedBuffers, 2);
+
+    // the current sample is a copy of the held buffer
+    IPreparationDataSample* pCurrent;
+    ASSERT_EQ(a_util::result::SUCCESS, cDataSampleFactory::CreateSample(&pCurrent));
+    ASSERT_EQ(a_util::result::SUCCESS, oAdapter.GetRecentSample(hRecvHandle, pCurrent));
+    ASSERT_EQ(pCurrent->GetSize(), sizeof(uint32_t));
+    EXPECT_NE(pCurrent->GetPtr(), vecBuffers[2] + sizeof(cFepDataHeader));
+    EXPECT_EQ(*static_cast<uint32_t*>(pCurrent->GetPtr()), 2);
+
+    //Clean up
+    delete pCurrent;
+    delete pSample;
+    oAdapter.Disable();
+    oAdapter.Destroy();
+
+    EXPECT_EQ(s_nReleasedBuffers, 3);
+}
@@ -55,6 +55,14 @@ TEST(cTesterTransmissionSelection, TestEnumToStringAndStringToEnum)
     strEnumString = "ZMQ";
     ASSERT_TRUE(strEnumString == fep::cFEPTransmissionType::ToString(TT_ZMQ));
 #endif
+#ifdef __linux__
+    strEnumString = "SHM";
+    ASSERT_TRUE(strEnumString == fep::cFEPTransmissionType::ToString(TT_SHM));
+    strEnumString = "UDP";
+    ASSERT_TRUE(strEnumString == fep::cFEPTransmissionType::ToString(TT_UDP));
+#endif
+    strEnumString = "INPROC";
+    ASSERT_TRUE(strEnumString == fep::cFEPTransmissionType::ToString(TT_INPROC));
 
     // String to enum. Part 1: Test correct strings
     strEnumString = "RTI_DDS";
@@ -67,6 +75,20 @@ TEST(cTesterTransmissionSelection, TestEnumToStringAndStringToEnum)
     ASSERT_TRUE(eFEPTransmissionType == TT_ZMQ);
 #endif
 
+#ifdef __linux__
+    strEnumString = "SHM";
+    ASSERT_EQ(a_util::result::SUCCESS, fep::cFEPTransmissionType::FromString(strEnumString.c_str(), eFEPTransmissionType));
+    ASSERT_TRUE(eFEPTransmissionType == TT_SHM);
+
+    strEnumString = "UDP";
+    ASSERT_EQ(a_util::result::SUCCESS, fep::cFEPTransmissionType::FromString(strEnumString.c_str(), eFEPTransmissionType));
+    ASSERT_TRUE(eFEPTransmissionType == TT_UDP);
+#endif
+
+    strEnumString = "INPROC";
+    ASSERT_EQ(a_util::result::SUCCESS, fep::cFEPTransmissionType::FromString(strEnumString.c_str(), eFEPTransmissionType));
+    ASSERT_TRUE(eFEPTransmissionType == TT_INPROC);
+
     // String to enum. Part 2: Test DEFAULT parameter
     strEnumString = "DEFAULT";
     ASSERT_EQ(a_util::result::SUCCESS, fep::cFEPTransmissionType::FromString(strEnumString.c_str(), eFEPTransmissionType));
@@ -21,7 +21,7 @@
  */
 
 #include "stdafx.h"
-#include "perfmeasure/perfmeasure.h"
+#include "perfmeasure/fep_trace.h"
 #include <algorithm>
 
 FepCyclicSender::FepCyclicSender(fep::IModule* pModule, uint32_t nClientId, uint32_t nServerId, FepElementMode eMode, timestamp_t nPeriod, size_t szNumberOfPacketsPerCycle, uint32_t nExpectedPackets, handle_t hRecvHandle, handle_t hSendHandle)
@@ -111,8 +111,7 @@ void FepCyclicSender::RunCyclic()
                     pPing->nServerId = static_cast<uint32_t>(-1); // Initialize with invalid value
                     pPing->tm01ClientSend= GetHighResTime();
 
-                    MEASURE_POINT_SET(IndexOfSendPacket, nSeqNr);
-                    MEASURE_POINT(ElementTransmitCalled);
+                    FEP_TRACE_INSTANT_VALUE("ElementTransmitCalled", "perf_measure", nSeqNr);
 
                     nResult = m_pModule->GetUserDataAccess()->TransmitData(m_pSendSample, true);
                     pPing->tm01ClientSendFinish = GetHighResTime();
@@ -185,11 +184,10 @@ fep::Result FepCyclicSender::Update(const fep::IUserDataSample* poSample)
             break;
         case ClientMode:
             {
-                MEASURE_POINT(ElementReceivedCalled);
                 const t_Ping* pPingSource= reinterpret_cast<const t_Ping*>(poSample->GetPtr());
 
                 size_t nSeqNr= pPingSource->nSeqNr;
-                MEASURE_POINT_SET(IndexOfReceivedPacket, nSeqNr);
+                FEP_TRACE_INSTANT_VALUE("ElementReceivedCalled", "perf_measure", nSeqNr);
 
                 assert(pPingSource->nServerId < m_tStatistic.m_poPerServerStats.size());
                 impl::FepPerServerStats*& poPerServerStats = m_tStatistic.m_poPerServerStats[pPingSource->nServerId];
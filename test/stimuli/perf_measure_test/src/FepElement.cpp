@@ -38,7 +38,7 @@
 #include "a_util/system.h"
 #include "a_util/logging.h"
 
-#include "perfmeasure/perfmeasure.h"
+#include "perfmeasure/fep_trace.h"
 
 static std::map<FepElementMode, std::string> CreateBaseElementNames()
 {
@@ -63,7 +63,7 @@ static std::map<std::string, std::string> CreateElementHeaders()
 static std::map<std::string, std::string> s_strElementHeaders = CreateElementHeaders();
 
 static const char* s_strMeasureFileBeginning = "results";
-static const char* s_strMeasureFileEnding = "_framework_measure.csv";
+static const char* s_strMeasureFileEnding = "_framework_trace.json";
 static const char* s_strDefaultSignalName = "Ping";
 static const char* s_strDefaultResponseSignalName = "Pong";
 static const char* s_strDefaultSignalType = "Ping";
@@ -576,8 +576,8 @@ fep::Result FepElement::CleanUp(const fep::tState eOldState)
 {
     fep::Result nResult= cModule::CleanUp(eOldState);
     
-    MEASURE_STOP();
-    MEASURE_SAVE((m_pElementConfig->m_strMeasureFile+s_strMeasureFileEnding).c_str());
+    fep::trace::Disable();
+    fep::trace::ExportChromeTrace((m_pElementConfig->m_strMeasureFile+s_strMeasureFileEnding).c_str());
 
     return nResult;
 }
@@ -780,7 +780,7 @@ fep::Result FepElement::ProcessInitializingEntry(const fep::tState eOldState)
         }
 	}
     std::cout << "Done registering signals!\n";
-    MEASURE_START(20*11*1000);
+    fep::trace::Enable();
     GetStateMachine()->InitDoneEvent();
     CHECK_ERROR("Send Init Done Event")
 